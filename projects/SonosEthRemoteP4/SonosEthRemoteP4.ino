@@ -7,6 +7,7 @@
  * Web UI at http://<hostname>.local/   OTA enabled.
  *
  * Native RMII Ethernet (IP101GRI). Direct SOAP/UPnP control — no libs.
+ * Web UI needs ESP32Async/ESPAsyncWebServer ≥ 3.7 (+ AsyncTCP).
  */
 
 #include <ArduinoOTA.h>
@@ -243,7 +244,7 @@ void setup() {
     Serial.println("No Ethernet — running USB-serial-only (ROOM:<slug> still works)");
   }
 
-  // Web UI + OTA — only if ETH is up. Without ETH the WebServer would still
+  // Web UI + OTA — only if ETH is up. Without ETH the web server would still
   // bind but nothing would reach it, and mDNS would no-op.
   if (ethOk) {
     initWebUI(hostname);
@@ -251,7 +252,9 @@ void setup() {
     ArduinoOTA.begin();
     logEvent("web: http://%s.local/", hostname);
 
-    // Discover and restore speaker
+    // Discover and restore speaker. The web-jobs task is already up, so
+    // hold the state lock: early requests wait until this is done.
+    StateLock lock;
     logEvent("discovering speakers...");
     discoverSpeakers();
     restoreSpeaker();
@@ -260,37 +263,45 @@ void setup() {
       logEvent("auto-selected: %s", spk.name.c_str());
     }
     lastDiscover = millis();
+    ssdpListenBegin();  // passive NOTIFY tracking between scans
   }
   ethConnected = ethOk;
 }
 
-void loop() {
-  // Serial command poll runs unconditionally so ROOM:<slug> always works.
+// One pass of everything but the knob, if the state lock is free.
+static void loopLocked() {
+  StateLock lock(0);
+  if (!lock) return;
+
+  // Serial command poll runs with or without Ethernet so ROOM:<slug> always works.
   pollSerialCommands();
   encoderHotswapTick();  // detect plug/unplug, auto-init on appear
   if (ethConnected) {
     ArduinoOTA.handle();
-    web.handleClient();
+    webTick();  // status snapshot + SSE push
   }
-  processEncoder();
-  processButton();
-  modeTick();
 
   unsigned long now = millis();
 
   // ETH-dependent paths only when the link is up.
   if (ethConnected) {
+    ssdpListenTick();
     if (scanRequested) {
       scanRequested = false;
       logEvent("discovery requested");
-      discoverSpeakers();
-      restoreSpeaker();
+      scanStart();
       lastDiscover = now;
     }
+    // Scans run cooperatively — one bounded step per pass.
+    if (scanTick()) restoreSpeaker();
     if (spk.connected() && (now - lastRefresh) >= T_STATE_POLL) {
       lastRefresh = now;
       static int refreshFails = 0;
-      if (!refreshState()) {
+      bool ok = refreshState();
+      // Speaker may have changed IP (DHCP) — re-resolve its UUID before
+      // counting this as a failure.
+      if (!ok && recoverSpeaker()) ok = refreshState();
+      if (!ok) {
         refreshFails++;
         dbg("refresh failure %d/3", refreshFails);
         // Require 3 consecutive failures (~15s) before declaring the speaker
@@ -308,11 +319,23 @@ void loop() {
     if (!spk.connected() && (now - lastDiscover) >= T_REDISCOVER) {
       lastDiscover = now;
       logEvent("auto-rediscovery");
-      discoverSpeakers();
-      restoreSpeaker();
+      scanStart();
     }
     updaterTick(ethConnected, hostname, ssReady, ssReady ? SS_EXPECT_VER : 0);
   }
+}
+
+void loop() {
+  // The knob first, every pass. processEncoder() and processButton() only
+  // talk to the speaker if they get the state lock; otherwise they keep the
+  // input for a later pass.
+  processEncoder();
+  processButton();
+  modeTick();
 
+  // Everything else reads or changes board state. While a web request holds
+  // the lock (webui.h — a SOAP call can take seconds) skip it rather than
+  // wait, so the knob above is still read every few ms.
+  loopLocked();
   delay(2);
 }
@@ -0,0 +1,177 @@
+#pragma once
+// =============================================================================
+// Album-art proxy cache — backs /api/art.
+//
+// The dashboard used to point <img> straight at the speaker's
+// http://<ip>:1400/getaa?… URL, so every open tab fetched every cover from
+// the speaker itself, and a tab that can't reach the speaker (remote, or an
+// https page refusing mixed content) showed nothing. Now the page asks the
+// board, and the board keeps the last few covers in PSRAM:
+//
+//   - keyed by FNV-1a of the art URL — one speaker fetch per track change no
+//     matter how many dashboards are open
+//   - LRU over ART_CACHE_SLOTS entries; an entry is revalidated with the
+//     speaker's own ETag / Last-Modified once it's ART_REVALIDATE_MS old
+//   - clients get a strong ETag (URL hash + body hash) and a bare 304 when
+//     theirs still matches, without the speaker hearing about it
+//
+// Bodies are shared_ptr-owned: a response still streaming an entry keeps it
+// alive even if a new track evicts it meanwhile. Fetches run on their own
+// web-art task (webui.h), the only user of the cache, without the state
+// lock, so neither the knob nor the other /api/* jobs wait on a slow cover. If PSRAM is missing or the fetch
+// fails, /api/art redirects to the speaker URL — the old behaviour.
+// =============================================================================
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <esp_heap_caps.h>
+#include <memory>
+#include "config.h"
+#include "speaker.h"
+
+void logEvent(const char* fmt, ...);  // defined in webui.h
+
+static constexpr int           ART_CACHE_SLOTS    = 8;
+static constexpr size_t        ART_MAX_BYTES      = 256 * 1024;  // Sonos covers run 20–150 KB
+static constexpr unsigned long ART_REVALIDATE_MS  = 600000;      // 10 min
+static constexpr unsigned long ART_FETCH_TIMEOUT  = 4000;
+static constexpr uint32_t      ART_CAPS           = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+
+struct ArtBlob {
+  uint8_t* data = nullptr;
+  size_t   len  = 0;
+  ~ArtBlob() { free(data); }   // heap_caps memory goes back through free()
+};
+
+struct ArtEntry {
+  uint32_t urlHash = 0;              // 0 = empty slot
+  std::shared_ptr<ArtBlob> blob;
+  char     type[32];                 // Content-Type as the speaker sent it
+  char     etag[20];                 // ours, quoted
+  String   upstreamEtag, lastModified;
+  unsigned long fetchedMs = 0, usedMs = 0;
+};
+
+static ArtEntry artCache[ART_CACHE_SLOTS];
+static uint32_t artFetches = 0;      // speaker round-trips since boot
+
+// Never 0, so 0 can mean "no art" / "empty slot".
+static uint32_t artUrlHash(const String& url) {
+  uint32_t h = fnv1a(url.c_str());
+  return h ? h : 1;
+}
+
+static ArtEntry* artLookup(uint32_t urlHash) {
+  for (auto& e : artCache)
+    if (e.urlHash == urlHash) return &e;
+  return nullptr;
+}
+
+// An empty slot, else the least recently served one.
+static ArtEntry* artVictim() {
+  ArtEntry* lru = &artCache[0];
+  for (auto& e : artCache) {
+    if (e.urlHash == 0) return &e;
+    if ((long)(e.usedMs - lru->usedMs) < 0) lru = &e;
+  }
+  return lru;
+}
+
+// Read the body into PSRAM. Content-Length when the speaker sends one,
+// otherwise until it closes (HTTP/1.0, so no chunk framing), up to the cap.
+static std::shared_ptr<ArtBlob> artReadBody(HTTPClient& http) {
+  int size = http.getSize();
+  if (size > (int)ART_MAX_BYTES) {
+    logEvent("art: %d B cover over the %u B cap", size, (unsigned)ART_MAX_BYTES);
+    return nullptr;
+  }
+  size_t cap = size > 0 ? (size_t)size : ART_MAX_BYTES;
+  auto blob = std::make_shared<ArtBlob>();
+  blob->data = (uint8_t*)heap_caps_malloc(cap, ART_CAPS);
+  if (!blob->data) {
+    logEvent("art: no PSRAM for %u B", (unsigned)cap);
+    return nullptr;
+  }
+
+  NetworkClient* s = http.getStreamPtr();
+  unsigned long t0 = millis();
+  while (blob->len < cap && millis() - t0 < ART_FETCH_TIMEOUT) {
+    int avail = s->available();
+    if (avail > 0) {
+      size_t want = min((size_t)avail, cap - blob->len);
+      int n = s->read(blob->data + blob->len, want);
+      if (n > 0) blob->len += n;
+      continue;
+    }
+    if (!s->connected()) break;
+    delay(1);
+  }
+  bool complete = size > 0 ? blob->len == (size_t)size
+                           : blob->len > 0 && blob->len < cap && !s->connected();
+  if (!complete) {
+    logEvent("art: short read (%u of %d B)", (unsigned)blob->len, size);
+    return nullptr;
+  }
+  if (blob->len < cap) {
+    void* shrunk = heap_caps_realloc(blob->data, blob->len, ART_CAPS);
+    if (shrunk) blob->data = (uint8_t*)shrunk;
+  }
+  return blob;
+}
+
+// Fetch `url` into the cache, or revalidate `have` (same URL) if given.
+// Returns the entry to serve, or nullptr if the speaker couldn't deliver.
+static ArtEntry* artFetch(const String& url, uint32_t urlHash, ArtEntry* have) {
+  HTTPClient http;
+  http.useHTTP10(true);
+  http.setConnectTimeout(2000);
+  http.setTimeout(ART_FETCH_TIMEOUT);
+  if (!http.begin(url)) return nullptr;
+  const char* keep[] = {"Content-Type", "ETag", "Last-Modified"};
+  http.collectHeaders(keep, 3);
+  if (have && have->upstreamEtag.length())  http.addHeader("If-None-Match", have->upstreamEtag);
+  if (have && have->lastModified.length())  http.addHeader("If-Modified-Since", have->lastModified);
+
+  int code = http.GET();
+  artFetches++;
+  if (code == 304 && have) {
+    have->fetchedMs = millis();
+    http.end();
+    return have;
+  }
+  if (code != 200) {
+    logEvent("art: speaker HTTP %d", code);
+    http.end();
+    return nullptr;
+  }
+  auto blob = artReadBody(http);
+  if (!blob) { http.end(); return nullptr; }
+
+  ArtEntry* e = have ? have : artVictim();
+  e->urlHash = urlHash;
+  e->blob = blob;
+  String type = http.header("Content-Type");
+  strlcpy(e->type, type.length() ? type.c_str() : "image/jpeg", sizeof(e->type));
+  uint32_t body = 2166136261u;
+  for (size_t i = 0; i < blob->len; i++) { body ^= blob->data[i]; body *= 16777619u; }
+  snprintf(e->etag, sizeof(e->etag), "\"%08lx%08lx\"", (unsigned long)urlHash, (unsigned long)body);
+  e->upstreamEtag = http.header("ETag");
+  e->lastModified = http.header("Last-Modified");
+  e->fetchedMs = millis();
+  http.end();
+  dbg("art: cached %u B %s (fetch #%lu)", (unsigned)blob->len, e->type, (unsigned long)artFetches);
+  return e;
+}
+
+// The entry for `url`, fetched or revalidated as needed.
+static ArtEntry* artGet(const String& url) {
+  uint32_t h = artUrlHash(url);
+  ArtEntry* e = artLookup(h);
+  if (!e || millis() - e->fetchedMs >= ART_REVALIDATE_MS) {
+    ArtEntry* fresh = artFetch(url, h, e);
+    if (fresh) e = fresh;
+    else if (e) e->fetchedMs = millis();  // keep serving the old copy; retry in 10 min
+    else return nullptr;
+  }
+  e->usedMs = millis();
+  return e;
+}
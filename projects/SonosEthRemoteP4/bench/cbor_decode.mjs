@@ -0,0 +1,111 @@
+#!/usr/bin/env node
+// =============================================================================
+// Hub CBOR decoder — round trip against the firmware, and hostile input.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/report_bench.cpp -o /tmp/report_bench
+//   /tmp/report_bench 10 /tmp/reports
+//   node bench/cbor_decode.mjs [/tmp/reports] [--worker path]
+//
+// With a dump dir from report_bench: every <name>-full.cbor must decode, via
+// the worker's decodeReport(), to exactly <name>.json; every steady-state
+// <name>.cbor to the same minus the identity fields it leaves out.
+//
+// Then malformed reports — truncated, lying about lengths, indefinite-length
+// strings, reserved length codes, stray breaks, deep nesting. Anyone with the
+// ingest secret (or one corrupt upload) can send these, so each must be
+// rejected with an exception, quickly. Each runs in its own worker thread
+// and is killed after LIMIT_MS: a decoder that loops on one shows up here
+// as a timeout instead of a Worker pinned at its CPU limit.
+//
+// Exits 1 on any failure. --worker checks an older worker.js.
+// =============================================================================
+import fs from "node:fs";
+import path from "node:path";
+import { Worker } from "node:worker_threads";
+import { fileURLToPath, pathToFileURL } from "node:url";
+
+const LIMIT_MS = 2000;
+const IDENTITY = ["client", "room", "label", "fw", "ip", "ss_pid", "speaker"];
+
+const args = process.argv.slice(2);
+const here = path.dirname(fileURLToPath(import.meta.url));
+const workerPath = path.resolve(args.includes("--worker") ? args[args.indexOf("--worker") + 1]
+  : path.join(here, "../fleet-hub/src/worker.js"));
+const dumpDir = args[0] && !args[0].startsWith("--") ? args[0] : null;
+const { decodeReport } = await import(pathToFileURL(workerPath).href);
+
+let failures = 0;
+const report = (name, ok, detail = "") => {
+  console.log(`${name.padEnd(28)} ${ok ? "ok" : "FAIL"}${detail ? "  " + detail : ""}`);
+  if (!ok) failures++;
+};
+
+// ── Round trip ───────────────────────────────────────────────────────────────
+if (dumpDir) {
+  for (const f of fs.readdirSync(dumpDir).filter(f => f.endsWith(".cbor")).sort()) {
+    const full = f.endsWith("-full.cbor");
+    const json = JSON.parse(fs.readFileSync(path.join(dumpDir, f.replace(/(-full)?\.cbor$/, ".json")), "utf8"));
+    if (!full) for (const k of IDENTITY) delete json[k];
+    let got, err = "";
+    try {
+      got = decodeReport(fs.readFileSync(path.join(dumpDir, f)));
+    } catch (e) {
+      err = e.message;
+    }
+    const diff = got ? [...new Set([...Object.keys(json), ...Object.keys(got)])]
+      .filter(k => JSON.stringify(json[k]) !== JSON.stringify(got[k])) : [];
+    report(f, !err && !diff.length, err || (diff.length ? "differs in " + diff.join(", ") : ""));
+  }
+}
+
+// ── Malformed ────────────────────────────────────────────────────────────────
+const nested = depth => [...Array(depth).fill(0x81), 0x00];
+const cases = {
+  "empty":                    [],
+  "not a map":                [0x01],
+  "unknown version":          [0xa1, 0x00, 0x02],
+  "truncated map":            [0xa2, 0x00, 0x01],
+  "text longer than input":   [0xa2, 0x00, 0x01, 0x03, 0x78, 0xff, 0x41],
+  "bytes, 2^32 length":       [0xa2, 0x00, 0x01, 0x06, 0x5a, 0xff, 0xff, 0xff, 0xff],
+  "bytes, 2^64 length":       [0xa2, 0x00, 0x01, 0x06, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff],
+  "array, 2^32 items":        [0xa2, 0x00, 0x01, 0x10, 0x9a, 0xff, 0xff, 0xff, 0xff],
+  "indefinite bytes":         [0xbf, 0x00, 0x01, 0x10, 0x9f, 0x5f, 0xff, 0xff],
+  "indefinite text in map":   [0xbf, 0x00, 0x01, 0x03, 0x7f, 0x61, 0x61, 0xff, 0xff],
+  "indefinite uint":          [0xbf, 0x00, 0x01, 0x05, 0x1f, 0xff],
+  "indefinite negative":      [0xbf, 0x00, 0x01, 0x05, 0x3f, 0xff],
+  "reserved length code":     [0xa2, 0x00, 0x01, 0x05, 0x1c],
+  "reserved array length":    [0xa2, 0x00, 0x01, 0x10, 0x9c, 0x00],
+  "break as a value":         [0xa2, 0x00, 0x01, 0x05, 0xff],
+  "unterminated indefinite":  [0xbf, 0x00, 0x01, 0x10, 0x9f, 0x00, 0x00],
+  "nested 100000 deep":       [0xa2, 0x00, 0x01, 0x10, ...nested(100000)],
+};
+
+function runCase(bytes) {
+  return new Promise(resolve => {
+    const w = new Worker(`
+      const { parentPort, workerData } = require("node:worker_threads");
+      import(workerData.url).then(({ decodeReport }) => {
+        try {
+          decodeReport(new Uint8Array(workerData.bytes));
+          parentPort.postMessage({ outcome: "accepted" });
+        } catch (e) {
+          parentPort.postMessage({ outcome: "threw", msg: String(e && e.message) });
+        }
+      });`, { eval: true, workerData: { url: pathToFileURL(workerPath).href, bytes } });
+    const timer = setTimeout(() => { w.terminate(); resolve({ outcome: "hung" }); }, LIMIT_MS);
+    w.on("message", m => { clearTimeout(timer); w.terminate(); resolve(m); });
+    w.on("error", e => { clearTimeout(timer); resolve({ outcome: "threw", msg: String(e.message) }); });
+  });
+}
+
+for (const [name, bytes] of Object.entries(cases)) {
+  const t0 = Date.now();
+  const r = await runCase(bytes);
+  const ms = Date.now() - t0;
+  const detail = r.outcome === "hung" ? `still decoding after ${LIMIT_MS} ms`
+    : r.outcome === "accepted" ? "accepted" : `${r.msg} (${ms} ms)`;
+  report(name, r.outcome === "threw", detail);
+}
+
+console.log(failures ? `FAIL (${failures})` : "pass");
+process.exit(failures ? 1 : 0);
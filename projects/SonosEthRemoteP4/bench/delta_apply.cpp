@@ -0,0 +1,87 @@
+// =============================================================================
+// Host run of the firmware's delta applier (ota_delta.h) on ota/delta.py
+// patches — proves the C++ decoder and the Python encoder agree.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/delta_apply.cpp -o /tmp/delta_apply
+//   ./ota/delta.py make old.bin new.bin /tmp/p.sdp
+//   /tmp/delta_apply old.bin /tmp/p.sdp new.bin
+//
+// Exits 1 if the patch fails to apply, leaves bytes unread, or the result
+// differs from new.bin. Also truncates the patch at every 97th byte and
+// checks each truncation is refused rather than producing an image.
+// =============================================================================
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "Arduino.h"
+#include "ota_delta.h"
+
+static std::vector<uint8_t> slurp(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) { perror(path); exit(2); }
+  std::vector<uint8_t> v;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+  fclose(f);
+  return v;
+}
+
+struct MemSrc {
+  const uint8_t* p; size_t len, pos = 0;
+  bool read(uint8_t* dst, size_t n) {
+    if (n > len - pos) return false;
+    memcpy(dst, p + pos, n); pos += n; return true;
+  }
+};
+struct MemBase {
+  const std::vector<uint8_t>& v;
+  bool readBase(uint32_t off, uint8_t* dst, size_t n) {
+    if (off > v.size() || n > v.size() - off) return false;
+    memcpy(dst, v.data() + off, n); return true;
+  }
+};
+struct MemOut {
+  std::vector<uint8_t> v;
+  bool write(const uint8_t* src, size_t n) { v.insert(v.end(), src, src + n); return true; }
+};
+
+static bool run(const std::vector<uint8_t>& base, const uint8_t* patch, size_t len,
+                std::vector<uint8_t>& result, size_t& consumed, const char*& err) {
+  MemSrc in{patch, len};
+  MemBase b{base};
+  MemOut out;
+  SdpHeader h;
+  if (!sdpReadHeader(in, h, err)) return false;
+  if (h.baseSize != base.size()) { err = "base size mismatch"; return false; }
+  if (!sdpApply(in, b, out, h, err)) return false;
+  result.swap(out.v);
+  consumed = in.pos;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 4) { fprintf(stderr, "usage: delta_apply base.bin patch.sdp new.bin\n"); return 2; }
+  auto base = slurp(argv[1]), patch = slurp(argv[2]), want = slurp(argv[3]);
+
+  std::vector<uint8_t> got;
+  size_t consumed = 0;
+  const char* err = nullptr;
+  if (!run(base, patch.data(), patch.size(), got, consumed, err)) {
+    printf("FAIL: %s\n", err); return 1;
+  }
+  if (consumed != patch.size()) { printf("FAIL: %zu trailing patch bytes\n", patch.size() - consumed); return 1; }
+  if (got != want) { printf("FAIL: result differs from %s\n", argv[3]); return 1; }
+  printf("applied %zu B patch → %zu B image, identical\n", patch.size(), got.size());
+
+  size_t refused = 0, tried = 0;
+  for (size_t cut = 0; cut < patch.size(); cut += 97) {
+    std::vector<uint8_t> r;
+    tried++;
+    if (!run(base, patch.data(), cut, r, consumed, err)) refused++;
+  }
+  printf("truncated patches refused: %zu / %zu\n", refused, tried);
+  if (refused != tried) { printf("FAIL\n"); return 1; }
+  printf("pass\n");
+  return 0;
+}
@@ -0,0 +1,158 @@
+// =============================================================================
+// The firmware's discovery scan on the host, over real sockets.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/discovery_host.cpp -o /tmp/discovery_host
+//   /tmp/discovery_host [--http-port P] [--ssdp-port P] [--mdns-port P] [--multicast] [-v]
+//
+// discovery.h, topology.h and lan_http.h, unchanged, with bench/host's
+// stand-ins and posix_net.h under them: scanStart(), then scanTick() with
+// loop()'s delay(2) between passes until the table is committed. Meant to
+// be run by bench/household_sim.py against its fake household (which
+// builds it if not given --scanner); on its own it scans whatever answers
+// on loopback.
+//
+// Prints one JSON object: wall time per scan phase, the committed table,
+// what it cost (TCP bytes read, the longest tick, host heap peak during the
+// scan, speakerTableBytes()) and how the scan left the UUID index. -v lets
+// the firmware's dbg()/logEvent() lines through to stderr.
+// =============================================================================
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <string>
+#include <thread>
+#include "Arduino.h"
+#include "posix_net.h"
+#include "discovery.h"
+
+static const auto epoch = std::chrono::steady_clock::now();
+unsigned long millis() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - epoch).count();
+}
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+static bool verbose = false;
+void logEvent(const char* fmt, ...) {
+  if (!verbose) return;
+  va_list ap;
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+// ── Heap meter ───────────────────────────────────────────────────────────────
+// Live bytes through operator new, and the high-water mark since reset.
+static size_t heapLive = 0, heapPeak = 0;
+
+void* operator new(size_t n) {
+  void* p = malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  heapLive += malloc_usable_size(p);
+  heapPeak = std::max(heapPeak, heapLive);
+  return p;
+}
+// GCC takes free() here for a mismatch with the replaced operator new above,
+// which is exactly the malloc() it's pairing with.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void* p) noexcept {
+  if (!p) return;
+  heapLive -= malloc_usable_size(p);
+  free(p);
+}
+#pragma GCC diagnostic pop
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+// ── Report ───────────────────────────────────────────────────────────────────
+static std::string jsonString(const char* s) {
+  std::string out = "\"";
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\') out += '\\';
+    if ((unsigned char)*s < 0x20) { char u[8]; snprintf(u, sizeof(u), "\\u%04x", *s); out += u; continue; }
+    out += *s;
+  }
+  return out + "\"";
+}
+
+static const char* phaseBucket(ScanPhase p) {
+  switch (p) {
+    case SCAN_MDNS:   return "mdns";
+    case SCAN_SEND:
+    case SCAN_LISTEN: return "ssdp";
+    case SCAN_FETCH:  return "fetch";
+    default:          return "commit";
+  }
+}
+
+int main(int argc, char** argv) {
+  PosixNet net;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() { return i + 1 < argc ? (uint16_t)atoi(argv[++i]) : (uint16_t)0; };
+    if (a == "--http-port")      net.httpPort = next();
+    else if (a == "--ssdp-port") net.ssdpPort = next();
+    else if (a == "--mdns-port") net.mdnsPortNo = next();
+    else if (a == "--multicast") net.multicast = true;
+    else if (a == "-v")          verbose = true;
+    else { fprintf(stderr, "unknown argument %s\n", argv[i]); return 2; }
+  }
+  if (!verbose) Serial.out = nullptr;
+  hostNet = &net;
+
+  std::map<std::string, unsigned long> phases;
+  unsigned long start = millis(), maxTick = 0;
+  size_t ticks = 0, heapBase = heapLive;
+  heapPeak = heapLive;
+
+  scanStart();
+  for (bool done = false; !done; ) {
+    ScanPhase p = scan.phase;
+    unsigned long t0 = millis();
+    done = scanTick();
+    maxTick = std::max(maxTick, millis() - t0);
+    ticks++;
+    if (!done) delay(2);   // loop()'s
+    phases[phaseBucket(p)] += millis() - t0;
+    if (millis() - start > 60000) { fprintf(stderr, "scan still running after 60 s\n"); return 1; }
+  }
+  unsigned long total = millis() - start;
+
+  // UUID index: probe length of every entry, and table UUIDs it lost.
+  size_t used = 0, probeSum = 0, probeMax = 0, lost = 0;
+  for (size_t i = 0; i < UUID_INDEX_SLOTS; i++) {
+    if (!uuidIndex[i].uuid[0]) continue;
+    size_t probes = ((i - fnv1a(uuidIndex[i].uuid)) & (UUID_INDEX_SLOTS - 1)) + 1;
+    used++;
+    probeSum += probes;
+    probeMax = std::max(probeMax, probes);
+  }
+  for (auto& s : speakers) {
+    String ip;
+    if (s.uuid.length() && (!uuidIndexGet(s.uuid, ip) || ip != s.ip)) lost++;
+  }
+
+  printf("{\"phases_ms\": {");
+  for (const char* k : {"mdns", "ssdp", "fetch"})
+    if (phases.count(k)) printf("\"%s\": %lu, ", k, phases[k]);
+  printf("\"total\": %lu}, \"found\": %zu, \"ticks\": %zu, \"max_tick_ms\": %lu, "
+         "\"wire_bytes\": %zu, \"connect_failures\": %u, \"heap_peak_bytes\": %zu, "
+         "\"table_bytes\": %zu, \"index\": {\"used\": %zu, \"probe_avg\": %.2f, \"probe_max\": %zu, "
+         "\"lost\": %zu}, \"table\": [",
+         total, speakers.size(), ticks, maxTick, net.tcpBytes, net.connectFailures,
+         heapPeak - heapBase, speakerTableBytes(speakers), used, used ? (double)probeSum / used : 0.0,
+         probeMax, lost);
+  for (size_t i = 0; i < speakers.size(); i++) {
+    auto& s = speakers[i];
+    printf("%s{\"ip\": %s, \"name\": %s, \"uuid\": %s, \"coordinator\": %s}", i ? ", " : "",
+           jsonString(s.ip.c_str()).c_str(), jsonString(s.name.c_str()).c_str(),
+           jsonString(s.uuid.c_str()).c_str(), jsonString(s.coordinator.c_str()).c_str());
+  }
+  printf("]}\n");
+  return 0;
+}
@@ -0,0 +1,113 @@
+// =============================================================================
+// Gesture delivery — the board side, for bench/event_delivery.mjs.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/event_delivery.cpp -o /tmp/event_delivery
+//   node bench/event_delivery.mjs /tmp/event_delivery
+//   /tmp/event_delivery [board-id] [seed]
+//
+// The firmware's FleetEventRing and CBOR encoder behind a line protocol on
+// stdin/stdout, so the real worker can be driven with lost requests, lost
+// replies, outages and reboots. Commands:
+//
+//   tick <ms>    log 0-4 gestures at board time <ms>; if any are queued,
+//                answer "report <hex>" and wait for "reply <json>" / "lost"
+//   flush <ms>   the same without logging anything new
+//   reboot       new boot id, empty ring (queued events are lost with RAM)
+//   done         print "expect <boot> <seq>..." — every event that should
+//                be on the hub exactly once — and "maybe <boot> <seq>...",
+//                the ones that went out but were overwritten or lost to a
+//                reboot before their ack came back, which the hub may have
+//                stored (at most once); then exit
+//
+// The ack is applied the way fleet.h does it: up to the reply's `ack`, or
+// everything sent if the hub gave none.
+// =============================================================================
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "fleet_report.h"
+
+struct Boot {
+  uint32_t id;
+  std::set<uint32_t> gone;    // overwritten in the ring, never sent
+  std::set<uint32_t> maybe;   // sent but unacked when overwritten, or queued at reboot
+  uint32_t last = 0;
+  uint32_t sent = 0;          // highest seq that went out in a report
+};
+
+static Boot newBoot(std::mt19937& rng) {
+  return Boot{ (uint32_t)rng() | 1, {}, {}, 0, 0 };
+}
+
+int main(int argc, char** argv) {
+  const char* id = argc > 1 ? argv[1] : "sim-board";
+  std::mt19937 rng(argc > 2 ? (unsigned)atoi(argv[2]) : 7);
+  static const char* const gids[] = { "1c", "2c", "rot+4", "hold", "rot-9", "3c+h", "lh", "x9" };
+  std::vector<Boot> boots{ newBoot(rng) };
+  FleetEventRing ring;
+  static uint8_t buf[2048];
+  char line[4096];
+  uint32_t overwritten = 0;   // ring.dropped, across reboots
+
+  while (fgets(line, sizeof(line), stdin)) {
+    Boot& b = boots.back();
+    bool tick = strncmp(line, "tick ", 5) == 0, flush = strncmp(line, "flush ", 6) == 0;
+    if (tick || flush) {
+      unsigned long ms = strtoul(line + (tick ? 5 : 6), nullptr, 10);
+      for (int n = tick ? rng() % 5 : 0; n > 0; n--) {
+        if (ring.count == FleetEventRing::CAP) {
+          uint32_t s = ring.firstSeq();
+          overwritten++;
+          (s <= b.sent ? b.maybe : b.gone).insert(s);
+        }
+        ring.log(gids[rng() % 8], rng() % 5 != 0, ms - n * 700);
+      }
+      b.last = ring.seq;
+      if (!ring.count) { puts("idle"); fflush(stdout); continue; }
+
+      FleetReportData d;
+      d.id = id;
+      d.fw = "1.0.4";
+      d.nowMs = ms;
+      d.boot = b.id;
+      d.events = &ring;
+      CborWriter c(buf, sizeof(buf));
+      size_t len = fleetEncodeCbor(c, d, true);
+      uint32_t sentThrough = b.sent = ring.seq;
+      printf("report ");
+      for (size_t i = 0; i < len; i++) printf("%02x", buf[i]);
+      printf("\n");
+      fflush(stdout);
+
+      if (!fgets(line, sizeof(line), stdin)) break;
+      if (strncmp(line, "reply ", 6) == 0) {
+        const char* a = strstr(line, "\"ack\":");
+        uint32_t ack = a ? strtoul(a + 6, nullptr, 10) : sentThrough;
+        ring.ack(ack < sentThrough ? ack : sentThrough);
+      }
+    } else if (strncmp(line, "reboot", 6) == 0) {
+      for (uint8_t i = 0; i < ring.count; i++) b.maybe.insert(ring.firstSeq() + i);
+      ring = FleetEventRing();
+      boots.push_back(newBoot(rng));
+      puts("ok");
+      fflush(stdout);
+    } else if (strncmp(line, "done", 4) == 0) {
+      for (const Boot& x : boots) {
+        printf("expect %u", x.id);
+        for (uint32_t s = 1; s <= x.last; s++) if (!x.gone.count(s) && !x.maybe.count(s)) printf(" %u", s);
+        printf("\nmaybe %u", x.id);
+        for (uint32_t s : x.maybe) printf(" %u", s);
+        printf("\n");
+      }
+      printf("dropped %u\n", overwritten);
+      fflush(stdout);
+      return 0;
+    }
+  }
+  return 1;
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env node
+// =============================================================================
+// Gesture delivery — exactly-once check, board ring + real worker.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/event_delivery.cpp -o /tmp/event_delivery
+//   node bench/event_delivery.mjs /tmp/event_delivery [--boards N] [--ticks N]
+//        [--lose-req P] [--lose-reply P] [--outages N] [--reboots N] [--seed S]
+//        [--worker path]
+//
+// Drives --boards board processes (bench/event_delivery.cpp: the firmware's
+// ring and CBOR encoder) against fleet-hub/src/worker.js on an in-memory KV,
+// one report per board per 30 s tick. Every board's report for a tick is in
+// flight at once, and the KV stand-in yields to the event loop on each
+// operation, so their reads and writes interleave as they would on the
+// real hub — that's what catches two boards overwriting each other's
+// events or delivery marks. Each report can be lost on the way in (the hub
+// never sees it) or on the way back (the hub stored it, the board never
+// hears) — the second is what used to duplicate events. Outages lose
+// everything, for every board, for a stretch of ticks, long enough to
+// overflow the ring; reboots drop whatever a board has queued. A fault-free
+// flush at the end drains the rings.
+//
+// Then every event in the hub's hourly buckets is checked against each
+// board's own record: each delivered event exactly once; each one that went
+// out but was overwritten or lost to a reboot before its ack, at most once;
+// nothing else. Exits 1 on any mismatch. --worker runs an older worker.js
+// (git show <rev>:...) for comparison — one that doesn't dedup stores a
+// resend for every lost reply, and one that shares documents between
+// boards loses events with --boards 2 or more.
+// =============================================================================
+import path from "node:path";
+import readline from "node:readline";
+import { spawn } from "node:child_process";
+import { fileURLToPath, pathToFileURL } from "node:url";
+
+const args = process.argv.slice(2);
+const opt = (name, dflt) => {
+  const i = args.indexOf(name);
+  return i >= 0 ? Number(args[i + 1]) : dflt;
+};
+const binary = args[0] && !args[0].startsWith("--") ? args[0] : "/tmp/event_delivery";
+const boardCount = opt("--boards", 4);
+const ticks = opt("--ticks", 2000);
+const loseReq = opt("--lose-req", 0.1);
+const loseReply = opt("--lose-reply", 0.1);
+const outages = opt("--outages", 5);
+const reboots = opt("--reboots", 3);
+const seed = opt("--seed", 1);
+const lcg = s => () => ((s = (s * 1103515245 + 12345) % 2147483648) / 2147483648);
+
+const here = path.dirname(fileURLToPath(import.meta.url));
+const workerPath = path.resolve(args.includes("--worker") ? args[args.indexOf("--worker") + 1]
+  : path.join(here, "../fleet-hub/src/worker.js"));
+const worker = (await import(pathToFileURL(workerPath).href)).default;
+
+// Every operation gives the other reports in flight a turn first.
+const data = new Map();
+const yieldTurn = () => new Promise(r => setImmediate(r));
+const kv = {
+  async get(k) { await yieldTurn(); return data.has(k) ? data.get(k).value : null; },
+  async put(k, v, o = {}) { await yieldTurn(); data.set(k, { value: String(v), metadata: o.metadata }); },
+  async list({ prefix = "" } = {}) {
+    await yieldTurn();
+    const keys = [...data.keys()].filter(k => k.startsWith(prefix)).sort();
+    return { keys: keys.map(name => ({ name, metadata: data.get(name).metadata })), list_complete: true };
+  },
+};
+const env = { INGEST_SECRET: "sim", STATE: kv };
+let clock = Date.now();
+Date.now = () => clock;
+
+// Site-wide outage windows of 20-60 ticks.
+const siteRand = lcg(seed);
+const outage = new Set();
+for (let i = 0; i < outages; i++) {
+  const start = Math.floor(siteRand() * ticks), len = 20 + Math.floor(siteRand() * 40);
+  for (let t = start; t < start + len; t++) outage.add(t);
+}
+
+// ── Boards ───────────────────────────────────────────────────────────────────
+// One process each, with its own fault stream and reboot points, so the
+// schedule doesn't depend on how the reports interleave.
+const n = { reports: 0, lostReq: 0, lostReply: 0, rebootCount: 0 };
+const boards = Array.from({ length: boardCount }, (_, i) => {
+  const id = `sim-board-${i}`;
+  const proc = spawn(binary, [id, String(7 + i)], { stdio: ["pipe", "pipe", "inherit"] });
+  const lines = readline.createInterface({ input: proc.stdout })[Symbol.asyncIterator]();
+  const rand = lcg(seed * 7919 + i + 1);
+  const rebootAt = new Set(Array.from({ length: reboots }, () => Math.floor(rand() * ticks)));
+  const tell = cmd => proc.stdin.write(cmd + "\n");
+  const ask = async cmd => { tell(cmd); return (await lines.next()).value; };
+  return { id, lines, rand, rebootAt, tell, ask, ms: 60000 };
+});
+
+async function step(b, cmd, tickNo, faults) {
+  const r = await b.ask(`${cmd} ${b.ms}`);
+  if (!r.startsWith("report ")) return;
+  n.reports++;
+  const body = Buffer.from(r.slice(7), "hex");
+  if (faults && (outage.has(tickNo) || b.rand() < loseReq)) { n.lostReq++; b.tell("lost"); return; }
+  const res = await worker.fetch(new Request("https://hub/report", {
+    method: "POST", headers: { "X-Fleet-Auth": "sim", "content-type": "application/cbor" }, body,
+  }), env);
+  const text = await res.text();
+  if (res.status !== 200) throw new Error(`${b.id}: HTTP ${res.status}: ${text}`);
+  if (faults && b.rand() < loseReply) { n.lostReply++; b.tell("lost"); return; }
+  b.tell("reply " + text);
+}
+
+for (let tickNo = 0; tickNo < ticks; tickNo++) {
+  await Promise.all(boards.map(async b => {
+    if (b.rebootAt.has(tickNo)) { await b.ask("reboot"); n.rebootCount++; b.ms = 5000; }
+    await step(b, "tick", tickNo, true);
+    b.ms += 30000;
+  }));
+  clock += 30000;
+}
+for (let i = 0; i < 5; i++) {
+  await Promise.all(boards.map(async b => { await step(b, "flush", ticks, false); b.ms += 30000; }));
+  clock += 30000;
+}
+
+// ── Check ────────────────────────────────────────────────────────────────────
+// Per board: seq -> how many of its boots should have it on the hub exactly
+// once (expect) or at most once (maybe), against what the buckets hold.
+const stored = new Map(boards.map(b => [b.id, new Map()]));
+let total = 0;
+for (const [k, { value }] of data) {
+  if (!k.startsWith("bucket:")) continue;
+  const doc = JSON.parse(value);   // bucket:<hour>:<id>:<batch> is a list; the older fleet-wide bucket:<hour> wasn't
+  for (const e of Array.isArray(doc) ? doc : doc.events) {
+    const m = stored.get(e.id);
+    if (m) m.set(e.seq, (m.get(e.seq) || 0) + 1);
+    total++;
+  }
+}
+
+const bad = [];
+let want = 0, maybeTotal = 0, dropped = 0;
+for (const b of boards) {
+  b.tell("done");
+  const expect = new Map(), maybe = new Map();
+  for (;;) {
+    const { value, done } = await b.lines.next();
+    if (done) break;
+    const [kind, , ...seqs] = value.split(" ");
+    if (kind === "dropped") { dropped += Number(value.split(" ")[1]); continue; }
+    const into = kind === "expect" ? expect : maybe;
+    for (const s of seqs) into.set(Number(s), (into.get(Number(s)) || 0) + 1);
+  }
+  want += [...expect.values()].reduce((a, c) => a + c, 0);
+  maybeTotal += [...maybe.values()].reduce((a, c) => a + c, 0);
+  const got = stored.get(b.id);
+  for (const s of new Set([...expect.keys(), ...maybe.keys(), ...got.keys()])) {
+    const g = got.get(s) || 0, w = expect.get(s) || 0, extra = maybe.get(s) || 0;
+    if (g < w || g > w + extra) bad.push(`${b.id} seq ${s}: stored ${g}, expected ${w}${extra ? ` (+${extra} maybe)` : ""}`);
+  }
+}
+
+console.log(`${boardCount} boards x ${ticks} ticks, ${n.reports} reports: ${n.lostReq} lost on the way in, ` +
+  `${n.lostReply} replies lost, ${outage.size} outage ticks, ${n.rebootCount} reboots`);
+console.log(`events stored ${total}, expected exactly once ${want}, overwritten in the ring ${dropped}, ` +
+  `sent but unacked when lost ${maybeTotal}`);
+if (bad.length) {
+  console.log(`FAIL: ${bad.length} mismatches, e.g.\n  ` + bad.slice(0, 5).join("\n  "));
+  process.exit(1);
+}
+console.log("exactly once: ok");
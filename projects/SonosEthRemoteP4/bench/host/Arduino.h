@@ -0,0 +1,145 @@
+#pragma once
+// Minimal host stand-ins for the Arduino types the benches touch (Print,
+// Stream, String, IPAddress, Serial), so the sketch headers build with a
+// plain g++. Not a port of the core — just enough surface, with String
+// backed by std::string so heap traffic is real and countable.
+//
+// millis() and delay() are only declared: a bench that pulls in a header
+// using them defines them, on a real or a virtual clock. The network
+// stand-ins next to this file (NetworkUdp.h, NetworkClient.h, mdns.h) go
+// through host_net.h the same way.
+#include <atomic>
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t n) {
+    for (size_t i = 0; i < n; i++) write(buf[i]);
+    return n;
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+class String {
+public:
+  String(const char* s = "") : s_(s) {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v) : s_(std::to_string(v)) {}
+  explicit String(unsigned v) : s_(std::to_string(v)) {}
+  explicit String(long v) : s_(std::to_string(v)) {}
+  explicit String(unsigned long v) : s_(std::to_string(v)) {}
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned)s_.size(); }
+  void reserve(unsigned n) { s_.reserve(n); }
+  char operator[](unsigned i) const { return s_[i]; }
+  String& operator=(const char* s) { s_ = s; return *this; }
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* s) { s_ += s; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(long v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { s_ += std::to_string(v); return *this; }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return s_ != o; }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(s_.c_str(), o.s_.c_str()) == 0; }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  int indexOf(const String& t, unsigned from = 0) const {
+    size_t i = s_.find(t.s_, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  String substring(unsigned from, unsigned to = ~0u) const {
+    if (from > s_.size()) return String();
+    if (to > s_.size()) to = (unsigned)s_.size();
+    return to > from ? String(s_.substr(from, to - from)) : String();
+  }
+  long toInt() const { return atol(s_.c_str()); }
+  void toUpperCase() { for (auto& c : s_) c = (char)toupper((unsigned char)c); }
+  void toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+  void replace(const String& from, const String& to) {
+    if (from.s_.empty()) return;
+    for (size_t i = 0; (i = s_.find(from.s_, i)) != std::string::npos; i += to.s_.size())
+      s_.replace(i, from.s_.size(), to.s_);
+  }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+  friend String operator+(const String& a, int b) { return String(a.s_ + std::to_string(b)); }
+  friend String operator+(const String& a, unsigned b) { return String(a.s_ + std::to_string(b)); }
+  friend String operator+(const String& a, unsigned long b) { return String(a.s_ + std::to_string(b)); }
+private:
+  std::string s_;
+};
+
+class IPAddress {
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : v_(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t v) : v_(v) {}
+  operator uint32_t() const { return v_; }
+  bool fromString(const char* s) {
+    unsigned a, b, c, d;
+    char tail;
+    if (sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || (a | b | c | d) > 255) return false;
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+  bool fromString(const String& s) { return fromString(s.c_str()); }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", v_ & 255, v_ >> 8 & 255, v_ >> 16 & 255, v_ >> 24);
+    return String(buf);
+  }
+private:
+  uint32_t v_ = 0;   // network order in memory, as on the ESP32
+};
+
+// To stderr, so a bench's own stdout stays parseable; out = nullptr mutes it.
+struct HostSerial {
+  FILE* out = stderr;
+  void println(const char* s) { if (out) fprintf(out, "%s\n", s); }
+  void printf(const char* fmt, ...) {
+    if (!out) return;
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(out, fmt, ap);
+    va_end(ap);
+  }
+};
+inline HostSerial Serial;
+
+struct EspClass {
+  uint32_t getFreeHeap() { return 0; }
+};
+inline EspClass ESP;
+
+#define LOW  0
+#define HIGH 1
+
+template <class T> T constrain(T v, T lo, T hi) { return v < lo ? lo : v > hi ? hi : v; }
+template <class T> T min(T a, T b) { return b < a ? b : a; }
+
+#include "freertos.h"
@@ -0,0 +1,4 @@
+#pragma once
+// discovery.h includes this for the MDNS responder; the query API it uses
+// is in mdns.h.
+#include "mdns.h"
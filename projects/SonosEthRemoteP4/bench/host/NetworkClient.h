@@ -0,0 +1,32 @@
+#pragma once
+// NetworkClient over host_net.h — wraps a connected socket (as lan_http.h
+// hands it one), writes, and reads of what's there.
+#include "Arduino.h"
+#include "host_net.h"
+
+class NetworkClient {
+public:
+  NetworkClient() {}
+  explicit NetworkClient(int fd) : h_(fd) {}
+  NetworkClient(const NetworkClient&) = delete;
+  NetworkClient& operator=(NetworkClient&& o) {
+    if (this != &o) {
+      stop();
+      h_ = o.h_;
+      o.h_ = -1;
+    }
+    return *this;
+  }
+  ~NetworkClient() { stop(); }
+  size_t write(const uint8_t* buf, size_t n) { return h_ >= 0 && hostNet->tcpSend(h_, buf, n) ? n : 0; }
+  int available() { return h_ >= 0 ? hostNet->tcpAvailable(h_) : 0; }
+  int read(uint8_t* buf, size_t n) { return h_ >= 0 ? hostNet->tcpRead(h_, buf, n) : -1; }
+  uint8_t connected() { return h_ >= 0 && hostNet->tcpOpen(h_); }
+  void stop() {
+    if (h_ >= 0) hostNet->tcpClose(h_);
+    h_ = -1;
+  }
+
+private:
+  int h_ = -1;
+};
@@ -0,0 +1,56 @@
+#pragma once
+// NetworkUDP over host_net.h — the calls discovery.h makes, nothing more.
+#include "Arduino.h"
+#include "host_net.h"
+
+class NetworkUDP {
+public:
+  ~NetworkUDP() { stop(); }
+  uint8_t begin(uint16_t port) { return open(port, 0); }
+  uint8_t beginMulticast(IPAddress group, uint16_t port) { return open(port, group); }
+  void stop() {
+    if (h_ >= 0) hostNet->udpClose(h_);
+    h_ = -1;
+  }
+  int beginPacket(IPAddress ip, uint16_t port) {
+    to_ = ip;
+    toPort_ = port;
+    out_.clear();
+    return 1;
+  }
+  size_t write(const uint8_t* buf, size_t n) { out_.append((const char*)buf, n); return n; }
+  int endPacket() {
+    return h_ >= 0 && hostNet->udpSend(h_, to_, toPort_, (const uint8_t*)out_.data(), out_.size());
+  }
+  int parsePacket() {
+    if (h_ < 0) return 0;
+    uint32_t from = 0;
+    int n = hostNet->udpRecv(h_, in_, sizeof(in_), from);
+    if (n < 0) return 0;
+    inLen_ = n;
+    inPos_ = 0;
+    from_ = from;
+    return n;
+  }
+  int read(uint8_t* buf, size_t n) {
+    size_t k = inLen_ - inPos_ < n ? inLen_ - inPos_ : n;
+    memcpy(buf, in_ + inPos_, k);
+    inPos_ += k;
+    return (int)k;
+  }
+  IPAddress remoteIP() const { return IPAddress(from_); }
+
+private:
+  int h_ = -1;
+  uint32_t to_ = 0, from_ = 0;
+  uint16_t toPort_ = 0;
+  std::string out_;
+  uint8_t in_[2048];
+  size_t inLen_ = 0, inPos_ = 0;
+
+  uint8_t open(uint16_t port, uint32_t group) {
+    stop();
+    h_ = hostNet->udpOpen(port, group);
+    return h_ >= 0;
+  }
+};
@@ -0,0 +1,39 @@
+#pragma once
+// Preferences in memory — one process, one "NVS".
+#include <map>
+#include "Arduino.h"
+
+class Preferences {
+public:
+  bool begin(const char* ns, bool = false) { ns_ = ns; return true; }
+  void end() {}
+  String getString(const char* key, const String& dflt = String()) {
+    auto it = store().find(ns_ + "/" + key);
+    return it == store().end() ? dflt : String(it->second);
+  }
+  size_t putString(const char* key, const String& v) {
+    store()[ns_ + "/" + key] = v.c_str();
+    return v.length();
+  }
+  uint32_t getUInt(const char* key, uint32_t dflt = 0) {
+    auto it = store().find(ns_ + "/" + key);
+    return it == store().end() ? dflt : (uint32_t)strtoul(it->second.c_str(), nullptr, 10);
+  }
+  size_t putUInt(const char* key, uint32_t v) {
+    store()[ns_ + "/" + key] = std::to_string(v);
+    return sizeof(v);
+  }
+  bool clear() {
+    std::string prefix = ns_ + "/";
+    for (auto it = store().lower_bound(prefix); it != store().end() && it->first.compare(0, prefix.size(), prefix) == 0; )
+      it = store().erase(it);
+    return true;
+  }
+
+private:
+  std::string ns_;
+  static std::map<std::string, std::string>& store() {
+    static std::map<std::string, std::string> m;
+    return m;
+  }
+};
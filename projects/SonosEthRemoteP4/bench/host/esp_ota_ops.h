@@ -0,0 +1,7 @@
+#pragma once
+// esp_ota_ops, declared only — see esp_partition.h.
+#include "esp_partition.h"
+
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t* start);
+const esp_partition_t* esp_ota_get_running_partition();
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* part);
@@ -0,0 +1,31 @@
+#pragma once
+// esp_partition over a bench-provided flash. Only declared: the bench
+// defines the three calls (and keeps the partition table), the same way it
+// defines millis().
+#include <cstddef>
+#include <cstdint>
+
+typedef int esp_err_t;
+#define ESP_OK   0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG  0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+inline const char* esp_err_to_name(esp_err_t e) {
+  switch (e) {
+    case ESP_OK:               return "ESP_OK";
+    case ESP_FAIL:             return "ESP_FAIL";
+    case ESP_ERR_INVALID_ARG:  return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    default:                   return "ESP_ERR_?";
+  }
+}
+
+struct esp_partition_t {
+  uint32_t address;
+  uint32_t size;
+};
+
+esp_err_t esp_partition_read(const esp_partition_t* part, size_t off, void* dst, size_t n);
+esp_err_t esp_partition_erase_range(const esp_partition_t* part, size_t off, size_t n);
+esp_err_t esp_partition_write(const esp_partition_t* part, size_t off, const void* src, size_t n);
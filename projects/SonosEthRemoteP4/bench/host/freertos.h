@@ -0,0 +1,87 @@
+#pragma once
+// FreeRTOS for the benches. The recursive mutex speaker.h takes is a no-op
+// (benches that use it are single-threaded); queues and tasks are real,
+// backed by std::thread, so a bench can run a producer/consumer pipeline
+// like ota_writer.h's for real — and under -fsanitize=thread.
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+#define portMAX_DELAY 0xffffffffu
+#define tskIDLE_PRIORITY 0
+
+typedef void* SemaphoreHandle_t;
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return (SemaphoreHandle_t)1; }
+inline int xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline int xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
+
+// Fixed-length queue of fixed-size items, copied in and out. Waits are in
+// milliseconds (one tick = 1 ms here).
+struct HostQueue {
+  std::mutex m;
+  std::condition_variable notEmpty, notFull;
+  std::deque<std::vector<uint8_t>> items;
+  size_t cap, itemSize;
+};
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t itemSize) {
+  auto* q = new HostQueue;
+  q->cap = len;
+  q->itemSize = itemSize;
+  return q;
+}
+inline void vQueueDelete(QueueHandle_t q) { delete q; }
+
+template <class Cv, class Pred>
+inline bool hostQueueWait(Cv& cv, std::unique_lock<std::mutex>& lock, TickType_t wait, Pred ready) {
+  if (wait == portMAX_DELAY) { cv.wait(lock, ready); return true; }
+  return cv.wait_for(lock, std::chrono::milliseconds(wait), ready);
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t wait) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!hostQueueWait(q->notFull, lock, wait, [&] { return q->items.size() < q->cap; })) return pdFALSE;
+  const uint8_t* p = (const uint8_t*)item;
+  q->items.emplace_back(p, p + q->itemSize);
+  q->notEmpty.notify_one();   // under the lock: the receiver may delete the queue next
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t wait) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!hostQueueWait(q->notEmpty, lock, wait, [&] { return !q->items.empty(); })) return pdFALSE;
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  q->notFull.notify_one();
+  return pdTRUE;
+}
+
+// A task is a detached thread; it ends when its function returns, so
+// vTaskDelete(nullptr) at the end of one is a no-op. Deleting another task
+// isn't supported. hostTasksRunning counts the ones still going.
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+inline std::atomic<int> hostTasksRunning{0};
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char*, uint32_t, void* arg, UBaseType_t,
+                              TaskHandle_t* handle) {
+  hostTasksRunning++;
+  std::thread([fn, arg] { fn(arg); hostTasksRunning--; }).detach();
+  if (handle) *handle = (TaskHandle_t)fn;
+  return pdPASS;
+}
+inline void vTaskDelete(TaskHandle_t) {}
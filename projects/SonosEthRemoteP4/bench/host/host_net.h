@@ -0,0 +1,34 @@
+#pragma once
+// The network under the host stand-ins. NetworkUdp.h, NetworkClient.h and
+// mdns.h call through `hostNet`, which a bench points at either real
+// sockets (posix_net.h — household_sim.py's fake household on loopback) or
+// a scripted fake (bench/scan_tick.cpp, on a virtual clock). Addresses are
+// IPAddress values, ports host order. Nothing here waits: a TCP connect is
+// started by tcpConnect() and then polled with tcpConnected(), the way
+// lan_http.h drives an lwIP socket with select().
+#include <cstddef>
+#include <cstdint>
+
+struct HostNet {
+  virtual ~HostNet() {}
+  // UDP: a bound socket (port 0 = any), optionally joined to `group`.
+  virtual int  udpOpen(uint16_t port, uint32_t group) = 0;
+  virtual bool udpSend(int h, uint32_t ip, uint16_t port, const uint8_t* buf, size_t n) = 0;
+  virtual int  udpRecv(int h, uint8_t* buf, size_t cap, uint32_t& fromIp) = 0;  // -1: nothing queued
+  virtual void udpClose(int h) = 0;
+  // TCP: a socket, then a connect that's polled until it's 1 (up) or -1
+  // (refused / unreachable); 0 is still connecting.
+  virtual int  tcpSocket() = 0;
+  virtual int  tcpConnect(int h, uint32_t ip, uint16_t port) = 0;
+  virtual int  tcpConnected(int h) = 0;
+  virtual bool tcpSend(int h, const uint8_t* buf, size_t n) = 0;
+  virtual int  tcpAvailable(int h) = 0;                                       // bytes readable now
+  virtual int  tcpRead(int h, uint8_t* buf, size_t n) = 0;
+  virtual bool tcpOpen(int h) = 0;          // false once the peer closed and everything was read
+  virtual void tcpClose(int h) = 0;
+  // Where mdns.h sends its one-shot _sonos._tcp query.
+  virtual uint32_t mdnsServer() { return 0; }
+  virtual uint16_t mdnsPort() { return 5353; }
+};
+
+inline HostNet* hostNet = nullptr;
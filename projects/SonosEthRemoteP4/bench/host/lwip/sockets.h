@@ -0,0 +1,49 @@
+#pragma once
+// The lwIP socket calls lan_http.h makes, over host_net.h: a TCP socket,
+// a non-blocking connect, select() for writability with a zero timeout,
+// SO_ERROR, close. Types and constants are the host's own.
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include "host_net.h"
+
+inline int lwip_socket(int domain, int type, int) {
+  return domain == AF_INET && type == SOCK_STREAM ? hostNet->tcpSocket() : -1;
+}
+
+// host_net.h sockets never block; O_NONBLOCK is what lan_http.h asks for anyway.
+inline int lwip_fcntl(int, int, int) { return 0; }
+
+inline int lwip_connect(int s, const sockaddr* name, socklen_t) {
+  const sockaddr_in* a = (const sockaddr_in*)name;
+  int r = hostNet->tcpConnect(s, a->sin_addr.s_addr, ntohs(a->sin_port));
+  if (r > 0) return 0;
+  errno = r == 0 ? EINPROGRESS : ECONNREFUSED;
+  return -1;
+}
+
+// Writability only — all lan_http.h asks of it. Never waits.
+inline int lwip_select(int maxfdp1, fd_set* readset, fd_set* writeset, fd_set* exceptset, timeval*) {
+  if (readset) FD_ZERO(readset);
+  if (exceptset) FD_ZERO(exceptset);
+  int ready = 0;
+  for (int s = 0; writeset && s < maxfdp1; s++) {
+    if (!FD_ISSET(s, writeset)) continue;
+    if (hostNet->tcpConnected(s) != 0) ready++;
+    else FD_CLR(s, writeset);
+  }
+  return ready;
+}
+
+inline int lwip_getsockopt(int s, int level, int optname, void* optval, socklen_t* optlen) {
+  if (level != SOL_SOCKET || optname != SO_ERROR || *optlen < sizeof(int)) return -1;
+  *(int*)optval = hostNet->tcpConnected(s) < 0 ? ECONNREFUSED : 0;
+  return 0;
+}
+
+inline int lwip_close(int s) {
+  hostNet->tcpClose(s);
+  return 0;
+}
@@ -0,0 +1,134 @@
+#pragma once
+// ESP-IDF's async mDNS query, over host_net.h: one PTR query for the
+// service, sent unicast to hostNet->mdnsServer(), and every A record in
+// the replies until the timeout or max_results. Names may use compression;
+// nothing else in the reply is looked at. No server → no query (nullptr),
+// which discovery.h treats as "go straight to SSDP", as on the board.
+#include <vector>
+#include "Arduino.h"
+#include "host_net.h"
+
+#define MDNS_TYPE_PTR 0x000C
+#define ESP_IPADDR_TYPE_V4 0
+
+struct esp_ip4_addr_t { uint32_t addr; };
+struct esp_ip_addr_t { union { esp_ip4_addr_t ip4; } u_addr; uint8_t type; };
+struct mdns_ip_addr_t { esp_ip_addr_t addr; mdns_ip_addr_t* next; };
+struct mdns_result_t {
+  mdns_result_t*  next;
+  char*           hostname;
+  mdns_ip_addr_t* addr;
+};
+
+struct mdns_search_once_t {
+  int           sock = -1;
+  unsigned long deadline = 0;
+  size_t        max = 0;
+  std::vector<std::pair<std::string, uint32_t>> found;   // hostname, address
+};
+
+// Name at `pos` into `out` (dotted), following pointers. Returns the offset
+// just past the name as it sits at `pos`, or 0 if it runs off the packet.
+inline size_t mdnsName(const uint8_t* p, size_t n, size_t pos, std::string& out) {
+  size_t end = 0;
+  for (int hops = 0; pos < n && hops < 16; ) {
+    uint8_t len = p[pos];
+    if ((len & 0xC0) == 0xC0) {
+      if (pos + 1 >= n) return 0;
+      if (!end) end = pos + 2;
+      pos = (len & 0x3F) << 8 | p[pos + 1];
+      hops++;
+      continue;
+    }
+    if (len == 0) return end ? end : pos + 1;
+    if (pos + 1 + len > n) return 0;
+    if (!out.empty()) out += '.';
+    out.append((const char*)p + pos + 1, len);
+    pos += 1 + len;
+  }
+  return 0;
+}
+
+inline void mdnsParse(mdns_search_once_t* s, const uint8_t* p, size_t n) {
+  if (n < 12) return;
+  unsigned qd = p[4] << 8 | p[5];
+  unsigned rr = (p[6] << 8 | p[7]) + (p[8] << 8 | p[9]) + (p[10] << 8 | p[11]);
+  size_t pos = 12;
+  std::string skip;
+  for (unsigned i = 0; i < qd && pos; i++) {
+    pos = mdnsName(p, n, pos, skip);
+    if (pos) pos += 4;
+  }
+  for (unsigned i = 0; i < rr && pos && pos < n; i++) {
+    std::string name;
+    pos = mdnsName(p, n, pos, name);
+    if (!pos || pos + 10 > n) return;
+    unsigned type = p[pos] << 8 | p[pos + 1], rdlen = p[pos + 8] << 8 | p[pos + 9];
+    pos += 10;
+    if (pos + rdlen > n) return;
+    if (type == 1 && rdlen == 4 && s->found.size() < s->max) {
+      uint32_t a;
+      memcpy(&a, p + pos, 4);
+      if (name.size() > 6 && name.compare(name.size() - 6, 6, ".local") == 0) name.resize(name.size() - 6);
+      s->found.push_back({name, a});
+    }
+    pos += rdlen;
+  }
+}
+
+inline mdns_search_once_t* mdns_query_async_new(const char*, const char* service, const char* proto,
+                                                uint16_t, uint32_t timeout, size_t max_results, void*) {
+  if (!hostNet->mdnsServer()) return nullptr;
+  auto* s = new mdns_search_once_t;
+  s->sock = hostNet->udpOpen(0, 0);
+  if (s->sock < 0) { delete s; return nullptr; }
+  uint8_t q[64] = {0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};   // one question
+  size_t n = 12;
+  for (const char* label : {service, proto, "local"}) {
+    size_t len = strlen(label);
+    q[n++] = (uint8_t)len;
+    memcpy(q + n, label, len);
+    n += len;
+  }
+  const uint8_t tail[] = {0, 0, MDNS_TYPE_PTR, 0, 1};
+  memcpy(q + n, tail, sizeof(tail));
+  n += sizeof(tail);
+  hostNet->udpSend(s->sock, hostNet->mdnsServer(), hostNet->mdnsPort(), q, n);
+  s->deadline = millis() + timeout;
+  s->max = max_results;
+  return s;
+}
+
+inline bool mdns_query_async_get_results(mdns_search_once_t* s, uint32_t, mdns_result_t** results,
+                                         uint8_t* num_results) {
+  uint8_t buf[1500];
+  uint32_t from;
+  for (int len; (len = hostNet->udpRecv(s->sock, buf, sizeof(buf), from)) >= 0; ) mdnsParse(s, buf, len);
+  if (s->found.size() < s->max && (long)(millis() - s->deadline) < 0) return false;
+  mdns_result_t* head = nullptr;
+  for (auto it = s->found.rbegin(); it != s->found.rend(); ++it) {
+    auto* a = new mdns_ip_addr_t{};
+    a->addr.type = ESP_IPADDR_TYPE_V4;
+    a->addr.u_addr.ip4.addr = it->second;
+    head = new mdns_result_t{head, strdup(it->first.c_str()), a};
+  }
+  *results = head;
+  if (num_results) *num_results = (uint8_t)s->found.size();
+  return true;
+}
+
+inline void mdns_query_results_free(mdns_result_t* r) {
+  while (r) {
+    mdns_result_t* next = r->next;
+    delete r->addr;
+    free(r->hostname);
+    delete r;
+    r = next;
+  }
+}
+
+inline bool mdns_query_async_delete(mdns_search_once_t* s) {
+  if (s->sock >= 0) hostNet->udpClose(s->sock);
+  delete s;
+  return true;
+}
@@ -0,0 +1,153 @@
+#pragma once
+// HostNet over real sockets, for driving discovery.h against
+// bench/household_sim.py's fake household on 127.42.x.y.
+//
+// The fakes can't all own 1400/1900 without root, so the well-known ports
+// are mapped to whatever the household was started on. Loopback has no
+// broadcast, so the scan's 255.255.255.255 M-SEARCH is dropped; its
+// multicast one goes unicast to 127.0.0.1 (the household's SSDP socket)
+// unless `multicast` is set, in which case it really is sent to the group
+// on lo. mDNS queries go unicast to 127.0.0.1:mdnsPortNo.
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <set>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "host_net.h"
+
+class PosixNet : public HostNet {
+public:
+  uint16_t httpPort = 1400, ssdpPort = 1900, mdnsPortNo = 5353;
+  bool     multicast = false;
+  // Meters for the driver.
+  size_t   tcpBytes = 0;
+  unsigned connectFailures = 0;
+
+  int udpOpen(uint16_t port, uint32_t group) override {
+    int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if (fd < 0) return -1;
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    if (bind(fd, (sockaddr*)&a, sizeof(a)) < 0) { close(fd); return -1; }
+    in_addr lo{htonl(INADDR_LOOPBACK)};
+    if (group) {
+      ip_mreq m{};
+      m.imr_multiaddr.s_addr = group;
+      m.imr_interface = lo;
+      setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &m, sizeof(m));   // best effort, as on lo
+    }
+    if (multicast) {
+      setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &lo, sizeof(lo));
+      setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &one, sizeof(one));
+    }
+    return fd;
+  }
+
+  bool udpSend(int h, uint32_t ip, uint16_t port, const uint8_t* buf, size_t n) override {
+    if (ip == 0xFFFFFFFFu) return true;                 // no broadcast on lo
+    bool group = (ip & 0xF0) == 0xE0;                   // 224.0.0.0/4, first octet in the low byte
+    if (group && !multicast) ip = htonl(INADDR_LOOPBACK);
+    if (port == 1900) port = ssdpPort;
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    a.sin_addr.s_addr = ip;
+    return sendto(h, buf, n, 0, (sockaddr*)&a, sizeof(a)) == (ssize_t)n;
+  }
+
+  int udpRecv(int h, uint8_t* buf, size_t cap, uint32_t& fromIp) override {
+    sockaddr_in a{};
+    socklen_t len = sizeof(a);
+    ssize_t n = recvfrom(h, buf, cap, MSG_DONTWAIT, (sockaddr*)&a, &len);
+    if (n < 0) return -1;
+    fromIp = a.sin_addr.s_addr;
+    return (int)n;
+  }
+
+  void udpClose(int h) override { close(h); }
+
+  int tcpSocket() override { return socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0); }
+
+  int tcpConnect(int h, uint32_t ip, uint16_t port) override {
+    sockaddr_in a{};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port == 1400 ? httpPort : port);
+    a.sin_addr.s_addr = ip;
+    if (connect(h, (sockaddr*)&a, sizeof(a)) == 0) return 1;
+    if (errno == EINPROGRESS) {
+      connecting.insert(h);
+      return 0;
+    }
+    connectFailures++;
+    return -1;
+  }
+
+  int tcpConnected(int h) override {
+    if (failed.count(h)) return -1;
+    if (!connecting.count(h)) return 1;
+    pollfd p{h, POLLOUT, 0};
+    if (poll(&p, 1, 0) != 1) return 0;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    getsockopt(h, SOL_SOCKET, SO_ERROR, &err, &len);
+    connecting.erase(h);
+    if (!err) return 1;
+    connectFailures++;
+    failed.insert(h);
+    return -1;
+  }
+
+  bool tcpSend(int h, const uint8_t* buf, size_t n) override {
+    // Requests are a few hundred bytes; the socket buffer takes them whole.
+    while (n) {
+      ssize_t k = send(h, buf, n, MSG_NOSIGNAL);
+      if (k < 0 && errno == EAGAIN) {
+        pollfd p{h, POLLOUT, 0};
+        poll(&p, 1, 100);
+        continue;
+      }
+      if (k <= 0) return false;
+      buf += k;
+      n -= k;
+    }
+    return true;
+  }
+
+  int tcpAvailable(int h) override {
+    int n = 0;
+    return ioctl(h, FIONREAD, &n) < 0 ? 0 : n;
+  }
+
+  int tcpRead(int h, uint8_t* buf, size_t n) override {
+    ssize_t k = recv(h, buf, n, MSG_DONTWAIT);
+    if (k < 0) return errno == EAGAIN ? 0 : -1;
+    tcpBytes += k;
+    return (int)k;
+  }
+
+  bool tcpOpen(int h) override {
+    if (tcpAvailable(h) > 0) return true;
+    uint8_t c;
+    ssize_t k = recv(h, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return k > 0 || (k < 0 && errno == EAGAIN);
+  }
+
+  void tcpClose(int h) override {
+    if (connecting.erase(h)) connectFailures++;   // given up on: LAN_CONNECT_MS ran out
+    failed.erase(h);
+    close(h);
+  }
+
+  uint32_t mdnsServer() override { return htonl(INADDR_LOOPBACK); }
+  uint16_t mdnsPort() override { return mdnsPortNo; }
+
+private:
+  std::set<int> connecting, failed;
+};
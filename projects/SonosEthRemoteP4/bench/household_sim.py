@@ -0,0 +1,477 @@
+#!/usr/bin/env python3
+"""
+Discovery scale benchmark — a fake Sonos household on loopback.
+
+Spins up N fake ZonePlayers on 127.42.x.y loopback aliases and runs the
+firmware's own scan against them: bench/discovery_host.cpp, which builds
+discovery.h, topology.h and lan_http.h unchanged over bench/host's
+stand-ins and real sockets (bench/host/posix_net.h). One scanner process
+per run, so every run starts from an empty table and UUID index.
+
+  mDNS   _sonos._tcp PTR query, polled until SCAN_MDNS_TIMEOUT / SCAN_CANDIDATES_MAX
+  SSDP   (mDNS found nothing) ZonePlayer M-SEARCH, stop at the first responder
+  FETCH  ZoneGroupTopology#GetZoneGroupState on that seed — or, with
+         --mode fallback, where every fake answers it with a 500, one
+         device_description.xml per candidate (the path taken when the seed
+         fails)
+
+Every fake answers SSDP, mDNS and HTTP with tunable latency, jitter and loss.
+The scanner is built with c++ on first use unless --scanner names a binary.
+
+Reported per run:
+  scan time      wall clock per phase, and the longest single scanTick()
+  memory         firmware-side estimate of the speaker table + UUID index,
+                 and the scanner's measured heap peak during the scan
+  lookup cost    string compares to build the table (findSpeakerByUuid is a
+                 linear scan), per-NOTIFY lookup cost, and probe lengths in
+                 the UUID index as the scan left it
+
+--max-scan-ms / --max-probes turn it into a gate: exit status 1 if exceeded.
+
+  ./household_sim.py --speakers 200 --latency-ms 5 --loss 0.02 --runs 3
+  ./household_sim.py --speakers 32 --mode fallback --json
+  ./household_sim.py --scanner /tmp/discovery_host -- -v    # scanner's log on stderr
+
+Linux routes all of 127.0.0.0/8 to lo already. On macOS add the aliases first:
+  for i in $(seq 1 200); do sudo ifconfig lo0 alias 127.42.0.$i up; done
+"""
+import argparse
+import html
+import json
+import random
+import re
+import shutil
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+FIRMWARE = HERE.parent
+
+SSDP_ST = "urn:schemas-upnp-org:device:ZonePlayer:1"
+
+
+# ── firmware constants ───────────────────────────────────────────────────────
+
+def firmware_constant(name, default):
+    """Pull `static constexpr ... NAME = <int>;` out of the sketch headers."""
+    pat = re.compile(r"constexpr\s+[\w:]+\s+" + name + r"\s*=\s*(\d+)")
+    for header in ("discovery.h", "speaker.h"):
+        try:
+            m = pat.search((FIRMWARE / header).read_text())
+        except OSError:
+            continue
+        if m:
+            return int(m.group(1))
+    return default
+
+
+UUID_INDEX_SLOTS = firmware_constant("UUID_INDEX_SLOTS", 256)
+
+
+# ── household model ──────────────────────────────────────────────────────────
+
+class FakePlayer:
+    def __init__(self, n, group_size, satellite):
+        self.ip = "127.42.%d.%d" % (n // 250, n % 250 + 1)
+        self.uuid = "RINCON_%012X01400" % (0x347E5C000000 + n)
+        self.name = "" if satellite else "Room %03d" % n
+        self.invisible = satellite
+        self.coordinator = None   # filled in by build_household
+        self.group = n // group_size
+
+
+def build_household(count, group_size, satellite_every):
+    players = []
+    for n in range(count):
+        sat = satellite_every > 0 and n % satellite_every == satellite_every - 1
+        players.append(FakePlayer(n, group_size, sat))
+    groups = {}
+    for p in players:
+        groups.setdefault(p.group, []).append(p)
+    for members in groups.values():
+        for p in members:
+            p.coordinator = members[0].uuid
+    return players, groups
+
+
+def zone_group_state(groups):
+    """The inner (unescaped) ZoneGroupState document, as a real player sends it."""
+    out = ["<ZoneGroupState><ZoneGroups>"]
+    for gid, members in sorted(groups.items()):
+        out.append('<ZoneGroup Coordinator="%s" ID="%s:%d">'
+                   % (members[0].uuid, members[0].uuid, gid))
+        for p in members:
+            tag = "Satellite" if p.invisible else "ZoneGroupMember"
+            out.append('<%s UUID="%s" Location="http://%s:1400/xml/device_description.xml"'
+                       ' ZoneName="%s" Invisible="%d" SoftwareVersion="85.0-64200"/>'
+                       % (tag, p.uuid, p.ip, html.escape(p.name), int(p.invisible)))
+        out.append("</ZoneGroup>")
+    out.append("</ZoneGroups><VanishedDevices/></ZoneGroupState>")
+    return "".join(out)
+
+
+class Conditions:
+    """Per-reply latency, jitter and loss. Seeded so runs are repeatable."""
+
+    def __init__(self, latency_ms, jitter_ms, loss, seed):
+        self.latency_ms = latency_ms
+        self.jitter_ms = jitter_ms
+        self.loss = loss
+        self.rng = random.Random(seed)
+        self.lock = threading.Lock()
+
+    def delay(self):
+        with self.lock:
+            j = self.rng.uniform(-self.jitter_ms, self.jitter_ms)
+        return max(0.0, self.latency_ms + j) / 1000.0
+
+    def dropped(self):
+        with self.lock:
+            return self.rng.random() < self.loss
+
+
+# ── fake responders ──────────────────────────────────────────────────────────
+
+class Household:
+    def __init__(self, players, groups, cond, http_port, ssdp_port, mdns_port):
+        self.players = players
+        self.by_ip = {p.ip: p for p in players}
+        self.cond = cond
+        self.http_port = http_port
+        self.ssdp_port = ssdp_port
+        self.mdns_port = mdns_port
+        self.zgs = zone_group_state(groups)
+        self.mdns_enabled = True
+        self.topology_enabled = True   # False: GetZoneGroupState -> 500, forcing the fallback
+        self.stats = {"ssdp_replies": 0, "mdns_replies": 0, "http_requests": 0, "http_bytes": 0}
+        self.stats_lock = threading.Lock()
+        self.threads = []
+        self.sockets = []
+        self.httpd = None
+
+    def count(self, key, n=1):
+        with self.stats_lock:
+            self.stats[key] += n
+
+    # Each reply leaves from the fake player's own address, after its own
+    # latency, so the client sees a realistic spread of arrivals.
+    def reply_later(self, player, payload, dest, stat):
+        def send():
+            time.sleep(self.cond.delay())
+            s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+            try:
+                s.bind((player.ip, 0))
+                s.sendto(payload, dest)
+                self.count(stat)
+            except OSError:
+                pass
+            finally:
+                s.close()
+        if not self.cond.dropped():
+            threading.Thread(target=send, daemon=True).start()
+
+    def ssdp_reply(self, p):
+        return ("HTTP/1.1 200 OK\r\n"
+                "CACHE-CONTROL: max-age = 1800\r\n"
+                "EXT:\r\n"
+                "LOCATION: http://%s:%d/xml/device_description.xml\r\n"
+                "SERVER: Linux UPnP/1.0 Sonos/85.0-64200 (ZPS9)\r\n"
+                "ST: %s\r\n"
+                "USN: uuid:%s::%s\r\n"
+                "X-RINCON-HOUSEHOLD: Sonos_bench\r\n\r\n"
+                % (p.ip, self.http_port, SSDP_ST, p.uuid, SSDP_ST)).encode()
+
+    def serve_ssdp(self, sock):
+        while True:
+            try:
+                data, src = sock.recvfrom(2048)
+            except OSError:
+                return
+            if not data.startswith(b"M-SEARCH") or b"ZonePlayer" not in data:
+                continue
+            for p in self.players:
+                self.reply_later(p, self.ssdp_reply(p), src, "ssdp_replies")
+
+    def mdns_reply(self, p):
+        # One PTR answer plus the A record, the way each player's responder
+        # answers a one-shot query. No name compression — we only parse ours.
+        inst = "Sonos-%s._sonos._tcp.local" % p.uuid[7:19]
+        host = "Sonos-%s.local" % p.uuid[7:19]
+        ptr = dns_name(inst)
+        pkt = struct.pack(">6H", 0, 0x8400, 0, 1, 0, 1)
+        pkt += dns_name("_sonos._tcp.local") + struct.pack(">HHIH", 12, 1, 120, len(ptr)) + ptr
+        pkt += dns_name(host) + struct.pack(">HHIH", 1, 1, 120, 4) + socket.inet_aton(p.ip)
+        return pkt
+
+    def serve_mdns(self, sock):
+        while True:
+            try:
+                data, src = sock.recvfrom(2048)
+            except OSError:
+                return
+            if not self.mdns_enabled or b"_sonos" not in data:
+                continue
+            for p in self.players:
+                if not p.invisible:
+                    self.reply_later(p, self.mdns_reply(p), src, "mdns_replies")
+
+    def start(self):
+        home = self
+
+        class Handler(BaseHTTPRequestHandler):
+            protocol_version = "HTTP/1.1"
+
+            def log_message(self, *args):
+                pass
+
+            def player(self):
+                return home.by_ip.get(self.connection.getsockname()[0])
+
+            def send(self, body, ctype):
+                home.count("http_requests")
+                home.count("http_bytes", len(body))
+                time.sleep(home.cond.delay())
+                if home.cond.dropped():
+                    self.close_connection = True
+                    return
+                self.send_response(200)
+                self.send_header("Content-Type", ctype)
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+
+            def do_GET(self):
+                p = self.player()
+                if not p or self.path != "/xml/device_description.xml":
+                    self.send_error(404)
+                    return
+                self.send(device_description(p).encode(), 'text/xml; charset="utf-8"')
+
+            def do_POST(self):
+                self.rfile.read(int(self.headers.get("Content-Length", 0)))
+                if not self.player() or self.path != "/ZoneGroupTopology/Control":
+                    self.send_error(404)
+                    return
+                if not home.topology_enabled:
+                    home.count("http_requests")
+                    self.send_error(500)
+                    return
+                body = ('<?xml version="1.0"?><s:Envelope xmlns:s="http://schemas.xmlsoap.org/soap/envelope/"'
+                        ' s:encodingStyle="http://schemas.xmlsoap.org/soap/encoding/"><s:Body>'
+                        '<u:GetZoneGroupStateResponse xmlns:u="urn:schemas-upnp-org:service:ZoneGroupTopology:1">'
+                        "<ZoneGroupState>%s</ZoneGroupState></u:GetZoneGroupStateResponse>"
+                        "</s:Body></s:Envelope>" % html.escape(home.zgs, quote=True))
+                self.send(body.encode(), 'text/xml; charset="utf-8"')
+
+        self.httpd = ThreadingHTTPServer(("0.0.0.0", self.http_port), Handler)
+        self.httpd.daemon_threads = True
+        self.spawn(self.httpd.serve_forever)
+
+        ssdp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        ssdp.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        ssdp.bind(("0.0.0.0", self.ssdp_port))
+        try:
+            mreq = socket.inet_aton("239.255.255.250") + socket.inet_aton("127.0.0.1")
+            ssdp.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+        except OSError:
+            pass  # loopback without MULTICAST flag — unicast M-SEARCH still works
+        self.sockets.append(ssdp)
+        self.spawn(self.serve_ssdp, ssdp)
+
+        mdns = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        mdns.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        mdns.bind(("127.0.0.1", self.mdns_port))
+        self.sockets.append(mdns)
+        self.spawn(self.serve_mdns, mdns)
+
+    def spawn(self, fn, *args):
+        t = threading.Thread(target=fn, args=args, daemon=True)
+        t.start()
+        self.threads.append(t)
+
+    def stop(self):
+        if self.httpd:
+            self.httpd.shutdown()
+            self.httpd.server_close()
+        for s in self.sockets:
+            s.close()
+
+
+def device_description(p):
+    return ('<?xml version="1.0" encoding="utf-8" ?><root xmlns="urn:schemas-upnp-org:device-1-0">'
+            "<device><deviceType>%s</deviceType><friendlyName>%s - Sonos One</friendlyName>"
+            "<roomName>%s</roomName><UDN>uuid:%s</UDN></device></root>"
+            % (SSDP_ST, p.ip, html.escape(p.name), p.uuid))
+
+
+def dns_name(name):
+    out = b""
+    for label in name.split("."):
+        out += bytes([len(label)]) + label.encode()
+    return out + b"\0"
+
+
+# ── scanner: the firmware's scan, built for the host ────────────────────────
+
+def build_scanner():
+    cxx = shutil.which("c++") or shutil.which("g++")
+    if not cxx:
+        sys.exit("no C++ compiler on PATH — build bench/discovery_host.cpp and pass --scanner")
+    out = Path(tempfile.mkdtemp(prefix="household_sim-")) / "discovery_host"
+    cmd = [cxx, "-O2", "-std=gnu++17", "-I", str(HERE / "host"), "-I", str(FIRMWARE),
+           str(HERE / "discovery_host.cpp"), "-o", str(out)]
+    r = subprocess.run(cmd, capture_output=True, text=True)
+    if r.returncode:
+        sys.exit("building the scanner failed:\n" + r.stderr)
+    return str(out)
+
+
+def run_scan(scanner, home, multicast, extra):
+    cmd = [scanner, "--http-port", str(home.http_port), "--ssdp-port", str(home.ssdp_port),
+           "--mdns-port", str(home.mdns_port)] + (["--multicast"] if multicast else []) + extra
+    r = subprocess.run(cmd, stdout=subprocess.PIPE, text=True, timeout=120)
+    if r.returncode:
+        sys.exit("scanner exited with %d" % r.returncode)
+    return json.loads(r.stdout)
+
+
+# ── firmware cost model ──────────────────────────────────────────────────────
+
+STRING_OBJ = 16   # sizeof(String) on 32-bit arduino-esp32, SSO up to 11 chars
+STRING_SSO = 11
+MALLOC_OVERHEAD = 8
+
+
+def string_bytes(s):
+    n = len(s.encode())
+    return STRING_OBJ + (0 if n <= STRING_SSO else ((n + 1 + 3) & ~3) + MALLOC_OVERHEAD)
+
+
+def firmware_memory(table):
+    """Estimated heap held by std::vector<SpeakerInfo> after a scan."""
+    cap = 1
+    while cap < len(table):
+        cap *= 2   # push_back doubling, never shrunk
+    payload = sum(string_bytes(e["ip"]) + string_bytes(e["name"]) + string_bytes(e["uuid"])
+                  + string_bytes(e["coordinator"]) - 4 * STRING_OBJ for e in table)
+    return {"speaker_table_bytes": cap * 4 * STRING_OBJ + payload + MALLOC_OVERHEAD,
+            "uuid_index_bytes": UUID_INDEX_SLOTS * (32 + 4 + 4)}
+
+
+def lookup_cost(index, table_size):
+    """Compare counts for the firmware's lookups, and the UUID index the scan left."""
+    return {
+        # stageTopology: findSpeakerByUuid over the staged table per member
+        "build_compares": table_size * (table_size - 1) // 2,
+        # NOTIFY for a known speaker: average linear findSpeakerByUuid
+        "notify_compares_avg": (table_size + 1) / 2 if table_size else 0,
+        "index_load": round(index["used"] / UUID_INDEX_SLOTS, 2),
+        "index_probe_avg": index["probe_avg"],
+        "index_probe_max": index["probe_max"],
+        "index_overwritten": index["lost"],
+    }
+
+
+# ── main ─────────────────────────────────────────────────────────────────────
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("--speakers", type=int, default=200)
+    ap.add_argument("--group-size", type=int, default=4, help="players per ZoneGroup")
+    ap.add_argument("--satellite-every", type=int, default=0,
+                    help="every Nth player is an invisible satellite (0 = none)")
+    ap.add_argument("--latency-ms", type=float, default=2.0)
+    ap.add_argument("--jitter-ms", type=float, default=1.0)
+    ap.add_argument("--loss", type=float, default=0.0, help="drop probability per reply")
+    ap.add_argument("--no-mdns", action="store_true", help="fakes ignore mDNS (forces SSDP)")
+    ap.add_argument("--mode", choices=("topology", "fallback"), default="topology")
+    ap.add_argument("--multicast", action="store_true",
+                    help="send M-SEARCH to 239.255.255.250 instead of unicast to the responder")
+    ap.add_argument("--runs", type=int, default=3)
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("--http-port", type=int, default=1400)
+    ap.add_argument("--ssdp-port", type=int, default=1900)
+    ap.add_argument("--mdns-port", type=int, default=5354)
+    ap.add_argument("--max-scan-ms", type=float, help="fail if the median scan exceeds this")
+    ap.add_argument("--max-probes", type=int, help="fail if any UUID index probe exceeds this")
+    ap.add_argument("--scanner", help="prebuilt bench/discovery_host binary (default: build one)")
+    ap.add_argument("--json", action="store_true")
+    ap.add_argument("scanner_args", nargs="*", help="passed to the scanner after --, e.g. -v")
+    args = ap.parse_args()
+    scanner = args.scanner or build_scanner()
+
+    players, groups = build_household(args.speakers, args.group_size, args.satellite_every)
+    home = Household(players, groups, Conditions(args.latency_ms, args.jitter_ms, args.loss, args.seed),
+                     args.http_port, args.ssdp_port, args.mdns_port)
+    home.mdns_enabled = not args.no_mdns
+    home.topology_enabled = args.mode == "topology"
+    try:
+        home.start()
+    except OSError as e:
+        sys.exit("can't bind fake household: %s (loopback aliases missing? ports in use?)" % e)
+
+    runs = []
+    try:
+        for _ in range(args.runs):
+            runs.append(run_scan(scanner, home, args.multicast, args.scanner_args))
+            time.sleep(0.2)   # let stragglers from the last run drain
+    finally:
+        home.stop()
+
+    last = runs[-1]
+    totals = sorted(r["phases_ms"]["total"] for r in runs)
+    report = {
+        "speakers": args.speakers,
+        "mode": args.mode,
+        "conditions": {"latency_ms": args.latency_ms, "jitter_ms": args.jitter_ms, "loss": args.loss,
+                       "mdns": not args.no_mdns},
+        "scan_ms": {"median": totals[len(totals) // 2], "min": totals[0], "max": totals[-1]},
+        "runs": [{k: v for k, v in r.items() if k != "table"} for r in runs],
+        "memory": dict(firmware_memory(last["table"]),
+                       scanner_heap_peak_bytes=last["heap_peak_bytes"]),
+        "lookup": lookup_cost(last["index"], len(last["table"])),
+        "responders": home.stats,
+    }
+
+    failed = []
+    if args.max_scan_ms is not None and report["scan_ms"]["median"] > args.max_scan_ms:
+        failed.append("median scan %.1f ms > %.1f ms" % (report["scan_ms"]["median"], args.max_scan_ms))
+    if args.max_probes is not None and report["lookup"]["index_probe_max"] > args.max_probes:
+        failed.append("UUID index probe %d > %d" % (report["lookup"]["index_probe_max"], args.max_probes))
+    report["gate"] = "fail" if failed else "pass"
+
+    if args.json:
+        print(json.dumps(report, indent=2))
+    else:
+        print("household: %d players, %s mode, %.1f±%.1f ms latency, %.0f%% loss, mDNS %s"
+              % (args.speakers, args.mode, args.latency_ms, args.jitter_ms, args.loss * 100,
+                 "on" if not args.no_mdns else "off"))
+        for i, r in enumerate(report["runs"], 1):
+            ph = r["phases_ms"]
+            print("  run %d: %7.1f ms  (mdns %.1f, ssdp %.1f, fetch %.1f)  found %d, %d B on the wire, "
+                  "longest tick %d ms%s"
+                  % (i, ph["total"], ph.get("mdns", 0), ph.get("ssdp", 0), ph.get("fetch", 0), r["found"],
+                     r["wire_bytes"], r["max_tick_ms"],
+                     ", %d connects failed" % r["connect_failures"] if r["connect_failures"] else ""))
+        s, m, lk = report["scan_ms"], report["memory"], report["lookup"]
+        print("scan:   median %.1f ms (min %.1f, max %.1f)" % (s["median"], s["min"], s["max"]))
+        print("memory: speaker table ~%d B, UUID index %d B, scanner heap peak %d B"
+              % (m["speaker_table_bytes"], m["uuid_index_bytes"], m["scanner_heap_peak_bytes"]))
+        print("lookup: %d compares to build, %.1f per NOTIFY; index load %.2f, probes avg %.2f max %d%s"
+              % (lk["build_compares"], lk["notify_compares_avg"], lk["index_load"],
+                 lk["index_probe_avg"], lk["index_probe_max"],
+                 ", %d OVERWRITTEN" % lk["index_overwritten"] if lk["index_overwritten"] else ""))
+        for f in failed:
+            print("GATE FAIL: " + f)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,223 @@
+#!/usr/bin/env node
+// =============================================================================
+// Fleet hub KV cost — the worker against an in-memory KV stand-in.
+//
+//   node bench/hub_kv_sim.mjs                       # current worker
+//   git show <rev>:projects/SonosEthRemoteP4/fleet-hub/src/worker.js > /tmp/worker_old.js
+//   node bench/hub_kv_sim.mjs --worker /tmp/worker_old.js
+//
+// For each fleet size, every board POSTs a report with a couple of gestures
+// every --step-h hours for --days days (on a faked clock), --concurrency
+// reports in flight at once. After each step the cron aggregation runs
+// until a run finds nothing left to fold in, as the once-a-minute trigger
+// would between steps. Then one dashboard refresh (GET /api/state +
+// /api/pulse + /api/rollup?hours=24) is timed, and a rollup over the whole
+// history is counted. The stand-in counts gets / puts / lists and charges
+// --latency ms per operation (operations the worker awaits one after
+// another add up, as they do against real KV, and concurrent reports
+// interleave their reads and writes). Ingest cost — operations and bytes
+// written per report — is shown for the first and last step, so growth
+// with history shows up.
+//
+// Then the aggregated documents are deleted, as after a deploy or a lost
+// key, and the cron has to rebuild them from every board's keys; and one
+// more run with nothing new must write nothing. Shown: cron runs to catch
+// up after a step and to rebuild, the most KV operations any single run
+// took, and the idle run's puts.
+//
+// Checks the refresh shows every board with its identity, the rollup
+// totals match what was sent, the rebuilt documents show every board, and
+// no cron run goes over CRON_OP_LIMIT — Workers' 1,000 KV operations per
+// invocation, past which the run throws before its puts. Exits 1 if not.
+// --max-ops N also fails any refresh over N KV operations; with the
+// aggregated documents it's 4 at every size.
+// =============================================================================
+import path from "node:path";
+import { pathToFileURL, fileURLToPath } from "node:url";
+
+const args = process.argv.slice(2);
+const opt = (name, dflt) => {
+  const i = args.indexOf(name);
+  return i >= 0 ? args[i + 1] : dflt;
+};
+const here = path.dirname(fileURLToPath(import.meta.url));
+const workerPath = path.resolve(opt("--worker", path.join(here, "../fleet-hub/src/worker.js")));
+const sizes = opt("--boards", "9,90,900").split(",").map(Number);
+const latency = Number(opt("--latency", "5"));
+const days = Number(opt("--days", "2"));
+const stepH = Number(opt("--step-h", "6"));
+const concurrency = Number(opt("--concurrency", "64"));
+const maxOps = opt("--max-ops") !== undefined ? Number(opt("--max-ops")) : null;
+
+const worker = (await import(pathToFileURL(workerPath).href)).default;
+
+// ── KV stand-in ──────────────────────────────────────────────────────────────
+// Enough of the Workers KV binding: get / put with expirationTtl and
+// metadata / list by prefix (1000 keys a page with a cursor, like the real
+// one), plus operation counters.
+class Kv {
+  constructor() { this.data = new Map(); this.reset(); this.delay = 0; }
+  reset() { this.ops = { get: 0, put: 0, list: 0 }; this.written = 0; }
+  async wait() { if (this.delay) await new Promise(r => setTimeout(r, this.delay)); }
+  async get(key) {
+    this.ops.get++; await this.wait();
+    const e = this.data.get(key);
+    if (!e || (e.exp && e.exp <= Date.now())) return null;
+    return e.value;
+  }
+  async put(key, value, o = {}) {
+    this.ops.put++; this.written += String(value).length; await this.wait();
+    this.data.set(key, {
+      value: String(value), metadata: o.metadata,
+      exp: o.expirationTtl ? Date.now() + o.expirationTtl * 1000 : 0,
+    });
+  }
+  async list({ prefix = "", cursor } = {}) {
+    this.ops.list++; await this.wait();
+    const all = [...this.data.entries()]
+      .filter(([k, e]) => k.startsWith(prefix) && !(e.exp && e.exp <= Date.now()))
+      .sort(([a], [b]) => (a < b ? -1 : 1));
+    const from = Number(cursor || 0), page = all.slice(from, from + 1000);
+    const done = from + 1000 >= all.length;
+    return {
+      keys: page.map(([name, e]) => (e.metadata ? { name, metadata: e.metadata } : { name })),
+      list_complete: done, cursor: done ? undefined : String(from + 1000),
+    };
+  }
+  total() { return this.ops.get + this.ops.put + this.ops.list; }
+}
+
+function report(i) {
+  const nowMs = 3600000 + i;
+  return {
+    id: `tpsvc-b${String(i).padStart(4, "0")}`, client: "tpsvc", room: `b${i}`, label: `Board ${i}`,
+    fw: "1.0.4", up: 3600, ip: `10.0.${i >> 8}.${i & 255}`, i2c: true, ss_pid: 4991,
+    speaker: "Kitchen", spkOnline: true, rotEvents: 10, lastRotMs: nowMs - 5000, nowMs,
+    errors: { soap: 0, spk_lost: 0, ota: 0 },
+    events: [{ ms: nowMs - 9000, gid: "1c", ok: true }, { ms: nowMs - 5000, gid: "rot+3", ok: true }],
+  };
+}
+
+const env = { INGEST_SECRET: "sim", LATEST_TTL_SECONDS: "1800" };
+const get = p => worker.fetch(new Request("https://hub" + p), env);
+async function cron() {
+  const waits = [];
+  await worker.scheduled({ cron: "* * * * *" }, env, { waitUntil: p => waits.push(p) });
+  await Promise.all(waits);
+}
+const json = async r => (r.ok ? r.json() : null);
+
+// Cron runs until one writes nothing. Returns runs (that last, idle one
+// included) and the most operations any one took.
+const CRON_OP_LIMIT = 1000;
+async function cronUntilIdle(kv) {
+  let runs = 0, most = 0;
+  for (;;) {
+    kv.reset();
+    await cron();
+    runs++;
+    most = Math.max(most, kv.total());
+    if (!kv.ops.put || runs >= 50) return { runs, most };
+  }
+}
+
+// The worker reads Date.now(); stepping it lets every board report every
+// --step-h hours over --days days of history before the dashboard is read.
+const realNow = Date.now;
+let clock = 0;
+Date.now = () => clock;
+
+console.log(`worker: ${path.relative(process.cwd(), workerPath)}, ${latency} ms per KV operation, ` +
+  `${days} days of history, a report per board every ${stepH} h, ${concurrency} at a time\n`);
+console.log("boards   ingest per report (first / last step)   cron runs per step   rebuild runs   " +
+  `max cron ops   idle puts   refresh ops   refresh ms   ${days}d rollup ops   boards shown   rollup ok`);
+let ok = true;
+for (const n of sizes) {
+  const kv = new Kv();
+  env.STATE = kv;
+  clock = realNow() - days * 86400000;
+  const steps = Math.round(days * 24 / stepH);
+  const perStep = [], cronRuns = [];
+  let cronMost = 0;
+  kv.delay = latency;
+  for (let step = 0; step < steps; step++, clock += stepH * 3600000) {
+    kv.reset();
+    for (let next = 0; next < n; ) {
+      const batch = [];
+      for (; next < n && batch.length < concurrency; next++) {
+        const i = next;
+        batch.push(worker.fetch(new Request("https://hub/report", {
+          method: "POST", headers: { "X-Fleet-Auth": "sim", "content-type": "application/json" },
+          body: JSON.stringify(report(i)),
+        }), env).then(r => {
+          if (r.status !== 200) { console.log(`report ${i}: HTTP ${r.status}`); process.exit(1); }
+        }));
+      }
+      await Promise.all(batch);
+    }
+    perStep.push(`${(kv.total() / n).toFixed(1)} ops ${(kv.written / n / 1024).toFixed(1)} KB`);
+    const c = await cronUntilIdle(kv);
+    cronRuns.push(c.runs);
+    cronMost = Math.max(cronMost, c.most);
+  }
+  clock -= stepH * 3600000;   // read right after the last reports
+
+  // One dashboard refresh, as the page does it.
+  kv.reset();
+  const t0 = performance.now();
+  const [s, p, r] = await Promise.all([get("/api/state"), get("/api/pulse"), get("/api/rollup?hours=24")]);
+  const ms = performance.now() - t0;
+  const refreshOps = kv.total();
+  const state = await json(s);
+  await json(p); await json(r);
+
+  // A query over the whole history.
+  kv.reset();
+  const week = await json(await get(`/api/rollup?hours=${days * 24}`));
+  const weekOps = kv.total();
+  kv.delay = 0;
+
+  // The documents lost: rebuilt from the per-board keys, a share per run.
+  kv.data.delete("fleet");
+  kv.data.delete("pulse");
+  const rebuild = await cronUntilIdle(kv);
+  cronMost = Math.max(cronMost, rebuild.most);
+  const rebuilt = await json(await get("/api/state"));
+  kv.reset();
+  await cron();
+  const idlePuts = kv.ops.put;
+
+  // Every board sent one "1c" and one "rot+3" per report.
+  let rollupOk = "—";
+  if (week) {
+    const t = Object.values(week.totals);
+    rollupOk = t.length === n && t.every(x => x.g === steps && x.rot === 3 * steps && x.f === 0) ? "yes" : "NO";
+    if (rollupOk !== "yes") ok = false;
+  }
+  console.log(`${String(n).padStart(6)}   ${(perStep[0] + " / " + perStep.at(-1)).padStart(36)}   ` +
+    `${String(Math.max(...cronRuns)).padStart(18)}   ${String(rebuild.runs).padStart(12)}   ` +
+    `${String(cronMost).padStart(12)}   ${String(idlePuts).padStart(9)}   ` +
+    `${String(refreshOps).padStart(11)}   ${ms.toFixed(0).padStart(10)}   ${String(week ? weekOps : "—").padStart(15)}   ` +
+    `${String(state.boards.length).padStart(12)}   ${rollupOk.padStart(9)}`);
+  if (state.boards.length !== n || state.boards.some(b => b.fw !== "1.0.4")) {
+    console.log(`FAIL: ${state.boards.filter(b => b.fw === "1.0.4").length} of ${n} boards on the dashboard`);
+    ok = false;
+  }
+  if (cronMost > CRON_OP_LIMIT) {
+    console.log(`FAIL: a cron run took ${cronMost} KV operations > ${CRON_OP_LIMIT}`);
+    ok = false;
+  }
+  if (rebuilt.boards.length !== n) {
+    console.log(`FAIL: ${rebuilt.boards.length} of ${n} boards after rebuilding the documents`);
+    ok = false;
+  }
+  if (idlePuts) {
+    console.log(`FAIL: a cron run with nothing new made ${idlePuts} puts`);
+    ok = false;
+  }
+  if (maxOps !== null && refreshOps > maxOps) {
+    console.log(`FAIL: refresh took ${refreshOps} KV operations > ${maxOps}`);
+    ok = false;
+  }
+}
+process.exit(ok ? 0 : 1);
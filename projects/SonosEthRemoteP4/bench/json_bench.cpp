@@ -0,0 +1,143 @@
+// =============================================================================
+// JsonWriter host benchmark — heap allocations and time per /api/status body.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/json_bench.cpp -o /tmp/json_bench
+//   /tmp/json_bench [iterations]
+//
+// Renders the same status document two ways: the old `String +=` chain with
+// a jsonEscape() copy per string field, and JsonWriter into a fixed buffer.
+// Every operator new is counted, so the JsonWriter column must read 0; the
+// run exits 1 if it doesn't, or if escaping doesn't match RFC 8259. Values
+// mirror a busy board: long titles, a control character from a bad tag.
+// =============================================================================
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include "Arduino.h"
+#include "json.h"
+
+static size_t allocs = 0;
+void* operator new(size_t n) { allocs++; if (void* p = malloc(n)) return p; throw std::bad_alloc(); }
+void* operator new[](size_t n) { allocs++; if (void* p = malloc(n)) return p; throw std::bad_alloc(); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+struct Status {
+  int vol = 23; bool mut = false, play = true;
+  String spk = "Great Room", title = "Symphony No. 9 in D minor, Op. 125 \"Choral\": IV. Presto\x01";
+  String artist = "Berliner Philharmoniker, Herbert von Karajan", album = "Beethoven: 9 Symphonies";
+  String art = "http://192.168.1.31:1400/getaa?s=1&u=x-sonos-spotify%3aspotify%253atrack%253a6rqhFgbbKwnb9MLmUQDhG6";
+  String dur = "0:24:31", elapsed = "0:03:07";
+  int bass = 2, treble = -1, modeVal = 23, step = 2;
+  String dev = "Kitchen knob", host = "tpsvc-grkit", room = "grkit", label = "Great Room Kitchen";
+  String ip = "192.168.1.57", upd = "idle", latest = "1.0.4", err = "";
+  unsigned long up = 86400, since = 412;
+};
+
+// ── the old way ─────────────────────────────────────────────────────────────
+static String jsonEscape(const String& s) {
+  String out;
+  out.reserve(s.length() + 8);
+  for (unsigned i = 0; i < s.length(); i++) {
+    char c = s[i];
+    if (c == '"') out += "\\\"";
+    else if (c == '\\') out += "\\\\";
+    else out += c;
+  }
+  return out;
+}
+
+static size_t renderString(const Status& d) {
+  String json;
+  json.reserve(640);
+  json = "{\"vol\":"; json += d.vol;
+  json += ",\"mut\":"; json += d.mut ? "true" : "false";
+  json += ",\"play\":"; json += d.play ? "true" : "false";
+  json += ",\"spk\":\""; json += jsonEscape(d.spk);
+  json += "\",\"title\":\""; json += jsonEscape(d.title);
+  json += "\",\"artist\":\""; json += jsonEscape(d.artist);
+  json += "\",\"album\":\""; json += jsonEscape(d.album);
+  json += "\",\"art\":\""; json += jsonEscape(d.art);
+  json += "\",\"dur\":\""; json += d.dur;
+  json += "\",\"elapsed\":\""; json += d.elapsed;
+  json += "\",\"bass\":"; json += d.bass;
+  json += ",\"treble\":"; json += d.treble;
+  json += ",\"mode\":\"volume\",\"modeVal\":"; json += d.modeVal;
+  json += ",\"dev\":\""; json += jsonEscape(d.dev);
+  json += "\",\"host\":\""; json += d.host;
+  json += "\",\"roomSlug\":\""; json += jsonEscape(d.room);
+  json += "\",\"roomLabel\":\""; json += jsonEscape(d.label);
+  json += "\",\"ip\":\""; json += d.ip;
+  json += "\",\"inv\":false,\"step\":"; json += d.step;
+  json += ",\"fwver\":\"1.0.4\",\"updStatus\":\""; json += jsonEscape(d.upd);
+  json += "\",\"updLatest\":\""; json += jsonEscape(d.latest);
+  json += "\",\"updError\":\""; json += jsonEscape(d.err);
+  json += "\",\"sinceAct\":"; json += (long)d.since;
+  json += ",\"up\":"; json += d.up;
+  json += ",\"firedGid\":\"\",\"firedOk\":false,\"firedSince\":-1}";
+  return json.length();
+}
+
+// ── JsonWriter ──────────────────────────────────────────────────────────────
+static char buf[1024];
+
+static size_t renderWriter(const Status& d) {
+  JsonWriter w(buf, sizeof(buf));
+  w.beginObject()
+   .kv("vol", d.vol).kv("mut", d.mut).kv("play", d.play)
+   .kv("spk", d.spk).kv("title", d.title).kv("artist", d.artist)
+   .kv("album", d.album).kv("art", d.art).kv("dur", d.dur).kv("elapsed", d.elapsed)
+   .kv("bass", d.bass).kv("treble", d.treble)
+   .kv("mode", "volume").kv("modeVal", d.modeVal)
+   .kv("dev", d.dev).kv("host", d.host).kv("roomSlug", d.room).kv("roomLabel", d.label)
+   .kv("ip", d.ip).kv("inv", false).kv("step", d.step)
+   .kv("fwver", "1.0.4").kv("updStatus", d.upd).kv("updLatest", d.latest).kv("updError", d.err)
+   .kv("sinceAct", (long)d.since).kv("up", d.up)
+   .kv("firedGid", "").kv("firedOk", false).kv("firedSince", -1)
+   .endObject();
+  return w.overflow() ? 0 : w.length();
+}
+
+template <typename F>
+static void measure(const char* name, F render, const Status& d, int iters,
+                    double& nsPer, double& allocsPer, size_t& bytes) {
+  allocs = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < iters; i++) bytes = render(d);
+  auto t1 = std::chrono::steady_clock::now();
+  nsPer = std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+  allocsPer = (double)allocs / iters;
+  printf("%-12s %7.0f ns/doc  %6.2f allocs/doc  %4zu B\n", name, nsPer, allocsPer, bytes);
+}
+
+static bool checkEscaping() {
+  char out[64];
+  JsonWriter w(out, sizeof(out));
+  w.beginArray().value("a\"b\\c\n\t\x01\x1f/\xc3\xa9").value(String("")).endArray();
+  const char* want = "[\"a\\\"b\\\\c\\n\\t\\u0001\\u001f/\xc3\xa9\",\"\"]";
+  if (strcmp(w.c_str(), want) != 0) {
+    printf("escape mismatch:\n  got  %s\n  want %s\n", w.c_str(), want);
+    return false;
+  }
+  JsonWriter tiny(out, 8);
+  tiny.beginObject().kv("title", "too long").endObject();
+  if (!tiny.overflow()) { printf("overflow not reported\n"); return false; }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  int iters = argc > 1 ? atoi(argv[1]) : 200000;
+  Status d;
+  double nsS, nsW, aS, aW;
+  size_t bS, bW;
+  measure("String +=", renderString, d, iters, nsS, aS, bS);
+  measure("JsonWriter", renderWriter, d, iters, nsW, aW, bW);
+  printf("time ratio String/JsonWriter %.2f (host malloc is cheap; the board's is not)\n", nsS / nsW);
+  bool ok = checkEscaping();
+  if (aW != 0) { printf("FAIL: JsonWriter allocated\n"); ok = false; }
+  if (bW == 0) { printf("FAIL: status document overflowed the buffer\n"); ok = false; }
+  printf(ok ? "pass\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+// =============================================================================
+// Host run of the firmware's OTZ1 decoder (ota_lzss.h) on ota/lzss.py
+// output — proves the two agree and times the inflate.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/lzss_unpack.cpp -o /tmp/lzss_unpack
+//   ./ota/lzss.py pack image.bin /tmp/image.otz
+//   /tmp/lzss_unpack /tmp/image.otz image.bin
+//
+// Exits 1 if the image doesn't inflate, leaves input unread, or differs from
+// image.bin. Also truncates the stream at every 997th byte and checks each
+// truncation is refused. The MB/s is host CPU; it only says the decoder does
+// no per-byte work beyond the bit reader and the window store.
+// =============================================================================
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "Arduino.h"
+#include "ota_lzss.h"
+
+static std::vector<uint8_t> slurp(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) { perror(path); exit(2); }
+  std::vector<uint8_t> v;
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+  fclose(f);
+  return v;
+}
+
+// Hands out at most 1460 B at a time, like a TCP segment.
+struct MemSrc {
+  const uint8_t* p; size_t len, pos = 0;
+  bool read(uint8_t* dst, size_t n) {
+    if (n > len - pos) return false;
+    memcpy(dst, p + pos, n); pos += n; return true;
+  }
+  size_t readSome(uint8_t* dst, size_t n) {
+    size_t k = std::min({n, len - pos, (size_t)1460});
+    memcpy(dst, p + pos, k); pos += k; return k;
+  }
+};
+
+static bool run(const uint8_t* z, size_t len, std::vector<uint8_t>& out, const char*& err) {
+  MemSrc in{z, len};
+  LzsReader<MemSrc> r(in);
+  if (!r.begin()) { err = r.err; return false; }
+  out.resize(r.rawSize);
+  uint8_t buf[1024];
+  for (uint32_t off = 0; off < r.rawSize; ) {
+    size_t k = std::min((size_t)sizeof(buf), (size_t)(r.rawSize - off));
+    if (!r.read(buf, k)) { err = r.err; return false; }
+    memcpy(out.data() + off, buf, k);
+    off += k;
+  }
+  if (!r.done() || in.pos != len) { err = "trailing input"; return false; }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) { fprintf(stderr, "usage: lzss_unpack image.otz image.bin\n"); return 2; }
+  auto z = slurp(argv[1]), want = slurp(argv[2]);
+
+  std::vector<uint8_t> got;
+  const char* err = nullptr;
+  auto t0 = std::chrono::steady_clock::now();
+  const int reps = 10;
+  for (int i = 0; i < reps; i++) {
+    if (!run(z.data(), z.size(), got, err)) { printf("FAIL: %s\n", err); return 1; }
+  }
+  double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / reps;
+  if (got != want) { printf("FAIL: result differs from %s\n", argv[2]); return 1; }
+  printf("inflated %zu B → %zu B (%.2fx), identical, %.0f MB/s out\n",
+         z.size(), got.size(), (double)got.size() / z.size(), got.size() / s / 1e6);
+
+  size_t refused = 0, tried = 0;
+  for (size_t cut = 0; cut < z.size(); cut += 997) {
+    std::vector<uint8_t> r;
+    tried++;
+    if (!run(z.data(), cut, r, err)) refused++;
+  }
+  printf("truncated streams refused: %zu / %zu\n", refused, tried);
+  if (refused != tried) { printf("FAIL\n"); return 1; }
+  printf("pass\n");
+  return 0;
+}
@@ -0,0 +1,294 @@
+// =============================================================================
+// OTA image writer on the host — pipeline overlap, abort and flash errors.
+//
+//   g++ -O2 -std=gnu++17 -pthread -Ibench/host -I. bench/ota_pipeline.cpp -o /tmp/ota_pipeline
+//   g++ -O1 -g -std=gnu++17 -fsanitize=thread -Ibench/host -I. bench/ota_pipeline.cpp -o /tmp/ota_pipeline_tsan
+//   /tmp/ota_pipeline [-v]
+//
+// Builds ota_writer.h unchanged. Its flash task is a real thread
+// (bench/host/freertos.h backs xQueue*/xTaskCreate with std::thread), so
+// the buffer hand-off between the caller and the task runs as it does on
+// the board — run the -fsanitize=thread build to check it for races.
+//
+// The slot is an in-memory flash with a per-sector erase and program cost
+// (sleeps), and the caller sleeps per KB as if reading the network. Every
+// scenario checks what finish() / write() / err say, that the slot was only
+// programmed over erased bytes, whether it was made bootable, and that the
+// flash task is gone afterwards:
+//
+//   overlap      whole image; wall time must come in well under network +
+//                flash, i.e. the two actually ran side by side
+//   resume       the first half already in the slot; only the rest is
+//                written, the hash still covers all of it
+//   abort        abort() part way through; destroyed without finish()
+//   flash-error  one sector's erase fails; write() has to report it within
+//                the pipeline's depth, and nothing becomes bootable
+//   bad-sha      finish() with the wrong digest
+//   overlong     more bytes than begin() announced
+//   too-big      an image larger than the slot
+//
+// Exits 1 on any failure.
+// =============================================================================
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+#include "ota_writer.h"
+
+static const auto epoch = std::chrono::steady_clock::now();
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - epoch).count();
+}
+unsigned long millis() { return micros() / 1000; }
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+static void sleepUs(unsigned us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+
+static bool verbose = false;
+void logEvent(const char* fmt, ...) {
+  if (!verbose) return;
+  va_list ap;
+  va_start(ap, fmt);
+  fputs("    ", stdout);
+  vprintf(fmt, ap);
+  va_end(ap);
+  fputc('\n', stdout);
+}
+
+// ── Flash ────────────────────────────────────────────────────────────────────
+// The update slot. Touched by the flash task (erase, write) and the caller
+// (read, for a resume); never both at once, if the writer is right.
+static constexpr size_t   SLOT_SIZE   = 1024 * 1024;
+static constexpr unsigned ERASE_US    = 6000;   // per 4 KB sector
+static constexpr unsigned PROGRAM_US  = 2000;   // per 4 KB sector
+static constexpr unsigned NET_US_PER_KB = 2000;  // the caller's side, per KB read
+
+static std::vector<uint8_t> flash(SLOT_SIZE, 0xFF);
+static const esp_partition_t slot{0x110000, SLOT_SIZE};
+static const esp_partition_t* bootPart = nullptr;
+static long   failEraseAt = -1;      // sector offset whose erase fails
+static size_t lowestErase = SIZE_MAX;
+static bool   programmedUnerased = false;
+
+esp_err_t esp_partition_read(const esp_partition_t* p, size_t off, void* dst, size_t n) {
+  if (p != &slot || off + n > flash.size()) return ESP_ERR_INVALID_SIZE;
+  memcpy(dst, flash.data() + off, n);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* p, size_t off, size_t n) {
+  if (p != &slot || off % OTA_SECTOR || n % OTA_SECTOR || off + n > flash.size()) return ESP_ERR_INVALID_ARG;
+  sleepUs(ERASE_US * (unsigned)(n / OTA_SECTOR));
+  if ((long)off == failEraseAt) return ESP_FAIL;
+  lowestErase = std::min(lowestErase, off);
+  memset(flash.data() + off, 0xFF, n);
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* p, size_t off, const void* src, size_t n) {
+  if (p != &slot || off + n > flash.size()) return ESP_ERR_INVALID_SIZE;
+  sleepUs((unsigned)(PROGRAM_US * n / OTA_SECTOR));
+  const uint8_t* s = (const uint8_t*)src;
+  for (size_t i = 0; i < n; i++) {
+    if ((flash[off + i] & s[i]) != s[i]) programmedUnerased = true;   // NOR only clears bits
+    flash[off + i] &= s[i];
+  }
+  return ESP_OK;
+}
+
+const esp_partition_t* esp_ota_get_next_update_partition(const esp_partition_t*) { return &slot; }
+const esp_partition_t* esp_ota_get_running_partition() { return nullptr; }
+esp_err_t esp_ota_set_boot_partition(const esp_partition_t* p) {
+  bootPart = p;
+  return ESP_OK;
+}
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+static std::vector<uint8_t> image(size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> v(n);
+  for (auto& b : v) b = (uint8_t)rng();
+  return v;
+}
+
+static String shaHex(const std::vector<uint8_t>& v) {
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  mbedtls_sha256_update(&sha, v.data(), v.size());
+  uint8_t digest[32];
+  char hex[65];
+  mbedtls_sha256_finish(&sha, digest);
+  bytesToHex(digest, 32, hex);
+  return String(hex);
+}
+
+static void resetFlash() {
+  std::fill(flash.begin(), flash.end(), 0xFF);
+  bootPart = nullptr;
+  failEraseAt = -1;
+  lowestErase = SIZE_MAX;
+  programmedUnerased = false;
+}
+
+// Feed v[from, to) the way the download loops do: 1 KB reads off the
+// network. Returns bytes accepted before write() refused.
+static size_t feed(OtaImageWriter& w, const std::vector<uint8_t>& v, size_t from, size_t to) {
+  for (size_t at = from; at < to; ) {
+    size_t k = std::min<size_t>(1024, to - at);
+    sleepUs(NET_US_PER_KB * (unsigned)k / 1024);
+    if (!w.write(v.data() + at, k)) return at - from;
+    at += k;
+  }
+  return to - from;
+}
+
+struct Check {
+  const char* name;
+  std::vector<std::string> errors;
+  explicit Check(const char* n) : name(n) {}
+  void expect(bool ok, const std::string& what) { if (!ok) errors.push_back(what); }
+  // `err` is read only once `ok` has been worked out.
+  void expect(bool ok, const char* what, const String& err) {
+    if (!ok) errors.push_back(std::string(what) + ": " + err.c_str());
+  }
+  bool report(const std::string& detail = "") {
+    // The flash task has sent its last buffer back by now; give its thread
+    // a moment to actually return.
+    for (int i = 0; i < 100 && hostTasksRunning; i++) delay(1);
+    expect(hostTasksRunning == 0, "flash task still running");
+    expect(!programmedUnerased, "programmed over unerased flash");
+    printf("%-12s %s%s%s\n", name, errors.empty() ? "ok" : "FAIL", detail.empty() ? "" : "  ", detail.c_str());
+    for (auto& e : errors) printf("    %s\n", e.c_str());
+    return errors.empty();
+  }
+};
+
+// ── Scenarios ────────────────────────────────────────────────────────────────
+static bool overlap() {
+  Check c{"overlap"};
+  resetFlash();
+  auto img = image(256 * 1024 + 1234, 1);   // a partial last sector too
+  unsigned long t0 = micros();
+  OtaImageWriter w;
+  c.expect(w.begin(img.size()), "begin", w.err);
+  c.expect(feed(w, img, 0, img.size()) == img.size(), "write refused", w.err);
+  c.expect(w.finish(shaHex(img)), "finish", w.err);
+  unsigned long wall = micros() - t0;
+  size_t sectors = (img.size() + OTA_SECTOR - 1) / OTA_SECTOR;
+  unsigned long net = NET_US_PER_KB * (img.size() / 1024), fl = (ERASE_US + PROGRAM_US) * sectors;
+  c.expect(bootPart == &slot, "slot not made bootable");
+  c.expect(memcmp(flash.data(), img.data(), img.size()) == 0, "slot doesn't hold the image");
+  // In turn it'd be net + flash; overlapped, about the larger of the two.
+  c.expect(wall < (net + fl) * 3 / 4, "no overlap: " + std::to_string(wall / 1000) + " ms wall for " +
+           std::to_string(net / 1000) + " ms network + " + std::to_string(fl / 1000) + " ms flash");
+  char detail[96];
+  snprintf(detail, sizeof(detail), "%lu ms wall, network %lu ms + flash %lu ms in turn", wall / 1000,
+           net / 1000, fl / 1000);
+  return c.report(detail);
+}
+
+static bool resume() {
+  Check c{"resume"};
+  resetFlash();
+  auto img = image(200 * 1024, 2);
+  size_t half = 25 * OTA_SECTOR;
+  memcpy(flash.data(), img.data(), half);   // what an earlier attempt left
+  OtaImageWriter w;
+  c.expect(w.begin(img.size(), half), "begin", w.err);
+  c.expect(feed(w, img, half, img.size()) == img.size() - half, "write refused", w.err);
+  c.expect(w.finish(shaHex(img)), "finish", w.err);
+  c.expect(lowestErase == half, "erased below the resume point");
+  c.expect(bootPart == &slot, "slot not made bootable");
+  c.expect(memcmp(flash.data(), img.data(), img.size()) == 0, "slot doesn't hold the image");
+  return c.report();
+}
+
+static bool abortMidway() {
+  Check c{"abort"};
+  resetFlash();
+  auto img = image(128 * 1024, 3);
+  {
+    OtaImageWriter w;
+    c.expect(w.begin(img.size()), "begin", w.err);
+    feed(w, img, 0, img.size() * 2 / 5);
+    w.abort();
+    c.expect(hostTasksRunning <= 1, "abort() returned with buffers still queued");
+  }
+  {
+    OtaImageWriter w;   // and just dropped, as on an early return
+    c.expect(w.begin(img.size()), "begin again", w.err);
+    feed(w, img, 0, img.size() / 3);
+  }
+  c.expect(bootPart == nullptr, "aborted slot made bootable");
+  return c.report();
+}
+
+static bool flashError() {
+  Check c{"flash-error"};
+  resetFlash();
+  auto img = image(256 * 1024, 4);
+  failEraseAt = 20 * OTA_SECTOR;
+  OtaImageWriter w;
+  c.expect(w.begin(img.size()), "begin", w.err);
+  size_t took = feed(w, img, 0, img.size());
+  w.abort();
+  // The error surfaces once the caller next needs a buffer back: at most
+  // the whole pipeline (OTA_PIPE_BUFS sectors plus the one being filled)
+  // past the failing sector.
+  c.expect(took < img.size(), "write() never reported the failure");
+  c.expect(took <= (size_t)failEraseAt + (OTA_PIPE_BUFS + 1) * OTA_SECTOR,
+           "failure reported " + std::to_string(took - failEraseAt) + " bytes late");
+  c.expect(strstr(w.err.c_str(), "flash write at 81920 failed") != nullptr, "err", w.err);
+  c.expect(bootPart == nullptr, "failed slot made bootable");
+  return c.report("refused after " + std::to_string(took) + " B: " + w.err.c_str());
+}
+
+static bool badSha() {
+  Check c{"bad-sha"};
+  resetFlash();
+  auto img = image(64 * 1024, 5);
+  OtaImageWriter w;
+  c.expect(w.begin(img.size()), "begin", w.err);
+  feed(w, img, 0, img.size());
+  c.expect(!w.finish(shaHex(image(64 * 1024, 6))), "finish() accepted the wrong digest");
+  c.expect(w.err.startsWith("sha256 mismatch"), "err", w.err);
+  c.expect(bootPart == nullptr, "mismatched slot made bootable");
+  return c.report();
+}
+
+static bool overlong() {
+  Check c{"overlong"};
+  resetFlash();
+  auto img = image(10000, 7);
+  OtaImageWriter w;
+  c.expect(w.begin(img.size() - 100), "begin", w.err);
+  c.expect(feed(w, img, 0, img.size()) < img.size(), "write() took more than announced");
+  c.expect(w.err == "image longer than announced", "err", w.err);
+  w.abort();
+  c.expect(bootPart == nullptr, "slot made bootable");
+  return c.report();
+}
+
+static bool tooBig() {
+  Check c{"too-big"};
+  resetFlash();
+  OtaImageWriter w;
+  c.expect(!w.begin(SLOT_SIZE + 1), "begin() took an image larger than the slot");
+  c.expect(strstr(w.err.c_str(), "doesn't fit") != nullptr, "err", w.err);
+  return c.report();
+}
+
+int main(int argc, char** argv) {
+  verbose = argc > 1 && !strcmp(argv[1], "-v");
+  if (!verbose) Serial.out = nullptr;
+  bool ok = true;
+  for (auto run : {overlap, resume, abortMidway, flashError, badSha, overlong, tooBig}) ok &= run();
+  printf(ok ? "pass\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""
+LAN peer OTA — a site of boards as host processes, one release rolled out.
+
+Each board is its own process running the decision updater.h makes on every
+check, on a compressed clock (--check-s stands in for the 5 min cadence):
+
+  manifest newer?  → a peer advertising fw=<new> and fwsha=<new sha>?
+                        copy /api/fw.bin from it (Range resume on a drop)
+                     → else the lowest-"IP" board still on the old version
+                        fetches from "GitHub"; the rest wait, up to 3 checks
+  verify sha256, "reboot" (--reboot-s), advertise the new version
+
+Boards serve their current image at /api/fw.bin over real HTTP on loopback,
+with Range support, like serveFirmware(). A directory of one JSON file per
+board stands in for the mDNS TXT records. The "GitHub" server counts what
+it sends and shares --wan-kbps between its transfers like a site uplink,
+so downloads take long enough for checks to overlap as on a real site.
+
+  ./peer_ota_sim.py --boards 8                 # with LAN peers
+  ./peer_ota_sim.py --boards 8 --no-peers      # every board to GitHub (before)
+  ./peer_ota_sim.py --boards 8 --drop 0.3      # cut 30% of transfers half-way
+
+Reported: WAN downloads and bytes, LAN copies, time from release until the
+last board runs it. --max-wan N exits 1 if more than N downloads hit the
+WAN. This checks the rollout logic, not the firmware's HTTP code; point
+--probe at a board to check its /api/fw.bin against its X-Fw-Sha256.
+"""
+import argparse
+import hashlib
+import json
+import multiprocessing as mp
+import os
+import random
+import shutil
+import sys
+import tempfile
+import threading
+import time
+import urllib.error
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PEER_WAITS = 3      # OTA_PEER_WAITS
+RECONNECTS = 5      # OTA_RECONNECTS
+
+
+# ── HTTP: an image with Range, optionally throttled / flaky ──────────────────
+
+def image_server(get_image, kbps=0, drop=0.0, counter=None, manifest=None):
+    # kbps is the site's link, shared by every transfer in flight, not a
+    # per-connection cap — eight boards at once each get an eighth of it.
+    pace = {"free_at": 0.0}
+    pace_lock = threading.Lock()
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, *args):
+            pass
+
+        def do_GET(self):
+            if self.path == "/manifest.json" and manifest is not None:
+                body = json.dumps(manifest()).encode()
+                self.send_response(200)
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+                return
+            data, sha = get_image()
+            start = 0
+            rng = self.headers.get("Range")
+            if rng:
+                start = int(rng.split("=", 1)[1].rstrip("-"))
+                if start >= len(data):
+                    self.send_response(416)
+                    self.send_header("Content-Length", "0")
+                    self.end_headers()
+                    return
+                self.send_response(206)
+                self.send_header("Content-Range", "bytes %d-%d/%d" % (start, len(data) - 1, len(data)))
+            else:
+                self.send_response(200)
+            self.send_header("Content-Length", str(len(data) - start))
+            self.send_header("X-Fw-Sha256", sha)
+            self.send_header("Connection", "close")
+            self.end_headers()
+            cut = len(data)
+            if drop and random.random() < drop:
+                cut = start + (len(data) - start) // 2
+            chunk = 16384
+            for off in range(start, cut, chunk):
+                piece = data[off:min(off + chunk, cut)]
+                try:
+                    self.wfile.write(piece)
+                except OSError:
+                    return
+                if counter is not None:
+                    with counter.get_lock():
+                        counter.value += len(piece)
+                if kbps:
+                    with pace_lock:
+                        now = time.time()
+                        pace["free_at"] = max(pace["free_at"], now) + len(piece) / (kbps * 1024)
+                        wait = pace["free_at"] - now
+                    time.sleep(wait)
+            self.close_connection = True
+
+    ThreadingHTTPServer.request_queue_size = 64
+    server = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    server.daemon_threads = True
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server.server_address[1]
+
+
+def fetch(url, expect_sha, size):
+    """Download with Range resume, like OtaDownload. (bytes, reconnects)."""
+    got = bytearray()
+    reconnects = 0
+    while len(got) < size:
+        req = urllib.request.Request(url)
+        if got:
+            req.add_header("Range", "bytes=%d-" % len(got))
+        try:
+            with urllib.request.urlopen(req, timeout=10) as r:
+                while len(got) < size:
+                    piece = r.read(16384)
+                    if not piece:
+                        break
+                    got += piece
+        except (OSError, urllib.error.URLError):
+            pass
+        if len(got) < size:
+            reconnects += 1
+            if reconnects > RECONNECTS:
+                return None, reconnects
+    if hashlib.sha256(got).hexdigest() != expect_sha:
+        return None, reconnects
+    return bytes(got), reconnects
+
+
+# ── one board ────────────────────────────────────────────────────────────────
+
+def board(idx, args, registry, wan_url, old_image, events):
+    random.seed(idx * 7919 + int(time.time()))
+    state = {"image": old_image, "sha": hashlib.sha256(old_image).hexdigest(), "fw": "1.0.0"}
+    lock = threading.Lock()
+
+    def current():
+        with lock:
+            return state["image"], state["sha"]
+
+    port = image_server(current, drop=args.drop)
+
+    def advertise():
+        path = os.path.join(registry, "%03d.json" % idx)
+        with open(path + ".tmp", "w") as f:
+            json.dump({"ip": idx, "port": port, "fw": state["fw"], "fwsha": state["sha"]}, f)
+        os.replace(path + ".tmp", path)
+
+    advertise()
+    waits = 0
+    time.sleep(random.uniform(0, args.check_s))
+    while True:
+        try:
+            with urllib.request.urlopen(wan_url + "/manifest.json", timeout=5) as r:
+                m = json.load(r)
+        except OSError:
+            m = None
+        if m and m["version"] != state["fw"]:
+            peers = []
+            for name in os.listdir(registry):
+                if name.endswith(".json") and name != "%03d.json" % idx:
+                    try:
+                        with open(os.path.join(registry, name)) as f:
+                            peers.append(json.load(f))
+                    except (OSError, ValueError):
+                        pass
+            have = [p for p in peers if p["fw"] == m["version"] and p["fwsha"] == m["sha256"]]
+            leader = min([p["ip"] for p in peers if p["fw"] == state["fw"]] + [idx])
+            image, source = None, "wan"
+            if args.no_peers:
+                pass
+            elif have:
+                p = random.choice(have)
+                image, _ = fetch("http://127.0.0.1:%d/api/fw.bin" % p["port"], m["sha256"], m["size"])
+                source = "lan"
+            elif leader != idx and waits < PEER_WAITS:
+                waits += 1
+                events.put(("wait", idx, time.time()))
+                source = None
+            if image is None and source is not None:   # leader, waited out, or the peer failed
+                image, _ = fetch(wan_url + "/fw.bin", m["sha256"], m["size"])
+                source = "wan"
+            if image is not None:
+                waits = 0
+                events.put((source, idx, time.time()))
+                time.sleep(args.reboot_s)
+                with lock:
+                    state.update(image=image, sha=m["sha256"], fw=m["version"])
+                advertise()
+                events.put(("running", idx, time.time()))
+        time.sleep(args.check_s * random.uniform(0.9, 1.1))
+
+
+# ── site ─────────────────────────────────────────────────────────────────────
+
+def probe(url):
+    with urllib.request.urlopen(url, timeout=30) as r:
+        want = r.headers.get("X-Fw-Sha256", "")
+        size = int(r.headers.get("Content-Length", "0"))
+    mid = size // 2
+    a, _ = fetch_range(url, 0, mid)
+    b, _ = fetch_range(url, mid, size)
+    got = hashlib.sha256(a + b).hexdigest()
+    print("%s: %d B in two Range halves, sha256 %s (%s)" % (url, size, got, "ok" if got == want else "MISMATCH, header " + want))
+    return 0 if got == want else 1
+
+
+def fetch_range(url, start, end):
+    req = urllib.request.Request(url, headers={"Range": "bytes=%d-" % start})
+    with urllib.request.urlopen(req, timeout=30) as r:
+        return r.read(end - start), r.status
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("--boards", type=int, default=8)
+    ap.add_argument("--image-kb", type=int, default=1100)
+    ap.add_argument("--check-s", type=float, default=3.0, help="stands in for the 5 min check")
+    ap.add_argument("--reboot-s", type=float, default=0.5)
+    ap.add_argument("--wan-kbps", type=int, default=400)
+    ap.add_argument("--drop", type=float, default=0.0, help="fraction of transfers cut half-way")
+    ap.add_argument("--no-peers", action="store_true", help="every board to GitHub, as before")
+    ap.add_argument("--timeout", type=float, default=120.0)
+    ap.add_argument("--max-wan", type=int, help="exit 1 if more WAN downloads than this")
+    ap.add_argument("--probe", help="check a board's /api/fw.bin instead of simulating")
+    args = ap.parse_args()
+    if args.probe:
+        return probe(args.probe)
+
+    rnd = random.Random(42)
+    old = bytes(rnd.getrandbits(8) for _ in range(args.image_kb * 1024))
+    new = bytearray(old)
+    for i in range(0, len(new), 4096):
+        new[i] ^= 0xFF
+    new = bytes(new)
+    new_sha = hashlib.sha256(new).hexdigest()
+    released = mp.Value("d", 0.0)
+    wan_bytes = mp.Value("q", 0)
+
+    def manifest():
+        if released.value and time.time() >= released.value:
+            return {"version": "1.0.1", "sha256": new_sha, "size": len(new)}
+        return {"version": "1.0.0", "sha256": hashlib.sha256(old).hexdigest(), "size": len(old)}
+
+    wan_port = image_server(lambda: (new, new_sha), kbps=args.wan_kbps, drop=args.drop,
+                            counter=wan_bytes, manifest=manifest)
+    wan_url = "http://127.0.0.1:%d" % wan_port
+    registry = tempfile.mkdtemp(prefix="peer_ota_")
+    events = mp.Queue()
+    ctx = mp.get_context("fork")
+    procs = [ctx.Process(target=board, args=(i, args, registry, wan_url, old, events), daemon=True)
+             for i in range(args.boards)]
+    for p in procs:
+        p.start()
+    time.sleep(args.check_s)           # everyone settled on 1.0.0
+    released.value = time.time()
+
+    running, wan, lan, waits = set(), 0, 0, 0
+    deadline = time.time() + args.timeout
+    last = released.value
+    while len(running) < args.boards and time.time() < deadline:
+        try:
+            kind, idx, t = events.get(timeout=0.5)
+        except Exception:
+            continue
+        if kind == "wan":
+            wan += 1
+        elif kind == "lan":
+            lan += 1
+        elif kind == "wait":
+            waits += 1
+        elif kind == "running":
+            running.add(idx)
+            last = t
+    for p in procs:
+        p.terminate()
+    shutil.rmtree(registry, ignore_errors=True)
+
+    print("%d boards, %s, check every %.1f s, WAN %d KB/s%s"
+          % (args.boards, "no peers" if args.no_peers else "LAN peers", args.check_s, args.wan_kbps,
+             ", %.0f%% of transfers cut" % (args.drop * 100) if args.drop else ""))
+    print("  updated     %d / %d, last one %.1f s after release" % (len(running), args.boards, last - released.value))
+    print("  WAN         %d downloads, %.2f MB (%.2fx the image)"
+          % (wan, wan_bytes.value / 1e6, wan_bytes.value / len(new)))
+    print("  LAN         %d copies, %d waits for the leader" % (lan, waits))
+    if len(running) < args.boards:
+        print("FAIL: not every board updated", file=sys.stderr)
+        return 1
+    if args.max_wan is not None and wan > args.max_wan:
+        print("FAIL: %d WAN downloads > %d" % (wan, args.max_wan), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,109 @@
+// =============================================================================
+// Fleet report host benchmark — bytes and encode time, JSON vs CBOR.
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/report_bench.cpp -o /tmp/report_bench
+//   /tmp/report_bench [iterations] [dump-dir]
+//
+// Encodes the reports a busy board sends (a full 24-event ring of clicks,
+// holds and volume spins) and an idle heartbeat, each as the JSON form, as
+// CBOR with the identity fields (first report after boot), and as the
+// steady-state CBOR without them. With a dump dir it also writes every
+// variant there (*.json, *.cbor) so the worker's decoder can be checked
+// against the JSON form:
+//
+//   node bench/cbor_decode.mjs <dump-dir>
+//
+// Exits 1 if a steady-state busy report isn't at least 8x smaller than its
+// JSON. Times are host CPU; the ratio is what carries over to the board.
+// =============================================================================
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "Arduino.h"
+#include "fleet_report.h"
+
+static FleetEventRing ring;
+
+static FleetReportData report(uint8_t events) {
+  static const char* const gids[] = { "1c", "rot+5", "2c", "rot-12", "hold", "rot+1", "3c+h", "lh" };
+  unsigned long now = 86400UL * 1000 * 3 + 12345;   // three days up
+  ring = FleetEventRing();
+  ring.seq = 4000;                                  // a few thousand gestures since boot
+  for (uint8_t i = 0; i < events; i++) {
+    ring.log(gids[i % 8], i % 7 != 3, now - 290000 + i * 11873UL);   // spread over ~5 min
+  }
+  FleetReportData d;
+  d.id = "tpsvc-grkit";
+  d.client = "tpsvc";
+  d.room = "grkit";
+  d.label = "Great Room Kitchen";
+  d.fw = "1.0.4";
+  uint8_t ip[4] = { 192, 168, 1, 57 };
+  memcpy(d.ip, ip, 4);
+  d.i2c = true;
+  d.ssPid = 4991;
+  d.speaker = "Great Room";
+  d.spkOnline = true;
+  d.rotEvents = 18342;
+  d.lastRotMs = events ? ring.at(events - 1).ms : now - 3600000;
+  d.nowMs = now;
+  d.soapErrors = 3;
+  d.boot = 0x5eed1234;
+  d.events = &ring;
+  return d;
+}
+
+static uint8_t buf[2048];
+
+template <typename F>
+static double nsPer(long iters, F&& f) {
+  auto t0 = std::chrono::steady_clock::now();
+  size_t sink = 0;
+  for (long i = 0; i < iters; i++) sink += f();
+  auto t1 = std::chrono::steady_clock::now();
+  if (sink == 0) printf("(nothing encoded)\n");
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+}
+
+static void dump(const char* dir, const char* name, const uint8_t* p, size_t n) {
+  if (!dir) return;
+  std::string path = std::string(dir) + "/" + name;
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) { perror(path.c_str()); exit(1); }
+  fwrite(p, 1, n, f);
+  fclose(f);
+}
+
+int main(int argc, char** argv) {
+  long iters = argc > 1 ? atol(argv[1]) : 200000;
+  const char* dir = argc > 2 ? argv[2] : nullptr;
+  bool ok = true;
+
+  printf("%-10s %12s %12s %12s   %s\n", "report", "json", "cbor+ident", "cbor", "encode ns (json / cbor)");
+  for (uint8_t events : { (uint8_t)24, (uint8_t)0 }) {
+    const char* name = events ? "busy" : "idle";
+    FleetReportData d = report(events);
+
+    JsonWriter w((char*)buf, sizeof(buf));
+    size_t jsonLen = fleetEncodeJson(w, d);
+    dump(dir, (std::string(name) + ".json").c_str(), buf, jsonLen);
+    CborWriter c(buf, sizeof(buf));
+    size_t fullLen = fleetEncodeCbor(c, d, true);
+    dump(dir, (std::string(name) + "-full.cbor").c_str(), buf, fullLen);
+    c.reset();
+    size_t cborLen = fleetEncodeCbor(c, d, false);
+    dump(dir, (std::string(name) + ".cbor").c_str(), buf, cborLen);
+
+    double jsonNs = nsPer(iters, [&] { JsonWriter w((char*)buf, sizeof(buf)); return fleetEncodeJson(w, d); });
+    double cborNs = nsPer(iters, [&] { CborWriter c(buf, sizeof(buf)); return fleetEncodeCbor(c, d, false); });
+
+    printf("%-10s %10zu B %10zu B %10zu B   %.0f / %.0f  (%.1fx smaller, %.1fx faster)\n",
+      name, jsonLen, fullLen, cborLen, jsonNs, cborNs, (double)jsonLen / cborLen, jsonNs / cborNs);
+    if (events && jsonLen < 8 * cborLen) {
+      printf("FAIL: busy CBOR report only %.1fx smaller than JSON\n", (double)jsonLen / cborLen);
+      ok = false;
+    }
+  }
+  return ok ? 0 : 1;
+}
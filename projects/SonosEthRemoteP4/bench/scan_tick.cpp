@@ -0,0 +1,477 @@
+// =============================================================================
+// Discovery scan on a virtual clock — what one scanTick() costs loop().
+//
+//   g++ -O2 -std=gnu++17 -Ibench/host -I. bench/scan_tick.cpp -o /tmp/scan_tick
+//   /tmp/scan_tick [-v]
+//
+// Builds discovery.h, topology.h and lan_http.h unchanged against a fake
+// household behind bench/host/host_net.h. Time only moves when the code
+// waits — loop()'s delay(2) between passes, or a delay() anywhere inside a
+// tick. A connect completes `latency` ms after it was started, or never if
+// nobody answers; a reply arrives `latency` ms after its request and then
+// streams at the player's byte rate. Code that waited on either would have
+// to sit in delay() for it, and show up here as a long tick.
+//
+// Every tick of every scenario is checked against what the scan claims:
+// no more than TICK_LIMIT_MS of waiting or of host CPU, at most
+// LAN_POLL_BYTES of TCP and SCAN_PACKETS_PER_TICK datagrams read. The
+// committed table is checked against the household. Exits 1 on any failure.
+//
+// Scenarios: a 200-player household over SSDP (topology from the first
+// responder); the same seed streaming its topology at 20 B/ms; mDNS
+// finding the players first; every player refusing GetZoneGroupState, so
+// the scan falls back to one device description per responder, with four
+// that answer SSDP but never accept a connection and two that trickle.
+//
+// Then the NOTIFY listener: five players the last scan didn't know announce
+// ssdp:alive — one refusing connections, one trickling its description and
+// one dropping off the network right after its NOTIFY — and
+// ssdpListenTick() has to name the rest under the same per-tick limits.
+// =============================================================================
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "host_net.h"
+#include "discovery.h"
+
+static unsigned long now = 0;
+unsigned long millis() { return now; }
+void delay(unsigned long ms) { now += ms; }
+void logEvent(const char*, ...) {}
+
+static constexpr unsigned long LOOP_PASS_MS = 2;   // delay(2) at the end of loop()
+// Longest a tick may hold loop() — a turn of the knob sent that much late.
+static constexpr unsigned long TICK_LIMIT_MS = 10;
+
+// ── Fake household ───────────────────────────────────────────────────────────
+struct Player {
+  uint32_t    ip;
+  std::string uuid, name, coordinator;
+  bool        satellite = false;
+  unsigned    latency = 2;           // ms, request to first byte (and connect)
+  unsigned    rate = 5000;           // bytes per ms once the reply is flowing
+  bool        refuses = false;       // answers SSDP, never accepts TCP
+  bool        noTopology = false;    // GetZoneGroupState -> 500
+};
+
+struct Datagram {
+  unsigned long at;
+  uint32_t      from;
+  std::string   data;
+};
+
+struct Conn {
+  Player*       p = nullptr;         // nobody at the address: the SYN goes unanswered
+  unsigned long upAt = 0;            // SYN-ACK
+  std::string   request, response;
+  unsigned long start = 0;           // first response byte; 0 = request not complete
+  size_t        read = 0;
+};
+
+static std::string zoneGroupState(const std::vector<Player>& players) {
+  std::string out = "<ZoneGroupState><ZoneGroups>";
+  std::string open;
+  for (auto& p : players) {
+    if (p.coordinator != open) {
+      if (!open.empty()) out += "</ZoneGroup>";
+      open = p.coordinator;
+      out += "<ZoneGroup Coordinator=\"" + open + "\" ID=\"" + open + ":1\">";
+    }
+    out += std::string("<") + (p.satellite ? "Satellite" : "ZoneGroupMember") + " UUID=\"" + p.uuid +
+           "\" Location=\"http://" + IPAddress(p.ip).toString().c_str() +
+           ":1400/xml/device_description.xml\" ZoneName=\"" + p.name + "\" Invisible=\"" +
+           (p.satellite ? "1" : "0") + "\" SoftwareVersion=\"85.0-64200\"/>";
+  }
+  return out + "</ZoneGroup></ZoneGroups><VanishedDevices/></ZoneGroupState>";
+}
+
+static std::string xmlEscape(const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c == '<') out += "&lt;";
+    else if (c == '>') out += "&gt;";
+    else if (c == '"') out += "&quot;";
+    else if (c == '&') out += "&amp;";
+    else out += c;
+  }
+  return out;
+}
+
+// Chunked, like a real player's SOAP replies; 1 KB chunks.
+static std::string chunked(const std::string& body) {
+  std::string out;
+  for (size_t i = 0; i < body.size(); i += 1024) {
+    size_t n = std::min<size_t>(1024, body.size() - i);
+    char head[16];
+    snprintf(head, sizeof(head), "%zx\r\n", n);
+    out += head + body.substr(i, n) + "\r\n";
+  }
+  return out + "0\r\n\r\n";
+}
+
+class FakeNet : public HostNet {
+public:
+  std::vector<Player> players;
+  bool mdns = false;
+  // Per-tick meters, reset by the driver.
+  size_t tcpBytes = 0, datagrams = 0;
+  int    mdnsSock = -1;
+  int    listenSock = -1;           // ssdpListenBegin()'s multicast socket
+
+  Player* find(uint32_t ip) {
+    for (auto& p : players) if (p.ip == ip) return &p;
+    return nullptr;
+  }
+
+  int udpOpen(uint16_t, uint32_t group) override {
+    udp[nextH] = {};
+    if (group) listenSock = nextH;
+    return nextH++;
+  }
+  bool udpSend(int h, uint32_t ip, uint16_t port, const uint8_t* buf, size_t n) override {
+    std::string msg((const char*)buf, n);
+    if (port == 1900 && msg.compare(0, 8, "M-SEARCH") == 0 && msg.find("ZonePlayer") != std::string::npos) {
+      for (auto& p : players) {
+        std::string r = "HTTP/1.1 200 OK\r\nCACHE-CONTROL: max-age = 1800\r\nEXT:\r\n"
+                        "LOCATION: http://" + std::string(IPAddress(p.ip).toString().c_str()) +
+                        ":1400/xml/device_description.xml\r\n"
+                        "ST: urn:schemas-upnp-org:device:ZonePlayer:1\r\n"
+                        "USN: uuid:" + p.uuid + "::urn:schemas-upnp-org:device:ZonePlayer:1\r\n\r\n";
+        deliver(h, p, r);
+      }
+    } else if (mdns && ip == mdnsServer() && port == mdnsPort()) {
+      mdnsSock = h;
+      for (auto& p : players) if (!p.satellite) deliver(h, p, mdnsAnswer(p));
+    }
+    return true;
+  }
+  int udpRecv(int h, uint8_t* buf, size_t cap, uint32_t& fromIp) override {
+    auto& q = udp[h];
+    auto it = std::min_element(q.begin(), q.end(),
+                               [](const Datagram& a, const Datagram& b) { return a.at < b.at; });
+    if (it == q.end() || it->at > now) return -1;
+    size_t n = std::min(cap, it->data.size());
+    memcpy(buf, it->data.data(), n);
+    fromIp = it->from;
+    q.erase(it);
+    if (h != mdnsSock) datagrams++;   // the mDNS query runs in its own task on the board
+    return (int)n;
+  }
+  void udpClose(int h) override { udp.erase(h); }
+
+  int tcpSocket() override {
+    tcp[nextH] = Conn{};
+    return nextH++;
+  }
+  int tcpConnect(int h, uint32_t ip, uint16_t port) override {
+    Player* p = find(ip);
+    if (!p || p->refuses || port != 1400) return 0;   // asleep or gone: never answers
+    tcp[h].p = p;
+    tcp[h].upAt = now + p->latency;
+    return 0;
+  }
+  int tcpConnected(int h) override {
+    const Conn& c = tcp[h];
+    return c.p && now >= c.upAt ? 1 : 0;
+  }
+  bool tcpSend(int h, const uint8_t* buf, size_t n) override {
+    Conn& c = tcp[h];
+    c.request.append((const char*)buf, n);
+    size_t end = c.request.find("\r\n\r\n");
+    if (c.start || end == std::string::npos) return true;
+    size_t len = 0;
+    size_t cl = c.request.find("Content-Length: ");
+    if (cl != std::string::npos) len = strtoul(c.request.c_str() + cl + 16, nullptr, 10);
+    if (c.request.size() < end + 4 + len) return true;
+    c.response = respond(*c.p, c.request);
+    c.start = now + c.p->latency;
+    return true;
+  }
+  int tcpAvailable(int h) override {
+    Conn& c = tcp[h];
+    if (!c.start || now < c.start) return 0;
+    size_t arrived = std::min(c.response.size(), (size_t)((now - c.start + 1) * c.p->rate));
+    return (int)(arrived - c.read);
+  }
+  int tcpRead(int h, uint8_t* buf, size_t n) override {
+    Conn& c = tcp[h];
+    n = std::min(n, (size_t)tcpAvailable(h));
+    memcpy(buf, c.response.data() + c.read, n);
+    c.read += n;
+    tcpBytes += n;
+    return (int)n;
+  }
+  bool tcpOpen(int h) override {
+    Conn& c = tcp[h];
+    return !c.start || c.read < c.response.size();
+  }
+  void tcpClose(int h) override { tcp.erase(h); }
+
+  // ssdp:alive from `p`, multicast to the listener.
+  void notify(const Player& p) {
+    std::string msg = "NOTIFY * HTTP/1.1\r\nHOST: 239.255.255.250:1900\r\nCACHE-CONTROL: max-age = 1800\r\n"
+                      "LOCATION: http://" + std::string(IPAddress(p.ip).toString().c_str()) +
+                      ":1400/xml/device_description.xml\r\n"
+                      "NT: urn:schemas-upnp-org:device:ZonePlayer:1\r\nNTS: ssdp:alive\r\n"
+                      "USN: uuid:" + p.uuid + "::urn:schemas-upnp-org:device:ZonePlayer:1\r\n\r\n";
+    deliver(listenSock, p, msg);
+  }
+
+  uint32_t mdnsServer() override { return mdns ? (uint32_t)IPAddress(224, 0, 0, 251) : 0; }
+
+private:
+  int nextH = 1;
+  std::map<int, std::vector<Datagram>> udp;
+  std::map<int, Conn> tcp;
+
+  void deliver(int h, const Player& p, const std::string& data) {
+    udp[h].push_back({now + p.latency, p.ip, data});
+  }
+
+  std::string mdnsAnswer(const Player& p) {
+    auto name = [](const std::string& dotted) {
+      std::string out;
+      size_t i = 0;
+      while (i < dotted.size()) {
+        size_t j = dotted.find('.', i);
+        if (j == std::string::npos) j = dotted.size();
+        out += (char)(j - i);
+        out += dotted.substr(i, j - i);
+        i = j + 1;
+      }
+      return out + '\0';
+    };
+    std::string host = "Sonos-" + p.uuid.substr(7, 12);
+    std::string ptr = name(host + "._sonos._tcp.local");
+    std::string pkt("\0\0\x84\0\0\0\0\x01\0\0\0\x01", 12);
+    pkt += name("_sonos._tcp.local") + std::string("\0\x0c\0\x01\0\0\0\x78\0", 9) + (char)ptr.size() + ptr;
+    uint32_t ip = p.ip;
+    pkt += name(host + ".local") + std::string("\0\x01\0\x01\0\0\0\x78\0\x04", 10) +
+           std::string((const char*)&ip, 4);
+    return pkt;
+  }
+
+  std::string respond(const Player& p, const std::string& req) {
+    if (req.compare(0, 4, "GET ") == 0 && req.find(" /xml/device_description.xml ") != std::string::npos) {
+      std::string body = "<?xml version=\"1.0\" encoding=\"utf-8\" ?><root xmlns=\"urn:schemas-upnp-org:device-1-0\">"
+                         "<device><deviceType>urn:schemas-upnp-org:device:ZonePlayer:1</deviceType>"
+                         "<roomName>" + xmlEscape(p.name) + "</roomName><UDN>uuid:" + p.uuid + "</UDN>" +
+                         (p.satellite ? "<internalSpeakerSize>-1</internalSpeakerSize>" : "") +
+                         "</device></root>";
+      return "HTTP/1.1 200 OK\r\nContent-Type: text/xml\r\nContent-Length: " + std::to_string(body.size()) +
+             "\r\nConnection: close\r\n\r\n" + body;
+    }
+    if (req.compare(0, 5, "POST ") == 0 && req.find(" /ZoneGroupTopology/Control ") != std::string::npos &&
+        !p.noTopology) {
+      std::string body = "<?xml version=\"1.0\"?><s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\">"
+                         "<s:Body><u:GetZoneGroupStateResponse xmlns:u=\"urn:schemas-upnp-org:service:ZoneGroupTopology:1\">"
+                         "<ZoneGroupState>" + xmlEscape(zoneGroupState(players)) +
+                         "</ZoneGroupState></u:GetZoneGroupStateResponse></s:Body></s:Envelope>";
+      return "HTTP/1.1 200 OK\r\nContent-Type: text/xml\r\nTransfer-Encoding: chunked\r\n\r\n" + chunked(body);
+    }
+    return "HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n";
+  }
+};
+
+static std::vector<Player> household(int count, int groupSize, int satelliteEvery) {
+  std::vector<Player> out;
+  for (int n = 0; n < count; n++) {
+    Player p;
+    p.ip = IPAddress(10, 0, n / 250, n % 250 + 1);
+    char uuid[32];
+    snprintf(uuid, sizeof(uuid), "RINCON_%012llX01400", 0x347E5C000000ull + n);
+    p.uuid = uuid;
+    p.satellite = satelliteEvery > 0 && n % satelliteEvery == satelliteEvery - 1;
+    char name[16];
+    snprintf(name, sizeof(name), "Room %03d", n);
+    p.name = p.satellite ? "" : name;
+    p.latency = 1 + n % 4;
+    out.push_back(p);
+  }
+  for (size_t i = 0; i < out.size(); i++) out[i].coordinator = out[i - i % groupSize].uuid;
+  return out;
+}
+
+// ── Driver ───────────────────────────────────────────────────────────────────
+struct Scenario {
+  const char* name;
+  std::vector<Player> players;
+  bool   mdns = false;
+  size_t expect;                 // speakers in the committed table
+  bool   coordinators;           // expect group coordinators (topology path)
+};
+
+static bool verbose = false;
+
+static bool run(FakeNet& net, const Scenario& sc) {
+  net.players = sc.players;
+  net.mdns = sc.mdns;
+  speakers.clear();
+  now = 1000;
+  unsigned long start = now;
+  std::vector<unsigned long> costs;
+  size_t maxBytes = 0, maxDatagrams = 0;
+  double maxCpuUs = 0;
+  std::vector<std::string> errors;
+
+  scanStart();
+  for (bool done = false; !done; ) {
+    unsigned long t0 = now;
+    net.tcpBytes = net.datagrams = 0;
+    auto c0 = std::chrono::steady_clock::now();
+    done = scanTick();
+    double cpu = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - c0).count();
+    unsigned long cost = now - t0;
+    costs.push_back(cost);
+    maxBytes = std::max(maxBytes, net.tcpBytes);
+    maxDatagrams = std::max(maxDatagrams, net.datagrams);
+    maxCpuUs = std::max(maxCpuUs, cpu);
+    if (verbose && cost) printf("  t=%6lu  tick %zu: %lu ms  %s\n", t0 - start, costs.size(), cost, scanMsg.c_str());
+    if (now - start > 120000) { errors.push_back("scan still running after 120 s"); break; }
+    delay(LOOP_PASS_MS);
+  }
+
+  std::vector<unsigned long> sorted = costs;
+  std::sort(sorted.begin(), sorted.end());
+  unsigned long maxCost = sorted.back(), p99 = sorted[sorted.size() * 99 / 100];
+  if (maxCost > TICK_LIMIT_MS)
+    errors.push_back("tick waited " + std::to_string(maxCost) + " ms > TICK_LIMIT_MS");
+  if (maxCpuUs > TICK_LIMIT_MS * 1000.0)
+    errors.push_back("tick ran " + std::to_string((long)maxCpuUs) + " us > TICK_LIMIT_MS");
+  if (maxBytes > LAN_POLL_BYTES)
+    errors.push_back("tick read " + std::to_string(maxBytes) + " B > LAN_POLL_BYTES");
+  if (maxDatagrams > (size_t)SCAN_PACKETS_PER_TICK)
+    errors.push_back("tick read " + std::to_string(maxDatagrams) + " datagrams");
+  if (speakers.size() != sc.expect)
+    errors.push_back("table has " + std::to_string(speakers.size()) + " speakers, expected " +
+                     std::to_string(sc.expect));
+  for (auto& s : speakers) {
+    IPAddress ip;
+    const Player* p = ip.fromString(s.ip) ? net.find(ip) : nullptr;
+    if (!p || s.uuid != p->uuid.c_str() || s.name != p->name.c_str() || p->satellite) {
+      errors.push_back(std::string("wrong entry ") + s.name.c_str() + " @ " + s.ip.c_str());
+      break;
+    }
+    if (sc.coordinators && s.coordinator != p->coordinator.c_str()) {
+      errors.push_back(std::string("wrong coordinator for ") + s.name.c_str());
+      break;
+    }
+  }
+
+  printf("%-14s %4zu found in %6lu ms, %5zu ticks: max %3lu ms (p99 %lu), "
+         "max %4zu B / %zu datagrams, max %.0f us CPU — %s\n",
+         sc.name, speakers.size(), now - start, costs.size(), maxCost, p99, maxBytes, maxDatagrams,
+         maxCpuUs, errors.empty() ? "ok" : "FAIL");
+  for (auto& e : errors) printf("    %s\n", e.c_str());
+  return errors.empty();
+}
+
+// A household the last scan saw, plus `joining` players that then announce
+// themselves; the last of them leaves again straight after. Only
+// ssdpListenTick() runs; it has to describe the newcomers (all but the
+// refusing one and the one that left) without any tick going over the
+// scan's limits.
+static bool runNotify(FakeNet& net, std::vector<Player> players, size_t joining) {
+  std::vector<Player> known(players.begin(), players.end() - joining);
+  net.players = known;
+  net.mdns = false;
+  speakers.clear();
+  now = 1000;
+  scanStart();
+  while (!scanTick()) delay(LOOP_PASS_MS);
+  std::vector<std::string> errors;
+  if (speakers.size() != known.size()) errors.push_back("scan found " + std::to_string(speakers.size()));
+
+  net.players = players;
+  size_t expect = speakers.size();
+  for (size_t i = players.size() - joining; i < players.size(); i++) {
+    net.notify(players[i]);
+    if (!players[i].refuses && i + 1 < players.size()) expect++;
+  }
+  net.players.pop_back();   // gone before anyone connects to it
+  unsigned long start = now, maxCost = 0;
+  size_t ticks = 0, maxBytes = 0, maxDatagrams = 0;
+  double maxCpuUs = 0;
+  do {
+    delay(LOOP_PASS_MS);
+    unsigned long t0 = now;
+    net.tcpBytes = net.datagrams = 0;
+    auto c0 = std::chrono::steady_clock::now();
+    ssdpListenTick();
+    double cpu = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - c0).count();
+    ticks++;
+    maxCpuUs = std::max(maxCpuUs, cpu);
+    maxCost = std::max(maxCost, now - t0);
+    maxBytes = std::max(maxBytes, net.tcpBytes);
+    maxDatagrams = std::max(maxDatagrams, net.datagrams);
+    if (now - start > 30000) { errors.push_back("joins still pending after 30 s"); break; }
+  } while (now - start < 10 || !pendingSpeakers.empty() || ssdpJoin.http.busy());
+
+  if (maxCost > TICK_LIMIT_MS)
+    errors.push_back("tick waited " + std::to_string(maxCost) + " ms > TICK_LIMIT_MS");
+  if (maxCpuUs > TICK_LIMIT_MS * 1000.0)
+    errors.push_back("tick ran " + std::to_string((long)maxCpuUs) + " us > TICK_LIMIT_MS");
+  if (maxBytes > LAN_POLL_BYTES)
+    errors.push_back("tick read " + std::to_string(maxBytes) + " B > LAN_POLL_BYTES");
+  if (maxDatagrams > (size_t)SSDP_PACKETS_PER_TICK)
+    errors.push_back("tick read " + std::to_string(maxDatagrams) + " datagrams");
+  if (speakers.size() != expect)
+    errors.push_back("table has " + std::to_string(speakers.size()) + " speakers, expected " +
+                     std::to_string(expect));
+  for (auto& s : speakers) {
+    IPAddress ip;
+    const Player* p = ip.fromString(s.ip) ? net.find(ip) : nullptr;
+    if (!p || s.uuid != p->uuid.c_str() || s.name != p->name.c_str()) {
+      errors.push_back(std::string("wrong entry ") + s.name.c_str() + " @ " + s.ip.c_str());
+      break;
+    }
+  }
+
+  printf("%-14s %4zu found in %6lu ms, %5zu ticks: max %3lu ms, max %4zu B / %zu datagrams, "
+         "max %.0f us CPU — %s\n",
+         "notify", speakers.size() - known.size(), now - start, ticks, maxCost, maxBytes, maxDatagrams,
+         maxCpuUs, errors.empty() ? "ok" : "FAIL");
+  for (auto& e : errors) printf("    %s\n", e.c_str());
+  return errors.empty();
+}
+
+int main(int argc, char** argv) {
+  verbose = argc > 1 && !strcmp(argv[1], "-v");
+  Serial.out = nullptr;   // dbg() lines
+  FakeNet net;
+  hostNet = &net;
+
+  std::vector<Scenario> scenarios;
+
+  auto big = household(200, 4, 10);
+  scenarios.push_back({"topology", big, false, 180, true});
+
+  auto slow = big;
+  for (auto& p : slow) p.rate = 20;   // the seed's 53 KB reply over 2.6 s
+  scenarios.push_back({"slow-seed", slow, false, 180, true});
+
+  scenarios.push_back({"mdns", household(12, 3, 0), true, 12, true});
+
+  auto fallback = household(24, 4, 0);
+  for (auto& p : fallback) p.noTopology = true;
+  for (int i : {3, 9, 15, 21}) fallback[i].refuses = true;
+  for (int i : {5, 11}) fallback[i].rate = 1;   // ~300 B description in ~0.3 s
+  scenarios.push_back({"fallback", fallback, false, 20, false});
+
+  bool ok = true;
+  for (auto& sc : scenarios) ok &= run(net, sc);
+
+  ssdpListenBegin();
+  auto joining = household(17, 4, 0);
+  joining[13].refuses = true;
+  joining[14].rate = 1;
+  ok &= runNotify(net, joining, 5);
+  ssdpListener.stop();   // before `net` goes out of scope
+  printf(ok ? "pass\n" : "FAIL\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+/api/status load generator — N dashboards polling one board.
+
+Each poller is a thread doing what the page's fallback poll does: GET
+/api/status?since=<v>, remember the "v" of every 200, take a 304 as "nothing
+changed". With --mode full the `since` is left off, which is what a plain
+`curl` or an old page does. --interval 0 polls back to back for peak
+throughput; the default of 1 s matches the page.
+
+Reported:
+  throughput   requests/s overall and per poller, bytes/s of body
+  mix          200 full / 200 delta / 304 / errors
+  latency      p50 / p90 / p99 / max, ms
+
+  ./status_load.py --host sonos-p4-grkit.local --pollers 50 --duration 30
+  ./status_load.py --host 192.168.1.57 --pollers 50 --interval 0 --mode full
+  ./status_load.py --mock --pollers 50 --interval 0   # check the generator itself
+
+--mock serves a canned status document on loopback whose version moves every
+--mock-change-ms, so the script can be exercised without a board. Numbers
+from it say nothing about the firmware.
+
+--min-rps turns it into a gate: exit status 1 below that throughput.
+"""
+import argparse
+import http.client
+import json
+import statistics
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+# ── mock board ───────────────────────────────────────────────────────────────
+
+def start_mock(change_ms):
+    """Loopback server that answers like the firmware: full, delta or 304."""
+    t0 = time.monotonic()
+    filler = "x" * 600
+
+    def version():
+        return 1000 + int((time.monotonic() - t0) * 1000 / change_ms)
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, *args):
+            pass
+
+        def do_GET(self):
+            v = version()
+            since = None
+            if "?since=" in self.path:
+                since = int(self.path.split("?since=", 1)[1] or 0)
+            if since == v:
+                self.send_response(304)
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+            if since == v - 1:
+                doc = {"v": v, "vol": 23, "elapsed": "0:01:%02d" % (v % 60)}
+            else:
+                doc = {"v": v, "vol": 23, "title": filler, "fwver": "mock"}
+            body = json.dumps(doc).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+    ThreadingHTTPServer.request_queue_size = 256   # the default 5 drops SYNs at 50 pollers
+    server = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    server.daemon_threads = True
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return "127.0.0.1", server.server_address[1]
+
+
+# ── pollers ──────────────────────────────────────────────────────────────────
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latency_ms = []
+        self.full = self.delta = self.not_modified = self.errors = 0
+        self.body_bytes = 0
+
+
+def poller(host, port, args, stop, stats):
+    v = 0
+    conn = None
+    while not stop.is_set():
+        started = time.monotonic()
+        path = "/api/status" if args.mode == "full" else "/api/status?since=%d" % v
+        try:
+            if conn is None:
+                conn = http.client.HTTPConnection(host, port, timeout=args.timeout)
+            conn.request("GET", path, headers={} if args.keepalive else {"Connection": "close"})
+            resp = conn.getresponse()
+            body = resp.read()
+            if not args.keepalive or resp.will_close:
+                conn.close()
+                conn = None
+        except (OSError, http.client.HTTPException):
+            if conn is not None:
+                conn.close()
+            conn = None
+            with stats.lock:
+                stats.errors += 1
+            time.sleep(0.2)
+            continue
+        elapsed = (time.monotonic() - started) * 1000
+        kind = "errors"
+        if resp.status == 304:
+            kind = "not_modified"
+        elif resp.status == 200:
+            try:
+                doc = json.loads(body)
+                # Every full document carries the device group; deltas
+                # almost never do.
+                kind = "full" if "fwver" in doc else "delta"
+                v = doc.get("v", v)
+            except ValueError:
+                kind = "errors"
+        with stats.lock:
+            stats.latency_ms.append(elapsed)
+            stats.body_bytes += len(body)
+            setattr(stats, kind, getattr(stats, kind) + 1)
+        if args.interval > 0:
+            stop.wait(max(0.0, args.interval - elapsed / 1000))
+    if conn is not None:
+        conn.close()
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("--host", help="board hostname or IP")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--pollers", type=int, default=50)
+    ap.add_argument("--duration", type=float, default=20.0, help="seconds")
+    ap.add_argument("--interval", type=float, default=1.0, help="seconds between polls per poller; 0 = flat out")
+    ap.add_argument("--mode", choices=["since", "full"], default="since")
+    ap.add_argument("--keepalive", action="store_true", help="reuse connections when the server allows")
+    ap.add_argument("--timeout", type=float, default=5.0)
+    ap.add_argument("--mock", action="store_true", help="poll a loopback stand-in instead of a board")
+    ap.add_argument("--mock-change-ms", type=int, default=1000)
+    ap.add_argument("--min-rps", type=float, help="exit 1 if throughput ends up below this")
+    ap.add_argument("--json", action="store_true")
+    args = ap.parse_args()
+
+    if args.mock:
+        host, port = start_mock(args.mock_change_ms)
+    elif args.host:
+        host, port = args.host, args.port
+    else:
+        ap.error("--host or --mock")
+
+    stats = Stats()
+    stop = threading.Event()
+    threads = [threading.Thread(target=poller, args=(host, port, args, stop, stats), daemon=True)
+               for _ in range(args.pollers)]
+    t0 = time.monotonic()
+    for t in threads:
+        t.start()
+    stop.wait(args.duration)
+    stop.set()
+    for t in threads:
+        t.join(args.timeout + 1)
+    wall = time.monotonic() - t0
+
+    ok = len(stats.latency_ms)
+    result = {
+        "pollers": args.pollers,
+        "mode": args.mode,
+        "seconds": round(wall, 2),
+        "requests": ok,
+        "rps": round(ok / wall, 1),
+        "rps_per_poller": round(ok / wall / args.pollers, 2),
+        "body_bytes_per_s": round(stats.body_bytes / wall),
+        "full": stats.full,
+        "delta": stats.delta,
+        "not_modified": stats.not_modified,
+        "errors": stats.errors,
+        "p50_ms": round(percentile(stats.latency_ms, 50), 1),
+        "p90_ms": round(percentile(stats.latency_ms, 90), 1),
+        "p99_ms": round(percentile(stats.latency_ms, 99), 1),
+        "max_ms": round(max(stats.latency_ms, default=0.0), 1),
+        "mean_ms": round(statistics.fmean(stats.latency_ms), 1) if ok else 0.0,
+    }
+    if args.json:
+        print(json.dumps(result))
+    else:
+        print("%d pollers, %s, %.1f s%s" % (args.pollers, args.mode, wall, " (mock)" if args.mock else ""))
+        print("  throughput  %8.1f req/s  (%.2f per poller)  %d B/s body"
+              % (result["rps"], result["rps_per_poller"], result["body_bytes_per_s"]))
+        print("  mix         %d full, %d delta, %d 304, %d errors"
+              % (stats.full, stats.delta, stats.not_modified, stats.errors))
+        print("  latency ms  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f"
+              % (result["p50_ms"], result["p90_ms"], result["p99_ms"], result["max_ms"]))
+    if args.min_rps is not None and result["rps"] < args.min_rps:
+        print("FAIL: %.1f req/s < %.1f" % (result["rps"], args.min_rps), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+
+// =============================================================================
+// CborWriter — fixed-buffer CBOR (RFC 8949) emitter, JsonWriter's binary twin.
+//
+// Used for the fleet report, where most of a JSON body is key names, quotes
+// and decimal digits. Here integers are one byte up to 23 and grow with their
+// value (the CBOR head is a length-prefixed varint), keys can be small
+// integers, and text goes out as length + raw UTF-8 with nothing to escape.
+//
+// Same rules as JsonWriter: the caller owns the buffer, there is no heap,
+// and overflow() says whether everything fitted — a truncated document is
+// never sent. Containers are either definite (the caller knows the count, as
+// for the events array) or indefinite (beginMap() with no count, closed by
+// end()) so optional members don't have to be counted up front.
+//
+//   uint8_t buf[128];
+//   CborWriter c(buf, sizeof(buf));
+//   c.beginMap().key(0).uint(1).key(1).text("tpsvc-grkit").end();
+// =============================================================================
+class CborWriter {
+public:
+  CborWriter(uint8_t* buf, size_t cap) : buf_(buf), cap_(cap) {}
+
+  CborWriter& uint(uint64_t v)       { head(0, v); return *this; }
+  CborWriter& sint(int64_t v)        { if (v < 0) head(1, (uint64_t)(-1 - v)); else head(0, (uint64_t)v); return *this; }
+  CborWriter& boolean(bool b)        { put(b ? 0xF5 : 0xF4); return *this; }
+  CborWriter& null()                 { put(0xF6); return *this; }
+  CborWriter& bytes(const uint8_t* p, size_t n) { head(2, n); write(p, n); return *this; }
+  CborWriter& text(const char* s, size_t n)     { head(3, n); write((const uint8_t*)s, n); return *this; }
+  CborWriter& text(const char* s)    { return s ? text(s, strlen(s)) : null(); }
+  CborWriter& text(const String& s)  { return text(s.c_str(), s.length()); }
+
+  CborWriter& beginArray(size_t n)   { head(4, n); return *this; }
+  CborWriter& beginMap(size_t n)     { head(5, n); return *this; }
+  CborWriter& beginArray()           { put(0x9F); return *this; }   // indefinite
+  CborWriter& beginMap()             { put(0xBF); return *this; }   // indefinite
+  CborWriter& end()                  { put(0xFF); return *this; }   // closes an indefinite one
+
+  // Integer map key; the value follows.
+  CborWriter& key(unsigned k)        { return uint(k); }
+
+  const uint8_t* data() const { return buf_; }
+  size_t length() const { return len_; }
+  bool   overflow() const { return overflow_; }
+  void   reset() { len_ = 0; overflow_ = false; }
+
+private:
+  uint8_t* buf_;
+  size_t   cap_;
+  size_t   len_ = 0;
+  bool     overflow_ = false;
+
+  void put(uint8_t b) {
+    if (len_ >= cap_) { overflow_ = true; return; }
+    buf_[len_++] = b;
+  }
+  void write(const uint8_t* p, size_t n) {
+    if (n > cap_ - len_) { overflow_ = true; len_ = cap_; return; }
+    memcpy(buf_ + len_, p, n);
+    len_ += n;
+  }
+  // Major type in the top 3 bits; the argument inline below 24, else in the
+  // smallest of 1/2/4/8 following big-endian bytes.
+  void head(uint8_t major, uint64_t v) {
+    major <<= 5;
+    if (v < 24)              { put(major | (uint8_t)v); return; }
+    uint8_t n = v <= 0xFF ? 1 : v <= 0xFFFF ? 2 : v <= 0xFFFFFFFFull ? 4 : 8;
+    put(major | (uint8_t)(n == 1 ? 24 : n == 2 ? 25 : n == 4 ? 26 : 27));
+    while (n--) put((uint8_t)(v >> (8 * n)));
+  }
+};
@@ -79,6 +79,11 @@ constexpr unsigned long T_UPDATE_JITTER   = 30UL * 1000UL;         // ±30s
 constexpr char FLEET_HUB_URL[] =
   "https://sonos-fleet-hub.davidvivesprice.workers.dev/report";
 
+// Reports go out as compact CBOR (see fleet.h). Set false to POST the
+// readable JSON form instead, e.g. to watch them in `wrangler tail` — the
+// hub accepts both.
+constexpr bool FLEET_REPORT_CBOR = true;
+
 // Shared secret comes from config_secrets.h (gitignored). If the file isn't
 // present at build time the secret stays empty and reporting is skipped — the
 // firmware still works, it just doesn't phone home. release.sh writes the
@@ -1,62 +1,418 @@
 #pragma once
 #include <ESPmDNS.h>
+#include <mdns.h>
 #include <NetworkUdp.h>
-#include <HTTPClient.h>
 #include "config.h"
+#include "lan_http.h"
 #include "speaker.h"
+#include "topology.h"
 
 // Scan state (read by web UI)
 static bool   scanActive = false;
 static String scanMsg    = "";
 static bool   scanRequested = false;  // async trigger from web API
+static uint32_t speakersVersion = 0;  // bumped on any change to `speakers`
 
-static bool hasSpeakerIP(const String& ip) {
-  for (auto& s : speakers) if (s.ip == ip) return true;
+static const IPAddress SSDP_GROUP(239, 255, 255, 250);
+constexpr uint16_t SSDP_PORT = 1900;
+
+// Lookups default to the live table; an active scan passes its staging table.
+static bool hasSpeakerIP(const String& ip,
+                         const std::vector<SpeakerInfo>& table = speakers) {
+  for (auto& s : table) if (s.ip == ip) return true;
   return false;
 }
 
-static String fetchRoomName(const String& ip) {
-  HTTPClient http;
-  http.setTimeout(2000);
-  http.begin("http://" + ip + ":1400/xml/device_description.xml");
-  String name;
-  if (http.GET() == HTTP_CODE_OK) {
-    String xml = http.getString();
-    name = SonosController::tag(xml, "roomName");
-    String sz = SonosController::tag(xml, "internalSpeakerSize");
-    if (sz.length() > 0 && sz.toInt() < 0) name = "";
-  }
-  http.end();
-  return name;
+static int findSpeakerByUuid(const String& uuid,
+                             const std::vector<SpeakerInfo>& table = speakers) {
+  if (uuid.length() == 0) return -1;
+  for (size_t i = 0; i < table.size(); i++)
+    if (table[i].uuid == uuid) return (int)i;
+  return -1;
+}
+
+// One HTTP fetch of the device description gives us both the room name and
+// the RINCON UUID (<UDN>uuid:RINCON_...</UDN>). Returns false for invisible
+// satellites (subs / surrounds report a negative internalSpeakerSize).
+static bool parseDeviceInfo(const String& xml, String& name, String& uuid) {
+  name = SonosController::tag(xml, "roomName");
+  uuid = SonosController::tag(xml, "UDN");
+  if (uuid.startsWith("uuid:")) uuid = uuid.substring(5);
+  String sz = SonosController::tag(xml, "internalSpeakerSize");
+  return !(sz.length() > 0 && sz.toInt() < 0);
 }
 
-static void addSpeaker(const String& ip, const String& fallbackName = "") {
-  if (hasSpeakerIP(ip)) return;
-  scanMsg = "getting name for " + ip;
-  String name = fetchRoomName(ip);
+// Add a player whose description came back as `name` / `uuid` (both "" if
+// the fetch failed); the fallbacks are what the caller knew beforehand.
+static void stageSpeaker(std::vector<SpeakerInfo>& table, const String& ip,
+                         String name, String uuid,
+                         const String& fallbackName, const String& knownUuid) {
+  if (uuid.length() == 0) uuid = knownUuid;
   if (name.length() == 0) name = fallbackName;
   if (name.length() == 0) return;
+  // mDNS and SSDP can both report the same player before we knew its UUID.
+  if (findSpeakerByUuid(uuid, table) >= 0) return;
 
-  speakers.push_back({ip, name});
-  dbg("found: %s @ %s", name.c_str(), ip.c_str());
+  table.push_back({ip, name, uuid, ""});
+  if (&table == &speakers) speakersVersion++;
+  uuidIndexPut(uuid, ip);
+  dbg("found: %s @ %s (%s)", name.c_str(), ip.c_str(), uuid.c_str());
 }
 
-static bool discoverViaMdns() {
-  scanMsg = "mDNS query...";
-  int n = MDNS.queryService("sonos", "tcp");
-  if (n <= 0) return false;
+// ── Device description, a slice per tick ──────────────────────────────────
+// GET /xml/device_description.xml through LanHttp — for the scan's fallback
+// and for players that announce themselves between scans. The document is a
+// few KB; it's kept whole (up to DEVICE_DESC_MAX) and the tags picked out
+// once it's in.
+static constexpr size_t DEVICE_DESC_MAX = 8192;
 
-  dbg("mDNS: %d service(s)", n);
-  for (int i = 0; i < n; i++)
-    addSpeaker(MDNS.address(i).toString(), MDNS.hostname(i));
+class TextSink : public Print {
+public:
+  String text;
+  size_t cap = 0;
+  size_t write(uint8_t c) override {
+    if (text.length() < cap) text += (char)c;
+    return 1;
+  }
+  using Print::write;
+};
 
-  return !speakers.empty();
+struct DeviceInfoFetch {
+  LanHttp  http;
+  TextSink body;
+  String   ip, knownUuid, fallbackName;
+
+  bool begin(const String& ip_, const String& uuid_, const String& name_) {
+    ip = ip_;
+    knownUuid = uuid_;
+    fallbackName = name_;
+    body.text = "";
+    body.cap = DEVICE_DESC_MAX;
+    return http.begin(ip, 1400, "GET", "/xml/device_description.xml", nullptr, nullptr,
+                      body, 2000);
+  }
+
+  LanHttp::Result poll() { return http.poll(); }
+
+  // Once poll() is no longer PENDING (or begin() failed): stage the player.
+  void finish(LanHttp::Result r, std::vector<SpeakerInfo>& table) {
+    String name, uuid;
+    if (r != LanHttp::DONE || http.status() != 200 || !parseDeviceInfo(body.text, name, uuid))
+      name = "";
+    body.text = "";
+    stageSpeaker(table, ip, name, uuid, fallbackName, knownUuid);
+  }
+};
+
+// Drop a table entry, keeping spk.idx pointing at the same speaker.
+static void removeSpeakerAt(int i) {
+  speakers.erase(speakers.begin() + i);
+  speakersVersion++;
+  if (spk.idx == i)     spk.idx = -1;
+  else if (spk.idx > i) spk.idx--;
+}
+
+// ── SSDP message parsing ──────────────────────────────────────────────────
+// Case-insensitive header lookup in a raw SSDP datagram. Copies the trimmed
+// value into `out`; returns false if the header is absent.
+static bool ssdpHeader(const char* msg, const char* name, char* out, size_t outLen) {
+  size_t nlen = strlen(name);
+  for (const char* line = msg; line && *line; ) {
+    if (strncasecmp(line, name, nlen) == 0 && line[nlen] == ':') {
+      const char* v = line + nlen + 1;
+      while (*v == ' ' || *v == '\t') v++;
+      size_t n = 0;
+      while (v[n] && v[n] != '\r' && v[n] != '\n' && n < outLen - 1) n++;
+      memcpy(out, v, n);
+      out[n] = '\0';
+      return true;
+    }
+    line = strchr(line, '\n');
+    if (line) line++;
+  }
+  return false;
+}
+
+// "uuid:RINCON_000E58A1B2C301400::urn:schemas-upnp-org:device:ZonePlayer:1"
+//   → "RINCON_000E58A1B2C301400"
+static String ssdpUuid(const char* usn) {
+  if (strncasecmp(usn, "uuid:", 5) == 0) usn += 5;
+  const char* end = strchr(usn, ':');
+  return end ? String(usn).substring(0, end - usn) : String(usn);
+}
+
+// ── Passive NOTIFY listener ───────────────────────────────────────────────
+// ZonePlayers multicast `ssdp:alive` when they boot, change IP or refresh
+// their cache-control lease, and `ssdp:byebye` when they leave. Listening
+// for those lets the table track the household between scans — no M-SEARCH
+// traffic, and a DHCP move shows up within seconds instead of at the next
+// T_REDISCOVER. Everything is keyed by RINCON UUID so repeated alives (one
+// per advertised device/service type) collapse into a single entry.
+static NetworkUDP ssdpListener;
+static bool       ssdpListening = false;
+
+// New players still need a device-description fetch for their room name.
+// Queue them and describe one at a time through LanHttp, a slice per tick
+// like the scan's FETCH phase, so neither a burst of alives (whole-house
+// power cut coming back) nor one slow player can stall loop().
+struct PendingSpeaker { String ip; String uuid; };
+static std::vector<PendingSpeaker> pendingSpeakers;
+static DeviceInfoFetch ssdpJoin;   // the pending player being described
+static constexpr size_t SSDP_PENDING_MAX = 8;
+static constexpr int    SSDP_PACKETS_PER_TICK = 4;
+
+static void ssdpListenBegin() {
+  if (ssdpListening) return;
+  ssdpListening = ssdpListener.beginMulticast(SSDP_GROUP, SSDP_PORT);
+  if (ssdpListening) logEvent("ssdp: listening for NOTIFY");
+  else               logEvent("ssdp: multicast join failed");
+}
+
+// Any sighting of a UUID at an address. Updates the index and the live
+// table, and re-binds the selected speaker the moment it shows up elsewhere.
+static void noteSpeakerLocation(const String& uuid, const String& ip) {
+  uuidIndexPut(uuid, ip);
+  int i = findSpeakerByUuid(uuid);
+  if (i >= 0 && speakers[i].ip != ip) {
+    dbg("ssdp: %s now @ %s", speakers[i].name.c_str(), ip.c_str());
+    speakers[i].ip = ip;
+    speakersVersion++;
+  }
+  if (uuid != spk.uuid) return;
+  if (ip != spk.ip) rebindSpeaker(ip);
+  else spk.online = true;  // announced at the same address — it's back
+}
+
+static void ssdpHandleAlive(const String& uuid, const String& ip) {
+  noteSpeakerLocation(uuid, ip);
+  if (findSpeakerByUuid(uuid) >= 0) return;
+  for (auto& p : pendingSpeakers) if (p.uuid == uuid) { p.ip = ip; return; }
+  if (pendingSpeakers.size() < SSDP_PENDING_MAX) pendingSpeakers.push_back({ip, uuid});
+}
+
+static void ssdpHandleByebye(const String& uuid) {
+  int i = findSpeakerByUuid(uuid);
+  if (i < 0) return;
+  logEvent("ssdp: %s left", speakers[i].name.c_str());
+  removeSpeakerAt(i);
+}
+
+// Address carried by an SSDP message: its LOCATION host, else the sender.
+static String ssdpSourceIP(const char* msg, const IPAddress& from) {
+  char loc[128];
+  String ip = ssdpHeader(msg, "LOCATION", loc, sizeof(loc)) ? urlHost(loc) : "";
+  return ip.length() ? ip : from.toString();
+}
+
+static void ssdpHandlePacket(const char* msg, const IPAddress& from) {
+  char usn[128];
+  // Unicast reply to one of our targeted probes (see ssdpProbeUuid).
+  if (strncmp(msg, "HTTP/1.1 200", 12) == 0) {
+    if (!ssdpHeader(msg, "USN", usn, sizeof(usn))) return;
+    String uuid = ssdpUuid(usn);
+    if (uuid.startsWith("RINCON_")) noteSpeakerLocation(uuid, ssdpSourceIP(msg, from));
+    return;
+  }
+  if (strncmp(msg, "NOTIFY", 6) != 0) return;  // ignore other controllers' M-SEARCHes
+  char nt[96], nts[32];
+  if (!ssdpHeader(msg, "NT", nt, sizeof(nt)) || !strstr(nt, "ZonePlayer")) return;
+  if (!ssdpHeader(msg, "NTS", nts, sizeof(nts))) return;
+  if (!ssdpHeader(msg, "USN", usn, sizeof(usn))) return;
+  String uuid = ssdpUuid(usn);
+  if (!uuid.startsWith("RINCON_")) return;
+
+  if (strcasecmp(nts, "ssdp:byebye") == 0) {
+    ssdpHandleByebye(uuid);
+  } else if (strcasecmp(nts, "ssdp:alive") == 0) {
+    ssdpHandleAlive(uuid, ssdpSourceIP(msg, from));
+  }
 }
 
-static bool discoverViaSsdp() {
+// Ask one specific player where it is. Sent from the listener socket so the
+// unicast reply lands in ssdpListenTick() → noteSpeakerLocation(), which
+// re-binds the selected speaker one round-trip later.
+static void ssdpProbeUuid(const String& uuid) {
+  if (!ssdpListening || uuid.length() == 0) return;
+  char msearch[200];
+  int n = snprintf(msearch, sizeof(msearch),
+    "M-SEARCH * HTTP/1.1\r\n"
+    "HOST: 239.255.255.250:1900\r\n"
+    "MAN: \"ssdp:discover\"\r\n"
+    "MX: 1\r\n"
+    "ST: uuid:%s\r\n\r\n", uuid.c_str());
+  ssdpListener.beginPacket(SSDP_GROUP, SSDP_PORT);
+  ssdpListener.write((const uint8_t*)msearch, n);
+  ssdpListener.endPacket();
+  dbg("ssdp: probing %s", uuid.c_str());
+}
+
+// Connect-failure recovery for the selected speaker: re-bind straight away
+// if the index already has a newer address, otherwise probe for its UUID.
+static bool recoverSpeaker() {
+  if (reResolveSpeaker()) return true;
+  ssdpProbeUuid(spk.uuid);
+  return false;
+}
+
+static void ssdpJoinDone(LanHttp::Result r) {
+  size_t before = speakers.size();
+  ssdpJoin.finish(r, speakers);
+  if (speakers.size() > before) logEvent("ssdp: joined %s @ %s",
+    speakers.back().name.c_str(), ssdpJoin.ip.c_str());
+}
+
+// Call from loop(). Bounded like a scan tick: a few datagrams, plus one
+// LanHttp step for the pending player at the head of the queue. A player
+// that announced itself and then dropped off costs polls until
+// LAN_CONNECT_MS runs out, never a wait.
+static void ssdpListenTick() {
+  if (!ssdpListening || scanActive) return;
+  for (int n = 0; n < SSDP_PACKETS_PER_TICK && ssdpListener.parsePacket() > 0; n++) {
+    char buf[768];
+    int len = ssdpListener.read((uint8_t*)buf, sizeof(buf) - 1);
+    if (len <= 0) continue;
+    buf[len] = '\0';
+    ssdpHandlePacket(buf, ssdpListener.remoteIP());
+  }
+  if (ssdpJoin.http.busy()) {
+    LanHttp::Result r = ssdpJoin.poll();
+    if (r != LanHttp::PENDING) ssdpJoinDone(r);
+    return;
+  }
+  if (!pendingSpeakers.empty()) {
+    PendingSpeaker p = pendingSpeakers.front();
+    pendingSpeakers.erase(pendingSpeakers.begin());
+    if (findSpeakerByUuid(p.uuid) >= 0 || hasSpeakerIP(p.ip)) return;  // a scan got there first
+    if (!ssdpJoin.begin(p.ip, p.uuid, "")) ssdpJoinDone(LanHttp::FAILED);
+  }
+}
+
+// ── Active discovery ──────────────────────────────────────────────────────
+// Active scans only need to find one ZonePlayer (the "seed"); its
+// ZoneGroupState fills the whole table, groups included. Per-speaker
+// device descriptions remain as the fallback if the topology call fails.
+static bool stageTopology(std::vector<ZoneMember>& members,
+                          std::vector<SpeakerInfo>& table) {
+  for (auto& m : members) {
+    uuidIndexPut(m.uuid, m.ip);  // satellites too — cheap, and they can move
+    if (m.invisible || m.name.length() == 0) continue;
+    if (findSpeakerByUuid(m.uuid, table) >= 0) continue;
+    table.push_back({m.ip, m.name, m.uuid, m.coordinator});
+    dbg("found: %s @ %s (%s)", m.name.c_str(), m.ip.c_str(), m.uuid.c_str());
+  }
+  dbg("topology: %d member(s), %d visible", members.size(), table.size());
+  return !table.empty();
+}
+
+// =============================================================================
+// Scan state machine — advanced one step per loop() pass by scanTick().
+//
+//   MDNS    async _sonos._tcp query, polled without blocking
+//   SEND    (mDNS found nothing) M-SEARCH broadcast + multicast
+//   LISTEN  drain a few SSDP replies per tick until the window closes
+//   FETCH   topology on the seed, else one device_description per
+//           candidate — each a LanHttp request, read a slice per tick
+//   COMMIT  swap the staged table in, report how many were found
+//
+// Each tick does at most SCAN_PACKETS_PER_TICK datagram reads and one
+// LanHttp step — start a connect, check on it, or read ≤ LAN_POLL_BYTES
+// already received — none of which waits, so the knob, OTA and web server
+// keep running throughout — bench/scan_tick.cpp checks that against a virtual
+// clock. The live `speakers` table stays intact (and selectable) until COMMIT.
+// =============================================================================
+enum ScanPhase : uint8_t {
+  SCAN_IDLE = 0,
+  SCAN_MDNS,
+  SCAN_SEND,
+  SCAN_LISTEN,
+  SCAN_FETCH,
+  SCAN_COMMIT,
+};
+
+struct ScanCandidate { String ip; String uuid; String name; };
+
+struct ScanJob {
+  ScanPhase     phase = SCAN_IDLE;
+  unsigned long phaseStart = 0;
+  unsigned long startedMs = 0;         // for the duration/heap line at COMMIT
+  uint32_t      heapAtStart = 0;
+  mdns_search_once_t* mdns = nullptr;
+  NetworkUDP    udp;
+  bool          udpOpen = false;
+  bool          seedTried = false;     // topology attempted on candidates[0]
+  size_t        nextCandidate = 0;     // fallback fetch cursor
+  ZoneGroupFetch  topo;                // in flight while topo.http.busy()
+  DeviceInfoFetch desc;                // likewise, one candidate at a time
+  std::vector<ScanCandidate> candidates;
+  std::vector<SpeakerInfo>   staged;
+};
+static ScanJob scan;
+
+static constexpr unsigned long SCAN_MDNS_TIMEOUT   = 2000;
+static constexpr unsigned long SCAN_SSDP_WINDOW    = 3000;
+static constexpr int           SCAN_PACKETS_PER_TICK = 4;
+static constexpr size_t        SCAN_CANDIDATES_MAX = 32;
+
+// Rough heap held by a speaker table: vector storage plus any String that
+// outgrew the inline (SSO) buffer.
+static size_t speakerTableBytes(const std::vector<SpeakerInfo>& table) {
+  size_t bytes = table.capacity() * sizeof(SpeakerInfo);
+  for (auto& s : table)
+    for (const String* f : {&s.ip, &s.name, &s.uuid, &s.coordinator})
+      if (f->length() > 11) bytes += f->length() + 1;
+  return bytes;
+}
+
+static void scanEnter(ScanPhase p) {
+  scan.phase = p;
+  scan.phaseStart = millis();
+}
+
+static void scanAddCandidate(const String& ip, const String& uuid, const String& name) {
+  for (auto& c : scan.candidates) if (c.ip == ip) return;
+  if (scan.candidates.size() < SCAN_CANDIDATES_MAX) scan.candidates.push_back({ip, uuid, name});
+}
+
+// Kick off a scan. No-op if one is already running.
+static void scanStart() {
+  if (scan.phase != SCAN_IDLE) return;
+  scan.candidates.clear();
+  scan.staged.clear();
+  scan.seedTried = false;
+  scan.nextCandidate = 0;
+  scanActive = true;
+  scan.startedMs = millis();
+  scan.heapAtStart = ESP.getFreeHeap();
+  scanMsg = "mDNS query...";
+  scan.mdns = mdns_query_async_new(NULL, "_sonos", "_tcp", MDNS_TYPE_PTR,
+                                   SCAN_MDNS_TIMEOUT, SCAN_CANDIDATES_MAX, NULL);
+  scanEnter(scan.mdns ? SCAN_MDNS : SCAN_SEND);
+}
+
+static void scanStepMdns() {
+  mdns_result_t* results = nullptr;
+  uint8_t n = 0;
+  if (!mdns_query_async_get_results(scan.mdns, 0, &results, &n)) return;  // still running
+  for (mdns_result_t* r = results; r; r = r->next) {
+    for (mdns_ip_addr_t* a = r->addr; a; a = a->next) {
+      if (a->addr.type != ESP_IPADDR_TYPE_V4) continue;
+      scanAddCandidate(IPAddress(a->addr.u_addr.ip4.addr).toString(), "",
+                       r->hostname ? String(r->hostname) : String(""));
+      break;
+    }
+  }
+  mdns_query_results_free(results);
+  mdns_query_async_delete(scan.mdns);
+  scan.mdns = nullptr;
+  dbg("mDNS: %d service(s)", scan.candidates.size());
+  // Only run SSDP if mDNS found nothing
+  scanEnter(scan.candidates.empty() ? SCAN_SEND : SCAN_FETCH);
+}
+
+static void scanStepSend() {
   scanMsg = "SSDP broadcast...";
-  NetworkUDP udp;
-  if (!udp.begin(1901)) return false;
+  scan.udpOpen = scan.udp.begin(1901);
+  if (!scan.udpOpen) { scanEnter(SCAN_COMMIT); return; }
 
   static const char msearch[] =
     "M-SEARCH * HTTP/1.1\r\n"
@@ -66,39 +422,113 @@ static bool discoverViaSsdp() {
     "ST: urn:schemas-upnp-org:device:ZonePlayer:1\r\n\r\n";
 
   // Broadcast + multicast for W5500 reliability
-  for (auto& addr : {IPAddress(255,255,255,255), IPAddress(239,255,255,250)}) {
-    udp.beginPacket(addr, 1900);
-    udp.write((const uint8_t*)msearch, strlen(msearch));
-    udp.endPacket();
-  }
-
-  unsigned long t = millis();
-  while (millis() - t < 3000) {
-    if (udp.parsePacket() > 0) {
-      char buf[512];
-      int len = udp.read((uint8_t*)buf, sizeof(buf) - 1);
-      buf[len] = '\0';
-      if (strstr(buf, "ZonePlayer"))
-        addSpeaker(udp.remoteIP().toString());
-    }
-    delay(10);
+  for (auto& addr : {IPAddress(255,255,255,255), SSDP_GROUP}) {
+    scan.udp.beginPacket(addr, SSDP_PORT);
+    scan.udp.write((const uint8_t*)msearch, strlen(msearch));
+    scan.udp.endPacket();
   }
-  udp.stop();
-  return !speakers.empty();
+  scanEnter(SCAN_LISTEN);
 }
 
-static bool discoverSpeakers() {
-  speakers.clear();
-  scanActive = true;
-  scanMsg = "starting...";
+static void scanCloseUdp() {
+  if (!scan.udpOpen) return;
+  scan.udp.stop();
+  scan.udpOpen = false;
+}
+
+static void scanStepListen() {
+  for (int n = 0; n < SCAN_PACKETS_PER_TICK && scan.udp.parsePacket() > 0; n++) {
+    char buf[512];
+    int len = scan.udp.read((uint8_t*)buf, sizeof(buf) - 1);
+    if (len <= 0) continue;
+    buf[len] = '\0';
+    if (!strstr(buf, "ZonePlayer")) continue;
+    char usn[128];
+    String uuid = ssdpHeader(buf, "USN", usn, sizeof(usn)) ? ssdpUuid(usn) : "";
+    String ip = scan.udp.remoteIP().toString();
+    uuidIndexPut(uuid, ip);
+    scanAddCandidate(ip, uuid, "");
+  }
+  bool windowOver = millis() - scan.phaseStart >= SCAN_SSDP_WINDOW;
+  // First responder seeds the topology — no need to sit out the window.
+  // If that seed fails we come back here for the rest of it.
+  if (!scan.seedTried && !scan.candidates.empty()) { scan.phase = SCAN_FETCH; return; }
+  if (windowOver) { scanCloseUdp(); scanEnter(SCAN_FETCH); }
+}
 
-  bool found = discoverViaMdns();
+static void scanTopologyDone(LanHttp::Result r) {
+  std::vector<ZoneMember> members;
+  if (r == LanHttp::DONE && scan.topo.take(members) && stageTopology(members, scan.staged)) {
+    scanCloseUdp();
+    scanEnter(SCAN_COMMIT);
+    return;
+  }
+  dbg("topology: GetZoneGroupState failed on %s", scan.candidates[0].ip.c_str());
+  // Seed didn't answer GetZoneGroupState. Finish the SSDP window if one
+  // is open, then fall back to per-speaker fetches.
+  if (scan.udpOpen) scan.phase = SCAN_LISTEN;
+}
 
-  // Only run SSDP if mDNS found nothing
-  if (!found) found = discoverViaSsdp();
+static void scanStepFetch() {
+  if (scan.topo.http.busy()) {
+    LanHttp::Result r = scan.topo.poll();
+    if (r != LanHttp::PENDING) scanTopologyDone(r);
+    return;
+  }
+  if (scan.desc.http.busy()) {
+    LanHttp::Result r = scan.desc.poll();
+    if (r != LanHttp::PENDING) scan.desc.finish(r, scan.staged);
+    return;
+  }
+  if (!scan.seedTried && !scan.candidates.empty()) {
+    scan.seedTried = true;
+    scanMsg = "household topology via " + scan.candidates[0].ip;
+    if (!scan.topo.begin(scan.candidates[0].ip)) scanTopologyDone(LanHttp::FAILED);
+    return;
+  }
+  if (scan.nextCandidate < scan.candidates.size()) {
+    const ScanCandidate& c = scan.candidates[scan.nextCandidate++];
+    if (findSpeakerByUuid(c.uuid, scan.staged) >= 0 || hasSpeakerIP(c.ip, scan.staged)) return;
+    scanMsg = "getting name for " + c.ip;
+    if (!scan.desc.begin(c.ip, c.uuid, c.name)) scan.desc.finish(LanHttp::FAILED, scan.staged);
+    return;
+  }
+  scanEnter(SCAN_COMMIT);
+}
 
+static void scanStepCommit() {
+  speakers.swap(scan.staged);
+  speakersVersion++;
+  scan.staged.clear();
+  scan.candidates.clear();
+  spk.idx = -1;  // caller re-resolves via restoreSpeaker()
   scanActive = false;
   scanMsg = String(speakers.size()) + " speaker(s) found";
-  dbg("discovery: %d speakers", speakers.size());
-  return found;
+  // Same figures bench/household_sim.py reports, so a board on a real
+  // household can be compared against the simulated one.
+  logEvent("discovery: %d speaker(s) in %lu ms, table ~%u B, heap %+d B",
+           speakers.size(), millis() - scan.startedMs, speakerTableBytes(speakers),
+           (int)scan.heapAtStart - (int)ESP.getFreeHeap());
+  scanEnter(SCAN_IDLE);
+}
+
+// Advance the active scan by one bounded step. Returns true on the tick the
+// scan completes (table committed) so the caller can re-resolve its speaker.
+static bool scanTick() {
+  switch (scan.phase) {
+    case SCAN_IDLE:   return false;
+    case SCAN_MDNS:   scanStepMdns();   return false;
+    case SCAN_SEND:   scanStepSend();   return false;
+    case SCAN_LISTEN: scanStepListen(); return false;
+    case SCAN_FETCH:  scanStepFetch();  return false;
+    case SCAN_COMMIT: scanStepCommit(); return true;
+  }
+  return false;
+}
+
+// Blocking wrapper for setup(), where nothing else needs servicing yet.
+static bool discoverSpeakers() {
+  scanStart();
+  while (!scanTick()) delay(10);
+  return !speakers.empty();
 }
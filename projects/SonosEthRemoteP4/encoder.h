@@ -3,10 +3,12 @@
 #include "speaker.h"
 #include "actions.h"
 #include "modes.h"
+#include "fleet_report.h"
 #include "Adafruit_seesaw.h"
 #include <Preferences.h>
 
 void logEvent(const char* fmt, ...);  // defined in webui.h
+void logHot(const char* fmt, ...);    // defined in webui.h
 
 // Seesaw module is owned by the sketch (SonosEthRemoteP4.ino) and shared here.
 extern Adafruit_seesaw ss;
@@ -87,37 +89,14 @@ unsigned long lastFiredMs     = 0;
 
 // Per-board ring buffer of recent gestures so the fleet hub can show a "pulse"
 // — every click / multi-click / hold from every board in one unified feed.
-// Drained on each fleetReport call. Capped — heavy usage in a 5-min window
-// past this size drops the oldest entries.
-struct FleetEvent {
-  unsigned long ms;       // board millis() at event time
-  char          gid[8];   // "1c", "2c+h", "hold", "lh", etc.
-  bool          ok;       // did the mapped action succeed?
-};
-static constexpr uint8_t FLEET_EVT_MAX = 24;
-static FleetEvent fleetEvents[FLEET_EVT_MAX];
-static uint8_t    fleetEvtCount = 0;
+// fleet.h drops events only once the hub acknowledges their sequence
+// numbers; see FleetEventRing in fleet_report.h.
+static FleetEventRing fleetEvents;
 
 inline void fleetLogGesture(const char* gid, bool ok) {
-  if (fleetEvtCount < FLEET_EVT_MAX) {
-    FleetEvent& e = fleetEvents[fleetEvtCount++];
-    e.ms = millis();
-    strncpy(e.gid, gid, sizeof(e.gid) - 1);
-    e.gid[sizeof(e.gid) - 1] = 0;
-    e.ok = ok;
-  } else {
-    // Drop oldest by shifting one down. Cheap at 24 entries.
-    for (uint8_t i = 0; i < FLEET_EVT_MAX - 1; i++) fleetEvents[i] = fleetEvents[i + 1];
-    FleetEvent& e = fleetEvents[FLEET_EVT_MAX - 1];
-    e.ms = millis();
-    strncpy(e.gid, gid, sizeof(e.gid) - 1);
-    e.gid[sizeof(e.gid) - 1] = 0;
-    e.ok = ok;
-  }
+  fleetEvents.log(gid, ok, millis());
 }
 
-inline void fleetEventsClear() { fleetEvtCount = 0; }
-
 // Rotation activity — coarse for the pulse: total count + when last detent
 // happened. The dashboard converts the timestamp into "Xs ago".
 volatile unsigned long lastRotationMs = 0;
@@ -169,6 +148,12 @@ static void processEncoder() {
       rotBurstDelta += detents;
     }
   }
+
+  // Everything below touches speaker/board state. If a web request holds the
+  // state lock (speaker.h), keep `pending` and send it on a later pass.
+  StateLock lock(0);
+  if (!lock) return;
+
   // Flush idle burst into pulse buffer.
   fleetMaybeFlushRotBurst();
 
@@ -191,25 +176,22 @@ static void processEncoder() {
 
   int beforeVal = currentModeValue();
   int afterVal  = applyRotation(delta);
-  logEvent("rot %s %d -> %d", modeName(currentMode), beforeVal, afterVal);
+  logHot("rot %s %d -> %d", modeName(currentMode), beforeVal, afterVal);
 }
 
 // =============================================================================
 // Helper: fire a gesture by id (clicks-then-hold = "Nc+h", clicks alone = "Nc",
 // standalone hold = "hold", standalone long hold = "lh").
+//
+// A gesture that fires while a web request holds the state lock waits in
+// gestureQueue and runs, in order, on the first pass the lock is free. Four
+// is more gestures than anyone gets in during one SOAP call.
 // =============================================================================
-static void fireGesture(uint8_t clicks, bool withHold, bool longHold) {
-  char gid[8];
-  if (longHold && clicks == 0) {
-    strcpy(gid, "lh");
-  } else if (withHold && clicks == 0) {
-    strcpy(gid, "hold");
-  } else if (withHold && clicks > 0) {
-    snprintf(gid, sizeof(gid), "%uc+h", clicks);
-  } else {
-    snprintf(gid, sizeof(gid), "%uc", clicks);
-  }
+static constexpr uint8_t GESTURE_QUEUE = 4;
+static char    gestureQueue[GESTURE_QUEUE][8];
+static uint8_t gestureQueued = 0;
 
+static void fireGestureNow(const char* gid) {
   if (!spk.connected()) {
     logEvent("gesture %s ignored (no speaker)", gid);
     lastFiredGid = String(gid);
@@ -237,6 +219,35 @@ static void fireGesture(uint8_t clicks, bool withHold, bool longHold) {
   if (!aid.startsWith("enter_")) exitMode();
 }
 
+static void runQueuedGestures() {
+  if (gestureQueued == 0) return;
+  StateLock lock(0);
+  if (!lock) return;
+  for (uint8_t i = 0; i < gestureQueued; i++) fireGestureNow(gestureQueue[i]);
+  gestureQueued = 0;
+}
+
+static void fireGesture(uint8_t clicks, bool withHold, bool longHold) {
+  char gid[8];
+  if (longHold && clicks == 0) {
+    strcpy(gid, "lh");
+  } else if (withHold && clicks == 0) {
+    strcpy(gid, "hold");
+  } else if (withHold && clicks > 0) {
+    snprintf(gid, sizeof(gid), "%uc+h", clicks);
+  } else {
+    snprintf(gid, sizeof(gid), "%uc", clicks);
+  }
+
+  runQueuedGestures();   // anything still waiting goes first
+  StateLock lock(0);
+  if (lock && gestureQueued == 0) {
+    fireGestureNow(gid);
+  } else if (gestureQueued < GESTURE_QUEUE) {
+    strcpy(gestureQueue[gestureQueued++], gid);
+  }
+}
+
 // =============================================================================
 // Button polling — distinguishes:
 //   press+release sequences (clicks)
@@ -246,6 +257,7 @@ static void fireGesture(uint8_t clicks, bool withHold, bool longHold) {
 // =============================================================================
 static void processButton() {
   if (!ssReady) return;
+  runQueuedGestures();
   unsigned long now = millis();
   // Seesaw switch is active-LOW with an internal pullup we enable in setup().
   // ss.digitalRead returns true when NOT pressed → BTN_IDLE.
@@ -68,6 +68,7 @@ fi
 if [[ $ROOM_ONLY -eq 0 ]]; then
   if [[ $REBUILD -eq 1 || ! -f "$BIN" ]]; then
     echo "compiling..."
+    python3 webui/build_webui.py
     arduino-cli compile --fqbn $FQBN --output-dir ./build .
   fi
   echo "uploading via USB..."
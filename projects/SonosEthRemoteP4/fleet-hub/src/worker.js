@@ -6,9 +6,19 @@
 // visibility into the entire fleet across all installs.
 //
 // Endpoints:
-//   POST /report      — board ingest (auth: X-Fleet-Auth header)
+//   POST /report      — board ingest (auth: X-Fleet-Auth header). The body is
+//                       compact CBOR (application/cbor, see decodeReport) or
+//                       the readable JSON form. The reply carries the
+//                       manifest's latest `fw` version, so a board that's
+//                       current skips its own manifest fetch.
 //   GET  /api/state   — JSON of every known board's latest status
+//   GET  /api/pulse   — recent gestures across the fleet, newest first
+//   GET  /api/rollup  — per-board, per-hour gesture / failure / rotation
+//                       counts for the last ?hours= (default 24), optionally
+//                       for one ?board=
 //   GET  /            — embedded HTML dashboard
+//   cron              — aggregate(): folds the per-board keys ingest writes
+//                       into the documents the /api/ endpoints read
 
 const DASHBOARD_HTML = `<!doctype html><html><head><meta charset="utf-8">
 <title>TPS × Vives · Sonos Fleet</title>
@@ -70,7 +80,7 @@ header .sub{font-family:var(--mono);font-size:10px;letter-spacing:3px;text-trans
 <header><h1>Sonos Fleet</h1><div class="sub">TPS × Vives · live</div></header>
 <div id="verdict" class="verdict"></div>
 <div class="pulse">
-  <h2><span>Pulse · recent activity</span><span class="live-dot"></span></h2>
+  <h2><span>Pulse · recent activity · up to 1 min behind</span><span class="live-dot"></span></h2>
   <div id="pulseFeed" class="feed"><div class="feed-empty">no activity yet</div></div>
 </div>
 <div id="grid" class="grid"><div class="empty">loading…</div></div>
@@ -82,14 +92,17 @@ header .sub{font-family:var(--mono);font-size:10px;letter-spacing:3px;text-trans
 <div class="footer" id="lastpoll"></div>
 <script>
 const STALE=600, DEAD=900;  // seconds
+let day={};  // per-board totals for the last 24h, from /api/rollup
 async function load(){
   try{
-    const [r1,r2]=await Promise.all([
+    const [r1,r2,r3]=await Promise.all([
       fetch('/api/state',{cache:'no-store'}),
-      fetch('/api/pulse',{cache:'no-store'})
+      fetch('/api/pulse',{cache:'no-store'}),
+      fetch('/api/rollup?hours=24',{cache:'no-store'})
     ]);
     const s=await r1.json();
     const p=await r2.json();
+    day=r3.ok?(await r3.json()).totals||{}:{};
     render(s);
     renderPulse(p);
   }catch(e){
@@ -173,23 +186,32 @@ function render(j){
   for(const b of boards){
     const s=stateOf(b,now);
     const lastSeen=Math.floor(now-b.ts);
-    const errs=Object.entries(b.errors24h||{}).filter(([_,n])=>n>0).map(([k,n])=>k+':'+n).join(' ');
+    const errs=Object.entries(b.errors24h||{}).filter(([_,n])=>n>0).map(([k,n])=>k+':'+n)
+      .concat(b.dropped>0?['events dropped:'+b.dropped]:[]).join(' ');
     h+=\`<div class="card \${s}"><div class="badge"></div>
       <div class="room">\${esc(b.label||b.room||b.id)}</div>
       <div class="host">\${esc(b.id)}</div>
       <div class="meta">
-        <span>last seen</span><b>\${ago(lastSeen)} ago</b>
+        <span title="as of the hub's last pass, which runs once a minute">last seen</span><b>\${ago(lastSeen)} ago</b>
         <span>uptime</span><b>\${ago(b.up||0)}</b>
         <span>fw</span><b>\${esc(b.fw||'?')}</b>
         <span>i2c</span><b>\${b.i2c?'✓ 0x'+(b.ss_pid||'').toString():'✗ none'}</b>
         <span>speaker</span><b>\${b.speaker?(b.spkOnline?'✓ '+esc(b.speaker):'✗ '+esc(b.speaker)):'—'}</b>
         <span>rotations</span><b>\${b.rotEvents??0} total</b>
         <span>last knob</span><b>\${lastTouchedAgo(b,now)}</b>
+        <span>24h</span><b>\${dayLine(day[b.id])}</b>
       </div>\${errs?'<div class="err">'+esc(errs)+'</div>':''}
     </div>\`;
   }
   document.getElementById('grid').innerHTML=h;
-  document.getElementById('lastpoll').textContent='last refresh '+new Date().toLocaleTimeString();
+  // The documents behind /api/state and /api/pulse are rebuilt by the
+  // minutely cron, so a report shows up here up to a minute after it lands.
+  document.getElementById('lastpoll').textContent='last refresh '+new Date().toLocaleTimeString()+' · hub updates once a minute';
+}
+function dayLine(t){
+  if(!t||(!t.g&&!t.rot)) return 'idle';
+  const fail=t.g?' · '+Math.round(t.failRate*100)+'% fail':'';
+  return t.g+' gestures'+fail+' · '+t.rot+' detents';
 }
 function lastTouchedAgo(b,now){
   // Convert board millis() lastRotMs into a wall-clock ago via the same
@@ -228,6 +250,9 @@ export default {
     if (request.method === "GET" && path === "/api/pulse") {
       return handlePulse(env);
     }
+    if (request.method === "GET" && path === "/api/rollup") {
+      return handleRollup(env, url.searchParams);
+    }
     if (request.method === "GET" && (path === "/" || path === "/index.html")) {
       return new Response(DASHBOARD_HTML, {
         headers: { "content-type": "text/html; charset=utf-8", "cache-control": "no-store" },
@@ -235,6 +260,11 @@ export default {
     }
     return new Response("Not found", { status: 404 });
   },
+
+  // Cron trigger (wrangler.toml) — rebuilds the dashboard documents.
+  async scheduled(event, env, ctx) {
+    ctx.waitUntil(aggregate(env));
+  },
 };
 
 async function handleReport(request, env) {
@@ -248,87 +278,516 @@ async function handleReport(request, env) {
   }
 
   let body;
-  try { body = await request.json(); }
-  catch { return new Response('{"ok":false,"err":"bad json"}', { status: 400, headers: { "content-type": "application/json" } }); }
+  const cbor = (request.headers.get("content-type") || "").startsWith("application/cbor");
+  try { body = cbor ? decodeReport(new Uint8Array(await request.arrayBuffer())) : await request.json(); }
+  catch { return new Response(`{"ok":false,"err":"bad ${cbor ? "cbor" : "json"}"}`, { status: 400, headers: { "content-type": "application/json" } }); }
 
   const id = String(body.id || "").slice(0, 64);
   if (!id || !/^[a-z0-9-]+$/.test(id)) {
     return new Response('{"ok":false,"err":"bad id"}', { status: 400, headers: { "content-type": "application/json" } });
   }
 
-  // Stamp ingest time so dashboard can compute "last seen".
+  // Look up the latest firmware while the KV writes go on.
+  const latest = latestFirmware(env);
+
+  // Ingest only touches this board's own keys — latest:<id> and events:<id>
+  // — so reports from different boards never race. A board has one report
+  // in flight at a time, so each key has a single writer. The aggregated
+  // documents the dashboard reads are built from these by aggregate(), on
+  // the cron trigger.
+  const received = Array.isArray(body.events) ? body.events : [];
+  const [prev, log] = await Promise.all([
+    loadDoc(env, `latest:${id}`),
+    received.length ? loadEvents(env, id) : null,
+  ]);
+
+  // Compact reports leave out the identity fields once we've acknowledged
+  // them — carry them over from the last record, or ask for them again.
+  let needFull = false;
+  if (cbor && !("fw" in body)) {
+    if (prev) {
+      for (const k of IDENTITY_FIELDS) if (k in prev) body[k] = prev[k];
+    } else {
+      needFull = true;
+    }
+  }
+
+  // Stamp ingest time so dashboard can compute "last seen". The events go
+  // to the board's event log below, not into its record.
   const nowSec = Math.floor(Date.now() / 1000);
   const record = { ...body, ts: nowSec };
+  delete record.events;
   const ttl = parseInt(env.LATEST_TTL_SECONDS || "1800", 10);
-  await env.STATE.put(`latest:${id}`, JSON.stringify(record), {
-    expirationTtl: ttl,
-  });
+  const writes = [env.STATE.put(`latest:${id}`, JSON.stringify(record), {
+    expirationTtl: ttl, metadata: { ts: nowSec },
+  })];
+
+  // Exactly-once: firmware that numbers its events (per boot, from 1) gets
+  // them stored only if they're past the highest sequence we have for that
+  // boot, and an `ack` of that highest sequence — after which it drops
+  // them. A resend because our reply got lost is then skipped here instead
+  // of stored twice. Older firmware sends no `boot`; its events go straight
+  // through, as before. The mark lives in the board's event log, so the
+  // events and the mark are one put.
+  const numbered = received.length > 0 && body.boot !== undefined;
+  const seen = numbered && log.mark && log.mark.boot === body.boot ? log.mark.seq : 0;
+  let highest = seen;
+  const incoming = [];
+  for (const e of received) {
+    if (numbered) {
+      const seq = Number(e.seq) || 0;
+      if (seq <= seen) continue;
+      highest = Math.max(highest, seq);
+    }
+    incoming.push(e);
+  }
 
   // Pulse feed — append individual gesture events. Convert board millis() to
   // an absolute wall-clock guess using (now - (nowMs - eventMs)/1000), so the
   // dashboard can sort across boards even though their clocks aren't sync'd.
-  const incoming = Array.isArray(body.events) ? body.events : [];
   const nowMs = Number(body.nowMs) || 0;
-  if (incoming.length > 0 && nowMs > 0) {
-    const eventsKey = `events:${id}`;
-    let log = [];
-    try {
-      const prev = await env.STATE.get(eventsKey);
-      if (prev) log = JSON.parse(prev);
-    } catch {}
+  const fresh = [];
+  if (nowMs > 0) {
     for (const e of incoming) {
       const ageMs = nowMs - Number(e.ms || 0);
       if (ageMs < 0 || ageMs > 24 * 3600 * 1000) continue;  // sanity
-      log.push({
+      const entry = {
         t:   nowSec - Math.floor(ageMs / 1000),
         gid: String(e.gid || "").slice(0, 8),
         ok:  !!e.ok,
         id,
-      });
+      };
+      if (numbered) entry.seq = Number(e.seq);
+      fresh.push(entry);
     }
-    // Keep only events from the last 24h, cap at 200 per board.
-    const cutoff = nowSec - 24 * 3600;
-    log = log.filter(e => e.t >= cutoff).slice(-200);
-    await env.STATE.put(eventsKey, JSON.stringify(log), {
-      expirationTtl: 25 * 3600,  // a touch over the 24h window
-    });
+  }
+  if (fresh.length || highest > seen) {
+    log.events.push(...fresh);
+    if (numbered) log.mark = { boot: body.boot, seq: highest };
+    // History before the log: its raw buckets are keyed by the batch, so a
+    // resend after a failed put below rewrites the same keys.
+    await recordHistory(env, log, fresh, body.boot, nowSec);
+    writes.push(saveEvents(env, id, log, nowSec));
   }
 
-  return new Response(JSON.stringify({ ok: true }), {
+  // Only acknowledge once everything is written: if a put fails the board
+  // gets an error, resends, and nothing is skipped.
+  await Promise.all(writes);
+
+  const reply = { ok: true };
+  if (numbered) reply.ack = highest;
+  const fw = await latest;
+  if (fw) reply.fw = fw;
+  if (needFull) reply.full = true;
+  return new Response(JSON.stringify(reply), {
     headers: { "content-type": "application/json", "cache-control": "no-store" },
   });
 }
 
-async function handlePulse(env) {
-  // Merge all per-board event logs into one chronological feed.
-  const list = await env.STATE.list({ prefix: "events:" });
-  const all = [];
-  for (const key of list.keys) {
-    const raw = await env.STATE.get(key.name);
-    if (!raw) continue;
-    try {
-      const log = JSON.parse(raw);
-      for (const e of log) all.push(e);
-    } catch {}
+// ── Compact reports ─────────────────────────────────────────────────────────
+// Mirrors fleet.h: a CBOR map with integer keys (REPORT_KEYS[key] is the JSON
+// name), event times as deltas from nowMs, gesture ids interned. Decoded
+// into exactly the object the JSON form would have been, so everything
+// after ingest — KV records, pulse log, dashboard — is unchanged.
+const REPORT_KEYS = ["v", "id", "client", "room", "label", "fw", "up", "ip", "i2c", "ss_pid",
+  "speaker", "spkOnline", "rotEvents", "lastRotAge", "nowMs", "errors", "events",
+  "boot", "seq", "dropped"];
+const IDENTITY_FIELDS = ["client", "room", "label", "fw", "ip", "ss_pid", "speaker"];
+const REPORT_GIDS = ["", "1c", "2c", "3c", "4c", "5c", "hold", "lh", "1c+h", "2c+h", "3c+h", "4c+h", "5c+h"];
+const GID_ROT = 32;
+
+export function decodeReport(bytes) {
+  const m = cborDecode(bytes);
+  if (!(m instanceof Map) || m.get(0) !== 1) throw new Error("unknown report version");
+  const body = {};
+  for (const [k, v] of m) if (REPORT_KEYS[k]) body[REPORT_KEYS[k]] = v;
+  delete body.v;
+  const nowMs = Number(body.nowMs) || 0;
+  if (body.ip instanceof Uint8Array) body.ip = Array.from(body.ip).join(".");
+  body.lastRotMs = body.lastRotAge !== undefined ? nowMs - body.lastRotAge : 0;
+  delete body.lastRotAge;
+  const [soap = 0, spk_lost = 0, ota = 0] = Array.isArray(body.errors) ? body.errors : [];
+  body.errors = { soap, spk_lost, ota };
+  if (body.dropped === undefined) body.dropped = 0;
+  const flat = Array.isArray(body.events) ? body.events : [];
+  let seq = Number(body.seq) || 0;   // the oldest event's; the rest follow
+  delete body.seq;
+  body.events = [];
+  for (let i = 0, ms = nowMs; i < flat.length; ) {
+    ms = i === 0 ? nowMs - flat[i++] : ms + flat[i++];
+    const g = flat[i++];
+    if (typeof g === "string") {
+      body.events.push({ seq: seq++, ms, gid: g, ok: !!flat[i++] });
+      continue;
+    }
+    const code = g >> 1;
+    let gid = REPORT_GIDS[code] || "";
+    if (code >= GID_ROT) {
+      const z = code - GID_ROT;
+      const d = z & 1 ? -(z + 1) / 2 : z / 2;
+      gid = "rot" + (d >= 0 ? "+" : "") + d;
+    }
+    body.events.push({ seq: seq++, ms, gid, ok: !!(g & 1) });
   }
-  all.sort((a, b) => b.t - a.t);  // newest first
-  return new Response(JSON.stringify({ events: all.slice(0, 100) }), {
-    headers: { "content-type": "application/json", "cache-control": "no-store" },
+  return body;
+}
+
+// Just enough CBOR (RFC 8949) for the above: integers, byte and text
+// strings, arrays and maps (definite or indefinite), false/true/null.
+// Anyone holding the ingest secret can send this anything, so every length
+// is checked against what's left of the input before it's used, only
+// arrays and maps may be indefinite, and nesting stops at CBOR_MAX_DEPTH —
+// malformed input throws, it never loops (bench/cbor_decode.mjs).
+const CBOR_MAX_DEPTH = 16;
+
+function cborDecode(bytes) {
+  let pos = 0, depth = 0;
+  const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  const left = () => bytes.length - pos;
+  const need = n => { if (n > left()) throw new Error("truncated"); };
+  function arg(ai) {
+    if (ai < 24) return ai;
+    if (ai === 31) return -1;                // indefinite length
+    if (ai > 27) throw new Error("reserved cbor length 0x" + ai.toString(16));
+    const n = 1 << (ai - 24);
+    need(n);
+    let v = 0;
+    for (let i = 0; i < n; i++) v = v * 256 + view.getUint8(pos++);
+    return v;
+  }
+  function item() {
+    need(1);
+    const ib = view.getUint8(pos++);
+    const major = ib >> 5, n = arg(ib & 31);
+    if (n < 0 && major !== 4 && major !== 5) throw new Error("unsupported cbor item 0x" + ib.toString(16));
+    switch (major) {
+      case 0: return n;
+      case 1: return -1 - n;
+      case 2: need(n); pos += n; return bytes.slice(pos - n, pos);
+      case 3: need(n); pos += n; return new TextDecoder().decode(bytes.subarray(pos - n, pos));
+      case 4:
+      case 5: {
+        need(n < 0 ? 1 : major === 4 ? n : 2 * n);   // every item takes a byte at least
+        if (++depth > CBOR_MAX_DEPTH) throw new Error("cbor nested too deep");
+        let out;
+        if (major === 4) {
+          out = [];
+          if (n < 0) while (!brk()) out.push(item());
+          else for (let i = 0; i < n; i++) out.push(item());
+        } else {
+          out = new Map();
+          if (n < 0) while (!brk()) out.set(item(), item());
+          else for (let i = 0; i < n; i++) out.set(item(), item());
+        }
+        depth--;
+        return out;
+      }
+      case 7:
+        if (ib === 0xf4) return false;
+        if (ib === 0xf5) return true;
+        if (ib === 0xf6) return null;
+    }
+    throw new Error("unsupported cbor item 0x" + ib.toString(16));
+  }
+  function brk() {
+    need(1);
+    if (view.getUint8(pos) !== 0xff) return false;
+    pos++;
+    return true;
+  }
+  const out = item();
+  if (left()) throw new Error("trailing bytes after cbor item");
+  return out;
+}
+
+// Latest firmware version from the OTA manifest. Cached at the edge for
+// MANIFEST_CACHE_SECONDS, so the whole fleet costs GitHub about one fetch per
+// interval; boards compare it against their own and only fetch the manifest
+// themselves (a second TLS handshake) when something newer is out.
+async function latestFirmware(env) {
+  if (!env.MANIFEST_URL) return null;
+  try {
+    const ttl = parseInt(env.MANIFEST_CACHE_SECONDS || "300", 10);
+    const r = await fetch(env.MANIFEST_URL, { cf: { cacheTtl: ttl, cacheEverything: true } });
+    if (!r.ok) return null;
+    const m = await r.json();
+    return typeof m.version === "string" && /^\d+\.\d+\.\d+$/.test(m.version) ? m.version : null;
+  } catch {
+    return null;
+  }
+}
+
+// ── Aggregates ──────────────────────────────────────────────────────────────
+// Each read endpoint is one KV get however many boards there are (it used
+// to be a list plus a get per board, per dashboard refresh, per viewer):
+//   fleet — { boards: { id: latest record } }, every board with a live
+//           latest:<id> key
+//   pulse — { events: [...], seen: { id: t } } newest first, last 24 h, at
+//           most PULSE_MAX: just the live feed, so it stays small; history
+//           is in the hourly buckets below. `seen` is the events:<id>
+//           version already merged in
+// Ingest never writes these. aggregate() runs on the cron trigger and is
+// their only writer: it lists latest:* and events:*, whose metadata carries
+// each key's write time, and only gets the keys that changed since the
+// version it already has. Its cost follows the report rate, not the fleet
+// size, and the dashboard is at most one cron interval behind.
+//
+// A Worker invocation gets 1,000 KV operations. A run fetches at most
+// AGG_MAX_GETS per-board keys — boards it has never seen first, then the
+// longest out of date — and writes the documents with what it got; the
+// rest are still newer than the documents next run, so they're picked up
+// then. The first run after a deploy, or after `fleet` / `pulse` is lost,
+// therefore fills the documents in over a few runs instead of failing on
+// the operation limit every time. A run that finds nothing changed writes
+// nothing: the read endpoints already drop boards and events past their
+// TTLs.
+//
+// A key read back too soon after its write (KV is eventually consistent
+// across locations, up to about 60 s) may come back older than its
+// listed metadata; it's taken as it is and fetched again next run.
+//
+// Until the first run, the read endpoints fall back to building the
+// documents from the per-board keys.
+const FLEET_KEY = "fleet";
+const PULSE_KEY = "pulse";
+const PULSE_MAX = 100;
+// Leaves room under the 1,000-operation limit for the two document gets
+// and puts, a list per 1,000 keys of each prefix and the rollup days.
+const AGG_MAX_GETS = 800;
+
+async function loadDoc(env, key) {
+  try { return JSON.parse(await env.STATE.get(key) || "null"); }
+  catch { return null; }
+}
+
+async function listAll(env, prefix) {
+  const keys = [];
+  let cursor;
+  do {
+    const page = await env.STATE.list({ prefix, cursor });
+    keys.push(...page.keys);
+    cursor = page.list_complete ? null : page.cursor;
+  } while (cursor);
+  return keys;
+}
+
+// events:<id> — { events: [...], hours: { <hour>: { g, f, rot } },
+// mark: { boot, seq }, t } the board's own gestures from the last 24 h, at
+// most PULSE_MAX, its counts for the hours those can fall in (see History),
+// its delivered-event mark (see handleReport) and when it was written.
+// Older versions of this key were a bare array.
+async function loadEvents(env, id) {
+  const doc = await loadDoc(env, `events:${id}`);
+  if (Array.isArray(doc)) return { events: doc };
+  return doc && Array.isArray(doc.events) ? doc : { events: [] };
+}
+
+async function saveEvents(env, id, log, nowSec) {
+  const cutoff = nowSec - 24 * 3600;
+  const events = log.events.filter(e => e.t >= cutoff).sort((a, b) => a.t - b.t).slice(-PULSE_MAX);
+  const hours = {};
+  for (const [h, c] of Object.entries(log.hours || {})) if (h * HOUR >= cutoff - HOUR) hours[h] = c;
+  await env.STATE.put(`events:${id}`, JSON.stringify({ ...log, events, hours, t: nowSec }), {
+    expirationTtl: 25 * 3600,  // a touch over the 24h window any event is accepted for
+    metadata: { t: nowSec },
   });
 }
 
-async function handleState(env) {
-  // List all latest:<id> keys, fetch each. Free-tier KV list is fine for our
-  // scale (we'd need >1000 keys to start paginating).
-  const list = await env.STATE.list({ prefix: "latest:" });
-  const boards = [];
-  for (const key of list.keys) {
-    const raw = await env.STATE.get(key.name);
-    if (raw) {
-      try { boards.push(JSON.parse(raw)); }
-      catch {}
+async function loadFleet(env) {
+  const doc = await loadDoc(env, FLEET_KEY);
+  if (doc && doc.boards) return doc;
+  const boards = {};
+  for (const key of await listAll(env, "latest:")) {
+    const rec = await loadDoc(env, key.name);
+    if (rec && rec.id) { delete rec.events; boards[rec.id] = rec; }
+  }
+  return { boards };
+}
+
+async function loadPulse(env) {
+  const doc = await loadDoc(env, PULSE_KEY);
+  if (doc && Array.isArray(doc.events)) return doc;
+  const events = [];
+  for (const key of await listAll(env, "events:")) {
+    events.push(...(await loadEvents(env, key.name.slice(7))).events);
+  }
+  events.sort((a, b) => b.t - a.t);
+  return { events };
+}
+
+function liveBoards(fleet, nowSec, env) {
+  const ttl = parseInt(env.LATEST_TTL_SECONDS || "1800", 10);
+  return Object.values(fleet.boards).filter(b => nowSec - (b.ts || 0) <= ttl);
+}
+
+async function aggregate(env) {
+  const nowSec = Math.floor(Date.now() / 1000);
+  const [fleet, pulse, latestKeys, eventKeys] = await Promise.all([
+    loadDoc(env, FLEET_KEY), loadDoc(env, PULSE_KEY), listAll(env, "latest:"), listAll(env, "events:"),
+  ]);
+
+  // What's out of date: a listed write time newer than the document's copy.
+  // Never-seen boards sort first, then the oldest copies.
+  const had = fleet?.boards || {};
+  const seenBefore = pulse?.seen || {};
+  const changed = latestKeys.map(k => k.name.slice(7))
+    .filter((id, i) => !had[id] || (latestKeys[i].metadata?.ts || 0) > had[id].ts)
+    .sort((a, b) => (had[a]?.ts || 0) - (had[b]?.ts || 0));
+  const stale = eventKeys.map(k => k.name.slice(7))
+    .filter((id, i) => !(id in seenBefore) || (eventKeys[i].metadata?.t || 0) > seenBefore[id])
+    .sort((a, b) => (seenBefore[a] || 0) - (seenBefore[b] || 0));
+  if (!changed.length && !stale.length) return;
+
+  // This run's share of the gets; the rest wait for the next run.
+  const half = AGG_MAX_GETS / 2;
+  const nLatest = Math.min(changed.length, Math.max(half, AGG_MAX_GETS - stale.length));
+  const nEvents = Math.min(stale.length, AGG_MAX_GETS - nLatest);
+  const fetchLatest = changed.slice(0, nLatest), fetchEvents = stale.slice(0, nEvents);
+
+  // Boards: every listed board, from this run's get or the copy we have. A
+  // key that's gone from the list has expired — the board went silent.
+  const records = await Promise.all(fetchLatest.map(id => loadDoc(env, `latest:${id}`)));
+  const fresh = new Map(fetchLatest.map((id, i) => [id, records[i]]));
+  const boards = {};
+  for (const k of latestKeys) {
+    const id = k.name.slice(7);
+    const rec = fresh.get(id) || had[id];
+    if (rec) { delete rec.events; boards[id] = rec; }
+  }
+
+  // Pulse: a fetched board's log replaces its entries. The feed keeps only
+  // the newest PULSE_MAX, which is still right after the merge — an entry
+  // that lost its place can't get it back, as everything after it is newer.
+  // A board still waiting for its get keeps its old entries and mark.
+  const logs = await Promise.all(fetchEvents.map(id => loadEvents(env, id)));
+  const listed = new Set(eventKeys.map(k => k.name.slice(7)));
+  const seen = {};
+  for (const id of listed) if (id in seenBefore) seen[id] = seenBefore[id];
+  fetchEvents.forEach((id, i) => { seen[id] = logs[i].t || 0; });
+  const replaced = new Set(fetchEvents);
+  const cutoff = nowSec - 24 * 3600;
+  const events = (pulse?.events || []).filter(e => !replaced.has(e.id));
+  for (const log of logs) events.push(...log.events);
+  const feed = events.filter(e => e.t >= cutoff).sort((a, b) => b.t - a.t).slice(0, PULSE_MAX);
+
+  // Rollups: a fetched board's hourly counts overwrite its slot in the day
+  // documents. They're absolute, not increments, so a run that repeats or
+  // overlaps another changes nothing.
+  const byDay = new Map();
+  fetchEvents.forEach((id, i) => {
+    for (const [h, c] of Object.entries(logs[i].hours || {})) {
+      const d = Math.floor(h * HOUR / DAY);
+      if (!byDay.has(d)) byDay.set(d, []);
+      byDay.get(d).push([h, id, c]);
+    }
+  });
+  const rollTtl = parseInt(env.ROLLUP_DAYS || "35", 10) * DAY;
+  const rolls = [...byDay].map(async ([d, counts]) => {
+    const doc = await loadDoc(env, `roll:${d}`) || { hours: {} };
+    for (const [h, id, c] of counts) (doc.hours[h] ||= {})[id] = c;
+    await env.STATE.put(`roll:${d}`, JSON.stringify(doc), { expirationTtl: rollTtl });
+  });
+
+  await Promise.all([
+    fetchLatest.length ? env.STATE.put(FLEET_KEY, JSON.stringify({ boards })) : null,
+    fetchEvents.length ? env.STATE.put(PULSE_KEY, JSON.stringify({ events: feed, seen })) : null,
+    ...rolls,
+  ]);
+}
+
+// ── History ─────────────────────────────────────────────────────────────────
+// Written by ingest on the reporting board's keys only:
+//   bucket:<hour>:<id>:<batch> — [...] the gestures from one report that
+//                   fall in that UTC hour, as received; put once and never
+//                   read back on ingest, kept PULSE_RAW_DAYS. <batch> is
+//                   <boot>-<first seq> for numbered events, so a resend
+//                   of the same batch lands on the same key; t<ingest time>
+//                   for older firmware
+//   events:<id>.hours — { <hour>: { g, f, rot } } the board's gestures,
+//                   failed gestures and rotation detents (the sum of
+//                   |delta| over rot bursts, which aren't counted as
+//                   gestures) per hour, for the 25 h an event can still
+//                   arrive in. In the same put as the events and the mark,
+//                   so a batch is counted once or not at all
+// and folded by aggregate() into:
+//   roll:<day>    — { hours: { <hour>: { <id>: { g, f, rot } } } } every
+//                   board per hour; kept ROLLUP_DAYS
+// Hours and days are epoch seconds / 3600 and / 86400. A report writes one
+// raw key per hour it touches (two at a boundary) and its own counts,
+// whatever the history length or fleet size, and a query over N days reads
+// N rollup documents and no raw events. Only events that passed
+// handleReport's sequence check get here, so a resent report isn't
+// counted twice.
+const HOUR = 3600, DAY = 86400;
+
+async function recordHistory(env, log, events, boot, nowSec) {
+  const rawTtl = parseInt(env.PULSE_RAW_DAYS || "7", 10) * DAY;
+  const byHour = new Map();
+  for (const e of events) {
+    const h = Math.floor(e.t / HOUR);
+    if (!byHour.has(h)) byHour.set(h, []);
+    byHour.get(h).push(e);
+  }
+  log.hours ||= {};
+  const puts = [];
+  for (const [h, list] of byHour) {
+    const c = log.hours[h] ||= { g: 0, f: 0, rot: 0 };
+    for (const e of list) {
+      const rot = /^rot([+-]\d+)$/.exec(e.gid);
+      if (rot) c.rot += Math.abs(parseInt(rot[1], 10));
+      else { c.g++; if (!e.ok) c.f++; }
+    }
+    const batch = list[0].seq !== undefined ? `${boot}-${list[0].seq}` : `t${nowSec}`;
+    puts.push(env.STATE.put(`bucket:${h}:${list[0].id}:${batch}`, JSON.stringify(list), { expirationTtl: rawTtl }));
+  }
+  await Promise.all(puts);
+}
+
+// { hours: [{ t, boards: { id: { g, f, rot } } }] oldest first, totals:
+// { id: { g, f, rot, failRate } } } over the last `hours`.
+async function handleRollup(env, params) {
+  const maxHours = parseInt(env.ROLLUP_DAYS || "35", 10) * 24;
+  const hours = Math.min(Math.max(parseInt(params.get("hours") || "24", 10) || 24, 1), maxHours);
+  const board = params.get("board");
+  const nowH = Math.floor(Date.now() / 1000 / HOUR);
+  const fromH = nowH - hours + 1;
+  const days = [];
+  for (let d = Math.floor(fromH * HOUR / DAY); d <= Math.floor(nowH * HOUR / DAY); d++) days.push(d);
+  const docs = await Promise.all(days.map(d => loadDoc(env, `roll:${d}`)));
+
+  const out = [], totals = {};
+  for (const doc of docs) {
+    for (const [h, boards] of Object.entries(doc?.hours || {})) {
+      if (h < fromH || h > nowH) continue;
+      const picked = {};
+      for (const [id, c] of Object.entries(boards)) {
+        if (board && id !== board) continue;
+        picked[id] = c;
+        const t = totals[id] ||= { g: 0, f: 0, rot: 0 };
+        t.g += c.g; t.f += c.f; t.rot += c.rot;
+      }
+      if (Object.keys(picked).length) out.push({ t: h * HOUR, boards: picked });
     }
   }
+  out.sort((a, b) => a.t - b.t);
+  for (const t of Object.values(totals)) t.failRate = t.g ? +(t.f / t.g).toFixed(3) : 0;
+  return new Response(JSON.stringify({ hours: out, totals }), {
+    headers: { "content-type": "application/json", "cache-control": "no-store" },
+  });
+}
+
+async function handlePulse(env) {
+  const pulse = await loadPulse(env);
+  const cutoff = Math.floor(Date.now() / 1000) - 24 * 3600;
+  const events = pulse.events.filter(e => e.t >= cutoff).slice(0, 100);
+  return new Response(JSON.stringify({ events }), {
+    headers: { "content-type": "application/json", "cache-control": "no-store" },
+  });
+}
+
+async function handleState(env) {
+  const fleet = await loadFleet(env);
+  const boards = liveBoards(fleet, Math.floor(Date.now() / 1000), env);
   return new Response(JSON.stringify({ boards, generated: Date.now() }), {
     headers: { "content-type": "application/json", "cache-control": "no-store" },
   });
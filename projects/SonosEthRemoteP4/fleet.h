@@ -1,7 +1,8 @@
 #pragma once
 // =============================================================================
-// Fleet Hub reporter — POSTs a small status JSON to the central Cloudflare
+// Fleet Hub reporter — POSTs a small status report to the central Cloudflare
 // Worker every 5 minutes (piggybacked on the manifest poll in updater.h).
+// Compact CBOR on the wire; the original JSON with FLEET_REPORT_CBOR = false.
 //
 // The hub dashboard at https://sonos-fleet-hub.davidvivesprice.workers.dev/
 // shows liveness + i2c + speaker state for every deployed board across all
@@ -9,11 +10,19 @@
 //
 // If FLEET_HUB_SECRET is empty (config_secrets.h missing at build time) the
 // reporter silently skips — firmware still works, it just doesn't phone home.
+//
+// The hub connection is kept open between reports (HTTP/1.1 keep-alive on a
+// static client), so while the hub holds it a report costs no TLS handshake.
+// The hub's reply names the latest firmware in the manifest (`fw`), which
+// lets updater.h skip its own manifest fetch — and that handshake — when
+// the board is already current.
 // =============================================================================
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include <NetworkClientSecure.h>
+#include <ArduinoJson.h>
 #include "config.h"
+#include "fleet_report.h"
 #include "room.h"
 #include "speaker.h"
 #include "encoder.h"
@@ -30,69 +39,140 @@ static uint32_t fleetOtaFailures   = 0;  // failed OTA attempts
 
 extern bool ssReady;
 
+// Latest firmware version per the hub's last reply, and when that was.
+static String        fleetHubFw;
+static unsigned long fleetHubFwMs = 0;
+
+// One connection to the hub, reused across reports while it stays up.
+static NetworkClientSecure fleetClient;
+static HTTPClient          fleetHttp;
+
+static bool fleetBegin() {
+  fleetClient.setInsecure();  // hub auth comes from the shared secret, not TLS pinning
+  fleetHttp.setReuse(true);
+  fleetHttp.setUserAgent(String("SonosEthRemoteP4/") + FW_VERSION);
+  fleetHttp.setConnectTimeout(4000);
+  fleetHttp.setTimeout(6000);
+  if (!fleetHttp.begin(fleetClient, FLEET_HUB_URL)) return false;
+  fleetHttp.addHeader("Content-Type", FLEET_REPORT_CBOR ? "application/cbor" : "application/json");
+  fleetHttp.addHeader("X-Fleet-Auth", FLEET_HUB_SECRET);
+  return true;
+}
+
+// ── Identity ─────────────────────────────────────────────────────────────────
+// Room slug and host prefix come out of NVS once per boot: changing either
+// restarts the board, so they can't go stale — no need for two Preferences
+// opens on every report.
+struct FleetIdentity {
+  String      slug, prefix;
+  const char* label = "";
+};
+static const FleetIdentity& fleetIdentity() {
+  static FleetIdentity id;
+  static bool loaded = false;
+  if (!loaded) {
+    id.slug   = loadRoomSlug();
+    id.prefix = loadHostPrefix();
+    id.label  = id.slug.length() ? labelForSlug(id.slug.c_str()) : "";
+    loaded = true;
+  }
+  return id;
+}
+
+static uint32_t fleetIdAcked = 0;   // identity hash the hub last confirmed
+
+// Random per boot, so the hub can tell this boot's event sequence numbers
+// from the last one's (they restart at 1).
+static uint32_t fleetBootId() {
+  static uint32_t id = 0;
+  while (!id) id = esp_random();
+  return id;
+}
+
+// Everything a report carries, read from the live globals in one place.
+static FleetReportData fleetSnapshot(const char* hostname, bool i2cOk, uint16_t ssPid) {
+  const FleetIdentity& id = fleetIdentity();
+  IPAddress a = ETH.localIP();
+  FleetReportData d;
+  d.id        = hostname;
+  d.client    = id.prefix.c_str();
+  d.room      = id.slug.c_str();
+  d.label     = id.label;
+  d.fw        = FW_VERSION;
+  for (int i = 0; i < 4; i++) d.ip[i] = a[i];
+  d.i2c       = i2cOk;
+  d.ssPid     = ssPid;
+  d.speaker   = spk.name.c_str();
+  d.spkOnline = spk.online;
+  d.rotEvents = fleetRotEvents;
+  d.lastRotMs = lastRotationMs;
+  d.nowMs     = millis();
+  d.soapErrors  = fleetSoapErrors;
+  d.spkLost     = fleetSpkLost;
+  d.otaFailures = fleetOtaFailures;
+  d.boot        = fleetBootId();
+  d.events      = &fleetEvents;
+  return d;
+}
+
 inline void fleetReport(const char* hostname, bool i2cOk, uint16_t ssPid) {
   // Reporting requires a real secret. If the build doesn't have one, skip.
   if (strlen(FLEET_HUB_SECRET) == 0) return;
 
-  NetworkClientSecure client;
-  client.setInsecure();  // hub auth comes from the shared secret, not TLS pinning
-  HTTPClient http;
-  http.setUserAgent(String("SonosEthRemoteP4/") + FW_VERSION);
-  http.setConnectTimeout(4000);
-  http.setTimeout(6000);
-  if (!http.begin(client, FLEET_HUB_URL)) {
-    logEvent("fleet: http.begin failed");
+  // Fits the static buffer with a full events ring either way; POSTed
+  // straight from it. The identity fields ride along in CBOR only until the
+  // hub has acknowledged them.
+  static uint8_t body[2048];
+  FleetReportData d = fleetSnapshot(hostname, i2cOk, ssPid);
+  uint32_t sentThrough = fleetEvents.seq;   // newest event in this report
+  size_t len;
+  uint32_t idHash = 0;
+  if (FLEET_REPORT_CBOR) {
+    idHash = fleetIdentityHash(d);
+    CborWriter c(body, sizeof(body));
+    len = fleetEncodeCbor(c, d, idHash != fleetIdAcked);
+  } else {
+    JsonWriter w((char*)body, sizeof(body));
+    len = fleetEncodeJson(w, d);
+  }
+  if (!len) {
+    logEvent("fleet: report exceeds %u B, skipped", (unsigned)sizeof(body));
     return;
   }
-  http.addHeader("Content-Type", "application/json");
-  http.addHeader("X-Fleet-Auth", FLEET_HUB_SECRET);
 
-  String slug   = loadRoomSlug();
-  String prefix = loadHostPrefix();
-  String label  = slug.length() ? String(labelForSlug(slug.c_str())) : String("");
-
-  // Build the payload — small, schema-stable so the hub can render even if
-  // future firmware adds new fields the worker doesn't know about.
-  String body;
-  body.reserve(512);
-  body  = "{\"id\":\"";   body += hostname;
-  body += "\",\"client\":\""; body += prefix;
-  body += "\",\"room\":\""; body += slug;
-  body += "\",\"label\":\""; body += label;
-  body += "\",\"fw\":\""; body += FW_VERSION;
-  body += "\",\"up\":"; body += (unsigned long)(millis() / 1000);
-  body += ",\"ip\":\""; body += ETH.localIP().toString();
-  body += "\",\"i2c\":"; body += i2cOk ? "true" : "false";
-  body += ",\"ss_pid\":"; body += ssPid;
-  body += ",\"speaker\":\""; body += spk.name;
-  body += "\",\"spkOnline\":"; body += spk.online ? "true" : "false";
-  body += ",\"rotEvents\":"; body += fleetRotEvents;
-  body += ",\"lastRotMs\":"; body += (unsigned long)lastRotationMs;
-  body += ",\"nowMs\":"; body += (unsigned long)millis();
-  body += ",\"errors\":{\"soap\":"; body += fleetSoapErrors;
-  body += ",\"spk_lost\":"; body += fleetSpkLost;
-  body += ",\"ota\":"; body += fleetOtaFailures;
-  body += "}";
-  // Gesture events ring buffer — every click/multi-click/hold since the last
-  // report. Hub stores them in a rolling per-board log so the pulse view
-  // shows individual user interactions with timestamps.
-  body += ",\"events\":[";
-  for (uint8_t i = 0; i < fleetEvtCount; i++) {
-    if (i > 0) body += ',';
-    body += "{\"ms\":";    body += fleetEvents[i].ms;
-    body += ",\"gid\":\""; body += fleetEvents[i].gid;
-    body += "\",\"ok\":";  body += fleetEvents[i].ok ? "true" : "false";
-    body += "}";
+  if (!fleetBegin()) {
+    logEvent("fleet: http.begin failed");
+    return;
+  }
+  bool reused = fleetClient.connected();
+  int code = fleetHttp.POST(body, len);
+  if (code < 0 && reused) {
+    // The hub dropped the idle connection under us — once more on a fresh one.
+    fleetHttp.end();
+    fleetClient.stop();
+    if (fleetBegin()) code = fleetHttp.POST(body, len);
   }
-  body += "]}";
-
-  int code = http.POST(body);
   if (code == 200) {
-    // Clear the events buffer only on confirmed delivery — if the hub is
-    // unreachable we want to retry next tick with the same events.
-    fleetEventsClear();
+    // Drop events only once the hub has them — if it's unreachable we
+    // retry next tick with the same ones. It acknowledges by sequence
+    // number (`ack`), having skipped any it already stored; a hub that
+    // doesn't send one stored the whole report.
+    fleetIdAcked = idHash;
+    JsonDocument reply;
+    if (deserializeJson(reply, fleetHttp.getString())) {
+      fleetEvents.ack(sentThrough);
+    } else {
+      uint32_t ack = reply["ack"] | sentThrough;
+      fleetEvents.ack(ack < sentThrough ? ack : sentThrough);
+      String fw = reply["fw"] | "";
+      if (fw.length()) {
+        fleetHubFw = fw;
+        fleetHubFwMs = millis();
+      }
+      if (reply["full"] | false) fleetIdAcked = 0;   // hub lost our identity
+    }
   } else {
     logEvent("fleet: POST -> %d", code);
   }
-  http.end();
+  fleetHttp.end();  // with reuse on, leaves the connection open if the hub allows
 }
@@ -0,0 +1,223 @@
+#pragma once
+// =============================================================================
+// Fleet report wire format — the two encodings fleet.h can POST to the hub.
+//
+// Kept apart from fleet.h (which owns the HTTP side and the live globals) so
+// it only needs Arduino.h: bench/report_bench.cpp builds it on the host to
+// compare sizes and encode time, and fleet-hub/src/worker.js decodes it.
+//
+// CBOR (v1, the default): a map with small integer keys instead of names.
+// Event times go as deltas — the first from nowMs back to the oldest event,
+// then event to event — so they're one or two bytes instead of a ten-digit
+// millis(). Gesture ids are interned: code << 1 | ok in one byte, with
+// rotation bursts as FLEET_GID_ROT + zigzag(delta); an id outside the table
+// goes as text followed by ok. Sequence numbers are implicit: FK_SEQ is the
+// oldest event's and the rest follow, scoped by FK_BOOT. The fields that
+// rarely change (client, room, label, fw, ip, ss_pid, speaker) can be left
+// out — the hub keeps the last ones it saw, and asks for them again if it
+// has lost them.
+//
+// JSON: the original schema, every field every time. For debugging
+// (FLEET_REPORT_CBOR = false); the hub stores both forms the same way.
+//
+// worker.js mirrors the keys and the gid table — change either there too,
+// and bump FLEET_CBOR_VERSION if a key changes meaning.
+// =============================================================================
+#include <Arduino.h>
+#include "json.h"
+#include "cbor.h"
+
+// One gesture in the ring encoder.h fills between reports.
+struct FleetEvent {
+  unsigned long ms;       // board millis() at event time
+  char          gid[8];   // "1c", "2c+h", "hold", "lh", etc.
+  bool          ok;       // did the mapped action succeed?
+};
+
+// The gestures the hub hasn't acknowledged yet. Each gets the next sequence
+// number (per boot, from 1); reports carry them and the hub answers with
+// the highest it has stored, which ack() drops. So a reply lost in transit
+// means a resend the hub recognises rather than a duplicate, and events
+// logged while a report is in flight stay queued. Heavy use with the hub
+// unreachable overwrites the oldest entry and counts it in `dropped`.
+// O(1) either way.
+struct FleetEventRing {
+  static constexpr uint8_t CAP = 24;
+  FleetEvent ev[CAP];
+  uint8_t    head    = 0;   // index of the oldest event
+  uint8_t    count   = 0;
+  uint32_t   seq     = 0;   // sequence number of the newest event
+  uint32_t   dropped = 0;   // overwritten before the hub acknowledged them
+
+  void log(const char* gid, bool ok, unsigned long ms) {
+    if (count == CAP) {
+      head = (head + 1) % CAP;
+      count--;
+      dropped++;
+    }
+    FleetEvent& e = ev[(head + count++) % CAP];
+    e.ms = ms;
+    strncpy(e.gid, gid, sizeof(e.gid) - 1);
+    e.gid[sizeof(e.gid) - 1] = 0;
+    e.ok = ok;
+    seq++;
+  }
+  uint32_t firstSeq() const { return seq - count + 1; }
+  const FleetEvent& at(uint8_t i) const { return ev[(head + i) % CAP]; }
+
+  // The hub has everything up to and including `through`.
+  void ack(uint32_t through) {
+    if (count == 0 || through < firstSeq()) return;
+    uint32_t n = through - firstSeq() + 1;
+    if (n > count) n = count;
+    head = (head + n) % CAP;
+    count -= n;
+  }
+};
+
+// Everything a report carries, snapshotted by fleet.h.
+struct FleetReportData {
+  const char*       id        = "";
+  const char*       client    = "";
+  const char*       room      = "";
+  const char*       label     = "";
+  const char*       fw        = "";
+  uint8_t           ip[4]     = {};
+  bool              i2c       = false;
+  uint16_t          ssPid     = 0;
+  const char*       speaker   = "";
+  bool              spkOnline = false;
+  uint32_t          rotEvents = 0;
+  unsigned long     lastRotMs = 0;      // 0 = knob never turned
+  unsigned long     nowMs     = 0;
+  uint32_t          soapErrors = 0, spkLost = 0, otaFailures = 0;
+  uint32_t          boot      = 0;      // random per boot; scopes the sequence numbers
+  const FleetEventRing* events = nullptr;
+};
+
+static constexpr uint8_t FLEET_CBOR_VERSION = 1;
+enum FleetKey : uint8_t {
+  FK_VERSION = 0, FK_ID, FK_CLIENT, FK_ROOM, FK_LABEL, FK_FW, FK_UP, FK_IP,
+  FK_I2C, FK_SS_PID, FK_SPEAKER, FK_SPK_ONLINE, FK_ROT_EVENTS, FK_LAST_ROT_AGE,
+  FK_NOW_MS, FK_ERRORS, FK_EVENTS, FK_BOOT, FK_SEQ, FK_DROPPED,
+};
+static const char* const FLEET_GIDS[] = {
+  "", "1c", "2c", "3c", "4c", "5c", "hold", "lh", "1c+h", "2c+h", "3c+h", "4c+h", "5c+h",
+};
+static constexpr unsigned FLEET_GID_ROT = 32;
+
+// Interned code for a gesture id, or 0 if it has none.
+inline unsigned fleetGidCode(const char* gid) {
+  if (strncmp(gid, "rot", 3) == 0) {
+    char* end;
+    long d = strtol(gid + 3, &end, 10);
+    if (end == gid + 3 || *end) return 0;
+    return FLEET_GID_ROT + (unsigned)(d >= 0 ? 2 * d : -2 * d - 1);
+  }
+  for (unsigned i = 1; i < sizeof(FLEET_GIDS) / sizeof(FLEET_GIDS[0]); i++) {
+    if (strcmp(gid, FLEET_GIDS[i]) == 0) return i;
+  }
+  return 0;
+}
+
+inline uint32_t fleetFnv(uint32_t h, const void* p, size_t n) {
+  const uint8_t* b = (const uint8_t*)p;
+  while (n--) { h ^= *b++; h *= 16777619u; }
+  return h;
+}
+
+// Hash of the fields CBOR reports may leave out. Strings are hashed with
+// their NUL so "ab"+"c" and "a"+"bc" differ.
+inline uint32_t fleetIdentityHash(const FleetReportData& d) {
+  uint32_t h = 2166136261u;
+  for (const char* s : { d.client, d.room, d.label, d.fw, d.speaker }) h = fleetFnv(h, s, strlen(s) + 1);
+  h = fleetFnv(h, d.ip, sizeof(d.ip));
+  return fleetFnv(h, &d.ssPid, sizeof(d.ssPid));
+}
+
+// Returns the encoded length, or 0 if it didn't fit.
+inline size_t fleetEncodeCbor(CborWriter& c, const FleetReportData& d, bool withIdentity) {
+  c.beginMap()
+   .key(FK_VERSION).uint(FLEET_CBOR_VERSION)
+   .key(FK_ID).text(d.id);
+  if (withIdentity) {
+    c.key(FK_CLIENT).text(d.client)
+     .key(FK_ROOM).text(d.room)
+     .key(FK_LABEL).text(d.label)
+     .key(FK_FW).text(d.fw)
+     .key(FK_IP).bytes(d.ip, 4)
+     .key(FK_SS_PID).uint(d.ssPid)
+     .key(FK_SPEAKER).text(d.speaker);
+  }
+  c.key(FK_UP).uint(d.nowMs / 1000)
+   .key(FK_I2C).boolean(d.i2c)
+   .key(FK_SPK_ONLINE).boolean(d.spkOnline)
+   .key(FK_ROT_EVENTS).uint(d.rotEvents)
+   .key(FK_NOW_MS).uint(d.nowMs);
+  if (d.lastRotMs) c.key(FK_LAST_ROT_AGE).uint(d.nowMs - d.lastRotMs);
+  c.key(FK_ERRORS).beginArray(3).uint(d.soapErrors).uint(d.spkLost).uint(d.otaFailures);
+  c.key(FK_BOOT).uint(d.boot);
+  if (d.events->dropped) c.key(FK_DROPPED).uint(d.events->dropped);
+  if (d.events->count) {
+    c.key(FK_SEQ).uint(d.events->firstSeq());
+    c.key(FK_EVENTS).beginArray();
+    unsigned long prev = d.nowMs;
+    for (uint8_t i = 0; i < d.events->count; i++) {
+      const FleetEvent& e = d.events->at(i);
+      c.uint(i == 0 ? d.nowMs - e.ms : e.ms - prev);
+      prev = e.ms;
+      unsigned code = fleetGidCode(e.gid);
+      if (code) c.uint(code << 1 | (e.ok ? 1 : 0));
+      else      c.text(e.gid).boolean(e.ok);
+    }
+    c.end();
+  }
+  c.end();
+  return c.overflow() ? 0 : c.length();
+}
+
+// Returns the encoded length, or 0 if it didn't fit.
+inline size_t fleetEncodeJson(JsonWriter& w, const FleetReportData& d) {
+  char ip[16];
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", d.ip[0], d.ip[1], d.ip[2], d.ip[3]);
+
+  // Small, schema-stable so the hub can render even if future firmware adds
+  // new fields the worker doesn't know about.
+  w.beginObject()
+   .kv("id", d.id)
+   .kv("client", d.client)
+   .kv("room", d.room)
+   .kv("label", d.label)
+   .kv("fw", d.fw)
+   .kv("up", (unsigned long)(d.nowMs / 1000))
+   .kv("ip", (const char*)ip)
+   .kv("i2c", d.i2c)
+   .kv("ss_pid", (unsigned)d.ssPid)
+   .kv("speaker", d.speaker)
+   .kv("spkOnline", d.spkOnline)
+   .kv("rotEvents", (unsigned long)d.rotEvents)
+   .kv("lastRotMs", d.lastRotMs)
+   .kv("nowMs", d.nowMs)
+   .key("errors").beginObject()
+     .kv("soap", (unsigned long)d.soapErrors)
+     .kv("spk_lost", (unsigned long)d.spkLost)
+     .kv("ota", (unsigned long)d.otaFailures)
+   .endObject()
+   .kv("boot", (unsigned long)d.boot)
+   .kv("dropped", (unsigned long)d.events->dropped);
+  // Gesture events ring buffer — every click/multi-click/hold the hub hasn't
+  // acknowledged yet. Hub stores them in a rolling log so the pulse view
+  // shows individual user interactions with timestamps.
+  w.key("events").beginArray();
+  for (uint8_t i = 0; i < d.events->count; i++) {
+    const FleetEvent& e = d.events->at(i);
+    w.beginObject()
+     .kv("seq", (unsigned long)(d.events->firstSeq() + i))
+     .kv("ms", e.ms)
+     .kv("gid", (const char*)e.gid)
+     .kv("ok", e.ok)
+     .endObject();
+  }
+  w.endArray().endObject();
+  return w.overflow() ? 0 : w.length();
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <Arduino.h>
+
+// =============================================================================
+// JsonWriter — fixed-buffer streaming JSON emitter.
+//
+// Writes into a caller-owned buffer; with a Print sink attached the buffer is
+// just a staging area and is flushed to the sink whenever it fills, so output
+// size is unbounded (web responses, fleet reports). Without a sink the buffer
+// is the result and overflow() says whether it all fitted.
+//
+// No heap: no String temporaries, no per-field escape copies. Commas are
+// tracked per nesting level, so callers never hand-place separators. Keys
+// given as string literals are copied with their compile-time length and are
+// not escaped — ours are plain ASCII. Everything else goes through RFC 8259
+// escaping: quote, backslash and all of U+0000..U+001F (control characters in
+// track titles used to pass straight through). UTF-8 is passed as-is.
+//
+//   char buf[256];
+//   JsonWriter w(buf, sizeof(buf), &stream);
+//   w.beginObject().kv("vol", 12).kv("title", spk.title).endObject().flush();
+// =============================================================================
+class JsonWriter {
+public:
+  JsonWriter(char* buf, size_t cap, Print* sink = nullptr)
+    : buf_(buf), cap_(cap), sink_(sink) {}
+
+  JsonWriter& beginObject() { separate(); put('{'); push(); return *this; }
+  JsonWriter& endObject()   { pop(); put('}'); return *this; }
+  JsonWriter& beginArray()  { separate(); put('['); push(); return *this; }
+  JsonWriter& endArray()    { pop(); put(']'); return *this; }
+
+  // Literal key: length from the array type, no strlen, no escaping.
+  template <size_t N>
+  JsonWriter& key(const char (&k)[N]) {
+    separate();
+    put('"'); write(k, N - 1); put('"'); put(':');
+    afterKey_ = true;
+    return *this;
+  }
+  // Runtime key (e.g. a gesture id) — escaped like any other string.
+  JsonWriter& key(const String& k) {
+    separate();
+    quoted(k.c_str(), k.length()); put(':');
+    afterKey_ = true;
+    return *this;
+  }
+
+  JsonWriter& value(const char* s)   { separate(); if (s) quoted(s, strlen(s)); else write("null", 4); return *this; }
+  JsonWriter& value(const String& s) { separate(); quoted(s.c_str(), s.length()); return *this; }
+  JsonWriter& value(bool b)          { separate(); if (b) write("true", 4); else write("false", 5); return *this; }
+  JsonWriter& value(int v)           { return value((long)v); }
+  JsonWriter& value(unsigned v)      { return value((unsigned long)v); }
+  JsonWriter& value(long v) {
+    separate();
+    if (v < 0) { put('-'); digits(0UL - (unsigned long)v); }
+    else digits((unsigned long)v);
+    return *this;
+  }
+  JsonWriter& value(unsigned long v) { separate(); digits(v); return *this; }
+  JsonWriter& null() { separate(); write("null", 4); return *this; }
+
+  template <size_t N, typename T>
+  JsonWriter& kv(const char (&k)[N], const T& v) { return key(k).value(v); }
+
+  // Push whatever is staged to the sink. No-op without one.
+  JsonWriter& flush() {
+    if (sink_ && len_) { sink_->write((const uint8_t*)buf_, len_); len_ = 0; }
+    return *this;
+  }
+
+  // Sinkless mode: the document so far, NUL-terminated. Drops the last byte
+  // if the buffer is exactly full (overflow() is already true then).
+  const char* c_str() {
+    if (cap_ == 0) return "";
+    buf_[len_ < cap_ ? len_ : cap_ - 1] = '\0';
+    return buf_;
+  }
+  size_t length() const { return len_; }
+  bool   overflow() const { return overflow_; }
+  void   reset() { len_ = 0; depth_ = 0; needComma_ = 0; afterKey_ = false; overflow_ = false; }
+
+private:
+  char*    buf_;
+  size_t   cap_;
+  Print*   sink_;
+  size_t   len_ = 0;
+  uint8_t  depth_ = 0;
+  uint32_t needComma_ = 0;   // bit n: level n already has a member
+  bool     afterKey_ = false;
+  bool     overflow_ = false;
+
+  void put(char c) {
+    // Keep one byte spare for c_str()'s terminator in sinkless mode.
+    if (len_ + 1 >= cap_) {
+      if (sink_) flush();
+      else { overflow_ = true; return; }
+    }
+    buf_[len_++] = c;
+  }
+  void write(const char* s, size_t n) {
+    while (n) {
+      size_t room = cap_ - 1 - len_;   // cap_ ≥ 1 whenever we get here
+      if (room == 0) {
+        if (sink_) { flush(); continue; }
+        overflow_ = true;
+        return;
+      }
+      size_t k = n < room ? n : room;
+      memcpy(buf_ + len_, s, k);
+      len_ += k; s += k; n -= k;
+    }
+  }
+  void digits(unsigned long v) {
+    char tmp[10];
+    size_t i = sizeof(tmp);
+    do { tmp[--i] = (char)('0' + v % 10); v /= 10; } while (v && i);
+    write(tmp + i, sizeof(tmp) - i);
+  }
+  void quoted(const char* s, size_t n) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    put('"');
+    size_t run = 0;   // start of the pending run of bytes that need no escape
+    for (size_t i = 0; i < n; i++) {
+      uint8_t c = (uint8_t)s[i];
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+      write(s + run, i - run);
+      run = i + 1;
+      switch (c) {
+        case '"':  put('\\'); put('"');  break;
+        case '\\': put('\\'); put('\\'); break;
+        case '\b': put('\\'); put('b');  break;
+        case '\f': put('\\'); put('f');  break;
+        case '\n': put('\\'); put('n');  break;
+        case '\r': put('\\'); put('r');  break;
+        case '\t': put('\\'); put('t');  break;
+        default:
+          put('\\'); put('u'); put('0'); put('0');
+          put(HEX_DIGITS[c >> 4]); put(HEX_DIGITS[c & 0xF]);
+      }
+    }
+    write(s + run, n - run);
+    put('"');
+  }
+  // Emit a comma if this value is not the first at its level. A value right
+  // after its key never takes one.
+  void separate() {
+    if (afterKey_) { afterKey_ = false; return; }
+    if (depth_ == 0) return;
+    uint32_t bit = 1u << (depth_ - 1);
+    if (needComma_ & bit) put(',');
+    needComma_ |= bit;
+  }
+  void push() { if (depth_ < 32) needComma_ &= ~(1u << depth_++); }
+  void pop()  { if (depth_ > 0) depth_--; }
+};
@@ -0,0 +1,219 @@
+#pragma once
+#include <Arduino.h>
+#include <NetworkClient.h>
+#include <lwip/sockets.h>
+
+// =============================================================================
+// LanHttp — one HTTP request to a player, read a slice at a time.
+//
+// HTTPClient returns only once the whole response is in or its timeout
+// fires. That's fine for a SOAP call the selected speaker answers in a few
+// ms, but discovery talks to players that may be slow, asleep or gone, from
+// inside loop(). Nothing here waits on the network:
+//
+//   begin()  opens a non-blocking lwIP socket and starts the TCP connect
+//   poll()   while connecting: asks select() whether the socket is writable
+//            yet (zero timeout), and once it is, hands it to a NetworkClient
+//            and sends the request. After that: reads only what has already
+//            arrived — at most LAN_POLL_BYTES — into a Print sink.
+//
+// A player that hasn't accepted within LAN_CONNECT_MS is treated as gone.
+// NetworkClient::connect() would sit in select() for that long under the
+// state lock; here it's a few cheap polls while loop() keeps turning.
+//
+// Requests are HTTP/1.0 with Connection: close, so the body ends at
+// Content-Length or EOF. A chunked body is decoded anyway, in case a player
+// answers with 1.1 framing regardless.
+// =============================================================================
+static constexpr int    LAN_CONNECT_MS = 250;
+static constexpr size_t LAN_POLL_BYTES = 1460;   // about one TCP segment per poll()
+
+class LanHttp {
+public:
+  enum Result : uint8_t { PENDING, DONE, FAILED };
+
+  // Start the connect; the request goes out from poll() once it's up.
+  // `headers` is zero or more "Name: value\r\n" lines. `body` is copied.
+  // False only if no socket could be opened or the address is bad — a
+  // player that doesn't answer shows up as FAILED from poll().
+  bool begin(const String& ip, uint16_t port, const char* method, const char* path,
+             const char* headers, const char* body, Print& sink, unsigned long timeoutMs) {
+    end();
+    IPAddress addr;
+    if (!addr.fromString(ip)) return false;
+    size_t bodyLen = body ? strlen(body) : 0;
+    char head[320];
+    int n = snprintf(head, sizeof(head),
+      "%s %s HTTP/1.0\r\nHost: %s:%u\r\nConnection: close\r\n%sContent-Length: %u\r\n\r\n",
+      method, path, ip.c_str(), (unsigned)port, headers ? headers : "", (unsigned)bodyLen);
+    if (n <= 0 || (size_t)n >= sizeof(head)) return false;
+
+    sock = lwip_socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) return false;
+    lwip_fcntl(sock, F_SETFL, lwip_fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = (uint32_t)addr;
+    if (lwip_connect(sock, (struct sockaddr*)&sa, sizeof(sa)) < 0 && errno != EINPROGRESS) {
+      lwip_close(sock);
+      sock = -1;
+      return false;
+    }
+
+    request = head;
+    if (bodyLen) request += body;
+    out = &sink;
+    connectBy = millis() + LAN_CONNECT_MS;
+    deadline = millis() + timeoutMs;
+    state = CONNECTING;
+    lineLen = 0;
+    code = 0;
+    left = 0;
+    sized = chunked = false;
+    active = true;
+    return true;
+  }
+
+  // Read whatever has arrived. DONE once the whole body is in, whatever the
+  // status — check status() for 200.
+  Result poll() {
+    if (!active) return FAILED;
+    if (state == CONNECTING) {
+      int up = connectState();
+      if (up < 0 || (up == 0 && (long)(millis() - connectBy) >= 0)) return finish(FAILED);
+      if (up == 0) return PENDING;
+      client = NetworkClient(sock);   // the client owns the socket from here
+      sock = -1;
+      client.write((const uint8_t*)request.c_str(), request.length());
+      request = String();
+      state = STATUS_LINE;
+      return PENDING;
+    }
+    uint8_t buf[256];
+    size_t budget = LAN_POLL_BYTES;
+    while (budget) {
+      int avail = client.available();
+      if (avail <= 0) break;
+      size_t want = (size_t)avail < sizeof(buf) ? (size_t)avail : sizeof(buf);
+      if (want > budget) want = budget;
+      int got = client.read(buf, want);
+      if (got <= 0) break;
+      budget -= got;
+      for (int i = 0; i < got; i++) {
+        if (!take(buf[i])) return finish(state == DONE_OK ? DONE : FAILED);
+      }
+    }
+    if (budget == LAN_POLL_BYTES && !client.connected()) {
+      // EOF. Fine only for a body that runs to the end of the stream.
+      return finish(state == BODY && !sized && !chunked ? DONE : FAILED);
+    }
+    if ((long)(millis() - deadline) >= 0) return finish(FAILED);
+    return PENDING;
+  }
+
+  void end() {
+    if (sock >= 0) lwip_close(sock);
+    sock = -1;
+    if (active) client.stop();
+    request = String();
+    active = false;
+  }
+
+  bool busy() const { return active; }
+  int  status() const { return code; }
+
+private:
+  enum State : uint8_t { CONNECTING, STATUS_LINE, HEADER, BODY, CHUNK_SIZE, CHUNK_DATA, CHUNK_END, DONE_OK };
+
+  NetworkClient client;
+  int           sock = -1;       // ours until the connect completes
+  String        request;         // head + body, sent once connected
+  Print*        out = nullptr;
+  unsigned long connectBy = 0;
+  unsigned long deadline = 0;
+  State         state = STATUS_LINE;
+  char          line[96];
+  size_t        lineLen = 0;
+  int           code = 0;
+  size_t        left = 0;        // Content-Length, or the current chunk, still to come
+  bool          sized = false;   // Content-Length seen
+  bool          chunked = false;
+  bool          active = false;
+
+  Result finish(Result r) {
+    end();
+    return r;
+  }
+
+  // 1 connected, 0 still connecting, -1 refused / unreachable. Never waits.
+  int connectState() {
+    fd_set w;
+    FD_ZERO(&w);
+    FD_SET(sock, &w);
+    struct timeval tv = {0, 0};
+    int ready = lwip_select(sock + 1, nullptr, &w, nullptr, &tv);
+    if (ready < 0) return -1;
+    if (ready == 0) return 0;
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (lwip_getsockopt(sock, SOL_SOCKET, SO_ERROR, &err, &len) < 0) return -1;
+    return err ? -1 : 1;
+  }
+
+  // One response byte. False when the response is over (state says how).
+  bool take(uint8_t c) {
+    switch (state) {
+      case BODY:
+        out->write(c);
+        if (sized && --left == 0) { state = DONE_OK; return false; }
+        return true;
+      case CHUNK_DATA:
+        out->write(c);
+        if (--left == 0) state = CHUNK_END;
+        return true;
+      default:
+        break;
+    }
+    // Line-oriented states: status line, headers, chunk sizes.
+    if (c != '\n') {
+      if (c != '\r' && lineLen < sizeof(line) - 1) line[lineLen++] = (char)c;
+      return true;
+    }
+    line[lineLen] = '\0';
+    lineLen = 0;
+    switch (state) {
+      case STATUS_LINE:
+        if (strncmp(line, "HTTP/1.", 7) != 0) return false;
+        code = atoi(line + 9);
+        state = HEADER;
+        return true;
+      case HEADER:
+        if (line[0] == '\0') {
+          if (chunked)       state = CHUNK_SIZE;
+          else if (!sized)   state = BODY;
+          else if (left)     state = BODY;
+          else             { state = DONE_OK; return false; }
+          return true;
+        }
+        if (strncasecmp(line, "Content-Length:", 15) == 0) {
+          sized = true;
+          left = strtoul(line + 15, nullptr, 10);
+        } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strstr(line, "chunked")) {
+          chunked = true;
+        }
+        return true;
+      case CHUNK_SIZE:
+        left = strtoul(line, nullptr, 16);
+        if (left == 0) { state = DONE_OK; return false; }
+        state = CHUNK_DATA;
+        return true;
+      case CHUNK_END:   // the CRLF after a chunk's data
+        state = CHUNK_SIZE;
+        return true;
+      default:
+        return false;
+    }
+  }
+};
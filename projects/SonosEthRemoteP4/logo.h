@@ -1,202 +1,565 @@
 #pragma once
+// GENERATED by webui/build_webui.py from webui/logo.png — do not edit.
 #include <Arduino.h>
 
-static const char LOGO_B64[] PROGMEM =
-  "iVBORw0KGgoAAAANSUhEUgAAALQAAABFCAYAAADjA8yOAAArOklEQVR42u19eZhcV3H9OXXf655N"
-  "I83mDYHAm2ZatoGIJQSMCJgk7OtMYiBAQoKB/MAsMcTGUqtHC1uAQCBgYsAEh0Ud9iWAjcOwLzF4"
-  "QSPZlryAkCzNJmk0M9393q36/fFej3rGs0s2DtL7vvdJGnW/ufe+unWrTlWdYm971xE8mC5SM2AQ"
-  "wb63fqD/mXlACoACQB7rggL64t62rpfVS/DBCcQxgACA1D4BICf/ZSYEaICl/5n+hZp+QGEwgB4w"
-  "BRkDGBWzPSBvJfBDUH7w9gO/3o/ku+wBpAj4Y51pHutcAX1x9Qfvalt9RkR5JMhHwWwNgEcocBrB"
-  "ZsDq0q+VDHaI5F4CtwO4SZQ/axwq33IpdpWrz0rXylenu9grXXdb6vcXcnUDrrqO72zJPSwO8FQ1"
-  "Pgawsw14GIjTYKgjOE7YXgC/EsO3JXb/ffmhW0cAYBu6XQ+Kk+8iELLxwSTPCpgjGZvWzyoJYKMj"
-  "W2g0AWnpmnOm1U9lm1MlfurTJuWf1a+cLpRzBXiqh13qVfdv6VhzvVCv4YEd1wPw3YDbBiiX8MKr"
-  "m7SAvnjLKeedStNuBZ4fwR4tkNaAhKUPVhjMjv4Sgk0k2wU8S4ALDUAkqqMdmTu2Wu4GL/bF+MCO"
-  "G6obpVYhLOaqVSIb0ed5/AWbRcD3dqx5pDO+OSae7cjWsGbeaoDRQLBeyDYBzzfg5Sp6z5aONf8x"
-  "NBF9sOdIcXAb4HrSjSHVLfhguQFo+vfZF5BQTV5zrDAzJP/Q9M9F/k5T2JQ7NrPIVEumPjZTkqdm"
-  "KC8VuOu2duT+Z0tb19OKgCdg+amnw4K0UgHQV2BV3Zb23Aaa/Tor7l8zlKcR0hrDrGzqK6Y+MtXY"
-  "kjFVx1s7vvRzaoA4cnXGuddm4K7LtOd+ubm962+RCvM2dLvFjnFLS+d5AFhAX0zAtqHbdQPueAhy"
-  "utFcoa3raTD7SJMLXm5Aa+2copp5p3PW6pqAXJUVt76tPvxVvq3r+T2Ar85xQS/DYN5g/v48fpa4"
-  "MLPdx/QcJn8KkxcoBsOEeSubWp0ET8m64Pot7V2fvLzp7I4CoAsV6uoRm287t/PcjsYf1jlXMKB9"
-  "XOO4bOoVZunvduktvO+cJsdX/QwAxGY6oXFcMVUn8sisBB/f2p77QW9716N7UPR5rAsWoTnVwK++"
-  "u23Nrzev6HzdllPOO7UHRV81D/JYF9ji1xkA2J2Ml0FH7osQXgliuGTeAxbXzmnavKfMNzazMY1j"
-  "kivrXfClfOual/eg6LvR7Rb0IhoYuAYJHI/+ggeTYN/vVpDCRmg2QUNlNI7eNq7++maXeWVTXeYn"
-  "vaesPn8hQp1P7e58xzmPyjLoCylrxzSOPMwABunL4jGMU9LnSGSKCfNwIn8SUH6Ub+/qKaAvXoRQ"
-  "m9K+YGbntgSZDzP2d29t6bx6y4quCxNz5KjWXswJtQ3dUgR8oT23vlkyz4HhoWZcG5s5W4T2T5wk"
-  "BpGZxqaadbxmU0fuSUUUvSxAdUVj6q8d9/EnDThEIJZap+sP+CIANZsww0bQNhnwA0c+n7TwiMY+"
-  "EDmL6r6aX/7IFRsTU4ezCTMA5Dtyp4UIv+ZETimZjwmGPDYhnnHMZnYEsINRovXr6sV9Pt/R+cIC"
-  "+uLu+c0PA8ANwzsvixA9/KBGbwRwR70LXuUcv7+1petnW1o6/37rss62HhR9ITERuQ3dbi6tnQek"
-  "B0X/9hVdqwj+U9m8EribtDtcIk66hLmKh5kj6Q3vM4CzCbQxuQ+q2dcd7BcAAzGEMPyLmv4kTL6q"
-  "f8DybAZYSGYC5fVe0Vgv7qKMyBMcZF0Mc2XzUYO4hzOoXEzANmLdjMLSj24WABWzq+roVpYTYQ6O"
-  "+4Bhvo4OBL5F4IdZOqew2JtZ1uTTvW2rVxdRXIiJZHlArhy+43dvH97xgSuGd1ww5uNLYFAQj1vh"
-  "Mh9DwLu3tHZ9eHPb6scQsB4UfVVrz/zIdQIAmYAvqhOpV0BAHlHDOI9hTxN0ZVNz5B9tbM09drZF"
-  "ZeqENJN8wTIJXwAAE+ZRMX0LDWOxKVJbp+rA/aFpbRIwNUTe4amNDK8smf+Vmt1SJ+5l3hRVOFCI"
-  "3BzHrOtB0W9u73pGRtxzJyy+X4R5moodIyxIX7go1NdJ0BArPgzgooW8q6rm/SDOzlyKXWUP3BoS"
-  "9IanD8eV1U7ktU3iXqdmr9va2vVjwq4q+Ymv9hwqHpxzUY2PqcqLwdx9/TiLFzhHVjEqg/ksnVPx"
-  "fzHfThUBcUij2w/6ys0V83sIjJJssqNa4Q/WBLFEqrNUO6usfj/MzhDyCY50AF2N4O+f7bjdjqIB"
-  "gAeuwBxmyQKHM5/vQk0+croZO2wSemcwYbHPijyt0Nb1tIUiHwTsdOyKU1ypgSCN+tv1B3d+uDzc"
-  "f8F4HK8bV/8pAx6/3GU+lXUNd2xq6XpfvvXs5vs66H2aHv2nas3zp5tL9QyCGW9JbwZBXfIzV0fn"
-  "MhQJKGFACmDt82kKFUA8sJ/Aj6iIIAaBXOrNdqSj+ZrSXhBS1kamikXCWL9nka3RBpQZxk4F0OCC"
-  "N45ZdDkhzIJ/N+bjnwvxR0l0xhArfppCeDPizflTzr0gMP5J2RQ8uhEWCc8nykVhs64xQakkJ8eT"
-  "AN4V22QsCQRMQKPwEgDfXfxmSgJRzls2cS77cPnBHd8H8P08Vr1mZEXDiynYWifypolK+BEAh2uC"
-  "M+ifHId5SdatZnNPjrMyrvEWgnvVzFHoYMiAVkdDI4AmA5YRaFKgWcAmMywDrS4CloM8PJ9ASwRD"
-  "hnKhIy/0MPhkkcxgjwAwauDFgLkE/v+/ddUxCKoqJIahYmrTnTQDpGxeafJmwL5TJn5H8l6DdTFZ"
-  "YGQcL960ouuOWw6essdSU+Wo3dinTt1zsuJkwuIYizQ3DLAMRSqm5k3Hs+IaK6azmXhJUAo2aNAv"
-  "OQZrvJkCcAa6yJQw+9N869nNPcPFw1PHulDHIhCgT6uBl/ecekFjuRI9GcBFBpwWw0CKzghaogiv"
-  "uiGmfwrJEMCFJKViagKKNxvVwY6ttdHTxV6BLWBClcQjTZ1IQ70EEnv9Emi5RgkuLKmHN6valAvR"
-  "NjaHke/tqHK8X9QyAaqhXEL8bjUbBqRZYM/OiHvsdKEmQEdhSHRMmD5VzD4D8OVOZJmaoWR+tB7u"
-  "EeXAX1JE8YoedDtMhmL70jnwKdX4+uLsDdMsnUTmv+fpL4VysKx2aVaCt1bmOA0NoBnDWpEnQA+z"
-  "gNJuzK4G8Iue5Pt+IZFNgbpk8WykAOg7W7rWeNjFlUr0ihYXriyZoqT+hsj035cfjvckQZmjoEGx"
-  "ihPLr19c8nphxsmnM3TnxKapLWUQog3tA4cLyB0GUQEwDnCcZuMKjBMYAzgOwxjExgmMmXHMgLGs"
-  "yETFdHsQLGiN6dKIjc/SyYT6T0Dtx3UueGFZE4/dQ0dgyAjZOJdQhxSROSRaAVdHQcW08f6yiyVx"
-  "JcqrO7i5p39HJQ0WbGX7gb6suCdUzHuALnV4fVn9v4SQSwTIgGwxs7vUsAKAy0DCMUT/Fgp9IrCT"
-  "eQUsAJo/fW0D4vFcnFjkizHHTEBGpoci8OLCgdvvTX/+tt72rr/IiLtgLhNvFs2rAekiRKclOrMb"
-  "RRRnfenb0C0jKEoBiAoBDylMQbt4U2vnkwPKM5bR4aCP7j3so3coee3bR3b0z4UmFlHU85i7OBD7"
-  "jTcbDzgZ1ZdE0RCEfcqI7TA8jOQKAxoB1BOsB20FzE6DIAND1sgMgAxpzswaCLsu8KYHFnLsgagT"
-  "sDky9QacQ2GPpzUlIXc7ZIavBeTzLXH8OdusIvW3gjxoZjPLNakTgDOzX97PDh9vvzfsyGPd/maU"
-  "w7egbyKPri0Z4Bu1PiEMUWPo3zka2ceyJp0KvNWAnynsjICy0ptl6xkUK+Y/TuBLk3ZzItDmKkce"
-  "SnGnpifYYkboMwyCCYu+VRjYee9VWBvuxQQ3oj/aDH47AC+IYDrbJpnJ+ZzMeRGXTRzWA3MNydKk"
-  "H7+1vfNcU77SkdLowneUTFFW/U6JdvVIJvzme/ffMlbV5GvQzdpkoenKpBc4VC/hByIoogQpm0zB"
-  "MZh6ce8pHLj1ziWbHLFG58z1gRW+USpByVfEPTsD+UzZVLKUC2MYokQqRQ11JF4CMLDZrQkNKFKO"
-  "7bX5ke0/wiKTZO4XXC7wcRJBgwJg64rouwcP8p6MyKrIzDvQeejh0X23HywAg4W21asDBg/16nsc"
-  "3MqAfEjZtCyUDIwX1D57DboJFGGQlRmKW4rDnMAEcpMB3IgmA5qMgG0ihudDJ2AWzZpIkSgTzAXZ"
-  "buzINWa8/hmAVwXmnlkvgsMa3x1DP6s2VRunTmJqVxfnnE8BXFmy+PMw1mVEnldrOhF0genuQntu"
-  "BGQJZuMAJgyYEGLcjBOAjQM2Aco4YONmnCBsIiOCCnBrUBjedXghi9t7Sm6sutHSQbBqMwuRReKB"
-  "z4tHi1g2D8gZgNs7h/22EZMJZw/IlQd46a5d5d72rt0OsiqGKklnhrFsR+6vC9BGmuQIPCzWwDnn"
-  "jzg6klIXUADojVPhugNVnPRUB6ACs8UGEAyAh+6bjqAoMFvKL70ZzNAB8qUpynEf4fWw+SLEtim2"
-  "r7cHdesOaYRI9TuednXF8b8LA/1HpmljXYATZ9WTy9QKqii6MF5uCJ9bm0phMK9mnwE5BLVlIOoI"
-  "1JOog7EOQBOBNgOzNMsYkBVYCDAwQ4OZfnfeJJPvYZ17Cvp8L9TVrI1MX/gZMzNntJFpCQ4KXjKH"
-  "9i38fiPeMFBiM5BcFVI+AWM5hv5EDT9qCLDbMQiP+PiAkAdLPh6A6k9q4amjhrCuIBwWjSakilYM"
-  "5RmSNkbn8EHgKPUKbfFQPxNM6BbgBII2ftBX/rmM6BMbRu7YMTmmVavqcE+jAh26HQeQnyE6OlMe"
-  "dgGwV2NtKFK6K4xlNDa8y9L3bwAdCIMe0caxSwr33FNasskx30JvwylGwHoXBGD8QcQH3bSdKROm"
-  "5QyZpbFDYQMZutCb+izkcFnj15Q03pUNslflgWunm0g0ZJcSSmHqJKnJ8pkigTY7apJG4bCDxkeR"
-  "qLdpekfnfpcGgLcM73zO9CIGAoYlClseYGIylY5UQv+LDN1ZllZnxGZQGAiukPGmA4X23CCIMowl"
-  "AmXQSmYokyiroUKwnBx6iEiLQFQyEKuY/2mAk9ekiVNIgdbpLm2Wki2b96HIGoGgnODAEgjPFnPX"
-  "NtDdEwOfKQBaW4Uxw2G26EuIs6v7aw1OsRQMHk+wxTl3Sohp8KMt0W/Z3Jp7HA2PBrXBz6PhDbDI"
-  "Z68pHLr5YK3Dl5oncQG5ZwaUlWqGyPw1MF5f59y1FdPk0Wa3gvgtjJ4wD1AMyADMwqxegFYDGkE0"
-  "AFYPoN6AUIE6A9ecFOjpthKRmQwhUBCp3lUyf3W9uC0VU42TnGWX4POqAp6RETnDa/T6mUFvLS8t"
-  "L570MBjsSYlQ9CnQXfXpJmx+E2/KTlKziercAs6N8U8iNW2rz6gz9+8N4p4ZgPPH3RP7HKMV/y0A"
-  "B6tITwIRFjWV+OdH0E+a2bedcJ0ju9PgDwlCo/ilhUO33b1kk+OkKE9zBQwZ49QCLW/xFyNlpxEv"
-  "m16/qNBYQafAuQBuzGEdgb6jUqVyyJZW5+EqphaSj9nSmstdMdy/YyO2BwB8QK+Am9HkSDSxAYbz"
-  "QYR2VE1+jsaLQTqdw8xMEBXgnS1nLldz32kUt+agjz6t4DcC4HDqX9jMAm00eIuXLfsNjiR2c80J"
-  "mAyDGDDl50X4ODX7DWB/L6Sk0WdIGHyvt33NmMEOE5gAAGU1qILDVB4G7aCRQwabANAgaodCF4zG"
-  "pgMnBXqaZiKRTc1IiZNsg1UZBv+qZr8ww95A5CFxAlcyyfSCeNNYkoJV9KPPas0DFQ7q4oMqVdxY"
-  "QwbBhMS9BF6cIh3MuMz/VlA5H+SM+QYJZKASk+ZAi2Esj2NfQyjv8YLA+8o9Nc7blKuIbimg6Dcx"
-  "s36FBGsO+uivNozs/PwxKYmpzvK9geBNAJ6rxPdhHAXQeBQes3YDswTaE8eYIokf0hCQEjqBkDCz"
-  "SbvInCFDwWHV/pMCXXMN4+yww1g3zYZmhnKREhdVzMfeDJJktUUwO9TkgvbDcfQGERfn21afURi6"
-  "bS8AVrPsAkb7oiSTU5aS61sy7+vEvajQ3vWG/GD/B/OAXJYEMn69hCkOzSZw1V/Zg6J/08qV9TLG"
-  "1x7U8ufWj9z2+TxyGaBDJ234ea6ZAis1UcnxRgl6jmgUZemeHKPqEJqvYxCMmb904+D2j896enTk"
-  "GlFCBgy1ISj5A0FWTwNRKmkmAzlpctReK9tcpgyrs8RenDzOJ8x7JrB7YIAFJFRtNw2fB7AhpDxO"
-  "YbsRZPdVv1d1MhnI73zFDjnKcn+0ZnBRfmHF1GfFfWBzR1fbdQM7NgHQPHKZNVjjqxtnIU5veuxj"
-  "NnqC7rRMrGV0WWc2kIYycHVSDNChx5IwNAWXNx6s2sypDyKpGePSTME3Fdpz6wAqgRISxzAAgF7o"
-  "qICCDEpgfLBkLl6ucXYcrJeMLVPjSZOj9jiMQ1/HWLLTz3Emi87aSFqduE4Py5dUQeAsVYsKA7cc"
-  "SDWxph/mFXt3Dm/qyN3pyEer2VIKIWiAi0y1nsGGP+9Y8xdPNf3H/GD/D4D++/BSzIPr2zxFvCgC"
-  "cM7aDTCo7U/C+H3H0VHRIcBJteDemw0L2Y4keQqhcE0At4azI6oz2jUhiUNxNCAnxTl5kQCg5Wyd"
-  "gfWGKXkXVlPAYAGIWPXOkvpvR+Y/qKZHytHYs/NDO747HfJKgw5mZj8PkhyXYwnjy7jF3pGPCynf"
-  "39q+5kOXn3Z2R1LRDckfhzz04mQWCYYIEGId1YjgccSTSrVRJiYJRjVoDFA2j3H15QmLowmL4+o9"
-  "rjPfE+or4xrHAE8KNACMYK3kAVHB2RmRbBrBogFwINU0zeIx78CSAd838McZuEeBbGoI6nxve1dP"
-  "fvkjV2BKPkcVN+Y3FUY7xjK1tH5OPcwyIv/Q5DO/3NzR+fKEtAa6iKpuzBxESzbjSF3mtrL5Sqx4"
-  "UQHQffhVkE84XLiQe55JVCbDoGAgYHOVH8WR8KZ3q9mdzS7ICiQ0MMC8NzLeEJBYeUILtGkseUD2"
-  "YiLJ3RX/0iBBlxSAORDe9IABXwrBPVC8ITLdLeSLml1QMODJBnyuTPduMZSbl9WXa02KnhR7rQ+C"
-  "75ZM9wYQOdbCYqa8FhOW8FJkGX5qa0fu6/n2znOTqm64pW6capHre/ffMqaGaxsleG2+pfO8S7Gr"
-  "XEhZohZyz8O1MJasATWliNDqmpjBhMwIWRlTf4U32xWSWEjOfrIprDE4gQMpFmnzWGIi9FcKLZ1P"
-  "CEwuLsFbNf87Keegh9kzImiD0Z7gKGtCCsY0+nevtiJDeWgEW3Xl0I7XzpyUsy64bH/fWG9b19VZ"
-  "5zaMWey5BAhvplzB2MxixFpP9yyAT9rUlnvb+qH+q5ho20l6rMU5b0UzgO8WW+/Nntcg8oPeFZ2X"
-  "EuyTOBpfyDNuOrJreDbuP1Vmg4AiQEZq9l1sBg+zDOWMWH0Qq+2lsDa3mwskJznhBDnlwrMGJ6Pf"
-  "7G3v+m5vR9f36OR/SDZoDTtRmsN8ep24h8H4uz3hodfEpjeOa/yOyPDlJhc0RcB1Bty1qbXrojzy"
-  "Ml07bkSfN4BBxT44rn4gPA5aehrhipsw7w1YXufcR7d05D6XP/3c9h7AL8WuLgC6EeDbhm7bOw59"
-  "thkm2oLMp0LHu5EJD8x1MxMesExw76Obc4+o5SNJHO9TqhyZ/WX1X1O1L1XUfy1W/UpF9ToDvCTI"
-  "h4nIKcvC8BpHnj1bxuDMGWWMgxM3JMggK/LEqvRVoIhngNUsSZf1RjzsEXHrJyP6m0LDNUZ3naM8"
-  "jPCraPiQCl9RQOF6IC9AwaYf41eMFod6M6vfGErmP2OLIxwXLX3UtvYwm7BYGxj8JWM8blNb7u/W"
-  "D/XfUGVsXaxQ5wEpDO/86T8t6zzfgviVRn2SGhs5S+X65M8J70I/PiU/BkAuhe2MUk/yWQYMp5mA"
-  "TKE7sZT+yasdOYIoEnLF4lAhi09o2K5i6hNEg6jhU7uPFsxQAgGXV9SHXuV9frjjzkz7gf8sKS6r"
-  "lyA3rnGrNo79/asH14YFFKKZAg3b0O16hoqfKbR3PmmZy7z2iEYRwfB4njwA3bjFUR2DR8SMP5s/"
-  "9YLzC/v7Dtw3YWphUGYeuUxhtH8IwHvTe9Fm3dF/PUWBPiD2ezXgzzN0fywAohQj1ZqPWlLxlFkK"
-  "18uJjnK4VEvMyCuXZgJVKuq/OqH+o1cM9r+wMNzfH7QPbBXKP8awICAB2O7CPfeULsKZOkf0TLeh"
-  "2+ngzv835uMvNUkQGmauKjnmOhyoEhx3Purtbc+tLy7B/CgCvoD+yvEaVSE9tTSQu8bj+M2lOH56"
-  "pH63QSOtYQwwQEk2prWpmlJN6EI39cnAyjx5wSAQBf5VhX23D+YBwenntkrMyxL+Yrt31Ec3jEfh"
-  "t5NjuDjXwls3irodYDzY0TPeMXBtkwR/Oabe17BrHh9uuyRBP6ChbbkLL+nt6MxsGNi5vhtwucQM"
-  "0Pke0dvSuSVDOSuCGWepEZ150egp9o9XDu7cV0uTsA3d0oOid7SLnHOvEPiXR2pvDV1wDWBNCpgA"
-  "DChiKTd0QEpIijdDyVQ5+xoZE66PsZMCvYDKkWzsV3QDIwXAb44kjOGvN/BqevvNhpGdPwGAdy7w"
-  "CE52SZ/HAP5qU3vXnRlxlysMsWmcsjEdaxCjmrHUZMBpRzTWJgmv7O3oPLJhYOe7FrExuuvFnWPq"
-  "awjh514oISEgylbZBGDfxhk46L3KwWXOXTSu2OOcqcECS4QZZjYWmf7EaHdTca+nDZTJRgc+o4Hu"
-  "wgnz1VAr71Mhn/Bf7DsZWFnA5cX5IhI8LxqUIQCbSXtEfmTnT9JgBhdrV+YBWT+444qy1+ep4e56"
-  "CYKU7622fMlmSSSaJHlPMdpakv/UHmWzkE+KoRabeZg8Pd96dnO+9eyVs1WFTyP208M++qoGctqE"
-  "uYfG1DNmuyfMPXTC4fSy+ld7aKxRGM1GieYkvmciOZWESW7MZD1wiiWvJvBiCF/vwDdkIedXzK+f"
-  "UH1VSKGbNteaaK7BuP2khsaiqlq4Ef1RL3JrBTqaX75qReFQ38GlKP5Cin70DBW/mm/O/ZBZvVLA"
-  "12XosmXzVUf1Pp00FAYB6Wq0pjeDMPmzGnWro0hJ/RcIPCMj0lCG3x+4bIfB/hXAszbO0sGjZveE"
-  "IErV3jILuba0dg7NRkRZRU78gdu2syN3Ux3do8vmrZonkxRbs9GRjWrVgmouDyhnNVp48RGNnmMx"
-  "XpgNwi9aQqUhR+s/0w0q+MJJgZ5fp2pck9BOwN5b1/yRt+z56cSxPjlBP+B6DvcPA3hzb0vXxysO"
-  "lxF8kdK8mVWq1TFJoCcJFSv0oCp/l6IBIHGGV4wQeEg1N6KiehfIG82wOjY7wwzcMLh995b23Lmb"
-  "Wruetn54x/XzoR9mSAnNcwHQPwf0l/w/p7E1YQZK3QL64l7jPwfkZytgRUCnk7UVQGRHoVM1WGyx"
-  "F4irZ/A1Z+MrJkwub2LwjvEkQOUMFtUzCMc1/qkNdnzlRDc5PGBxteVGctxbXL3T/IKsi4IpDYxS"
-  "YT4uCTs9qSmzDd1uw8iO7W8f3P5KddEFZvZlIW9S4AYDfwCwz4CbJIleHjCzLwDcZsQXzPAbwL5l"
-  "4CjT/BMP/RHMHgLYL8rm74Tg7N6O3OVKfCPO+ptSJEPnM48SB7JDq/kiM93V/58vRJ1yoIgf3L7t"
-  "iEbfWiZBJobeAVjMKfDjVODCQ+OsCMou+7bCQP87JzQ+EEBoQDlLF0amw2byNwX0ndg4dJbiOKXL"
-  "xtSOWTEMFfV3escRJKVJ1UABj2dbjsSuLqbQ2jpZv7/vrs1tqz8kcB9f5jJPH7d4cnSRGQLw3NDJ"
-  "hsmf0eDACyLTlDjQrEHCl5V8fBkEWwJKRk19hvLYkMRYBV8BcEMVeZjVgSXrAXChif2e2pCBGO7L"
-  "vDCdbwV5jf5ylPJuGk8PhOfENherKsSbGcgnJicHv1vv3MWxWTYy3TFh/qWbh3bszANyIudyoKT+"
-  "OgCHAQakEUY1oixmgyB3BuAvPXlLlVyFs1d6HCesFgr0aR6QK4du+991wNqnt+e2OPKtBiCGRgTD"
-  "GGZxQvYzSQXsj9LskgDK5hWCS81oFag60pXNRw6BGPEMADfMRAVWLWw1w5DRzqvCjQvrMCmd3hlF"
-  "cXgep5gbh3eNEnhNb/uaa0IIYsQ6e/SU1KRksT3xAO1mb/rEktlHRzX60HuGbhutFvYGJ3iV9z9s"
-  "GNxxx8Lh3aU32MSi6xsHAqBDrxzse1uhvfP7AeWj9QxWTqS2Yw3hOmbgj2FC3iIrPQ2S5HD/FkSz"
-  "ActJPB5T2FGnt47oUxB9zQwv27w89yge6r9pjhD65BFH4gWR6p1XHtk1+PZp7KPTzfOPYW2Yx41e"
-  "YTcvnOw94fO2IP74vRp86L0Hbh2b3ovxhDY5vOnybeh2IyjK9QmnBoDuyXKhfvRZcR7634UhGsdW"
-  "vpQf3PmNfEfusVD/0XoJnpe0QZufGyFO2zeGFBeD14nh8aAtN7POt7Wcubwwcueh+3JEp0z7xk95"
-  "2mV0+gEAT6ntolU1QbbjANfgFOtBMd7Y2vWqVsmcO+TLb2GaZTjXvPfiRl8ANE98rWT+PenBMmNW"
-  "nSWs5ywTXweAwr7bB2u75dZunOABDlLYgyvuLT6t+LAioMUpdRvHHpAhYFvP6GyLy7yCYg5zMLPO"
-  "hK6EJkEJenNu8LxregaK9wJ4/qaO3PuzlDeWzOt8aajV/I6KKcTwEtCCkqkJ2V4X1D0CwE3T4buE"
-  "LKfbbRgpbi+0rH7/qUHdmza3dG2LAr6+MNB370y/Z3Pr6lfW0119UCu3xnWNH000Zp+fz7zqRrcr"
-  "DBR3Fdpzn2l24V8fnjm/RUM6d0Tjmy2s35LSLLAwi6J4IAWaAcj4/yDT/1IxawBWjqKWBql/c0Au"
-  "ajcrDI0SoOwr1/eg+PGrsDa8Hmfq+oHim3rbux5ZJ+5PS0nxrltgr5i0+DdtsGPxmQBumjQxUJvH"
-  "UdRuwOnIaW8dbNl/SqvLvnQ4rvz5ppauTxv0R44c8Cr1pOYAvqhFwscc1mh3Oa68sDC8YzzNG7H5"
-  "K2SKuhEQjcI3jCI6tV6CPyubV5viHJqGoFSIDxT23TiOeTR/8ED2+ytZvF3NQpxAVyDOl72fiIBw"
-  "Md3CLGm97AgcAoAWnKlpCiZp2qtwf8pFNASwSbmGSdJxZdVcH09MrT5gBC/b1LL6B47un5rEvc6B"
-  "r9OUZYQADmsUH9bo30oVny8c2T24mN7ik6ZOQhv255s6cq8n5AM2hcWW4pOMyL0LQVweCIHWkCIV"
-  "8zcr8E06LDuRBDo2owOqtW+LqPo2ppUzbjqrZyzuf1X9QEjpiBdOjTD9M2fMp9U3AuwHZP3IbVe9"
-  "aeXK/+BE4+PN5AIztAM2LsRtXvDTKwd37qu2sOtGURfJHDtpb6u3n2cCUlOag2rDhYqpUuO7Adh8"
-  "tA0PhEAnGoEYoKIMyokVzLFQSOPxzAAsDPQf6e3I/daRHX5p1AgArG0B2nNSeN6/Z88EgO+lNxZK"
-  "MLMoMj+RPw5AVDsTJOykRGw2onHd/ulFA78vgU575/EhBmsE1Z9I8uwsbR2C40a5IEm42vZJGkRZ"
-  "CpE6yKYplenTkZWmc9sbssxETML+kRlhXgLLcqoUVhTippgY0eCpA0tAdsygZ9WCN0ygQBI2hEM3"
-  "H14IAfkDIdASmcLMckKoxvjRiSTQSYszPW6O8CQZpOEAySUSqSeklJgZ1SEAC0J3Qwh3viZEOqmg"
-  "uBlIecNJi7nKPuqWHTgXo7hj4fZ01SmVc6Z1CzOXtMPaN1kWNs/zggeuIyvrspTHlu3+qNJ4MKto"
-  "jS2mJ4/vWhNz91mZhwQSgGXnAimNuK5i/q7Y4GsT/G0q57Tdd7PQi7cjCzEPpmfigfZwTRlfq0pb"
-  "QNDsFtQGfR4kdLpVAgbiBCJQF3UlT60QzCrsuE1ebdY+K/MV1FalsCnR+PfNLQaADcM73nJ8clQW"
-  "htdnTntUW+wrZ6QpsFPgGzFuf7DWFJ4QwjxFY/hoHGbjx3viFJaP6R2QDTXEjTNSC29Dt0uYR7GA"
-  "UH0usw3dbtsi2d2rBJKVuPRQB2nWKagNJWUn3ZXY+312kvD899wRYHzotrGgI3dQiFNTQhAel8eb"
-  "NR/Lkzhvqic0nzTdrLyt5czlKyz7HCOerkCXActBlMSwm7Tv09uXLz/UfzfQv4QRpe2jKWeGZFo7"
-  "SJfilhKZjyPiNwCwfQEa/2QJ1v1oYtW0MrtXjhZXLFrw8oBMy4wzAzttiekHCcBro0eb+cyIprgC"
-  "oBtXrH7pCtbtaA7CT9eJe7nBzgNsOYBVocgLVkjm/XBu16aWrt78UZdxKVvtHMFRJ7fa8dcMQ47c"
-  "VzXjTgr07/VaJ2kF5+5EoBce9me1xwrx8CSRPkkOKqAvftPKlfUC+5MooQp3i1XtBEHD3toxThfm"
-  "IuA3tq6+tC3IXmtmy0a0srHsy4+KGZ8Wj5y6sqFh9PRyhLOHfOXVararI8isdy2d/zHXJpnpqsKG"
-  "pjzfpm1kR4Lk79L0XS7EJj9pcjwgutpuXoLOkshUQ/BRm9pyl1w51P8xoi9+78qV9eOl5vdlRU5Z"
-  "SILSHObGjtk0cxHwm5d3/lE9g38Z0+gmr/6F6w/dftfRT+0C9iAG9uwGsPu9K1deOzS27N86XPaV"
-  "m1u6flQY2fGRhfJW96DoDWAv7Tw/pXWHqYCiZncBR2kQTmro3+vVV21m/YOkFRwXmxctCmPg+NFN"
-  "7V2/7m3PXTdWWvbrjMhrSqa2NNJHSgwjFD+d2dHqroZ3N6rZxKhVnrv+0O135ZHLVCl1q1XaeUBe"
-  "jbXhW/bsmXj7yI6/GdboV0L05rGqLmVe5UIw8Y2nn9sG4mFVhGNKa2hj/wL6kp8U6AfiSuvs2Dl4"
-  "3i2x6fYwkT+/WAw/MrOMuFydyEWhyJmVhHRlKXaqOpBl9ftjx5+mNY1aK2BFFP272lYvE/KZYxZ/"
-  "csvI7t9ehbVhAf2VKqVuNeG+AOjHcGP0aqwNASBWn2+kaw9aGh8DwLbNI19VhMP57OlJ8a9N1hRa"
-  "QhwDGH81V0TzpEDjgcaj17keFL0YPxSCtCWkzxJgZKol836u2ruFhAIyFJL8fGGg/0iasD+99RrK"
-  "iodnKS4D9zUD2DIHxRkAXIUbYwAMPX88YV5h+shEq67j3PZzd9p3RU8PE+5cPZr/A1c2H6vTW2t5"
-  "PU4K9O9dS/f5PCDNLZVrxjTuz9IFKZnMEprK0i31nVnaWqOkfiIU//5kn0yNulV7zQRgkwEG4RAB"
-  "K85T9FAN6+0bjY9EhkgSFAQLbSRkZmvcUaL5JORNwgx7MJBAdoUFIkQnBfoBcAn7AV66a1fZFH+r"
-  "ZrFLAmH6AA8jrpfAqVn+8v233b0N3ffJi6hGDc10jABV0WoAuye70MzZjJCtzZnGkAhNeHiRm+3R"
-  "00Lz5kAQ3F1Af2WhBQMnBfoBuoqA34Zulx/e8bOS6t8EFBFAlqipF4+xwKImCcNRH/3XhqEd70kR"
-  "CJ0pXA8AFdG7K6bewz+LgI3gTpnPrAJg4vQJ9QzElLcsLLI3eUKcXk1KqqIwkvSlvWs2aPGkQP+e"
-  "r6R2cV1QGNpx7YT6v6JhrI7OLYYudglJSB4AmiQIx330XzrIl+YBSWkJbCY4rxvdrjC863AM+04D"
-  "5VVXtJ7zkEtwY1RFOVCDclhS0T5ZEhWCG8csGm5oGv0FAPbMM6/JpCTwjKlJSZNb8S6c7PX9oLan"
-  "4zzWBRsH+z5/Zcc5Oxs0/HC9BE+MoIgsyROf1hNxKZcmtiiDegYuMq2Me7/5ysEdm2qTgeZr7hZQ"
-  "8w7Bz5st/PKmlrNeuH6k/7cz2859cR65TKbVPtwimccMaukNb9mzZ2I+HPpoUtLZbbG3h9QmJaXd"
-  "tEDInScF+v+AUG9Dt+sZKN4M4MLN7WteBdpb6uk6LekqAIV5Tr7zSY04hQMDR+u5JvsfGuhCUkI6"
-  "Kav3FdMvVmBbC4P9N9U8zOYzj7oBd8XQ7b/Y2LL6re0u++5RtZs3t3S+S8W+7IdK9xRwTymPdQFa"
-  "f3daRsOnmNhlbS5zwQFfLvrh2z6cB6RnHnKayWrzqK4NYs0KVUkzAQkyMoWp3lXbP/2kyfGgNj8S"
-  "R+fKwe1XRwNjj45UXxKpfYuG8QYGrl6CIEtxASmSMDTXSjcFZEgyQ5F6BkGDBEFIUs3uKGn8Xg+u"
-  "ffvA9p7CQP9N29DtOEs75LmEeuPIbe8Z1vKrAFhbkH1nA4KdQWv93s2tnXcHLfv31CHz25Yg8+kM"
-  "5YIhX36PHz71JWna7Ly/a9JeD2QYhnIdA6meTgEpkemY+sxtwNH+iSc19IM86FItLO1BsYRBfBbA"
-  "Zzet6FpVdv6JSjwRxPkwPBREK8zqwJSq1iw2ouTVDhHYB/B2gjdC7cfRMG4qYEcFONqFaim1ftU2"
-  "FhuGb/vE1mWdXzmEyvMV/DOCXQCWETiosF8d8uXvlRy+VBjaeTuwE4UFskxVk64K+285sLG965Xe"
-  "5AqFdZjZCoEQZoXCoZsPdieV7wse/0KrhS3fnGvN1unqKKYqbAnNXGhhYFKO4+2F4V2Hl0ivlYzl"
-  "1AtOyZqeFcV+yWNxMGbDzK2X7b9l7EEg3yldWJ9Oh9Lyp69tCEqlNoM2i7NsBAAqpcA4Ggc2UuXd"
-  "m5qbvC6Y6VlYUnfZ+9rCM9nhaV9EXeo7BYCtyzrb4tCd4kkrDP1651Jk5P8D29BERspaHMIAAAAA"
-  "SUVORK5CYII=";
-
-static const size_t LOGO_B64_LEN = 14832;
+static const char LOGO_ETAG[] = "\"5b117d35aea08d7c\"";
+static const size_t LOGO_PNG_LEN = 11123;
+static const uint8_t LOGO_PNG[] PROGMEM = {
+  0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0xb4,
+  0x00,0x00,0x00,0x45,0x08,0x06,0x00,0x00,0x00,0xe3,0x03,0xcc,0x8e,0x00,0x00,0x2b,0x3a,0x49,0x44,0x41,
+  0x54,0x78,0xda,0xed,0x7d,0x79,0x98,0x5c,0x57,0x71,0xfd,0x39,0x75,0xdf,0xeb,0x9e,0x4d,0x23,0xcd,0xe6,
+  0x0d,0x81,0xc0,0x9b,0x66,0x5a,0xb6,0x81,0x88,0x25,0x04,0x8c,0x08,0x98,0x24,0xec,0xeb,0x4c,0x62,0x20,
+  0x40,0x42,0x82,0x81,0xfc,0xc0,0x2c,0x31,0xc4,0xc6,0x52,0xab,0x47,0x0b,0x5b,0x80,0x40,0x20,0x60,0x62,
+  0xc0,0x04,0x87,0x45,0x1d,0xf6,0x25,0x80,0x8d,0xc3,0xb0,0x2f,0x31,0x78,0x41,0x23,0xd9,0x96,0xbc,0x80,
+  0x90,0x2c,0xcd,0x26,0x69,0x34,0x33,0xdd,0xfd,0xde,0xad,0xfa,0xfd,0xf1,0x5e,0x8f,0x7a,0xc6,0xb3,0x4b,
+  0x36,0x0e,0xd2,0xfb,0xbe,0xf7,0x49,0x1a,0x75,0xbf,0xb9,0xf7,0xbe,0xba,0x75,0xab,0x4e,0x55,0x9d,0x62,
+  0x6f,0x7b,0xd7,0x11,0x3c,0x98,0x2e,0x52,0x33,0x60,0x10,0xc1,0xbe,0xb7,0x7e,0xa0,0xff,0x99,0x79,0x40,
+  0x0a,0x80,0x02,0x40,0x1e,0xeb,0x82,0x02,0xfa,0xe2,0xde,0xb6,0xae,0x97,0xd5,0x4b,0xf0,0xc1,0x09,0xc4,
+  0x31,0x80,0x00,0x80,0xd4,0x3e,0x01,0x20,0x27,0xff,0x65,0x26,0x04,0x68,0x80,0xa5,0xff,0x99,0xfe,0x85,
+  0x9a,0x7e,0x40,0x61,0x30,0x80,0x1e,0x30,0x05,0x19,0x03,0x18,0x15,0xb3,0x3d,0x20,0x6f,0x25,0xf0,0x43,
+  0x50,0x7e,0xf0,0xf6,0x03,0xbf,0xde,0x8f,0xe4,0xbb,0xec,0x01,0xa4,0x08,0xf8,0x63,0x9d,0x69,0x1e,0xeb,
+  0x5c,0x01,0x7d,0x71,0xf5,0x07,0xef,0x6a,0x5b,0x7d,0x46,0x44,0x79,0x24,0xc8,0x47,0xc1,0x6c,0x0d,0x80,
+  0x47,0x28,0x70,0x1a,0xc1,0x66,0xc0,0xea,0xd2,0xaf,0x95,0x0c,0x76,0x88,0xe4,0x5e,0x02,0xb7,0x03,0xb8,
+  0x49,0x94,0x3f,0x6b,0x1c,0x2a,0xdf,0x72,0x29,0x76,0x95,0xab,0xcf,0x4a,0xd7,0xca,0x57,0xa7,0xbb,0xd8,
+  0x2b,0x5d,0x77,0x5b,0xea,0xf7,0x17,0x72,0x75,0x03,0xae,0xba,0x8e,0xef,0x6c,0xc9,0x3d,0x2c,0x0e,0xf0,
+  0x54,0x35,0x3e,0x06,0xb0,0xb3,0x0d,0x78,0x18,0x88,0xd3,0x60,0xa8,0x23,0x38,0x4e,0xd8,0x5e,0x00,0xbf,
+  0x12,0xc3,0xb7,0x25,0x76,0xff,0x7d,0xf9,0xa1,0x5b,0x47,0x00,0x60,0x1b,0xba,0x5d,0x0f,0x8a,0x93,0xef,
+  0x22,0x10,0xb2,0xf1,0xc1,0x24,0xcf,0x0a,0x98,0x23,0x19,0x9b,0xd6,0xcf,0x2a,0x09,0x60,0xa3,0x23,0x5b,
+  0x68,0x34,0x01,0x69,0xe9,0x9a,0x73,0xa6,0xd5,0x4f,0x65,0x9b,0x53,0x25,0x7e,0xea,0xd3,0x26,0xe5,0x9f,
+  0xd5,0xaf,0x9c,0x2e,0x94,0x73,0x05,0x78,0xaa,0x87,0x5d,0xea,0x55,0xf7,0x6f,0xe9,0x58,0x73,0xbd,0x50,
+  0xaf,0xe1,0x81,0x1d,0xd7,0x03,0xf0,0xdd,0x80,0xdb,0x06,0x28,0x97,0xf0,0xc2,0xab,0x9b,0xb4,0x80,0xbe,
+  0x78,0xcb,0x29,0xe7,0x9d,0x4a,0xd3,0x6e,0x05,0x9e,0x1f,0xc1,0x1e,0x2d,0x90,0xd6,0x80,0x84,0xa5,0x0f,
+  0x56,0x18,0xcc,0x8e,0xfe,0x12,0x82,0x4d,0x24,0xdb,0x05,0x3c,0x4b,0x80,0x0b,0x0d,0x40,0x24,0xaa,0xa3,
+  0x1d,0x99,0x3b,0xb6,0x5a,0xee,0x06,0x2f,0xf6,0xc5,0xf8,0xc0,0x8e,0x1b,0xaa,0x1b,0xa5,0x56,0x21,0x2c,
+  0xe6,0xaa,0x55,0x22,0x1b,0xd1,0xe7,0x79,0xfc,0x05,0x9b,0x45,0xc0,0xf7,0x76,0xac,0x79,0xa4,0x33,0xbe,
+  0x39,0x26,0x9e,0xed,0xc8,0xd6,0xb0,0x66,0xde,0x6a,0x80,0xd1,0x40,0xb0,0x5e,0xc8,0x36,0x01,0xcf,0x37,
+  0xe0,0xe5,0x2a,0x7a,0xcf,0x96,0x8e,0x35,0xff,0x31,0x34,0x11,0x7d,0xb0,0xe7,0x48,0x71,0x70,0x1b,0xe0,
+  0x7a,0xd2,0x8d,0x21,0xd5,0x2d,0xf8,0x60,0xb9,0x01,0x68,0xfa,0xf7,0xd9,0x17,0x90,0x50,0x4d,0x5e,0x73,
+  0xac,0x30,0x33,0x24,0xff,0xd0,0xf4,0xcf,0x45,0xfe,0x4e,0x53,0xd8,0x94,0x3b,0x36,0xb3,0xc8,0x54,0x4b,
+  0xa6,0x3e,0x36,0x53,0x92,0xa7,0x66,0x28,0x2f,0x15,0xb8,0xeb,0xb6,0x76,0xe4,0xfe,0x67,0x4b,0x5b,0xd7,
+  0xd3,0x8a,0x80,0x27,0x60,0xf9,0xa9,0xa7,0xc3,0x82,0xb4,0x52,0x01,0xd0,0x57,0x60,0x55,0xdd,0x96,0xf6,
+  0xdc,0x06,0x9a,0xfd,0x3a,0x2b,0xee,0x5f,0x33,0x94,0xa7,0x11,0xd2,0x1a,0xc3,0xac,0x6c,0xea,0x2b,0xa6,
+  0x3e,0x32,0xd5,0xd8,0x92,0x31,0x55,0xc7,0x5b,0x3b,0xbe,0xf4,0x73,0x6a,0x80,0x38,0x72,0x75,0xc6,0xb9,
+  0xd7,0x66,0xe0,0xae,0xcb,0xb4,0xe7,0x7e,0xb9,0xb9,0xbd,0xeb,0x6f,0x91,0x0a,0xf3,0x36,0x74,0xbb,0xc5,
+  0x8e,0x71,0x4b,0x4b,0xe7,0x79,0x00,0x58,0x40,0x5f,0x4c,0xc0,0xb6,0xa1,0xdb,0x75,0x03,0xee,0x78,0x08,
+  0x72,0xba,0xd1,0x5c,0xa1,0xad,0xeb,0x69,0x30,0xfb,0x48,0x93,0x0b,0x5e,0x6e,0x40,0x6b,0xed,0x9c,0xa2,
+  0x9a,0x79,0xa7,0x73,0xd6,0xea,0x9a,0x80,0x5c,0x95,0x15,0xb7,0xbe,0xad,0x3e,0xfc,0x55,0xbe,0xad,0xeb,
+  0xf9,0x3d,0x80,0xaf,0xce,0x71,0x41,0x2f,0xc3,0x60,0xde,0x60,0xfe,0xfe,0x3c,0x7e,0x96,0xb8,0x30,0xb3,
+  0xdd,0xc7,0xf4,0x1c,0x26,0x7f,0x0a,0x93,0x17,0x28,0x06,0xc3,0x84,0x79,0x2b,0x9b,0x5a,0x9d,0x04,0x4f,
+  0xc9,0xba,0xe0,0xfa,0x2d,0xed,0x5d,0x9f,0xbc,0xbc,0xe9,0xec,0x8e,0x02,0xa0,0x0b,0x15,0xea,0xea,0x11,
+  0x9b,0x6f,0x3b,0xb7,0xf3,0xdc,0x8e,0xc6,0x1f,0xd6,0x39,0x57,0x30,0xa0,0x7d,0x5c,0xe3,0xb8,0x6c,0xea,
+  0x15,0x66,0xe9,0xef,0x76,0xe9,0x2d,0xbc,0xef,0x9c,0x26,0xc7,0x57,0xfd,0x0c,0x00,0xc4,0x66,0x3a,0xa1,
+  0x71,0x5c,0x31,0x55,0x27,0xf2,0xc8,0xac,0x04,0x1f,0xdf,0xda,0x9e,0xfb,0x41,0x6f,0x7b,0xd7,0xa3,0x7b,
+  0x50,0xf4,0x79,0xac,0x0b,0x16,0xa1,0x39,0xd5,0xc0,0xaf,0xbe,0xbb,0x6d,0xcd,0xaf,0x37,0xaf,0xe8,0x7c,
+  0xdd,0x96,0x53,0xce,0x3b,0xb5,0x07,0x45,0x5f,0x35,0x0f,0xf2,0x58,0x17,0xd8,0xe2,0xd7,0x19,0x00,0xd8,
+  0x9d,0x8c,0x97,0x41,0x47,0xee,0x8b,0x10,0x5e,0x09,0x62,0xb8,0x64,0xde,0x03,0x16,0xd7,0xce,0x69,0xda,
+  0xbc,0xa7,0xcc,0x37,0x36,0xb3,0x31,0x8d,0x63,0x92,0x2b,0xeb,0x5d,0xf0,0xa5,0x7c,0xeb,0x9a,0x97,0xf7,
+  0xa0,0xe8,0xbb,0xd1,0xed,0x16,0xf4,0x22,0x1a,0x18,0xb8,0x06,0x09,0x1c,0x8f,0xfe,0x82,0x07,0x93,0x60,
+  0xdf,0xef,0x56,0x90,0xc2,0x46,0x68,0x36,0x41,0x43,0x65,0x34,0x8e,0xde,0x36,0xae,0xfe,0xfa,0x66,0x97,
+  0x79,0x65,0x53,0x5d,0xe6,0x27,0xbd,0xa7,0xac,0x3e,0x7f,0x21,0x42,0x9d,0x4f,0xed,0xee,0x7c,0xc7,0x39,
+  0x8f,0xca,0x32,0xe8,0x0b,0x29,0x6b,0xc7,0x34,0x8e,0x3c,0xcc,0x00,0x06,0xe9,0xcb,0xe2,0x31,0x8c,0x53,
+  0xd2,0xe7,0x48,0x64,0x8a,0x09,0xf3,0x70,0x22,0x7f,0x12,0x50,0x7e,0x94,0x6f,0xef,0xea,0x29,0xa0,0x2f,
+  0x5e,0x84,0x50,0x9b,0xd2,0xbe,0x60,0x66,0xe7,0xb6,0x04,0x99,0x0f,0x33,0xf6,0x77,0x6f,0x6d,0xe9,0xbc,
+  0x7a,0xcb,0x8a,0xae,0x0b,0x13,0x73,0xe4,0xa8,0xd6,0x5e,0xcc,0x09,0xb5,0x0d,0xdd,0x52,0x04,0x7c,0xa1,
+  0x3d,0xb7,0xbe,0x59,0x32,0xcf,0x81,0xe1,0xa1,0x66,0x5c,0x1b,0x9b,0x39,0x5b,0x84,0xf6,0x4f,0x9c,0x24,
+  0x06,0x91,0x99,0xc6,0xa6,0x9a,0x75,0xbc,0x66,0x53,0x47,0xee,0x49,0x45,0x14,0xbd,0x2c,0x40,0x75,0x45,
+  0x63,0xea,0xaf,0x1d,0xf7,0xf1,0x27,0x0d,0x38,0x44,0x20,0x96,0x5a,0xa7,0xeb,0x0f,0xf8,0x22,0x00,0x35,
+  0x9b,0x30,0xc3,0x46,0xd0,0x36,0x19,0xf0,0x03,0x47,0x3e,0x9f,0xb4,0xf0,0x88,0xc6,0x3e,0x10,0x39,0x8b,
+  0xea,0xbe,0x9a,0x5f,0xfe,0xc8,0x15,0x1b,0x13,0x53,0x87,0xb3,0x09,0x33,0x00,0xe4,0x3b,0x72,0xa7,0x85,
+  0x08,0xbf,0xe6,0x44,0x4e,0x29,0x99,0x8f,0x09,0x86,0x3c,0x36,0x21,0x9e,0x71,0xcc,0x66,0x76,0x04,0xb0,
+  0x83,0x51,0xa2,0xf5,0xeb,0xea,0xc5,0x7d,0x3e,0xdf,0xd1,0xf9,0xc2,0x02,0xfa,0xe2,0xee,0xf9,0xcd,0x0f,
+  0x03,0xc0,0x0d,0xc3,0x3b,0x2f,0x8b,0x10,0x3d,0xfc,0xa0,0x46,0x6f,0x04,0x70,0x47,0xbd,0x0b,0x5e,0xe5,
+  0x1c,0xbf,0xbf,0xb5,0xa5,0xeb,0x67,0x5b,0x5a,0x3a,0xff,0x7e,0xeb,0xb2,0xce,0xb6,0x1e,0x14,0x7d,0x21,
+  0x31,0x11,0xb9,0x0d,0xdd,0x6e,0x2e,0xad,0x9d,0x07,0xa4,0x07,0x45,0xff,0xf6,0x15,0x5d,0xab,0x08,0xfe,
+  0x53,0xd9,0xbc,0x12,0xb8,0x9b,0xb4,0x3b,0x5c,0x22,0x4e,0xba,0x84,0xb9,0x8a,0x87,0x99,0x23,0xe9,0x0d,
+  0xef,0x33,0x80,0xb3,0x09,0xb4,0x31,0xb9,0x0f,0xaa,0xd9,0xd7,0x1d,0xec,0x17,0x00,0x03,0x31,0x84,0x30,
+  0xfc,0x8b,0x9a,0xfe,0x24,0x4c,0xbe,0xaa,0x7f,0xc0,0xf2,0x6c,0x06,0x58,0x48,0x66,0x02,0xe5,0xf5,0x5e,
+  0xd1,0x58,0x2f,0xee,0xa2,0x8c,0xc8,0x13,0x1c,0x64,0x5d,0x0c,0x73,0x65,0xf3,0x51,0x83,0xb8,0x87,0x33,
+  0xa8,0x5c,0x4c,0xc0,0x36,0x62,0xdd,0x8c,0xc2,0xd2,0x8f,0x6e,0x16,0x00,0x15,0xb3,0xab,0xea,0xe8,0x56,
+  0x96,0x13,0x61,0x0e,0x8e,0xfb,0x80,0x61,0xbe,0x8e,0x0e,0x04,0xbe,0x45,0xe0,0x87,0x59,0x3a,0xa7,0xb0,
+  0xd8,0x9b,0x59,0xd6,0xe4,0xd3,0xbd,0x6d,0xab,0x57,0x17,0x51,0x5c,0x88,0x89,0x64,0x79,0x40,0xae,0x1c,
+  0xbe,0xe3,0x77,0x6f,0x1f,0xde,0xf1,0x81,0x2b,0x86,0x77,0x5c,0x30,0xe6,0xe3,0x4b,0x60,0x50,0x10,0x8f,
+  0x5b,0xe1,0x32,0x1f,0x43,0xc0,0xbb,0xb7,0xb4,0x76,0x7d,0x78,0x73,0xdb,0xea,0xc7,0x10,0xb0,0x1e,0x14,
+  0x7d,0x55,0x6b,0xcf,0xfc,0xc8,0x75,0x02,0x00,0x99,0x80,0x2f,0xaa,0x13,0xa9,0x57,0x40,0x40,0x1e,0x51,
+  0xc3,0x38,0x8f,0x61,0x4f,0x13,0x74,0x65,0x53,0x73,0xe4,0x1f,0x6d,0x6c,0xcd,0x3d,0x76,0xb6,0x45,0x65,
+  0xea,0x84,0x34,0x93,0x7c,0xc1,0x32,0x09,0x5f,0x00,0x00,0x13,0xe6,0x51,0x31,0x7d,0x0b,0x0d,0x63,0xb1,
+  0x29,0x52,0x5b,0xa7,0xea,0xc0,0xfd,0xa1,0x69,0x6d,0x12,0x30,0x35,0x44,0xde,0xe1,0xa9,0x8d,0x0c,0xaf,
+  0x2c,0x99,0xff,0x95,0x9a,0xdd,0x52,0x27,0xee,0x65,0xde,0x14,0x55,0x38,0x50,0x88,0xdc,0x1c,0xc7,0xac,
+  0xeb,0x41,0xd1,0x6f,0x6e,0xef,0x7a,0x46,0x46,0xdc,0x73,0x27,0x2c,0xbe,0x5f,0x84,0x79,0x9a,0x8a,0x1d,
+  0x23,0x2c,0x48,0x5f,0xb8,0x28,0xd4,0xd7,0x49,0xd0,0x10,0x2b,0x3e,0x0c,0xe0,0xa2,0x85,0xbc,0xab,0xaa,
+  0xe6,0xfd,0x20,0xce,0xce,0x5c,0x8a,0x5d,0x65,0x0f,0xdc,0x1a,0x12,0xf4,0x86,0xa7,0x0f,0xc7,0x95,0xd5,
+  0x4e,0xe4,0xb5,0x4d,0xe2,0x5e,0xa7,0x66,0xaf,0xdb,0xda,0xda,0xf5,0x63,0xc2,0xae,0x2a,0xf9,0x89,0xaf,
+  0xf6,0x1c,0x2a,0x1e,0x9c,0x73,0x51,0x8d,0x8f,0xa9,0xca,0x8b,0xc1,0xdc,0x7d,0xfd,0x38,0x8b,0x17,0x38,
+  0x47,0x56,0x31,0x2a,0x83,0xf9,0x2c,0x9d,0x53,0xf1,0x7f,0x31,0xdf,0x4e,0x15,0x01,0x71,0x48,0xa3,0xdb,
+  0x0f,0xfa,0xca,0xcd,0x15,0xf3,0x7b,0x08,0x8c,0x92,0x6c,0xb2,0xa3,0x5a,0xe1,0x0f,0xd6,0x04,0xb1,0x44,
+  0xaa,0xb3,0x54,0x3b,0xab,0xac,0x7e,0x3f,0xcc,0xce,0x10,0xf2,0x09,0x8e,0x74,0x00,0x5d,0x8d,0xe0,0xef,
+  0x9f,0xed,0xb8,0xdd,0x8e,0xa2,0x01,0x80,0x07,0xae,0xc0,0x1c,0x66,0xc9,0x02,0x87,0x33,0x9f,0xef,0x42,
+  0x4d,0x3e,0x72,0xba,0x19,0x3b,0x6c,0x12,0x7a,0x67,0x30,0x61,0xb1,0xcf,0x8a,0x3c,0xad,0xd0,0xd6,0xf5,
+  0xb4,0x85,0x22,0x1f,0x04,0xec,0x74,0xec,0x8a,0x53,0x5c,0xa9,0x81,0x20,0x8d,0xfa,0xdb,0xf5,0x07,0x77,
+  0x7e,0xb8,0x3c,0xdc,0x7f,0xc1,0x78,0x1c,0xaf,0x1b,0x57,0xff,0x29,0x03,0x1e,0xbf,0xdc,0x65,0x3e,0x95,
+  0x75,0x0d,0x77,0x6c,0x6a,0xe9,0x7a,0x5f,0xbe,0xf5,0xec,0xe6,0xfb,0x3a,0xe8,0x7d,0x9a,0x1e,0xfd,0xa7,
+  0x6a,0xcd,0xf3,0xa7,0x9b,0x4b,0xf5,0x0c,0x82,0x19,0x6f,0x49,0x6f,0x06,0x41,0x5d,0xf2,0x33,0x57,0x47,
+  0xe7,0x32,0x14,0x09,0x28,0x61,0x40,0x0a,0x60,0xed,0xf3,0x69,0x0a,0x15,0x40,0x3c,0xb0,0x9f,0xc0,0x8f,
+  0xa8,0x88,0x20,0x06,0x81,0x5c,0xea,0xcd,0x76,0xa4,0xa3,0xf9,0x9a,0xd2,0x5e,0x10,0x52,0xd6,0x46,0xa6,
+  0x8a,0x45,0xc2,0x58,0xbf,0x67,0x91,0xad,0xd1,0x06,0x94,0x19,0xc6,0x4e,0x05,0xd0,0xe0,0x82,0x37,0x8e,
+  0x59,0x74,0x39,0x21,0xcc,0x82,0x7f,0x37,0xe6,0xe3,0x9f,0x0b,0xf1,0x47,0x49,0x74,0xc6,0x10,0x2b,0x7e,
+  0x9a,0x42,0x78,0x33,0xe2,0xcd,0xf9,0x53,0xce,0xbd,0x20,0x30,0xfe,0x49,0xd9,0x14,0x3c,0xba,0x11,0x16,
+  0x09,0xcf,0x27,0xca,0x45,0x61,0xb3,0xae,0x31,0x41,0xa9,0x24,0x27,0xc7,0x93,0x00,0xde,0x15,0xdb,0x64,
+  0x2c,0x09,0x04,0x4c,0x40,0xa3,0xf0,0x12,0x00,0xdf,0x5d,0xfc,0x66,0x4a,0x02,0x51,0xce,0x5b,0x36,0x71,
+  0x2e,0xfb,0x70,0xf9,0xc1,0x1d,0xdf,0x07,0xf0,0xfd,0x3c,0x56,0xbd,0x66,0x64,0x45,0xc3,0x8b,0x29,0xd8,
+  0x5a,0x27,0xf2,0xa6,0x89,0x4a,0xf8,0x11,0x00,0x87,0x6b,0x82,0x33,0xe8,0x9f,0x1c,0x87,0x79,0x49,0xd6,
+  0xad,0x66,0x73,0x4f,0x8e,0xb3,0x32,0xae,0xf1,0x16,0x82,0x7b,0xd5,0xcc,0x51,0xe8,0x60,0xc8,0x80,0x56,
+  0x47,0x43,0x23,0x80,0x26,0x03,0x96,0x11,0x68,0x52,0xa0,0x59,0xc0,0x26,0x33,0x2c,0x03,0xad,0x2e,0x02,
+  0x96,0x83,0x3c,0x3c,0x9f,0x40,0x4b,0x04,0x43,0x86,0x72,0xa1,0x23,0x2f,0xf4,0x30,0xf8,0x64,0x91,0xcc,
+  0x60,0x8f,0x00,0x30,0x6a,0xe0,0xc5,0x80,0xb9,0x04,0xfe,0xff,0xbf,0x75,0xd5,0x31,0x08,0xaa,0x2a,0x24,
+  0x86,0xa1,0x62,0x6a,0xd3,0x9d,0x34,0x03,0xa4,0x6c,0x5e,0x69,0xf2,0x66,0xc0,0xbe,0x53,0x26,0x7e,0x47,
+  0xf2,0x5e,0x83,0x75,0x31,0x59,0x60,0x64,0x1c,0x2f,0xde,0xb4,0xa2,0xeb,0x8e,0x5b,0x0e,0x9e,0xb2,0xc7,
+  0x52,0x53,0xe5,0xa8,0xdd,0xd8,0xa7,0x4e,0xdd,0x73,0xb2,0xe2,0x64,0xc2,0xe2,0x18,0x8b,0x34,0x37,0x0c,
+  0xb0,0x0c,0x45,0x2a,0xa6,0xe6,0x4d,0xc7,0xb3,0xe2,0x1a,0x2b,0xa6,0xb3,0x99,0x78,0x49,0x50,0x0a,0x36,
+  0x68,0xd0,0x2f,0x39,0x06,0x6b,0xbc,0x99,0x02,0x70,0x06,0xba,0xc8,0x94,0x30,0xfb,0xd3,0x7c,0xeb,0xd9,
+  0xcd,0x3d,0xc3,0xc5,0xc3,0x53,0xc7,0xba,0x50,0xc7,0x22,0x10,0xa0,0x4f,0xab,0x81,0x97,0xf7,0x9c,0x7a,
+  0x41,0x63,0xb9,0x12,0x3d,0x19,0xc0,0x45,0x06,0x9c,0x16,0xc3,0x40,0x8a,0xce,0x08,0x5a,0xa2,0x08,0xaf,
+  0xba,0x21,0xa6,0x7f,0x0a,0xc9,0x10,0xc0,0x85,0x24,0xa5,0x62,0x6a,0x02,0x8a,0x37,0x1b,0xd5,0xc1,0x8e,
+  0xad,0xb5,0xd1,0xd3,0xc5,0x5e,0x81,0x2d,0x60,0x42,0x95,0xc4,0x23,0x4d,0x9d,0x48,0x43,0xbd,0x04,0x12,
+  0x7b,0xfd,0x12,0x68,0xb9,0x46,0x09,0x2e,0x2c,0xa9,0x87,0x37,0xab,0xda,0x94,0x0b,0xd1,0x36,0x36,0x87,
+  0x91,0xef,0xed,0xa8,0x72,0xbc,0x5f,0xd4,0x32,0x01,0xaa,0xa1,0x5c,0x42,0xfc,0x6e,0x35,0x1b,0x06,0xa4,
+  0x59,0x60,0xcf,0xce,0x88,0x7b,0xec,0x74,0xa1,0x26,0x40,0x47,0x61,0x48,0x74,0x4c,0x98,0x3e,0x55,0xcc,
+  0x3e,0x03,0xf0,0xe5,0x4e,0x64,0x99,0x9a,0xa1,0x64,0x7e,0xb4,0x1e,0xee,0x11,0xe5,0xc0,0x5f,0x52,0x44,
+  0xf1,0x8a,0x1e,0x74,0x3b,0x4c,0x86,0x62,0xfb,0xd2,0x39,0xf0,0x29,0xd5,0xf8,0xfa,0xe2,0xec,0x0d,0xd3,
+  0x2c,0x9d,0x44,0xe6,0xbf,0xe7,0xe9,0x2f,0x85,0x72,0xb0,0xac,0x76,0x69,0x56,0x82,0xb7,0x56,0xe6,0x38,
+  0x0d,0x0d,0xa0,0x19,0xc3,0x5a,0x91,0x27,0x40,0x0f,0xb3,0x80,0xd2,0x6e,0xcc,0xae,0x06,0xf0,0x8b,0x9e,
+  0xe4,0xfb,0x7e,0x21,0x91,0x4d,0x81,0xba,0x64,0xf1,0x6c,0xa4,0x00,0xe8,0x3b,0x5b,0xba,0xd6,0x78,0xd8,
+  0xc5,0x95,0x4a,0xf4,0x8a,0x16,0x17,0xae,0x2c,0x99,0xa2,0xa4,0xfe,0x86,0xc8,0xf4,0xdf,0x97,0x1f,0x8e,
+  0xf7,0x24,0x41,0x99,0xa3,0xa0,0x41,0xb1,0x8a,0x13,0xcb,0xaf,0x5f,0x5c,0xf2,0x7a,0x61,0xc6,0xc9,0xa7,
+  0x33,0x74,0xe7,0xc4,0xa6,0xa9,0x2d,0x65,0x10,0xa2,0x0d,0xed,0x03,0x87,0x0b,0xc8,0x1d,0x06,0x51,0x01,
+  0x30,0x0e,0x70,0x9c,0x66,0xe3,0x0a,0x8c,0x13,0x18,0x03,0x38,0x0e,0xc3,0x18,0xc4,0xc6,0x09,0x8c,0x99,
+  0x71,0xcc,0x80,0xb1,0xac,0xc8,0x44,0xc5,0x74,0x7b,0x10,0x2c,0x68,0x8d,0xe9,0xd2,0x88,0x8d,0xcf,0xd2,
+  0xc9,0x84,0xfa,0x4f,0x40,0xed,0xc7,0x75,0x2e,0x78,0x61,0x59,0x13,0x8f,0xdd,0x43,0x47,0x60,0xc8,0x08,
+  0xd9,0x38,0x97,0x50,0x87,0x14,0x91,0x39,0x24,0x5a,0x01,0x57,0x47,0x41,0xc5,0xb4,0xf1,0xfe,0xb2,0x8b,
+  0x25,0x71,0x25,0xca,0xab,0x3b,0xb8,0xb9,0xa7,0x7f,0x47,0x25,0x0d,0x16,0x6c,0x65,0xfb,0x81,0xbe,0xac,
+  0xb8,0x27,0x54,0xcc,0x7b,0x80,0x2e,0x75,0x78,0x7d,0x59,0xfd,0xbf,0x84,0x90,0x4b,0x04,0xc8,0x80,0x6c,
+  0x31,0xb3,0xbb,0xd4,0xb0,0x02,0x80,0xcb,0x40,0xc2,0x31,0x44,0xff,0x16,0x0a,0x7d,0x22,0xb0,0x93,0x79,
+  0x05,0x2c,0x00,0x9a,0x3f,0x7d,0x6d,0x03,0xe2,0xf1,0x5c,0x9c,0x58,0xe4,0x8b,0x31,0xc7,0x4c,0x40,0x46,
+  0xa6,0x87,0x22,0xf0,0xe2,0xc2,0x81,0xdb,0xef,0x4d,0x7f,0xfe,0xb6,0xde,0xf6,0xae,0xbf,0xc8,0x88,0xbb,
+  0x60,0x2e,0x13,0x6f,0x16,0xcd,0xab,0x01,0xe9,0x22,0x44,0xa7,0x25,0x3a,0xb3,0x1b,0x45,0x14,0x67,0x7d,
+  0xe9,0xdb,0xd0,0x2d,0x23,0x28,0x4a,0x01,0x88,0x0a,0x01,0x0f,0x29,0x4c,0x41,0xbb,0x78,0x53,0x6b,0xe7,
+  0x93,0x03,0xca,0x33,0x96,0xd1,0xe1,0xa0,0x8f,0xee,0x3d,0xec,0xa3,0x77,0x28,0x79,0xed,0xdb,0x47,0x76,
+  0xf4,0xcf,0x85,0x26,0x16,0x51,0xd4,0xf3,0x98,0xbb,0x38,0x10,0xfb,0x8d,0x37,0x1b,0x0f,0x38,0x19,0xd5,
+  0x97,0x44,0xd1,0x10,0x84,0x7d,0xca,0x88,0xed,0x30,0x3c,0x8c,0xe4,0x0a,0x03,0x1a,0x01,0xd4,0x13,0xac,
+  0x07,0x6d,0x05,0xcc,0x4e,0x83,0x20,0x03,0x43,0xd6,0xc8,0x0c,0x80,0x0c,0x69,0xce,0xcc,0x1a,0x08,0xbb,
+  0x2e,0xf0,0xa6,0x07,0x16,0x72,0xec,0x81,0xa8,0x13,0xb0,0x39,0x32,0xf5,0x06,0x9c,0x43,0x61,0x8f,0xa7,
+  0x35,0x25,0x21,0x77,0x3b,0x64,0x86,0xaf,0x05,0xe4,0xf3,0x2d,0x71,0xfc,0x39,0xdb,0xac,0x22,0xf5,0xb7,
+  0x82,0x3c,0x68,0x66,0x33,0xcb,0x35,0xa9,0x13,0x80,0x33,0xb3,0x5f,0xde,0xcf,0x0e,0x1f,0x6f,0xbf,0x37,
+  0xec,0xc8,0x63,0xdd,0xfe,0x66,0x94,0xc3,0xb7,0xa0,0x6f,0x22,0x8f,0xae,0x2d,0x19,0xe0,0x1b,0xb5,0x3e,
+  0x21,0x0c,0x51,0x63,0xe8,0xdf,0x39,0x1a,0xd9,0xc7,0xb2,0x26,0x9d,0x0a,0xbc,0xd5,0x80,0x9f,0x29,0xec,
+  0x8c,0x80,0xb2,0xd2,0x9b,0x65,0xeb,0x19,0x14,0x2b,0xe6,0x3f,0x4e,0xe0,0x4b,0x93,0x76,0x73,0x22,0xd0,
+  0xe6,0x2a,0x47,0x1e,0x4a,0x71,0xa7,0xa6,0x27,0xd8,0x62,0x46,0xe8,0x33,0x0c,0x82,0x09,0x8b,0xbe,0x55,
+  0x18,0xd8,0x79,0xef,0x55,0x58,0x1b,0xee,0xc5,0x04,0x37,0xa2,0x3f,0xda,0x0c,0x7e,0x3b,0x00,0x2f,0x88,
+  0x60,0x3a,0xdb,0x26,0x99,0xc9,0xf9,0x9c,0xcc,0x79,0x11,0x97,0x4d,0x1c,0xd6,0x03,0x73,0x0d,0xc9,0xd2,
+  0xa4,0x1f,0xbf,0xb5,0xbd,0xf3,0x5c,0x53,0xbe,0xd2,0x91,0xd2,0xe8,0xc2,0x77,0x94,0x4c,0x51,0x56,0xfd,
+  0x4e,0x89,0x76,0xf5,0x48,0x26,0xfc,0xe6,0x7b,0xf7,0xdf,0x32,0x56,0xd5,0xe4,0x6b,0xd0,0xcd,0xda,0x64,
+  0xa1,0xe9,0xca,0xa4,0x17,0x38,0x54,0x2f,0xe1,0x07,0x22,0x28,0xa2,0x04,0x29,0x9b,0x4c,0xc1,0x31,0x98,
+  0x7a,0x71,0xef,0x29,0x1c,0xb8,0xf5,0xce,0x25,0x9b,0x1c,0xb1,0x46,0xe7,0xcc,0xf5,0x81,0x15,0xbe,0x51,
+  0x2a,0x41,0xc9,0x57,0xc4,0x3d,0x3b,0x03,0xf9,0x4c,0xd9,0x54,0xb2,0x94,0x0b,0x63,0x18,0xa2,0x44,0x2a,
+  0x45,0x0d,0x75,0x24,0x5e,0x02,0x30,0xb0,0xd9,0xad,0x09,0x0d,0x28,0x52,0x8e,0xed,0xb5,0xf9,0x91,0xed,
+  0x3f,0xc2,0x22,0x93,0x64,0xee,0x17,0x5c,0x2e,0xf0,0x71,0x12,0x41,0x83,0x02,0x60,0xeb,0x8a,0xe8,0xbb,
+  0x07,0x0f,0xf2,0x9e,0x8c,0xc8,0xaa,0xc8,0xcc,0x3b,0xd0,0x79,0xe8,0xe1,0xd1,0x7d,0xb7,0x1f,0x2c,0x00,
+  0x83,0x85,0xb6,0xd5,0xab,0x03,0x06,0x0f,0xf5,0xea,0x7b,0x1c,0xdc,0xca,0x80,0x7c,0x48,0xd9,0xb4,0x2c,
+  0x94,0x0c,0x8c,0x17,0xd4,0x3e,0x7b,0x0d,0xba,0x09,0x14,0x61,0x90,0x95,0x19,0x8a,0x5b,0x8a,0xc3,0x9c,
+  0xc0,0x04,0x72,0x93,0x01,0xdc,0x88,0x26,0x03,0x9a,0x8c,0x80,0x6d,0x22,0x86,0xe7,0x43,0x27,0x60,0x16,
+  0xcd,0x9a,0x48,0x91,0x28,0x13,0xcc,0x05,0xd9,0x6e,0xec,0xc8,0x35,0x66,0xbc,0xfe,0x19,0x80,0x57,0x05,
+  0xe6,0x9e,0x59,0x2f,0x82,0xc3,0x1a,0xdf,0x1d,0x43,0x3f,0xab,0x36,0x55,0x1b,0xa7,0x4e,0x62,0x6a,0x57,
+  0x17,0xe7,0x9c,0x4f,0x01,0x5c,0x59,0xb2,0xf8,0xf3,0x30,0xd6,0x65,0x44,0x9e,0x57,0x6b,0x3a,0x11,0x74,
+  0x81,0xe9,0xee,0x42,0x7b,0x6e,0x04,0x64,0x09,0x66,0xe3,0x00,0x26,0x0c,0x98,0x10,0x62,0xdc,0x8c,0x13,
+  0x80,0x8d,0x03,0x36,0x01,0xca,0x38,0x60,0xe3,0x66,0x9c,0x20,0x6c,0x22,0x23,0x82,0x0a,0x70,0x6b,0x50,
+  0x18,0xde,0x75,0x78,0x21,0x8b,0xdb,0x7b,0x4a,0x6e,0xac,0xba,0xd1,0xd2,0x41,0xb0,0x6a,0x33,0x0b,0x91,
+  0x45,0xe2,0x81,0xcf,0x8b,0x47,0x8b,0x58,0x36,0x0f,0xc8,0x19,0x80,0xdb,0x3b,0x87,0xfd,0xb6,0x11,0x93,
+  0x09,0x67,0x0f,0xc8,0x95,0x07,0x78,0xe9,0xae,0x5d,0xe5,0xde,0xf6,0xae,0xdd,0x0e,0xb2,0x2a,0x86,0x2a,
+  0x49,0x67,0x86,0xb1,0x6c,0x47,0xee,0xaf,0x0b,0xd0,0x46,0x9a,0xe4,0x08,0x3c,0x2c,0xd6,0xc0,0x39,0xe7,
+  0x8f,0x38,0x3a,0x92,0x52,0x17,0x50,0x00,0xe8,0x8d,0x53,0xe1,0xba,0x03,0x55,0x9c,0xf4,0x54,0x07,0xa0,
+  0x02,0xb3,0xc5,0x06,0x10,0x0c,0x80,0x87,0xee,0x9b,0x8e,0xa0,0x28,0x30,0x5b,0xca,0x2f,0xbd,0x19,0xcc,
+  0xd0,0x01,0xf2,0xa5,0x29,0xca,0x71,0x1f,0xe1,0xf5,0xb0,0xf9,0x22,0xc4,0xb6,0x29,0xb6,0xaf,0xb7,0x07,
+  0x75,0xeb,0x0e,0x69,0x84,0x48,0xf5,0x3b,0x9e,0x76,0x75,0xc5,0xf1,0xbf,0x0b,0x03,0xfd,0x47,0xa6,0x69,
+  0x63,0x5d,0x80,0x13,0x67,0xd5,0x93,0xcb,0xd4,0x0a,0xaa,0x28,0xba,0x30,0x5e,0x6e,0x08,0x9f,0x5b,0x9b,
+  0x4a,0x61,0x30,0xaf,0x66,0x9f,0x01,0x39,0x04,0xb5,0x65,0x20,0xea,0x08,0xd4,0x93,0xa8,0x83,0xb1,0x0e,
+  0x40,0x13,0x81,0x36,0x03,0xb3,0x34,0xcb,0x18,0x90,0x15,0x58,0x08,0x30,0x30,0x43,0x83,0x99,0x7e,0x77,
+  0xde,0x24,0x93,0xef,0x61,0x9d,0x7b,0x0a,0xfa,0x7c,0x2f,0xd4,0xd5,0xac,0x8d,0x4c,0x5f,0xf8,0x19,0x33,
+  0x33,0x67,0xb4,0x91,0x69,0x09,0x0e,0x0a,0x5e,0x32,0x87,0xf6,0x2d,0xfc,0x7e,0x23,0xde,0x30,0x50,0x62,
+  0x33,0x90,0x5c,0x15,0x52,0x3e,0x01,0x63,0x39,0x86,0xfe,0x44,0x0d,0x3f,0x6a,0x08,0xb0,0xdb,0x31,0x08,
+  0x8f,0xf8,0xf8,0x80,0x90,0x07,0x4b,0x3e,0x1e,0x80,0xea,0x4f,0x6a,0xe1,0xa9,0xa3,0x86,0xb0,0xae,0x20,
+  0x1c,0x16,0x8d,0x26,0xa4,0x8a,0x56,0x0c,0xe5,0x19,0x92,0x36,0x46,0xe7,0xf0,0x41,0xe0,0x28,0xf5,0x0a,
+  0x6d,0xf1,0x50,0x3f,0x13,0x4c,0xe8,0x16,0xe0,0x04,0x82,0x36,0x7e,0xd0,0x57,0xfe,0xb9,0x8c,0xe8,0x13,
+  0x1b,0x46,0xee,0xd8,0x31,0x39,0xa6,0x55,0xab,0xea,0x70,0x4f,0xa3,0x02,0x1d,0xba,0x1d,0x07,0x90,0x9f,
+  0x21,0x3a,0x3a,0x53,0x1e,0x76,0x01,0xb0,0x57,0x63,0x6d,0x28,0x52,0xba,0x2b,0x8c,0x65,0x34,0x36,0xbc,
+  0xcb,0xd2,0xf7,0x6f,0x00,0x1d,0x08,0x83,0x1e,0xd1,0xc6,0xb1,0x4b,0x0a,0xf7,0xdc,0x53,0x5a,0xb2,0xc9,
+  0x31,0xdf,0x42,0x6f,0xc3,0x29,0x46,0xc0,0x7a,0x17,0x04,0x60,0xfc,0x41,0xc4,0x07,0xdd,0xb4,0x9d,0x29,
+  0x13,0xa6,0xe5,0x0c,0x99,0xa5,0xb1,0x43,0x61,0x03,0x19,0xba,0xd0,0x9b,0xfa,0x2c,0xe4,0x70,0x59,0xe3,
+  0xd7,0x94,0x34,0xde,0x95,0x0d,0xb2,0x57,0xe5,0x81,0x6b,0xa7,0x9b,0x48,0x34,0x64,0x97,0x12,0x4a,0x61,
+  0xea,0x24,0xa9,0xc9,0xf2,0x99,0x22,0x81,0x36,0x3b,0x6a,0x92,0x46,0xe1,0xb0,0x83,0xc6,0x47,0x91,0xa8,
+  0xb7,0x69,0x7a,0x47,0xe7,0x7e,0x97,0x06,0x80,0xb7,0x0c,0xef,0x7c,0xce,0xf4,0x22,0x06,0x02,0x86,0x25,
+  0x0a,0x5b,0x1e,0x60,0x62,0x32,0x95,0x8e,0x54,0x42,0xff,0x8b,0x0c,0xdd,0x59,0x96,0x56,0x67,0xc4,0x66,
+  0x50,0x18,0x08,0xae,0x90,0xf1,0xa6,0x03,0x85,0xf6,0xdc,0x20,0x88,0x32,0x8c,0x25,0x02,0x65,0xd0,0x4a,
+  0x66,0x28,0x93,0x28,0xab,0xa1,0x42,0xb0,0x9c,0x1c,0x7a,0x88,0x48,0x8b,0x40,0x54,0x32,0x10,0xab,0x98,
+  0xff,0x69,0x80,0x93,0xd7,0xa4,0x89,0x53,0x48,0x81,0xd6,0xe9,0x2e,0x6d,0x96,0x92,0x2d,0x9b,0xf7,0xa1,
+  0xc8,0x1a,0x81,0xa0,0x9c,0xe0,0xc0,0x12,0x08,0xcf,0x16,0x73,0xd7,0x36,0xd0,0xdd,0x13,0x03,0x9f,0x29,
+  0x00,0x5a,0x5b,0x85,0x31,0xc3,0x61,0xb6,0xe8,0x4b,0x88,0xb3,0xab,0xfb,0x6b,0x0d,0x4e,0xb1,0x14,0x0c,
+  0x1e,0x4f,0xb0,0xc5,0x39,0x77,0x4a,0x88,0x69,0xf0,0xa3,0x2d,0xd1,0x6f,0xd9,0xdc,0x9a,0x7b,0x1c,0x0d,
+  0x8f,0x06,0xb5,0xc1,0xcf,0xa3,0xe1,0x0d,0xb0,0xc8,0x67,0xaf,0x29,0x1c,0xba,0xf9,0x60,0xad,0xc3,0x97,
+  0x9a,0x27,0x71,0x01,0xb9,0x67,0x06,0x94,0x95,0x6a,0x86,0xc8,0xfc,0x35,0x30,0x5e,0x5f,0xe7,0xdc,0xb5,
+  0x15,0xd3,0xe4,0xd1,0x66,0xb7,0x82,0xf8,0x2d,0x8c,0x9e,0x30,0x0f,0x50,0x0c,0xc8,0x00,0xcc,0xc2,0xac,
+  0x5e,0x80,0x56,0x03,0x1a,0x41,0x34,0x00,0x56,0x0f,0xa0,0xde,0x80,0x50,0x81,0x3a,0x03,0xd7,0x9c,0x14,
+  0xe8,0xe9,0xb6,0x12,0x91,0x99,0x0c,0x21,0x50,0x10,0xa9,0xde,0x55,0x32,0x7f,0x75,0xbd,0xb8,0x2d,0x15,
+  0x53,0x8d,0x93,0x9c,0x65,0x97,0xe0,0xf3,0xaa,0x02,0x9e,0x91,0x11,0x39,0xc3,0x6b,0xf4,0xfa,0x99,0x41,
+  0x6f,0x2d,0x2f,0x2d,0x2f,0x9e,0xf4,0x30,0x18,0xec,0x49,0x89,0x50,0xf4,0x29,0xd0,0x5d,0xf5,0xe9,0x26,
+  0x6c,0x7e,0x13,0x6f,0xca,0x4e,0x52,0xb3,0x89,0xea,0xdc,0x02,0xce,0x8d,0xf1,0x4f,0x22,0x35,0x6d,0xab,
+  0xcf,0xa8,0x33,0xf7,0xef,0x0d,0xe2,0x9e,0x19,0x80,0xf3,0xc7,0xdd,0x13,0xfb,0x1c,0xa3,0x15,0xff,0x2d,
+  0x00,0x07,0xab,0x48,0x4f,0x02,0x11,0x16,0x35,0x95,0xf8,0xe7,0x47,0xd0,0x4f,0x9a,0xd9,0xb7,0x9d,0x70,
+  0x9d,0x23,0xbb,0xd3,0xe0,0x0f,0x09,0x42,0xa3,0xf8,0xa5,0x85,0x43,0xb7,0xdd,0xbd,0x64,0x93,0xe3,0xa4,
+  0x28,0x4f,0x73,0x05,0x0c,0x19,0xe3,0xd4,0x02,0x2d,0x6f,0xf1,0x17,0x23,0x65,0xa7,0x11,0x2f,0x9b,0x5e,
+  0xbf,0xa8,0xd0,0x58,0x41,0xa7,0xc0,0xb9,0x00,0x6e,0xcc,0x61,0x1d,0x81,0xbe,0xa3,0x52,0xa5,0x72,0xc8,
+  0x96,0x56,0xe7,0xe1,0x2a,0xa6,0x16,0x92,0x8f,0xd9,0xd2,0x9a,0xcb,0x5d,0x31,0xdc,0xbf,0x63,0x23,0xb6,
+  0x07,0x00,0x7c,0x40,0xaf,0x80,0x9b,0xd1,0xe4,0x48,0x34,0xb1,0x01,0x86,0xf3,0x41,0x84,0x76,0x54,0x4d,
+  0x7e,0x8e,0xc6,0x8b,0x41,0x3a,0x9d,0xc3,0xcc,0x4c,0x10,0x15,0xe0,0x9d,0x2d,0x67,0x2e,0x57,0x73,0xdf,
+  0x69,0x14,0xb7,0xe6,0xa0,0x8f,0x3e,0xad,0xe0,0x37,0x02,0xe0,0x70,0xea,0x5f,0xd8,0xcc,0x02,0x6d,0x34,
+  0x78,0x8b,0x97,0x2d,0xfb,0x0d,0x8e,0x24,0x76,0x73,0xcd,0x09,0x98,0x0c,0x83,0x18,0x30,0xe5,0xe7,0x45,
+  0xf8,0x38,0x35,0xfb,0x0d,0x60,0x7f,0x2f,0xa4,0xa4,0xd1,0x67,0x48,0x18,0x7c,0xaf,0xb7,0x7d,0xcd,0x98,
+  0xc1,0x0e,0x13,0x98,0x00,0x00,0x65,0x35,0xa8,0x82,0xc3,0x54,0x1e,0x06,0xed,0xa0,0x91,0x43,0x06,0x9b,
+  0x00,0xd0,0x20,0x6a,0x87,0x42,0x17,0x8c,0xc6,0xa6,0x03,0x27,0x05,0x7a,0x9a,0x66,0x22,0x91,0x4d,0xcd,
+  0x48,0x89,0x93,0x6c,0x83,0x55,0x19,0x06,0xff,0xaa,0x66,0xbf,0x30,0xc3,0xde,0x40,0xe4,0x21,0x71,0x02,
+  0x57,0x32,0xc9,0xf4,0x82,0x78,0xd3,0x58,0x92,0x82,0x55,0xf4,0xa3,0xcf,0x6a,0xcd,0x03,0x15,0x0e,0xea,
+  0xe2,0x83,0x2a,0x55,0xdc,0x58,0x43,0x06,0xc1,0x84,0xc4,0xbd,0x04,0x5e,0x9c,0x22,0x1d,0xcc,0xb8,0xcc,
+  0xff,0x56,0x50,0x39,0x1f,0xe4,0x8c,0xf9,0x06,0x09,0x64,0xa0,0x12,0x93,0xe6,0x40,0x8b,0x61,0x2c,0x8f,
+  0x63,0x5f,0x43,0x28,0xef,0xf1,0x82,0xc0,0xfb,0xca,0x3d,0x35,0xce,0xdb,0x94,0xab,0x88,0x6e,0x29,0xa0,
+  0xe8,0x37,0x31,0xb3,0x7e,0x85,0x04,0x6b,0x0e,0xfa,0xe8,0xaf,0x36,0x8c,0xec,0xfc,0xfc,0x31,0x29,0x89,
+  0xa9,0xce,0xf2,0xbd,0x81,0xe0,0x4d,0x00,0x9e,0xab,0xc4,0xf7,0x61,0x1c,0x05,0xd0,0x78,0x14,0x1e,0xb3,
+  0x76,0x03,0xb3,0x04,0xda,0x13,0xc7,0x98,0x22,0x89,0x1f,0xd2,0x10,0x90,0x12,0x3a,0x81,0x90,0x30,0xb3,
+  0x49,0xbb,0xc8,0x9c,0x21,0x43,0xc1,0x61,0xd5,0xfe,0x93,0x02,0x5d,0x73,0x0d,0xe3,0xec,0xb0,0xc3,0x58,
+  0x37,0xcd,0x86,0x66,0x86,0x72,0x91,0x12,0x17,0x55,0xcc,0xc7,0xde,0x0c,0x92,0x64,0xb5,0x45,0x30,0x3b,
+  0xd4,0xe4,0x82,0xf6,0xc3,0x71,0xf4,0x06,0x11,0x17,0xe7,0xdb,0x56,0x9f,0x51,0x18,0xba,0x6d,0x2f,0x00,
+  0x56,0xb3,0xec,0x02,0x46,0xfb,0xa2,0x24,0x93,0x53,0x96,0x92,0xeb,0x5b,0x32,0xef,0xeb,0xc4,0xbd,0xa8,
+  0xd0,0xde,0xf5,0x86,0xfc,0x60,0xff,0x07,0xf3,0x80,0x5c,0x96,0x04,0x32,0x7e,0xbd,0x84,0x29,0x0e,0xcd,
+  0x26,0x70,0xd5,0x5f,0xd9,0x83,0xa2,0x7f,0xd3,0xca,0x95,0xf5,0x32,0xc6,0xd7,0x1e,0xd4,0xf2,0xe7,0xd6,
+  0x8f,0xdc,0xf6,0xf9,0x3c,0x72,0x19,0xa0,0x43,0x27,0x6d,0xf8,0x79,0xae,0x99,0x02,0x2b,0x35,0x51,0xc9,
+  0xf1,0x46,0x09,0x7a,0x8e,0x68,0x14,0x65,0xe9,0x9e,0x1c,0xa3,0xea,0x10,0x9a,0xaf,0x63,0x10,0x8c,0x99,
+  0xbf,0x74,0xe3,0xe0,0xf6,0x8f,0xcf,0x7a,0x7a,0x74,0xe4,0x1a,0x51,0x42,0x06,0x0c,0xb5,0x21,0x28,0xf9,
+  0x03,0x41,0x56,0x4f,0x03,0x51,0x2a,0x69,0x26,0x03,0x39,0x69,0x72,0xd4,0x5e,0x2b,0xdb,0x5c,0xa6,0x0c,
+  0xab,0xb3,0xc4,0x5e,0x9c,0x3c,0xce,0x27,0xcc,0x7b,0x26,0xb0,0x7b,0x60,0x80,0x05,0x24,0x54,0x6d,0x37,
+  0x0d,0x9f,0x07,0xb0,0x21,0xa4,0x3c,0x4e,0x61,0xbb,0x11,0x64,0xf7,0x55,0xbf,0x57,0x75,0x32,0x19,0xc8,
+  0xef,0x7c,0xc5,0x0e,0x39,0xca,0x72,0x7f,0xb4,0x66,0x70,0x51,0x7e,0x61,0xc5,0xd4,0x67,0xc5,0x7d,0x60,
+  0x73,0x47,0x57,0xdb,0x75,0x03,0x3b,0x36,0x01,0xd0,0x3c,0x72,0x99,0x35,0x58,0xe3,0xab,0x1b,0x67,0x21,
+  0x4e,0x6f,0x7a,0xec,0x63,0x36,0x7a,0x82,0xee,0xb4,0x4c,0xac,0x65,0x74,0x59,0x67,0x36,0x90,0x86,0x32,
+  0x70,0x75,0x52,0x0c,0xd0,0xa1,0xc7,0x92,0x30,0x34,0x05,0x97,0x37,0x1e,0xac,0xda,0xcc,0xa9,0x0f,0x22,
+  0xa9,0x19,0xe3,0xd2,0x4c,0xc1,0x37,0x15,0xda,0x73,0xeb,0x00,0x2a,0x81,0x12,0x12,0xc7,0x30,0x00,0x80,
+  0x5e,0xe8,0xa8,0x80,0x82,0x0c,0x4a,0x60,0x7c,0xb0,0x64,0x2e,0x5e,0xae,0x71,0x76,0x1c,0xac,0x97,0x8c,
+  0x2d,0x53,0xe3,0x49,0x93,0xa3,0xf6,0x38,0x8c,0x43,0x5f,0xc7,0x58,0xb2,0xd3,0xcf,0x71,0x26,0x8b,0xce,
+  0xda,0x48,0x5a,0x9d,0xb8,0x4e,0x0f,0xcb,0x97,0x54,0x41,0xe0,0x2c,0x55,0x8b,0x0a,0x03,0xb7,0x1c,0x48,
+  0x35,0xb1,0xa6,0x1f,0xe6,0x15,0x7b,0x77,0x0e,0x6f,0xea,0xc8,0xdd,0xe9,0xc8,0x47,0xab,0xd9,0x52,0x0a,
+  0x21,0x68,0x80,0x8b,0x4c,0xb5,0x9e,0xc1,0x86,0x3f,0xef,0x58,0xf3,0x17,0x4f,0x35,0xfd,0xc7,0xfc,0x60,
+  0xff,0x0f,0x80,0xfe,0xfb,0xf0,0x52,0xcc,0x83,0xeb,0xdb,0x3c,0x45,0xbc,0x28,0x02,0x70,0xce,0xda,0x0d,
+  0x30,0xa8,0xed,0x4f,0xc2,0xf8,0x7d,0xc7,0xd1,0x51,0xd1,0x21,0xc0,0x49,0xb5,0xe0,0xde,0x9b,0x0d,0x0b,
+  0xd9,0x8e,0x24,0x79,0x0a,0xa1,0x70,0x4d,0x00,0xb7,0x86,0xb3,0x23,0xaa,0x33,0xda,0x35,0x21,0x89,0x43,
+  0x71,0x34,0x20,0x27,0xc5,0x39,0x79,0x91,0x00,0xa0,0xe5,0x6c,0x9d,0x81,0xf5,0x86,0x29,0x79,0x17,0x56,
+  0x53,0xc0,0x60,0x01,0x88,0x58,0xf5,0xce,0x92,0xfa,0x6f,0x47,0xe6,0x3f,0xa8,0xa6,0x47,0xca,0xd1,0xd8,
+  0xb3,0xf3,0x43,0x3b,0xbe,0x3b,0x1d,0xf2,0x4a,0x83,0x0e,0x66,0x66,0x3f,0x0f,0x92,0x1c,0x97,0x63,0x09,
+  0xe3,0xcb,0xb8,0xc5,0xde,0x91,0x8f,0x0b,0x29,0xdf,0xdf,0xda,0xbe,0xe6,0x43,0x97,0x9f,0x76,0x76,0x47,
+  0x52,0xd1,0x0d,0xc9,0x1f,0x87,0x3c,0xf4,0xe2,0x64,0x16,0x09,0x86,0x08,0x10,0x62,0x1d,0xd5,0x88,0xe0,
+  0x71,0xc4,0x93,0x4a,0xb5,0x51,0x26,0x26,0x09,0x46,0x35,0x68,0x0c,0x50,0x36,0x8f,0x71,0xf5,0xe5,0x09,
+  0x8b,0xa3,0x09,0x8b,0xe3,0xea,0x3d,0xae,0x33,0xdf,0x13,0xea,0x2b,0xe3,0x1a,0xc7,0x00,0x4f,0x0a,0x34,
+  0x00,0x8c,0x60,0xad,0xe4,0x01,0x51,0xc1,0xd9,0x19,0x91,0x6c,0x1a,0xc1,0xa2,0x01,0x70,0x20,0xd5,0x34,
+  0xcd,0xe2,0x31,0xef,0xc0,0x92,0x01,0xdf,0x37,0xf0,0xc7,0x19,0xb8,0x47,0x81,0x6c,0x6a,0x08,0xea,0x7c,
+  0x6f,0x7b,0x57,0x4f,0x7e,0xf9,0x23,0x57,0x60,0x4a,0x3e,0x47,0x15,0x37,0xe6,0x37,0x15,0x46,0x3b,0xc6,
+  0x32,0xb5,0xb4,0x7e,0x4e,0x3d,0xcc,0x32,0x22,0xff,0xd0,0xe4,0x33,0xbf,0xdc,0xdc,0xd1,0xf9,0xf2,0x84,
+  0xb4,0x06,0xba,0x88,0xaa,0x6e,0xcc,0x1c,0x44,0x4b,0x36,0xe3,0x48,0x5d,0xe6,0xb6,0xb2,0xf9,0x4a,0xac,
+  0x78,0x51,0x01,0xd0,0x7d,0xf8,0x55,0x90,0x4f,0x38,0x5c,0xb8,0x90,0x7b,0x9e,0x49,0x54,0x26,0xc3,0xa0,
+  0x60,0x20,0x60,0x73,0x95,0x1f,0xc5,0x91,0xf0,0xa6,0x77,0xab,0xd9,0x9d,0xcd,0x2e,0xc8,0x0a,0x24,0x34,
+  0x30,0xc0,0xbc,0x37,0x32,0xde,0x10,0x90,0x58,0x79,0x42,0x0b,0xb4,0x69,0x2c,0x79,0x40,0xf6,0x62,0x22,
+  0xc9,0xdd,0x15,0xff,0xd2,0x20,0x41,0x97,0x14,0x80,0x39,0x10,0xde,0xf4,0x80,0x01,0x5f,0x0a,0xc1,0x3d,
+  0x50,0xbc,0x21,0x32,0xdd,0x2d,0xe4,0x8b,0x9a,0x5d,0x50,0x30,0xe0,0xc9,0x06,0x7c,0xae,0x4c,0xf7,0x6e,
+  0x31,0x94,0x9b,0x97,0xd5,0x97,0x6b,0x4d,0x8a,0x9e,0x14,0x7b,0xad,0x0f,0x82,0xef,0x96,0x4c,0xf7,0x06,
+  0x10,0x39,0xd6,0xc2,0x62,0xa6,0xbc,0x16,0x13,0x96,0xf0,0x52,0x64,0x19,0x7e,0x6a,0x6b,0x47,0xee,0xeb,
+  0xf9,0xf6,0xce,0x73,0x93,0xaa,0x6e,0xb8,0xa5,0x6e,0x9c,0x6a,0x91,0xeb,0x7b,0xf7,0xdf,0x32,0xa6,0x86,
+  0x6b,0x1b,0x25,0x78,0x6d,0xbe,0xa5,0xf3,0xbc,0x4b,0xb1,0xab,0x5c,0x48,0x59,0xa2,0x16,0x72,0xcf,0xc3,
+  0xb5,0x30,0x96,0xac,0x01,0x35,0xa5,0x88,0xd0,0xea,0x9a,0x98,0xc1,0x84,0xcc,0x08,0x59,0x19,0x53,0x7f,
+  0x85,0x37,0xdb,0x15,0x92,0x58,0x48,0xce,0x7e,0xb2,0x29,0xac,0x31,0x38,0x81,0x03,0x29,0x16,0x69,0xf3,
+  0x58,0x62,0x22,0xf4,0x57,0x0a,0x2d,0x9d,0x4f,0x08,0x4c,0x2e,0x2e,0xc1,0x5b,0x35,0xff,0x3b,0x29,0xe7,
+  0xa0,0x87,0xd9,0x33,0x22,0x68,0x83,0xd1,0x9e,0xe0,0x28,0x6b,0x42,0x0a,0xc6,0x34,0xfa,0x77,0xaf,0xb6,
+  0x22,0x43,0x79,0x68,0x04,0x5b,0x75,0xe5,0xd0,0x8e,0xd7,0xce,0x9c,0x94,0xb3,0x2e,0xb8,0x6c,0x7f,0xdf,
+  0x58,0x6f,0x5b,0xd7,0xd5,0x59,0xe7,0x36,0x8c,0x59,0xec,0xb9,0x04,0x08,0x6f,0xa6,0x5c,0xc1,0xd8,0xcc,
+  0x62,0xc4,0x5a,0x4f,0xf7,0x2c,0x80,0x4f,0xda,0xd4,0x96,0x7b,0xdb,0xfa,0xa1,0xfe,0xab,0x98,0x68,0xdb,
+  0x49,0x7a,0xac,0xc5,0x39,0x6f,0x45,0x33,0x80,0xef,0x16,0x5b,0xef,0xcd,0x9e,0xd7,0x20,0xf2,0x83,0xde,
+  0x15,0x9d,0x97,0x12,0xec,0x93,0x38,0x1a,0x5f,0xc8,0x33,0x6e,0x3a,0xb2,0x6b,0x78,0x36,0xee,0x3f,0x55,
+  0x66,0x83,0x80,0x22,0x40,0x46,0x6a,0xf6,0x5d,0x6c,0x06,0x0f,0xb3,0x0c,0xe5,0x8c,0x58,0x7d,0x10,0xab,
+  0xed,0xa5,0xb0,0x36,0xb7,0x9b,0x0b,0x24,0x27,0x39,0xe1,0x04,0x39,0xe5,0xc2,0xb3,0x06,0x27,0xa3,0xdf,
+  0xec,0x6d,0xef,0xfa,0x6e,0x6f,0x47,0xd7,0xf7,0xe8,0xe4,0x7f,0x48,0x36,0x68,0x0d,0x3b,0x51,0x9a,0xc3,
+  0x7c,0x7a,0x9d,0xb8,0x87,0xc1,0xf8,0xbb,0x3d,0xe1,0xa1,0xd7,0xc4,0xa6,0x37,0x8e,0x6b,0xfc,0x8e,0xc8,
+  0xf0,0xe5,0x26,0x17,0x34,0x45,0xc0,0x75,0x06,0xdc,0xb5,0xa9,0xb5,0xeb,0xa2,0x3c,0xf2,0x32,0x5d,0x3b,
+  0x6e,0x44,0x9f,0x37,0x80,0x41,0xc5,0x3e,0x38,0xae,0x7e,0x20,0x3c,0x0e,0x5a,0x7a,0x1a,0xe1,0x8a,0x9b,
+  0x30,0xef,0x0d,0x58,0x5e,0xe7,0xdc,0x47,0xb7,0x74,0xe4,0x3e,0x97,0x3f,0xfd,0xdc,0xf6,0x1e,0xc0,0x2f,
+  0xc5,0xae,0x2e,0x00,0xba,0x11,0xe0,0xdb,0x86,0x6e,0xdb,0x3b,0x0e,0x7d,0xb6,0x19,0x26,0xda,0x82,0xcc,
+  0xa7,0x42,0xc7,0xbb,0x91,0x09,0x0f,0xcc,0x75,0x33,0x13,0x1e,0xb0,0x4c,0x70,0xef,0xa3,0x9b,0x73,0x8f,
+  0xa8,0xe5,0x23,0x49,0x1c,0xef,0x53,0xaa,0x1c,0x99,0xfd,0x65,0xf5,0x5f,0x53,0xb5,0x2f,0x55,0xd4,0x7f,
+  0x2d,0x56,0xfd,0x4a,0x45,0xf5,0x3a,0x03,0xbc,0x24,0xc8,0x87,0x89,0xc8,0x29,0xcb,0xc2,0xf0,0x1a,0x47,
+  0x9e,0x3d,0x5b,0xc6,0xe0,0xcc,0x19,0x65,0x8c,0x83,0x13,0x37,0x24,0xc8,0x20,0x2b,0xf2,0xc4,0xaa,0xf4,
+  0x55,0xa0,0x88,0x67,0x80,0xd5,0x2c,0x49,0x97,0xf5,0x46,0x3c,0xec,0x11,0x71,0xeb,0x27,0x23,0xfa,0x9b,
+  0x42,0xc3,0x35,0x46,0x77,0x9d,0xa3,0x3c,0x8c,0xf0,0xab,0x68,0xf8,0x90,0x0a,0x5f,0x51,0x40,0xe1,0x7a,
+  0x20,0x2f,0x40,0xc1,0xa6,0x1f,0xe3,0x57,0x8c,0x16,0x87,0x7a,0x33,0xab,0xdf,0x18,0x4a,0xe6,0x3f,0x63,
+  0x8b,0x23,0x1c,0x17,0x2d,0x7d,0xd4,0xb6,0xf6,0x30,0x9b,0xb0,0x58,0x1b,0x18,0xfc,0x25,0x63,0x3c,0x6e,
+  0x53,0x5b,0xee,0xef,0xd6,0x0f,0xf5,0xdf,0x50,0x65,0x6c,0x5d,0xac,0x50,0xe7,0x01,0x29,0x0c,0xef,0xfc,
+  0xe9,0x3f,0x2d,0xeb,0x3c,0xdf,0x82,0xf8,0x95,0x46,0x7d,0x92,0x1a,0x1b,0x39,0x4b,0xe5,0xfa,0xe4,0xcf,
+  0x09,0xef,0x42,0x3f,0x3e,0x25,0x3f,0x06,0x40,0x2e,0x85,0xed,0x8c,0x52,0x4f,0xf2,0x59,0x06,0x0c,0xa7,
+  0x99,0x80,0x4c,0xa1,0x3b,0xb1,0x94,0xfe,0xc9,0xab,0x1d,0x39,0x82,0x28,0x12,0x72,0xc5,0xe2,0x50,0x21,
+  0x8b,0x4f,0x68,0xd8,0xae,0x62,0xea,0x13,0x44,0x83,0xa8,0xe1,0x53,0xbb,0x8f,0x16,0xcc,0x50,0x02,0x01,
+  0x97,0x57,0xd4,0x87,0x5e,0xe5,0x7d,0x7e,0xb8,0xe3,0xce,0x4c,0xfb,0x81,0xff,0x2c,0x29,0x2e,0xab,0x97,
+  0x20,0x37,0xae,0x71,0xab,0x36,0x8e,0xfd,0xfd,0xab,0x07,0xd7,0x86,0x05,0x14,0xa2,0x99,0x02,0x0d,0xdb,
+  0xd0,0xed,0x7a,0x86,0x8a,0x9f,0x29,0xb4,0x77,0x3e,0x69,0x99,0xcb,0xbc,0xf6,0x88,0x46,0x11,0xc1,0xf0,
+  0x78,0x9e,0x3c,0x00,0xdd,0xb8,0xc5,0x51,0x1d,0x83,0x47,0xc4,0x8c,0x3f,0x9b,0x3f,0xf5,0x82,0xf3,0x0b,
+  0xfb,0xfb,0x0e,0xdc,0x37,0x61,0x6a,0x61,0x50,0x66,0x1e,0xb9,0x4c,0x61,0xb4,0x7f,0x08,0xc0,0x7b,0xd3,
+  0x7b,0xd1,0x66,0xdd,0xd1,0x7f,0x3d,0x45,0x81,0x3e,0x20,0xf6,0x7b,0x35,0xe0,0xcf,0x33,0x74,0x7f,0x2c,
+  0x00,0xa2,0x14,0x23,0xd5,0x9a,0x8f,0x5a,0x52,0xf1,0x94,0x59,0x0a,0xd7,0xcb,0x89,0x8e,0x72,0xb8,0x54,
+  0x4b,0xcc,0xc8,0x2b,0x97,0x66,0x02,0x55,0x2a,0xea,0xbf,0x3a,0xa1,0xfe,0xa3,0x57,0x0c,0xf6,0xbf,0xb0,
+  0x30,0xdc,0xdf,0x1f,0xb4,0x0f,0x6c,0x15,0xca,0x3f,0xc6,0xb0,0x20,0x20,0x01,0xd8,0xee,0xc2,0x3d,0xf7,
+  0x94,0x2e,0xc2,0x99,0x3a,0x47,0xf4,0x4c,0xb7,0xa1,0xdb,0xe9,0xe0,0xce,0xff,0x37,0xe6,0xe3,0x2f,0x35,
+  0x49,0x10,0x1a,0x66,0xae,0x2a,0x39,0xe6,0x3a,0x1c,0xa8,0x12,0x1c,0x77,0x3e,0xea,0xed,0x6d,0xcf,0xad,
+  0x2f,0x2e,0xc1,0xfc,0x28,0x02,0xbe,0x80,0xfe,0xca,0xf1,0x1a,0x55,0x21,0x3d,0xb5,0x34,0x90,0xbb,0xc6,
+  0xe3,0xf8,0xcd,0xa5,0x38,0x7e,0x7a,0xa4,0x7e,0xb7,0x41,0x23,0xad,0x61,0x0c,0x30,0x40,0x49,0x36,0xa6,
+  0xb5,0xa9,0x9a,0x52,0x4d,0xe8,0x42,0x37,0xf5,0xc9,0xc0,0xca,0x3c,0x79,0xc1,0x20,0x10,0x05,0xfe,0x55,
+  0x85,0x7d,0xb7,0x0f,0xe6,0x01,0xc1,0xe9,0xe7,0xb6,0x4a,0xcc,0xcb,0x12,0xfe,0x62,0xbb,0x77,0xd4,0x47,
+  0x37,0x8c,0x47,0xe1,0xb7,0x93,0x63,0xb8,0x38,0xd7,0xc2,0x5b,0x37,0x8a,0xba,0x1d,0x60,0x3c,0xd8,0xd1,
+  0x33,0xde,0x31,0x70,0x6d,0x93,0x04,0x7f,0x39,0xa6,0xde,0xd7,0xb0,0x6b,0x1e,0x1f,0x6e,0xbb,0x24,0x41,
+  0x3f,0xa0,0xa1,0x6d,0xb9,0x0b,0x2f,0xe9,0xed,0xe8,0xcc,0x6c,0x18,0xd8,0xb9,0xbe,0x1b,0x70,0xb9,0xc4,
+  0x0c,0xd0,0xf9,0x1e,0xd1,0xdb,0xd2,0xb9,0x25,0x43,0x39,0x2b,0x82,0x19,0x67,0xa9,0x11,0x9d,0x79,0xd1,
+  0xe8,0x29,0xf6,0x8f,0x57,0x0e,0xee,0xdc,0x57,0x4b,0x93,0xb0,0x0d,0xdd,0xd2,0x83,0xa2,0x77,0xb4,0x8b,
+  0x9c,0x73,0xaf,0x10,0xf8,0x97,0x47,0x6a,0x6f,0x0d,0x5d,0x70,0x0d,0x60,0x4d,0x0a,0x98,0x00,0x0c,0x28,
+  0x62,0x29,0x37,0x74,0x40,0x4a,0x48,0x8a,0x37,0x43,0xc9,0x54,0x39,0xfb,0x1a,0x19,0x13,0xae,0x8f,0xb1,
+  0x93,0x02,0xbd,0x80,0xca,0x91,0x6c,0xec,0x57,0x74,0x03,0x23,0x05,0xc0,0x6f,0x8e,0x24,0x8c,0xe1,0xaf,
+  0x37,0xf0,0x6a,0x7a,0xfb,0xcd,0x86,0x91,0x9d,0x3f,0x01,0x80,0x77,0x2e,0xf0,0x08,0x4e,0x76,0x49,0x9f,
+  0xc7,0x00,0xfe,0x6a,0x53,0x7b,0xd7,0x9d,0x19,0x71,0x97,0x2b,0x0c,0xb1,0x69,0x9c,0xb2,0x31,0x1d,0x6b,
+  0x10,0xa3,0x9a,0xb1,0xd4,0x64,0xc0,0x69,0x47,0x34,0xd6,0x26,0x09,0xaf,0xec,0xed,0xe8,0x3c,0xb2,0x61,
+  0x60,0xe7,0xbb,0x16,0xb1,0x31,0xba,0xeb,0xc5,0x9d,0x63,0xea,0x6b,0x08,0xe1,0xe7,0x5e,0x28,0x21,0x21,
+  0x20,0xca,0x56,0xd9,0x04,0x60,0xdf,0xc6,0x19,0x38,0xe8,0xbd,0xca,0xc1,0x65,0xce,0x5d,0x34,0xae,0xd8,
+  0xe3,0x9c,0xa9,0xc1,0x02,0x4b,0x84,0x19,0x66,0x36,0x16,0x99,0xfe,0xc4,0x68,0x77,0x53,0x71,0xaf,0xa7,
+  0x0d,0x94,0xc9,0x46,0x07,0x3e,0xa3,0x81,0xee,0xc2,0x09,0xf3,0xd5,0x50,0x2b,0xef,0x53,0x21,0x9f,0xf0,
+  0x5f,0xec,0x3b,0x19,0x58,0x59,0xc0,0xe5,0xc5,0xf9,0x22,0x12,0x3c,0x2f,0x1a,0x94,0x21,0x00,0x9b,0x49,
+  0x7b,0x44,0x7e,0x64,0xe7,0x4f,0xd2,0x60,0x06,0x17,0x6b,0x57,0xe6,0x01,0x59,0x3f,0xb8,0xe3,0x8a,0xb2,
+  0xd7,0xe7,0xa9,0xe1,0xee,0x7a,0x09,0x82,0x94,0xef,0xad,0xb6,0x7c,0xc9,0x66,0x49,0x24,0x9a,0x24,0x79,
+  0x4f,0x31,0xda,0x5a,0x92,0xff,0xd4,0x1e,0x65,0xb3,0x90,0x4f,0x8a,0xa1,0x16,0x9b,0x79,0x98,0x3c,0x3d,
+  0xdf,0x7a,0x76,0x73,0xbe,0xf5,0xec,0x95,0xb3,0x55,0x85,0x4f,0x23,0xf6,0xd3,0xc3,0x3e,0xfa,0xaa,0x06,
+  0x72,0xda,0x84,0xb9,0x87,0xc6,0xd4,0x33,0x66,0xbb,0x27,0xcc,0x3d,0x74,0xc2,0xe1,0xf4,0xb2,0xfa,0x57,
+  0x7b,0x68,0xac,0x51,0x18,0xcd,0x46,0x89,0xe6,0x24,0xbe,0x67,0x22,0x39,0x95,0x84,0x49,0x6e,0xcc,0x64,
+  0x3d,0x70,0x8a,0x25,0xaf,0x26,0xf0,0x62,0x08,0x5f,0xef,0xc0,0x37,0x64,0x21,0xe7,0x57,0xcc,0xaf,0x9f,
+  0x50,0x7d,0x55,0x48,0xa1,0x9b,0x36,0xd7,0x9a,0x68,0xae,0xc1,0xb8,0xfd,0xa4,0x86,0xc6,0xa2,0xaa,0x5a,
+  0xb8,0x11,0xfd,0x51,0x2f,0x72,0x6b,0x05,0x3a,0x9a,0x5f,0xbe,0x6a,0x45,0xe1,0x50,0xdf,0xc1,0xa5,0x28,
+  0xfe,0x42,0x8a,0x7e,0xf4,0x0c,0x15,0xbf,0x9a,0x6f,0xce,0xfd,0x90,0x59,0xbd,0x52,0xc0,0xd7,0x65,0xe8,
+  0xb2,0x65,0xf3,0x55,0x47,0xf5,0x3e,0x9d,0x34,0x14,0x06,0x01,0xe9,0x6a,0xb4,0xa6,0x37,0x83,0x30,0xf9,
+  0xb3,0x1a,0x75,0xab,0xa3,0x48,0x49,0xfd,0x17,0x08,0x3c,0x23,0x23,0xd2,0x50,0x86,0xdf,0x1f,0xb8,0x6c,
+  0x87,0xc1,0xfe,0x15,0xc0,0xb3,0x36,0xce,0xd2,0xc1,0xa3,0x66,0xf7,0x84,0x20,0x4a,0xd5,0xde,0x32,0x0b,
+  0xb9,0xb6,0xb4,0x76,0x0e,0xcd,0x46,0x44,0x59,0x45,0x4e,0xfc,0x81,0xdb,0xb6,0xb3,0x23,0x77,0x53,0x1d,
+  0xdd,0xa3,0xcb,0xe6,0xad,0x9a,0x27,0x93,0x14,0x5b,0xb3,0xd1,0x91,0x8d,0x6a,0xd5,0x82,0x6a,0x2e,0x0f,
+  0x28,0x67,0x35,0x5a,0x78,0xf1,0x11,0x8d,0x9e,0x63,0x31,0x5e,0x98,0x0d,0xc2,0x2f,0x5a,0x42,0xa5,0x21,
+  0x47,0xeb,0x3f,0xd3,0x0d,0x2a,0xf8,0xc2,0x49,0x81,0x9e,0x5f,0xa7,0x6a,0x5c,0x93,0xd0,0x4e,0xc0,0xde,
+  0x5b,0xd7,0xfc,0x91,0xb7,0xec,0xf9,0xe9,0xc4,0xb1,0x3e,0x39,0x41,0x3f,0xe0,0x7a,0x0e,0xf7,0x0f,0x03,
+  0x78,0x73,0x6f,0x4b,0xd7,0xc7,0x2b,0x0e,0x97,0x11,0x7c,0x91,0xd2,0xbc,0x99,0x55,0xaa,0xd5,0x31,0x49,
+  0xa0,0x27,0x09,0x15,0x2b,0xf4,0xa0,0x2a,0x7f,0x97,0xa2,0x01,0x20,0x71,0x86,0x57,0x8c,0x10,0x78,0x48,
+  0x35,0x37,0xa2,0xa2,0x7a,0x17,0xc8,0x1b,0xcd,0xb0,0x3a,0x36,0x3b,0xc3,0x0c,0xdc,0x30,0xb8,0x7d,0xf7,
+  0x96,0xf6,0xdc,0xb9,0x9b,0x5a,0xbb,0x9e,0xb6,0x7e,0x78,0xc7,0xf5,0xf3,0xa1,0x1f,0x66,0x48,0x09,0xcd,
+  0x73,0x01,0xd0,0x3f,0x07,0xf4,0x97,0xfc,0x3f,0xa7,0xb1,0x35,0x61,0x06,0x4a,0xdd,0x02,0xfa,0xe2,0x5e,
+  0xe3,0x3f,0x07,0xe4,0x67,0x2b,0x60,0x45,0x40,0xa7,0x93,0xb5,0x15,0x40,0x64,0x47,0xa1,0x53,0x35,0x58,
+  0x6c,0xb1,0x17,0x88,0xab,0x67,0xf0,0x35,0x67,0xe3,0x2b,0x26,0x4c,0x2e,0x6f,0x62,0xf0,0x8e,0xf1,0x24,
+  0x40,0xe5,0x0c,0x16,0xd5,0x33,0x08,0xc7,0x35,0xfe,0xa9,0x0d,0x76,0x7c,0xe5,0x44,0x37,0x39,0x3c,0x60,
+  0x71,0xb5,0xe5,0x46,0x72,0xdc,0x5b,0x5c,0xbd,0xd3,0xfc,0x82,0xac,0x8b,0x82,0x29,0x0d,0x8c,0x52,0x61,
+  0x3e,0x2e,0x09,0x3b,0x3d,0xa9,0x29,0xb3,0x0d,0xdd,0x6e,0xc3,0xc8,0x8e,0xed,0x6f,0x1f,0xdc,0xfe,0x4a,
+  0x75,0xd1,0x05,0x66,0xf6,0x65,0x21,0x6f,0x52,0xe0,0x06,0x03,0x7f,0x00,0xb0,0xcf,0x80,0x9b,0x24,0x89,
+  0x5e,0x1e,0x30,0xb3,0x2f,0x00,0xdc,0x66,0xc4,0x17,0xcc,0xf0,0x1b,0xc0,0xbe,0x65,0xe0,0x28,0xd3,0xfc,
+  0x13,0x0f,0xfd,0x11,0xcc,0x1e,0x02,0xd8,0x2f,0xca,0xe6,0xef,0x84,0xe0,0xec,0xde,0x8e,0xdc,0xe5,0x4a,
+  0x7c,0x23,0xce,0xfa,0x9b,0x52,0x24,0x43,0xe7,0x33,0x8f,0x12,0x07,0xb2,0x43,0xab,0xf9,0x22,0x33,0xdd,
+  0xd5,0xff,0x9f,0x2f,0x44,0x9d,0x72,0xa0,0x88,0x1f,0xdc,0xbe,0xed,0x88,0x46,0xdf,0x5a,0x26,0x41,0x26,
+  0x86,0xde,0x01,0x58,0xcc,0x29,0xf0,0xe3,0x54,0xe0,0xc2,0x43,0xe3,0xac,0x08,0xca,0x2e,0xfb,0xb6,0xc2,
+  0x40,0xff,0x3b,0x27,0x34,0x3e,0x10,0x40,0x68,0x40,0x39,0x4b,0x17,0x46,0xa6,0xc3,0x66,0xf2,0x37,0x05,
+  0xf4,0x9d,0xd8,0x38,0x74,0x96,0xe2,0x38,0xa5,0xcb,0xc6,0xd4,0x8e,0x59,0x31,0x0c,0x15,0xf5,0x77,0x7a,
+  0xc7,0x11,0x24,0xa5,0x49,0xd5,0x40,0x01,0x8f,0x67,0x5b,0x8e,0xc4,0xae,0x2e,0xa6,0xd0,0xda,0x3a,0x59,
+  0xbf,0xbf,0xef,0xae,0xcd,0x6d,0xab,0x3f,0x24,0x70,0x1f,0x5f,0xe6,0x32,0x4f,0x1f,0xb7,0x78,0x72,0x74,
+  0x91,0x19,0x02,0xf0,0xdc,0xd0,0xc9,0x86,0xc9,0x9f,0xd1,0xe0,0xc0,0x0b,0x22,0xd3,0x94,0x38,0xd0,0xac,
+  0x41,0xc2,0x97,0x95,0x7c,0x7c,0x19,0x04,0x5b,0x02,0x4a,0x46,0x4d,0x7d,0x86,0xf2,0xd8,0x90,0xc4,0x58,
+  0x05,0x5f,0x01,0x70,0x43,0x15,0x79,0x98,0xd5,0x81,0x25,0xeb,0x01,0x70,0xa1,0x89,0xfd,0x9e,0xda,0x90,
+  0x81,0x18,0xee,0xcb,0xbc,0x30,0x9d,0x6f,0x05,0x79,0x8d,0xfe,0x72,0x94,0xf2,0x6e,0x1a,0x4f,0x0f,0x84,
+  0xe7,0xc4,0x36,0x17,0xab,0x2a,0xc4,0x9b,0x19,0xc8,0x27,0x26,0x27,0x07,0xbf,0x5b,0xef,0xdc,0xc5,0xb1,
+  0x59,0x36,0x32,0xdd,0x31,0x61,0xfe,0xa5,0x9b,0x87,0x76,0xec,0xcc,0x03,0x72,0x22,0xe7,0x72,0xa0,0xa4,
+  0xfe,0x3a,0x00,0x87,0x01,0x06,0xa4,0x11,0x46,0x35,0xa2,0x2c,0x66,0x83,0x20,0x77,0x06,0xe0,0x2f,0x3d,
+  0x79,0x4b,0x95,0x5c,0x85,0xb3,0x57,0x7a,0x1c,0x27,0xac,0x16,0x0a,0xf4,0x69,0x1e,0x90,0x2b,0x87,0x6e,
+  0xfb,0xdf,0x75,0xc0,0xda,0xa7,0xb7,0xe7,0xb6,0x38,0xf2,0xad,0x06,0x20,0x86,0x46,0x04,0xc3,0x18,0x66,
+  0x71,0x42,0xf6,0x33,0x49,0x05,0xec,0x8f,0xd2,0xec,0x92,0x00,0xca,0xe6,0x15,0x82,0x4b,0xcd,0x68,0x15,
+  0xa8,0x3a,0xd2,0x95,0xcd,0x47,0x0e,0x81,0x18,0xf1,0x0c,0x00,0x37,0xcc,0x44,0x05,0x56,0x2d,0x6c,0x35,
+  0xc3,0x90,0xd1,0xce,0xab,0xc2,0x8d,0x0b,0xeb,0x30,0x29,0x9d,0xde,0x19,0x45,0x71,0x78,0x1e,0xa7,0x98,
+  0x1b,0x87,0x77,0x8d,0x12,0x78,0x4d,0x6f,0xfb,0x9a,0x6b,0x42,0x08,0x62,0xc4,0x3a,0x7b,0xf4,0x94,0xd4,
+  0xa4,0x64,0xb1,0x3d,0xf1,0x00,0xed,0x66,0x6f,0xfa,0xc4,0x92,0xd9,0x47,0x47,0x35,0xfa,0xd0,0x7b,0x86,
+  0x6e,0x1b,0xad,0x16,0xf6,0x06,0x27,0x78,0x95,0xf7,0x3f,0x6c,0x18,0xdc,0x71,0xc7,0xc2,0xe1,0xdd,0xa5,
+  0x37,0xd8,0xc4,0xa2,0xeb,0x1b,0x07,0x02,0xa0,0x43,0xaf,0x1c,0xec,0x7b,0x5b,0xa1,0xbd,0xf3,0xfb,0x01,
+  0xe5,0xa3,0xf5,0x0c,0x56,0x4e,0xa4,0xb6,0x63,0x0d,0xe1,0x3a,0x66,0xe0,0x8f,0x61,0x42,0xde,0x22,0x2b,
+  0x3d,0x0d,0x92,0xe4,0x70,0xff,0x16,0x44,0xb3,0x01,0xcb,0x49,0x3c,0x1e,0x53,0xd8,0x51,0xa7,0xb7,0x8e,
+  0xe8,0x53,0x10,0x7d,0xcd,0x0c,0x2f,0xdb,0xbc,0x3c,0xf7,0x28,0x1e,0xea,0xbf,0x69,0x8e,0x10,0xfa,0xe4,
+  0x11,0x47,0xe2,0x05,0x91,0xea,0x9d,0x57,0x1e,0xd9,0x35,0xf8,0xf6,0x69,0xec,0xa3,0xd3,0xcd,0xf3,0x8f,
+  0x61,0x6d,0x98,0xc7,0x8d,0x5e,0x61,0x37,0x2f,0x9c,0xec,0x3d,0xe1,0xf3,0xb6,0x20,0xfe,0xf8,0xbd,0x1a,
+  0x7c,0xe8,0xbd,0x07,0x6e,0x1d,0x9b,0xde,0x8b,0xf1,0x84,0x36,0x39,0xbc,0xe9,0xf2,0x6d,0xe8,0x76,0x23,
+  0x28,0xca,0xf5,0x09,0xa7,0x06,0x80,0xee,0xc9,0x72,0xa1,0x7e,0xf4,0x59,0x71,0x1e,0xfa,0xdf,0x85,0x21,
+  0x1a,0xc7,0x56,0xbe,0x94,0x1f,0xdc,0xf9,0x8d,0x7c,0x47,0xee,0xb1,0x50,0xff,0xd1,0x7a,0x09,0x9e,0x97,
+  0xb4,0x41,0x9b,0x9f,0x1b,0x21,0x4e,0xdb,0x37,0x86,0x14,0x17,0x83,0xd7,0x89,0xe1,0xf1,0xa0,0x2d,0x37,
+  0xb3,0xce,0xb7,0xb5,0x9c,0xb9,0xbc,0x30,0x72,0xe7,0xa1,0xfb,0x72,0x44,0xa7,0x4c,0xfb,0xc6,0x4f,0x79,
+  0xda,0x65,0x74,0xfa,0x01,0x00,0x4f,0xa9,0xed,0xa2,0x55,0x35,0x41,0xb6,0xe3,0x00,0xd7,0xe0,0x14,0xeb,
+  0x41,0x31,0xde,0xd8,0xda,0xf5,0xaa,0x56,0xc9,0x9c,0x3b,0xe4,0xcb,0x6f,0x61,0x9a,0x65,0x38,0xd7,0xbc,
+  0xf7,0xe2,0x46,0x5f,0x00,0x34,0x4f,0x7c,0xad,0x64,0xfe,0x3d,0xe9,0xc1,0x32,0x63,0x56,0x9d,0x25,0xac,
+  0xe7,0x2c,0x13,0x5f,0x07,0x80,0xc2,0xbe,0xdb,0x07,0x6b,0xbb,0xe5,0xd6,0x6e,0x9c,0xe0,0x01,0x0e,0x52,
+  0xd8,0x83,0x2b,0xee,0x2d,0x3e,0xad,0xf8,0xb0,0x22,0xa0,0xc5,0x29,0x75,0x1b,0xc7,0x1e,0x90,0x21,0x60,
+  0x5b,0xcf,0xe8,0x6c,0x8b,0xcb,0xbc,0x82,0x62,0x0e,0x73,0x30,0xb3,0xce,0x84,0xae,0x84,0x26,0x41,0x09,
+  0x7a,0x73,0x6e,0xf0,0xbc,0x6b,0x7a,0x06,0x8a,0xf7,0x02,0x78,0xfe,0xa6,0x8e,0xdc,0xfb,0xb3,0x94,0x37,
+  0x96,0xcc,0xeb,0x7c,0x69,0xa8,0xd5,0xfc,0x8e,0x8a,0x29,0xc4,0xf0,0x12,0xd0,0x82,0x92,0xa9,0x09,0xd9,
+  0x5e,0x17,0xd4,0x3d,0x02,0xc0,0x4d,0xd3,0xe1,0xbb,0x84,0x2c,0xa7,0xdb,0x6d,0x18,0x29,0x6e,0x2f,0xb4,
+  0xac,0x7e,0xff,0xa9,0x41,0xdd,0x9b,0x36,0xb7,0x74,0x6d,0x8b,0x02,0xbe,0xbe,0x30,0xd0,0x77,0xef,0x4c,
+  0xbf,0x67,0x73,0xeb,0xea,0x57,0xd6,0xd3,0x5d,0x7d,0x50,0x2b,0xb7,0xc6,0x75,0x8d,0x1f,0x4d,0x34,0x66,
+  0x9f,0x9f,0xcf,0xbc,0xea,0x46,0xb7,0x2b,0x0c,0x14,0x77,0x15,0xda,0x73,0x9f,0x69,0x76,0xe1,0x5f,0x1f,
+  0x9e,0x39,0xbf,0x45,0x43,0x3a,0x77,0x44,0xe3,0x9b,0x2d,0xac,0xdf,0x92,0xd2,0x2c,0xb0,0x30,0x8b,0xa2,
+  0x78,0x20,0x05,0x9a,0x01,0xc8,0xf8,0xff,0x20,0xd3,0xff,0x52,0x31,0x6b,0x00,0x56,0x8e,0xa2,0x96,0x06,
+  0xa9,0x7f,0x73,0x40,0x2e,0x6a,0x37,0x2b,0x0c,0x8d,0x12,0xa0,0xec,0x2b,0xd7,0xf7,0xa0,0xf8,0xf1,0xab,
+  0xb0,0x36,0xbc,0x1e,0x67,0xea,0xfa,0x81,0xe2,0x9b,0x7a,0xdb,0xbb,0x1e,0x59,0x27,0xee,0x4f,0x4b,0x49,
+  0xf1,0xae,0x5b,0x60,0xaf,0x98,0xb4,0xf8,0x37,0x6d,0xb0,0x63,0xf1,0x99,0x00,0x6e,0x9a,0x34,0x31,0x50,
+  0x9b,0xc7,0x51,0xd4,0x6e,0xc0,0xe9,0xc8,0x69,0x6f,0x1d,0x6c,0xd9,0x7f,0x4a,0xab,0xcb,0xbe,0x74,0x38,
+  0xae,0xfc,0xf9,0xa6,0x96,0xae,0x4f,0x1b,0xf4,0x47,0x8e,0x1c,0xf0,0x2a,0xf5,0xa4,0xe6,0x00,0xbe,0xa8,
+  0x45,0xc2,0xc7,0x1c,0xd6,0x68,0x77,0x39,0xae,0xbc,0xb0,0x30,0xbc,0x63,0x3c,0xcd,0x1b,0xb1,0xf9,0x2b,
+  0x64,0x8a,0xba,0x11,0x10,0x8d,0xc2,0x37,0x8c,0x22,0x3a,0xb5,0x5e,0x82,0x3f,0x2b,0x9b,0x57,0x9b,0xe2,
+  0x1c,0x9a,0x86,0xa0,0x54,0x88,0x0f,0x14,0xf6,0xdd,0x38,0x8e,0x79,0x34,0x7f,0xf0,0x40,0xf6,0xfb,0x2b,
+  0x59,0xbc,0x5d,0xcd,0x42,0x9c,0x40,0x57,0x20,0xce,0x97,0xbd,0x9f,0x88,0x80,0x70,0x31,0xdd,0xc2,0x2c,
+  0x69,0xbd,0xec,0x08,0x1c,0x02,0x80,0x16,0x9c,0xa9,0x69,0x0a,0x26,0x69,0xda,0xab,0x70,0x7f,0xca,0x45,
+  0x34,0x04,0xb0,0x49,0xb9,0x86,0x49,0xd2,0x71,0x65,0xd5,0x5c,0x1f,0x4f,0x4c,0xad,0x3e,0x60,0x04,0x2f,
+  0xdb,0xd4,0xb2,0xfa,0x07,0x8e,0xee,0x9f,0x9a,0xc4,0xbd,0xce,0x81,0xaf,0xd3,0x94,0x65,0x84,0x00,0x0e,
+  0x6b,0x14,0x1f,0xd6,0xe8,0xdf,0x4a,0x15,0x9f,0x2f,0x1c,0xd9,0x3d,0xb8,0x98,0xde,0xe2,0x93,0xa6,0x4e,
+  0x42,0x1b,0xf6,0xe7,0x9b,0x3a,0x72,0xaf,0x27,0xe4,0x03,0x36,0x85,0xc5,0x96,0xe2,0x93,0x8c,0xc8,0xbd,
+  0x0b,0x41,0x5c,0x1e,0x08,0x81,0xd6,0x90,0x22,0x15,0xf3,0x37,0x2b,0xf0,0x4d,0x3a,0x2c,0x3b,0x91,0x04,
+  0x3a,0x36,0xa3,0x03,0xaa,0xb5,0x6f,0x8b,0xa8,0xfa,0x36,0xa6,0x95,0x33,0x6e,0x3a,0xab,0x67,0x2c,0xee,
+  0x7f,0x55,0xfd,0x40,0x48,0xe9,0x88,0x17,0x4e,0x8d,0x30,0xfd,0x33,0x67,0xcc,0xa7,0xd5,0x37,0x02,0xec,
+  0x07,0x64,0xfd,0xc8,0x6d,0x57,0xbd,0x69,0xe5,0xca,0xff,0xe0,0x44,0xe3,0xe3,0xcd,0xe4,0x02,0x33,0xb4,
+  0x03,0x36,0x2e,0xc4,0x6d,0x5e,0xf0,0xd3,0x2b,0x07,0x77,0xee,0xab,0xb6,0xb0,0xeb,0x46,0x51,0x17,0xc9,
+  0x1c,0x3b,0x69,0x6f,0xab,0xb7,0x9f,0x67,0x02,0x52,0x53,0x9a,0x83,0x6a,0xc3,0x85,0x8a,0xa9,0x52,0xe3,
+  0xbb,0x01,0xd8,0x7c,0xb4,0x0d,0x0f,0x84,0x40,0x27,0x1a,0x81,0x18,0xa0,0xa2,0x0c,0xca,0x89,0x15,0xcc,
+  0xb1,0x50,0x48,0xe3,0xf1,0xcc,0x00,0x2c,0x0c,0xf4,0x1f,0xe9,0xed,0xc8,0xfd,0xd6,0x91,0x1d,0x7e,0x69,
+  0xd4,0x08,0x00,0xac,0x6d,0x01,0xda,0x73,0x52,0x78,0xde,0xbf,0x67,0xcf,0x04,0x80,0xef,0xa5,0x37,0x16,
+  0x4a,0x30,0xb3,0x28,0x32,0x3f,0x91,0x3f,0x0e,0x40,0x54,0x3b,0x13,0x24,0xec,0xa4,0x44,0x6c,0x36,0xa2,
+  0x71,0xdd,0xfe,0xe9,0x45,0x03,0xbf,0x2f,0x81,0x4e,0x7b,0xe7,0xf1,0x21,0x06,0x6b,0x04,0xd5,0x9f,0x48,
+  0xf2,0xec,0x2c,0x6d,0x1d,0x82,0xe3,0x46,0xb9,0x20,0x49,0xb8,0xda,0xf6,0x49,0x1a,0x44,0x59,0x0a,0x91,
+  0x3a,0xc8,0xa6,0x29,0x95,0xe9,0xd3,0x91,0x95,0xa6,0x73,0xdb,0x1b,0xb2,0xcc,0x44,0x4c,0xc2,0xfe,0x91,
+  0x19,0x61,0x5e,0x02,0xcb,0x72,0xaa,0x14,0x56,0x14,0xe2,0xa6,0x98,0x18,0xd1,0xe0,0xa9,0x03,0x4b,0x40,
+  0x76,0xcc,0xa0,0x67,0xd5,0x82,0x37,0x4c,0xa0,0x40,0x12,0x36,0x84,0x43,0x37,0x1f,0x5e,0x08,0x01,0xf9,
+  0x03,0x21,0xd0,0x12,0x99,0xc2,0xcc,0x72,0x42,0xa8,0xc6,0xf8,0xd1,0x89,0x24,0xd0,0x49,0x8b,0x33,0x3d,
+  0x6e,0x8e,0xf0,0x24,0x19,0xa4,0xe1,0x00,0xc9,0x25,0x12,0xa9,0x27,0xa4,0x94,0x98,0x19,0xd5,0x21,0x00,
+  0x0b,0x42,0x77,0x43,0x08,0x77,0xbe,0x26,0x44,0x3a,0xa9,0xa0,0xb8,0x19,0x48,0x79,0xc3,0x49,0x8b,0xb9,
+  0xca,0x3e,0xea,0x96,0x1d,0x38,0x17,0xa3,0xb8,0x63,0xe1,0xf6,0x74,0xd5,0x29,0x95,0x73,0xa6,0x75,0x0b,
+  0x33,0x97,0xb4,0xc3,0xda,0x37,0x59,0x16,0x36,0xcf,0xf3,0x82,0x07,0xae,0x23,0x2b,0xeb,0xb2,0x94,0xc7,
+  0x96,0xed,0xfe,0xa8,0xd2,0x78,0x30,0xab,0x68,0x8d,0x2d,0xa6,0x27,0x8f,0xef,0x5a,0x13,0x73,0xf7,0x59,
+  0x99,0x87,0x04,0x12,0x80,0x65,0xe7,0x02,0x29,0x8d,0xb8,0xae,0x62,0xfe,0xae,0xd8,0xe0,0x6b,0x13,0xfc,
+  0x6d,0x2a,0xe7,0xb4,0xdd,0x77,0xb3,0xd0,0x8b,0xb7,0x23,0x0b,0x31,0x0f,0xa6,0x67,0xe2,0x81,0xf6,0x70,
+  0x4d,0x19,0x5f,0xab,0x4a,0x5b,0x40,0xd0,0xec,0x16,0xd4,0x06,0x7d,0x1e,0x24,0x74,0xba,0x55,0x02,0x06,
+  0xe2,0x04,0x22,0x50,0x17,0x75,0x25,0x4f,0xad,0x10,0xcc,0x2a,0xec,0xb8,0x4d,0x5e,0x6d,0xd6,0x3e,0x2b,
+  0xf3,0x15,0xd4,0x56,0xa5,0xb0,0x29,0xd1,0xf8,0xf7,0xcd,0x2d,0x06,0x80,0x0d,0xc3,0x3b,0xde,0x72,0x7c,
+  0x72,0x54,0x16,0x86,0xd7,0x67,0x4e,0x7b,0x54,0x5b,0xec,0x2b,0x67,0xa4,0x29,0xb0,0x53,0xe0,0x1b,0x31,
+  0x6e,0x7f,0xb0,0xd6,0x14,0x9e,0x10,0xc2,0x3c,0x45,0x63,0xf8,0x68,0x1c,0x66,0xe3,0xc7,0x7b,0xe2,0x14,
+  0x96,0x8f,0xe9,0x1d,0x90,0x0d,0x35,0xc4,0x8d,0x33,0x52,0x0b,0x6f,0x43,0xb7,0x4b,0x98,0x47,0xb1,0x80,
+  0x50,0x7d,0x2e,0xb3,0x0d,0xdd,0x6e,0xdb,0x22,0xd9,0xdd,0xab,0x04,0x92,0x95,0xb8,0xf4,0x50,0x07,0x69,
+  0xd6,0x29,0xa8,0x0d,0x25,0x65,0x27,0xdd,0x95,0xd8,0xfb,0x7d,0x76,0x92,0xf0,0xfc,0xf7,0xdc,0x11,0x60,
+  0x7c,0xe8,0xb6,0xb1,0xa0,0x23,0x77,0x50,0x88,0x53,0x53,0x42,0x10,0x1e,0x97,0xc7,0x9b,0x35,0x1f,0xcb,
+  0x93,0x38,0x6f,0xaa,0x27,0x34,0x9f,0x34,0xdd,0xac,0xbc,0xad,0xe5,0xcc,0xe5,0x2b,0x2c,0xfb,0x1c,0x23,
+  0x9e,0xae,0x40,0x97,0x01,0xcb,0x41,0x94,0xc4,0xb0,0x9b,0xb4,0xef,0xd3,0xdb,0x97,0x2f,0x3f,0xd4,0x7f,
+  0x37,0xd0,0xbf,0x84,0x11,0xa5,0xed,0xa3,0x29,0x67,0x86,0x64,0x5a,0x3b,0x48,0x97,0xe2,0x96,0x12,0x99,
+  0x8f,0x23,0xe2,0x37,0x00,0xb0,0x7d,0x01,0x1a,0xff,0x64,0x09,0xd6,0xfd,0x68,0x62,0xd5,0xb4,0x32,0xbb,
+  0x57,0x8e,0x16,0x57,0x2c,0x5a,0xf0,0xf2,0x80,0x4c,0xcb,0x8c,0x33,0x03,0x3b,0x6d,0x89,0xe9,0x07,0x09,
+  0xc0,0x6b,0xa3,0x47,0x9b,0xf9,0xcc,0x88,0xa6,0xb8,0x02,0xa0,0x1b,0x57,0xac,0x7e,0xe9,0x0a,0xd6,0xed,
+  0x68,0x0e,0xc2,0x4f,0xd7,0x89,0x7b,0xb9,0xc1,0xce,0x03,0x6c,0x39,0x80,0x55,0xa1,0xc8,0x0b,0x56,0x48,
+  0xe6,0xfd,0x70,0x6e,0xd7,0xa6,0x96,0xae,0xde,0xfc,0x51,0x97,0x71,0x29,0x5b,0xed,0x1c,0xc1,0x51,0x27,
+  0xb7,0xda,0xf1,0xd7,0x0c,0x43,0x8e,0xdc,0x57,0x35,0xe3,0x4e,0x0a,0xf4,0xef,0xf5,0x5a,0x27,0x69,0x05,
+  0xe7,0xee,0x44,0xa0,0x17,0x1e,0xf6,0x67,0xb5,0xc7,0x0a,0xf1,0xf0,0x24,0x91,0x3e,0x49,0x0e,0x2a,0xa0,
+  0x2f,0x7e,0xd3,0xca,0x95,0xf5,0x02,0xfb,0x93,0x28,0xa1,0x0a,0x77,0x8b,0x55,0xed,0x04,0x41,0xc3,0xde,
+  0xda,0x31,0x4e,0x17,0xe6,0x22,0xe0,0x37,0xb6,0xae,0xbe,0xb4,0x2d,0xc8,0x5e,0x6b,0x66,0xcb,0x46,0xb4,
+  0xb2,0xb1,0xec,0xcb,0x8f,0x8a,0x19,0x9f,0x16,0x8f,0x9c,0xba,0xb2,0xa1,0x61,0xf4,0xf4,0x72,0x84,0xb3,
+  0x87,0x7c,0xe5,0xd5,0x6a,0xb6,0xab,0x23,0xc8,0xac,0x77,0x2d,0x9d,0xff,0x31,0xd7,0x26,0x99,0xe9,0xaa,
+  0xc2,0x86,0xa6,0x3c,0xdf,0xa6,0x6d,0x64,0x47,0x82,0xe4,0xef,0xd2,0xf4,0x5d,0x2e,0xc4,0x26,0x3f,0x69,
+  0x72,0x3c,0x20,0xba,0xda,0x6e,0x5e,0x82,0xce,0x92,0xc8,0x54,0x43,0xf0,0x51,0x9b,0xda,0x72,0x97,0x5c,
+  0x39,0xd4,0xff,0x31,0xa2,0x2f,0x7e,0xef,0xca,0x95,0xf5,0xe3,0xa5,0xe6,0xf7,0x65,0x45,0x4e,0x59,0x48,
+  0x82,0xd2,0x1c,0xe6,0xc6,0x8e,0xd9,0x34,0x73,0x11,0xf0,0x9b,0x97,0x77,0xfe,0x51,0x3d,0x83,0x7f,0x19,
+  0xd3,0xe8,0x26,0xaf,0xfe,0x85,0xeb,0x0f,0xdd,0x7e,0xd7,0xd1,0x4f,0xed,0x02,0xf6,0x20,0x06,0xf6,0xec,
+  0x06,0xb0,0xfb,0xbd,0x2b,0x57,0x5e,0x3b,0x34,0xb6,0xec,0xdf,0x3a,0x5c,0xf6,0x95,0x9b,0x5b,0xba,0x7e,
+  0x54,0x18,0xd9,0xf1,0x91,0x85,0xf2,0x56,0xf7,0xa0,0xe8,0x0d,0x60,0x2f,0xed,0x3c,0x3f,0xa5,0x75,0x87,
+  0xa9,0x80,0xa2,0x66,0x77,0x01,0x47,0x69,0x10,0x4e,0x6a,0xe8,0xdf,0xeb,0xd5,0x57,0x6d,0x66,0xfd,0x83,
+  0xa4,0x15,0x1c,0x17,0x9b,0x17,0x2d,0x0a,0x63,0xe0,0xf8,0xd1,0x4d,0xed,0x5d,0xbf,0xee,0x6d,0xcf,0x5d,
+  0x37,0x56,0x5a,0xf6,0xeb,0x8c,0xc8,0x6b,0x4a,0xa6,0xb6,0x34,0xd2,0x47,0x4a,0x0c,0x23,0x14,0x3f,0x9d,
+  0xd9,0xd1,0xea,0xae,0x86,0x77,0x37,0xaa,0xd9,0xc4,0xa8,0x55,0x9e,0xbb,0xfe,0xd0,0xed,0x77,0xe5,0x91,
+  0xcb,0x54,0x29,0x75,0xab,0x55,0xda,0x79,0x40,0x5e,0x8d,0xb5,0xe1,0x5b,0xf6,0xec,0x99,0x78,0xfb,0xc8,
+  0x8e,0xbf,0x19,0xd6,0xe8,0x57,0x42,0xf4,0xe6,0xb1,0xaa,0x2e,0x65,0x5e,0xe5,0x42,0x30,0xf1,0x8d,0xa7,
+  0x9f,0xdb,0x06,0xe2,0x61,0x55,0x84,0x63,0x4a,0x6b,0x68,0x63,0xff,0x02,0xfa,0x92,0x9f,0x14,0xe8,0x07,
+  0xe2,0x4a,0xeb,0xec,0xd8,0x39,0x78,0xde,0x2d,0xb1,0xe9,0xf6,0x30,0x91,0x3f,0xbf,0x58,0x0c,0x3f,0x32,
+  0xb3,0x8c,0xb8,0x5c,0x9d,0xc8,0x45,0xa1,0xc8,0x99,0x95,0x84,0x74,0x65,0x29,0x76,0xaa,0x3a,0x90,0x65,
+  0xf5,0xfb,0x63,0xc7,0x9f,0xa6,0x35,0x8d,0x5a,0x2b,0x60,0x45,0x14,0xfd,0xbb,0xda,0x56,0x2f,0x13,0xf2,
+  0x99,0x63,0x16,0x7f,0x72,0xcb,0xc8,0xee,0xdf,0x5e,0x85,0xb5,0x61,0x01,0xfd,0x95,0x2a,0xa5,0x6e,0x35,
+  0xe1,0xbe,0x00,0xe8,0xc7,0x70,0x63,0xf4,0x6a,0xac,0x0d,0x01,0x20,0x56,0x9f,0x6f,0xa4,0x6b,0x0f,0x5a,
+  0x1a,0x1f,0x03,0xc0,0xb6,0xcd,0x23,0x5f,0x55,0x84,0xc3,0xf9,0xec,0xe9,0x49,0xf1,0xaf,0x4d,0xd6,0x14,
+  0x5a,0x42,0x1c,0x03,0x18,0x7f,0x35,0x57,0x44,0xf3,0xa4,0x40,0xe3,0x81,0xc6,0xa3,0xd7,0xb9,0x1e,0x14,
+  0xbd,0x18,0x3f,0x14,0x82,0xb4,0x25,0xa4,0xcf,0x12,0x60,0x64,0xaa,0x25,0xf3,0x7e,0xae,0xda,0xbb,0x85,
+  0x84,0x02,0x32,0x14,0x92,0xfc,0x7c,0x61,0xa0,0xff,0x48,0x9a,0xb0,0x3f,0xbd,0xf5,0x1a,0xca,0x8a,0x87,
+  0x67,0x29,0x2e,0x03,0xf7,0x35,0x03,0xd8,0x32,0x07,0xc5,0x19,0x00,0x5c,0x85,0x1b,0x63,0x00,0x0c,0x3d,
+  0x7f,0x3c,0x61,0x5e,0x61,0xfa,0xc8,0x44,0xab,0xae,0xe3,0xdc,0xf6,0x73,0x77,0xda,0x77,0x45,0x4f,0x0f,
+  0x13,0xee,0x5c,0x3d,0x9a,0xff,0x03,0x57,0x36,0x1f,0xab,0xd3,0x5b,0x6b,0x79,0x3d,0x4e,0x0a,0xf4,0xef,
+  0x5d,0x4b,0xf7,0xf9,0x3c,0x20,0xcd,0x2d,0x95,0x6b,0xc6,0x34,0xee,0xcf,0xd2,0x05,0x29,0x99,0xcc,0x12,
+  0x9a,0xca,0xd2,0x2d,0xf5,0x9d,0x59,0xda,0x5a,0xa3,0xa4,0x7e,0x22,0x14,0xff,0xfe,0x64,0x9f,0x4c,0x8d,
+  0xba,0x55,0x7b,0xcd,0x04,0x60,0x93,0x01,0x06,0xe1,0x10,0x01,0x2b,0xce,0x53,0xf4,0x50,0x0d,0xeb,0xed,
+  0x1b,0x8d,0x8f,0x44,0x86,0x48,0x12,0x14,0x04,0x0b,0x6d,0x24,0x64,0x66,0x6b,0xdc,0x51,0xa2,0xf9,0x24,
+  0xe4,0x4d,0xc2,0x0c,0x7b,0x30,0x90,0x40,0x76,0x85,0x05,0x22,0x44,0x27,0x05,0xfa,0x01,0x70,0x09,0xfb,
+  0x01,0x5e,0xba,0x6b,0x57,0xd9,0x14,0x7f,0xab,0x66,0xb1,0x4b,0x02,0x61,0xfa,0x00,0x0f,0x23,0xae,0x97,
+  0xc0,0xa9,0x59,0xfe,0xf2,0xfd,0xb7,0xdd,0xbd,0x0d,0xdd,0xf7,0xc9,0x8b,0xa8,0x46,0x0d,0xcd,0x74,0x8c,
+  0x00,0x55,0xd1,0x6a,0x00,0xbb,0x27,0xbb,0xd0,0xcc,0xd9,0x8c,0x90,0xad,0xcd,0x99,0xc6,0x90,0x08,0x4d,
+  0x78,0x78,0x91,0x9b,0xed,0xd1,0xd3,0x42,0xf3,0xe6,0x40,0x10,0xdc,0x5d,0x40,0x7f,0x65,0xa1,0x05,0x03,
+  0x27,0x05,0xfa,0x01,0xba,0x8a,0x80,0xdf,0x86,0x6e,0x97,0x1f,0xde,0xf1,0xb3,0x92,0xea,0xdf,0x04,0x14,
+  0x11,0x40,0x96,0xa8,0xa9,0x17,0x8f,0xb1,0xc0,0xa2,0x26,0x09,0xc3,0x51,0x1f,0xfd,0xd7,0x86,0xa1,0x1d,
+  0xef,0x49,0x11,0x08,0x9d,0x29,0x5c,0x0f,0x00,0x15,0xd1,0xbb,0x2b,0xa6,0xde,0xc3,0x3f,0x8b,0x80,0x8d,
+  0xe0,0x4e,0x99,0xcf,0xac,0x02,0x60,0xe2,0xf4,0x09,0xf5,0x0c,0xc4,0x94,0xb7,0x2c,0x2c,0xb2,0x37,0x79,
+  0x42,0x9c,0x5e,0x4d,0x4a,0xaa,0xa2,0x30,0x92,0xf4,0xa5,0xbd,0x6b,0x36,0x68,0xf1,0xa4,0x40,0xff,0x9e,
+  0xaf,0xa4,0x76,0x71,0x5d,0x50,0x18,0xda,0x71,0xed,0x84,0xfa,0xbf,0xa2,0x61,0xac,0x8e,0xce,0x2d,0x86,
+  0x2e,0x76,0x09,0x49,0x48,0x1e,0x00,0x9a,0x24,0x08,0xc7,0x7d,0xf4,0x5f,0x3a,0xc8,0x97,0xe6,0x01,0x49,
+  0x69,0x09,0x6c,0x26,0x38,0xaf,0x1b,0xdd,0xae,0x30,0xbc,0xeb,0x70,0x0c,0xfb,0x4e,0x03,0xe5,0x55,0x57,
+  0xb4,0x9e,0xf3,0x90,0x4b,0x70,0x63,0x54,0x45,0x39,0x50,0x83,0x72,0x58,0x52,0xd1,0x3e,0x59,0x12,0x15,
+  0x82,0x1b,0xc7,0x2c,0x1a,0x6e,0x68,0x1a,0xfd,0x05,0x00,0xf6,0xcc,0x33,0xaf,0xc9,0xa4,0x24,0xf0,0x8c,
+  0xa9,0x49,0x49,0x93,0x5b,0xf1,0x2e,0x9c,0xec,0xf5,0xfd,0xa0,0xb6,0xa7,0xe3,0x3c,0xd6,0x05,0x1b,0x07,
+  0xfb,0x3e,0x7f,0x65,0xc7,0x39,0x3b,0x1b,0x34,0xfc,0x70,0xbd,0x04,0x4f,0x8c,0xa0,0x88,0x2c,0xc9,0x13,
+  0x9f,0xd6,0x13,0x71,0x29,0x97,0x26,0xb6,0x28,0x83,0x7a,0x06,0x2e,0x32,0xad,0x8c,0x7b,0xbf,0xf9,0xca,
+  0xc1,0x1d,0x9b,0x6a,0x93,0x81,0xe6,0x6b,0xee,0x16,0x50,0xf3,0x0e,0xc1,0xcf,0x9b,0x2d,0xfc,0xf2,0xa6,
+  0x96,0xb3,0x5e,0xb8,0x7e,0xa4,0xff,0xb7,0x33,0xdb,0xce,0x7d,0x71,0x1e,0xb9,0x4c,0xa6,0xd5,0x3e,0xdc,
+  0x22,0x99,0xc7,0x0c,0x6a,0xe9,0x0d,0x6f,0xd9,0xb3,0x67,0x62,0x3e,0x1c,0xfa,0x68,0x52,0xd2,0xd9,0x6d,
+  0xb1,0xb7,0x87,0xd4,0x26,0x25,0xa5,0xdd,0xb4,0x40,0xc8,0x9d,0x27,0x05,0xfa,0xff,0x80,0x50,0x6f,0x43,
+  0xb7,0xeb,0x19,0x28,0xde,0x0c,0xe0,0xc2,0xcd,0xed,0x6b,0x5e,0x05,0xda,0x5b,0xea,0xe9,0x3a,0x2d,0xe9,
+  0x2a,0x00,0x85,0x79,0x4e,0xbe,0xf3,0x49,0x8d,0x38,0x85,0x03,0x03,0x47,0xeb,0xb9,0x26,0xfb,0x1f,0x1a,
+  0xe8,0x42,0x52,0x42,0x3a,0x29,0xab,0xf7,0x15,0xd3,0x2f,0x56,0x60,0x5b,0x0b,0x83,0xfd,0x37,0xd5,0x3c,
+  0xcc,0xe6,0x33,0x8f,0xba,0x01,0x77,0xc5,0xd0,0xed,0xbf,0xd8,0xd8,0xb2,0xfa,0xad,0xed,0x2e,0xfb,0xee,
+  0x51,0xb5,0x9b,0x37,0xb7,0x74,0xbe,0x4b,0xc5,0xbe,0xec,0x87,0x4a,0xf7,0x14,0x70,0x4f,0x29,0x8f,0x75,
+  0x01,0x5a,0x7f,0x77,0x5a,0x46,0xc3,0xa7,0x98,0xd8,0x65,0x6d,0x2e,0x73,0xc1,0x01,0x5f,0x2e,0xfa,0xe1,
+  0xdb,0x3e,0x9c,0x07,0xa4,0x67,0x1e,0x72,0x9a,0xc9,0x6a,0xf3,0xa8,0xae,0x0d,0x62,0xcd,0x0a,0x55,0x49,
+  0x33,0x01,0x09,0x32,0x32,0x85,0xa9,0xde,0x55,0xdb,0x3f,0xfd,0xa4,0xc9,0xf1,0xa0,0x36,0x3f,0x12,0x47,
+  0xe7,0xca,0xc1,0xed,0x57,0x47,0x03,0x63,0x8f,0x8e,0x54,0x5f,0x12,0xa9,0x7d,0x8b,0x86,0xf1,0x06,0x06,
+  0xae,0x5e,0x82,0x20,0x4b,0x71,0x01,0x29,0x92,0x30,0x34,0xd7,0x4a,0x37,0x05,0x64,0x48,0x32,0x43,0x91,
+  0x7a,0x06,0x41,0x83,0x04,0x41,0x48,0x52,0xcd,0xee,0x28,0x69,0xfc,0x5e,0x0f,0xae,0x7d,0xfb,0xc0,0xf6,
+  0x9e,0xc2,0x40,0xff,0x4d,0xdb,0xd0,0xed,0x38,0x4b,0x3b,0xe4,0xb9,0x84,0x7a,0xe3,0xc8,0x6d,0xef,0x19,
+  0xd6,0xf2,0xab,0x00,0x58,0x5b,0x90,0x7d,0x67,0x03,0x82,0x9d,0x41,0x6b,0xfd,0xde,0xcd,0xad,0x9d,0x77,
+  0x07,0x2d,0xfb,0xf7,0xd4,0x21,0xf3,0xdb,0x96,0x20,0xf3,0xe9,0x0c,0xe5,0x82,0x21,0x5f,0x7e,0x8f,0x1f,
+  0x3e,0xf5,0x25,0x69,0xda,0xec,0xbc,0xbf,0x6b,0xd2,0x5e,0x0f,0x64,0x18,0x86,0x72,0x1d,0x03,0xa9,0x9e,
+  0x4e,0x01,0x29,0x91,0xe9,0x98,0xfa,0xcc,0x6d,0xc0,0xd1,0xfe,0x89,0x27,0x35,0xf4,0x83,0x3c,0xe8,0x52,
+  0x2d,0x2c,0xed,0x41,0xb1,0x84,0x41,0x7c,0x16,0xc0,0x67,0x37,0xad,0xe8,0x5a,0x55,0x76,0xfe,0x89,0x4a,
+  0x3c,0x11,0xc4,0xf9,0x30,0x3c,0x14,0x44,0x2b,0xcc,0xea,0xc0,0x94,0xaa,0xd6,0x2c,0x36,0xa2,0xe4,0xd5,
+  0x0e,0x11,0xd8,0x07,0xf0,0x76,0x82,0x37,0x42,0xed,0xc7,0xd1,0x30,0x6e,0x2a,0x60,0x47,0x05,0x38,0xda,
+  0x85,0x6a,0x29,0xb5,0x7e,0xd5,0x36,0x16,0x1b,0x86,0x6f,0xfb,0xc4,0xd6,0x65,0x9d,0x5f,0x39,0x84,0xca,
+  0xf3,0x15,0xfc,0x33,0x82,0x5d,0x00,0x96,0x11,0x38,0xa8,0xb0,0x5f,0x1d,0xf2,0xe5,0xef,0x95,0x1c,0xbe,
+  0x54,0x18,0xda,0x79,0x3b,0xb0,0x13,0x85,0x05,0xb2,0x4c,0x55,0x93,0xae,0x0a,0xfb,0x6f,0x39,0xb0,0xb1,
+  0xbd,0xeb,0x95,0xde,0xe4,0x0a,0x85,0x75,0x98,0xd9,0x0a,0x81,0x10,0x66,0x85,0xc2,0xa1,0x9b,0x0f,0x76,
+  0x27,0x95,0xef,0x0b,0x1e,0xff,0x42,0xab,0x85,0x2d,0xdf,0x9c,0x6b,0xcd,0xd6,0xe9,0xea,0x28,0xa6,0x2a,
+  0x6c,0x09,0xcd,0x5c,0x68,0x61,0x60,0x52,0x8e,0xe3,0xed,0x85,0xe1,0x5d,0x87,0x97,0x48,0xaf,0x95,0x8c,
+  0xe5,0xd4,0x0b,0x4e,0xc9,0x9a,0x9e,0x15,0xc5,0x7e,0xc9,0x63,0x71,0x30,0x66,0xc3,0xcc,0xad,0x97,0xed,
+  0xbf,0x65,0xec,0x41,0x20,0xdf,0x29,0x5d,0x58,0x9f,0x4e,0x87,0xd2,0xf2,0xa7,0xaf,0x6d,0x08,0x4a,0xa5,
+  0x36,0x83,0x36,0x8b,0xb3,0x6c,0x04,0x00,0x2a,0xa5,0xc0,0x38,0x1a,0x07,0x36,0x52,0xe5,0xdd,0x9b,0x9a,
+  0x9b,0xbc,0x2e,0x98,0xe9,0x59,0x58,0x52,0x77,0xd9,0xfb,0xda,0xc2,0x33,0xd9,0xe1,0x69,0x5f,0x44,0x5d,
+  0xea,0x3b,0x05,0x80,0xad,0xcb,0x3a,0xdb,0xe2,0xd0,0x9d,0xe2,0x49,0x2b,0x0c,0xfd,0x7a,0xe7,0x52,0x64,
+  0xe4,0xff,0x03,0xdb,0xd0,0x44,0x46,0xca,0x5a,0x1c,0xc2,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,
+  0x42,0x60,0x82,
+};
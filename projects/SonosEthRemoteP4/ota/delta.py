@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+"""
+Delta OTA patches — make them at release time, check them offline.
+
+  ./ota/delta.py make  <base.bin> <new.bin> <out.sdp>
+  ./ota/delta.py apply <base.bin> <patch.sdp> <out.bin>
+  ./ota/delta.py check <base.bin> <patch.sdp> [<new.bin>]
+
+`check` applies the patch exactly as ota_delta.h does on the board and
+verifies the base and result SHA-256 recorded in the header (and, given
+new.bin, that the result is byte-identical). release.sh runs it on every
+patch before uploading.
+
+Patch format (SDP1), bsdiff-style: a new image is mostly the old one with
+small changes and shifted addresses, so each op copies a region of the base
+with byte-wise additions (mostly zero), after a run of fresh literal bytes.
+
+  header   "SDP1" | u32 base_size | u32 new_size        (little-endian)
+           | base sha256 (32) | new sha256 (32)
+  op       varint E | E literal bytes
+           | varint D | if D: varint base_offset, then D bytes of
+             (varint zero_run | varint n | n bytes to add mod 256) pairs
+  …ops until new_size bytes have been produced.
+
+Reads the base at arbitrary offsets (the board reads its running partition),
+writes the new image strictly in order, so it applies in a stream with a few
+hundred bytes of RAM.
+"""
+import hashlib
+import struct
+import sys
+
+MAGIC = b"SDP1"
+HEADER = struct.Struct("<4sII32s32s")
+SEED = 8            # exact bytes needed to start a copy region
+MAX_CANDIDATES = 8  # base offsets remembered per seed
+GIVE_UP = 256       # stop extending after this many bytes with no gain
+
+
+# ── varints ──────────────────────────────────────────────────────────────────
+
+def put_varint(out, v):
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, n):
+        if self.pos + n > len(self.data):
+            raise ValueError("patch truncated at byte %d" % self.pos)
+        chunk = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return chunk
+
+    def varint(self):
+        v = shift = 0
+        while True:
+            b = self.take(1)[0]
+            v |= (b & 0x7F) << shift
+            if b < 0x80:
+                return v
+            shift += 7
+            if shift > 35:
+                raise ValueError("varint too long at byte %d" % self.pos)
+
+
+# ── make ─────────────────────────────────────────────────────────────────────
+
+def index_base(base):
+    idx = {}
+    for i in range(len(base) - SEED + 1):
+        key = base[i:i + SEED]
+        slot = idx.get(key)
+        if slot is None:
+            idx[key] = [i]
+        elif len(slot) < MAX_CANDIDATES:
+            slot.append(i)
+    return idx
+
+
+def exact_len(base, o, new, p, limit=64):
+    n = 0
+    end = min(limit, len(base) - o, len(new) - p)
+    while n < end and base[o + n] == new[p + n]:
+        n += 1
+    return n
+
+
+def extend(base, o, new, p):
+    """Length of the region starting at (o, p) that maximises matches minus
+    mismatches — the bsdiff forward-extension rule."""
+    best_score = score = 0
+    best_len = 0
+    end = min(len(base) - o, len(new) - p)
+    i = 0
+    while i < end:
+        score += 1 if base[o + i] == new[p + i] else -1
+        i += 1
+        if score > best_score:
+            best_score, best_len = score, i
+        elif i - best_len > GIVE_UP:
+            break
+    return best_len
+
+
+def encode_diff(out, base, o, new, p, length):
+    i = 0
+    while i < length:
+        z = i
+        while z < length and base[o + z] == new[p + z]:
+            z += 1
+        put_varint(out, z - i)
+        i = z
+        if i >= length:
+            break
+        j = i
+        # a short run of matches inside changed bytes is cheaper kept inline
+        while j < length and (base[o + j] != new[p + j] or
+                              (j + 1 < length and base[o + j + 1] != new[p + j + 1])):
+            j += 1
+        put_varint(out, j - i)
+        out.extend((new[p + k] - base[o + k]) & 0xFF for k in range(i, j))
+        i = j
+
+
+def make(base, new):
+    idx = index_base(base)
+    out = bytearray(HEADER.pack(MAGIC, len(base), len(new),
+                                hashlib.sha256(base).digest(), hashlib.sha256(new).digest()))
+    disp = 0          # base offset - new offset of the last region
+    lit = 0           # start of pending literal bytes
+    p = 0
+    while p < len(new):
+        cand = None
+        o = p + disp
+        if 0 <= o and exact_len(base, o, new, p, SEED) == SEED:
+            cand = o
+        elif p + SEED <= len(new):
+            best = 0
+            for o in idx.get(bytes(new[p:p + SEED]), ()):
+                n = exact_len(base, o, new, p)
+                if n > best:
+                    best, cand = n, o
+        if cand is None:
+            p += 1
+            continue
+        length = extend(base, cand, new, p)
+        put_varint(out, p - lit)
+        out.extend(new[lit:p])
+        put_varint(out, length)
+        put_varint(out, cand)
+        encode_diff(out, base, cand, new, p, length)
+        disp = cand - p
+        p += length
+        lit = p
+    if lit < len(new):
+        put_varint(out, len(new) - lit)
+        out.extend(new[lit:])
+        put_varint(out, 0)
+    return bytes(out)
+
+
+# ── apply ────────────────────────────────────────────────────────────────────
+
+def apply(base, patch):
+    r = Reader(patch)
+    magic, base_size, new_size, base_sha, new_sha = HEADER.unpack(r.take(HEADER.size))
+    if magic != MAGIC:
+        raise ValueError("not an SDP1 patch")
+    if base_size != len(base) or hashlib.sha256(base).digest() != base_sha:
+        raise ValueError("patch is for a different base image")
+    out = bytearray()
+    while len(out) < new_size:
+        e = r.varint()
+        out.extend(r.take(e))
+        d = r.varint()
+        if d == 0:
+            continue
+        o = r.varint()
+        if o + d > base_size:
+            raise ValueError("copy past end of base at op byte %d" % r.pos)
+        done = 0
+        while done < d:
+            z = r.varint()
+            out.extend(base[o + done:o + done + z])
+            done += z
+            if done >= d:
+                break
+            n = r.varint()
+            add = r.take(n)
+            out.extend((base[o + done + k] + add[k]) & 0xFF for k in range(n))
+            done += n
+        if done != d:
+            raise ValueError("diff run overshoots its region")
+    if len(out) != new_size:
+        raise ValueError("patch produced %d bytes, header says %d" % (len(out), new_size))
+    if r.pos != len(patch):
+        raise ValueError("%d trailing bytes after the last op" % (len(patch) - r.pos))
+    if hashlib.sha256(out).digest() != new_sha:
+        raise ValueError("result SHA-256 doesn't match the header")
+    return bytes(out)
+
+
+def main(argv):
+    if len(argv) < 4 or argv[1] not in ("make", "apply", "check"):
+        print(__doc__.strip().split("\n\n")[1], file=sys.stderr)
+        return 2
+    cmd = argv[1]
+    base = open(argv[2], "rb").read()
+    if cmd == "make":
+        new = open(argv[3], "rb").read()
+        patch = make(base, new)
+        apply(base, patch)   # never publish a patch that doesn't round-trip
+        open(argv[4], "wb").write(patch)
+        print("%s: %d B → %d B patch (%.1fx smaller than the image)"
+              % (argv[4], len(new), len(patch), len(new) / max(1, len(patch))))
+        return 0
+    patch = open(argv[3], "rb").read()
+    try:
+        out = apply(base, patch)
+    except ValueError as e:
+        print("%s: %s" % (argv[3], e), file=sys.stderr)
+        return 1
+    if cmd == "apply":
+        open(argv[4], "wb").write(out)
+    elif len(argv) > 4 and open(argv[4], "rb").read() != out:
+        print("%s: result differs from %s" % (argv[3], argv[4]), file=sys.stderr)
+        return 1
+    print("%s: ok, %d B → %d B image sha256=%s"
+          % (argv[3], len(patch), len(out), hashlib.sha256(out).hexdigest()))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+Compressed OTA images — pack them at release time, check them offline.
+
+  ./ota/lzss.py pack   <image.bin> <out.otz>
+  ./ota/lzss.py unpack <image.otz> <out.bin>
+  ./ota/lzss.py check  <image.otz> [<image.bin>]
+
+The board inflates the image as it downloads (ota_lzss.h), so the format is
+picked for the decoder's RAM, not for ratio: LZSS with a 4 KB window and no
+entropy coding. That's about 2x on a firmware image against deflate's ~2.3x,
+for a 4 KB window buffer and a few bytes of state instead of inflate's 32 KB
+dictionary plus tables.
+
+Format (OTZ1):
+
+  header   "OTZ1" | u8 window_bits | u8 lookahead_bits | u16 0
+           | u32 raw_size                                (little-endian)
+  body     heatshrink's bitstream, MSB first:
+             1 + 8 bits                       literal byte
+             0 + window_bits + lookahead_bits  back-reference: distance-1,
+                                              length-1
+           zero-padded to a whole byte at the end.
+
+So `heatshrink -e -w 12 -l 4` output with this header in front is a valid
+OTZ1 file, and the other way round. No hashes here: the manifest carries the
+SHA-256 of both the .otz and the image it inflates to, and the board checks
+both.
+"""
+import struct
+import sys
+
+MAGIC = b"OTZ1"
+HEADER = struct.Struct("<4sBBHI")
+WINDOW_BITS = 12     # ota_lzss.h LZS_MAX_WINDOW_BITS caps what the board accepts
+LOOKAHEAD_BITS = 4
+CHAIN_DEPTH = 32     # candidates tried per position
+
+
+# ── pack ─────────────────────────────────────────────────────────────────────
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, bits):
+        self.acc = (self.acc << bits) | value
+        self.n += bits
+        while self.n >= 8:
+            self.n -= 8
+            self.out.append((self.acc >> self.n) & 0xFF)
+        self.acc &= (1 << self.n) - 1
+
+    def flush(self):
+        if self.n:
+            self.out.append((self.acc << (8 - self.n)) & 0xFF)
+            self.acc = self.n = 0
+        return self.out
+
+
+def pack(data, w=WINDOW_BITS, l=LOOKAHEAD_BITS):
+    window = 1 << w
+    max_len = 1 << l
+    # a back-reference has to cost less than the literals it replaces
+    min_len = (1 + w + l) // 9 + 1
+    head = {}
+    prev = [-1] * len(data)
+    bw = BitWriter()
+
+    def remember(j):
+        if j + 3 <= len(data):
+            key = data[j:j + 3]
+            prev[j] = head.get(key, -1)
+            head[key] = j
+
+    i = 0
+    while i < len(data):
+        best = dist = 0
+        limit = min(max_len, len(data) - i)
+        if limit >= min_len and i + 3 <= len(data):
+            c = head.get(data[i:i + 3], -1)
+            depth = CHAIN_DEPTH
+            while c >= 0 and i - c <= window and depth:
+                if data[c + best] == data[i + best] if best < limit else False:
+                    n = 0
+                    while n < limit and data[c + n] == data[i + n]:
+                        n += 1
+                    if n > best:
+                        best, dist = n, i - c
+                        if n == limit:
+                            break
+                c = prev[c]
+                depth -= 1
+        if best >= min_len:
+            bw.put(0, 1)
+            bw.put(dist - 1, w)
+            bw.put(best - 1, l)
+            for j in range(i, i + best):
+                remember(j)
+            i += best
+        else:
+            bw.put(1, 1)
+            bw.put(data[i], 8)
+            remember(i)
+            i += 1
+    return HEADER.pack(MAGIC, w, l, 0, len(data)) + bytes(bw.flush())
+
+
+# ── unpack ───────────────────────────────────────────────────────────────────
+
+def unpack(blob):
+    """Decode exactly as ota_lzss.h does, with the same refusals."""
+    if len(blob) < HEADER.size:
+        raise ValueError("header truncated")
+    magic, w, l, _, raw_size = HEADER.unpack_from(blob)
+    if magic != MAGIC:
+        raise ValueError("not an OTZ1 image")
+    if not (4 <= w <= 15 and 3 <= l < w):
+        raise ValueError("bad window/lookahead bits %d/%d" % (w, l))
+    body = blob[HEADER.size:]
+    pos = 0
+    acc = nbits = 0
+
+    def bits(n):
+        nonlocal pos, acc, nbits
+        while nbits < n:
+            if pos >= len(body):
+                raise ValueError("truncated at output byte %d" % len(out))
+            acc = (acc << 8) | body[pos]
+            pos += 1
+            nbits += 8
+        nbits -= n
+        v = (acc >> nbits) & ((1 << n) - 1)
+        acc &= (1 << nbits) - 1
+        return v
+
+    out = bytearray()
+    while len(out) < raw_size:
+        if bits(1):
+            out.append(bits(8))
+            continue
+        dist = bits(w) + 1
+        length = bits(l) + 1
+        if dist > len(out) or length > raw_size - len(out):
+            raise ValueError("bad back-reference at output byte %d" % len(out))
+        for _ in range(length):
+            out.append(out[-dist])
+    if pos != len(body):
+        raise ValueError("%d trailing bytes" % (len(body) - pos))
+    return bytes(out)
+
+
+def main(argv):
+    if len(argv) < 3 or argv[1] not in ("pack", "unpack", "check") or \
+            (argv[1] != "check" and len(argv) < 4):
+        print(__doc__.strip().split("\n\n")[1], file=sys.stderr)
+        return 2
+    cmd = argv[1]
+    src = open(argv[2], "rb").read()
+    if cmd == "pack":
+        z = pack(src)
+        if unpack(z) != src:   # never publish an image that doesn't round-trip
+            print("%s: round trip failed" % argv[2], file=sys.stderr)
+            return 1
+        open(argv[3], "wb").write(z)
+        print("%s: %d B → %d B (%.2fx)" % (argv[3], len(src), len(z), len(src) / max(1, len(z))))
+        return 0
+    try:
+        raw = unpack(src)
+    except ValueError as e:
+        print("%s: %s" % (argv[2], e), file=sys.stderr)
+        return 1
+    if cmd == "unpack":
+        open(argv[3], "wb").write(raw)
+    elif len(argv) > 3 and open(argv[3], "rb").read() != raw:
+        print("%s: inflates to something other than %s" % (argv[2], argv[3]), file=sys.stderr)
+        return 1
+    print("%s: ok, %d B → %d B" % (argv[2], len(src), len(raw)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
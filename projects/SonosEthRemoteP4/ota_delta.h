@@ -0,0 +1,113 @@
+#pragma once
+// =============================================================================
+// Delta OTA — apply an SDP1 patch from ota/delta.py.
+//
+// A release usually changes a few functions and shifts the addresses around
+// them, so instead of the full ~1.1 MB image the board can download a patch
+// against the image it's running: runs of fresh bytes, plus regions copied
+// from the running partition with small byte-wise additions. ota/delta.py
+// documents the format; this is the same decoder, streaming:
+//
+//   patch  read front to back, a byte at a time through the caller's buffer
+//   base   read at the offsets the patch asks for (running partition)
+//   out    written strictly in order (the next OTA slot)
+//
+// Two 512 B stack buffers, nothing else. Every length is bounds-checked
+// against the header before use, so a corrupt patch fails cleanly instead of
+// reading outside the base or writing past the new size. The caller checks
+// the result's SHA-256 against the manifest before selecting the slot.
+//
+// Templated on the three ends so bench/delta_apply.cpp can run the exact
+// same code on the host against ota/delta.py output.
+// =============================================================================
+#include <Arduino.h>
+
+static constexpr size_t SDP_HEADER_LEN = 4 + 4 + 4 + 32 + 32;
+static constexpr size_t SDP_CHUNK      = 512;
+
+struct SdpHeader {
+  uint32_t baseSize;
+  uint32_t newSize;
+  uint8_t  baseSha[32];
+  uint8_t  newSha[32];
+};
+
+// Src needs: bool read(uint8_t* dst, size_t n) — exactly n bytes or false.
+template <typename Src>
+static bool sdpReadHeader(Src& in, SdpHeader& h, const char*& err) {
+  uint8_t raw[SDP_HEADER_LEN];
+  if (!in.read(raw, sizeof(raw))) { err = "patch header truncated"; return false; }
+  if (memcmp(raw, "SDP1", 4) != 0) { err = "not an SDP1 patch"; return false; }
+  h.baseSize = raw[4] | raw[5] << 8 | raw[6] << 16 | (uint32_t)raw[7] << 24;
+  h.newSize  = raw[8] | raw[9] << 8 | raw[10] << 16 | (uint32_t)raw[11] << 24;
+  memcpy(h.baseSha, raw + 12, 32);
+  memcpy(h.newSha, raw + 44, 32);
+  return true;
+}
+
+template <typename Src>
+static bool sdpVarint(Src& in, uint32_t& v) {
+  v = 0;
+  for (int shift = 0; shift <= 28; shift += 7) {
+    uint8_t b;
+    if (!in.read(&b, 1)) return false;
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if (b < 0x80) return true;
+  }
+  return false;   // more than 5 bytes — corrupt
+}
+
+// Base needs: bool readBase(uint32_t offset, uint8_t* dst, size_t n).
+// Out needs:  bool write(const uint8_t* src, size_t n).
+template <typename Src, typename Base, typename Out>
+static bool sdpApply(Src& in, Base& base, Out& out, const SdpHeader& h, const char*& err) {
+  uint8_t buf[SDP_CHUNK], add[SDP_CHUNK];
+  uint32_t produced = 0;
+  err = nullptr;
+
+  while (produced < h.newSize) {
+    uint32_t e, d;
+    if (!sdpVarint(in, e)) { err = "patch truncated (literal)"; return false; }
+    if (e > h.newSize - produced) { err = "literal runs past the new image"; return false; }
+    for (uint32_t left = e; left; ) {
+      size_t k = left < SDP_CHUNK ? left : SDP_CHUNK;
+      if (!in.read(buf, k)) { err = "patch truncated (literal)"; return false; }
+      if (!out.write(buf, k)) { err = "write failed"; return false; }
+      left -= k;
+    }
+    produced += e;
+
+    if (!sdpVarint(in, d)) { err = "patch truncated (copy)"; return false; }
+    if (d == 0) continue;
+    uint32_t o;
+    if (!sdpVarint(in, o)) { err = "patch truncated (copy)"; return false; }
+    if (d > h.newSize - produced || o > h.baseSize || d > h.baseSize - o) {
+      err = "copy region out of bounds";
+      return false;
+    }
+
+    uint32_t done = 0;
+    while (done < d) {
+      uint32_t z, n;
+      if (!sdpVarint(in, z) || z > d - done) { err = "bad zero run"; return false; }
+      for (uint32_t left = z; left; ) {
+        size_t k = left < SDP_CHUNK ? left : SDP_CHUNK;
+        if (!base.readBase(o + done, buf, k)) { err = "base read failed"; return false; }
+        if (!out.write(buf, k)) { err = "write failed"; return false; }
+        done += k; left -= k;
+      }
+      if (done >= d) break;
+      if (!sdpVarint(in, n) || n > d - done) { err = "bad diff run"; return false; }
+      for (uint32_t left = n; left; ) {
+        size_t k = left < SDP_CHUNK ? left : SDP_CHUNK;
+        if (!in.read(add, k)) { err = "patch truncated (diff)"; return false; }
+        if (!base.readBase(o + done, buf, k)) { err = "base read failed"; return false; }
+        for (size_t i = 0; i < k; i++) buf[i] += add[i];
+        if (!out.write(buf, k)) { err = "write failed"; return false; }
+        done += k; left -= k;
+      }
+    }
+    produced += d;
+  }
+  return true;
+}
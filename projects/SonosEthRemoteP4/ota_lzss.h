@@ -0,0 +1,120 @@
+#pragma once
+// =============================================================================
+// Compressed OTA — inflate an OTZ1 image from ota/lzss.py as it downloads.
+//
+// The image is about half code and half strings, tables and the (already
+// gzipped) dashboard, and it goes out over TLS byte for byte. Packed with
+// LZSS it's roughly half the size, so half the download and half the TLS
+// decrypt work; inflating costs far less than the decrypt it saves.
+//
+// ota/lzss.py documents the format (heatshrink's bitstream behind a 12-byte
+// header). RAM is the window — 1 << window_bits bytes, 4 KB for what
+// release.sh publishes, heap-allocated so it stays off the loop stack — plus
+// a 256 B input buffer. Every back-reference is checked against what's been
+// produced so far and the declared size, so a corrupt stream fails cleanly.
+// The caller hashes the compressed bytes on the way in and the image on the
+// way out; both are in the manifest.
+//
+// Templated on the source so bench/lzss_unpack.cpp can run the exact same
+// decoder on the host against ota/lzss.py output.
+// =============================================================================
+#include <Arduino.h>
+
+static constexpr size_t  LZS_HEADER_LEN       = 12;
+static constexpr uint8_t LZS_MAX_WINDOW_BITS  = 12;   // 4 KB — what ota/lzss.py uses
+static constexpr size_t  LZS_IN_BUF           = 256;
+
+// Src needs:
+//   bool   read(uint8_t* dst, size_t n)      — exactly n bytes or false
+//   size_t readSome(uint8_t* dst, size_t n)  — 1..n bytes, 0 at end / error
+template <typename Src>
+struct LzsReader {
+  Src&     in;
+  uint8_t  windowBits = 0, lookaheadBits = 0;
+  uint32_t rawSize = 0, produced = 0;
+  const char* err = nullptr;
+
+  explicit LzsReader(Src& s) : in(s) {}
+  ~LzsReader() { free(window); }
+
+  // Header + window allocation. False with `err` set if the stream isn't
+  // one we can inflate.
+  bool begin() {
+    uint8_t raw[LZS_HEADER_LEN];
+    if (!in.read(raw, sizeof(raw)))  { err = "header truncated"; return false; }
+    if (memcmp(raw, "OTZ1", 4) != 0) { err = "not an OTZ1 image"; return false; }
+    windowBits    = raw[4];
+    lookaheadBits = raw[5];
+    rawSize = raw[8] | raw[9] << 8 | raw[10] << 16 | (uint32_t)raw[11] << 24;
+    if (windowBits < 4 || windowBits > LZS_MAX_WINDOW_BITS ||
+        lookaheadBits < 3 || lookaheadBits >= windowBits) {
+      err = "unsupported window";
+      return false;
+    }
+    mask = (1u << windowBits) - 1;
+    window = (uint8_t*)malloc(mask + 1);
+    if (!window) { err = "no RAM for window"; return false; }
+    return true;
+  }
+
+  // Exactly n more bytes of the image, or false with `err` set.
+  bool read(uint8_t* dst, size_t n) {
+    while (n) {
+      if (copyLeft) {
+        uint8_t b = window[(produced - copyDist) & mask];
+        emit(b, dst); n--; copyLeft--;
+        continue;
+      }
+      if (produced >= rawSize) { err = "read past the image"; return false; }
+      uint32_t tag, v, len;
+      if (!bits(1, tag)) return false;
+      if (tag) {
+        if (!bits(8, v)) return false;
+        emit((uint8_t)v, dst); n--;
+        continue;
+      }
+      if (!bits(windowBits, v) || !bits(lookaheadBits, len)) return false;
+      copyDist = v + 1;
+      copyLeft = len + 1;
+      if (copyDist > produced || copyLeft > rawSize - produced) {
+        err = "bad back-reference";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whole image out and every input byte consumed — nothing trailing.
+  bool done() const { return produced == rawSize && copyLeft == 0 && inPos == inLen; }
+
+ private:
+  uint8_t* window = nullptr;
+  uint32_t mask = 0;
+  uint32_t copyDist = 0, copyLeft = 0;
+  uint8_t  inBuf[LZS_IN_BUF];
+  size_t   inPos = 0, inLen = 0;
+  uint32_t acc = 0;
+  uint8_t  accBits = 0;
+
+  void emit(uint8_t b, uint8_t*& dst) {
+    window[produced & mask] = b;
+    *dst++ = b;
+    produced++;
+  }
+
+  bool bits(uint8_t n, uint32_t& v) {
+    while (accBits < n) {
+      if (inPos == inLen) {
+        inLen = in.readSome(inBuf, sizeof(inBuf));
+        inPos = 0;
+        if (inLen == 0) { err = "stream truncated"; return false; }
+      }
+      acc = acc << 8 | inBuf[inPos++];
+      accBits += 8;
+    }
+    accBits -= n;
+    v = (acc >> accBits) & ((1u << n) - 1);
+    acc &= (1u << accBits) - 1;
+    return true;
+  }
+};
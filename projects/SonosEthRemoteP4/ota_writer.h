@@ -0,0 +1,323 @@
+#pragma once
+// =============================================================================
+// OTA image writer — the next OTA slot, written and hashed in a pipeline.
+//
+// Every update path in updater.h (full image, delta, compressed, LAN peer)
+// ends here: bytes in, one flash task erasing, programming and hashing
+// sectors behind the caller, the slot made bootable only once the SHA-256
+// of everything in it matches. Also the helpers that read the slot back —
+// partition hashing and the NVS resume point — since a resumed download
+// starts by hashing what an earlier attempt left there.
+//
+// Its own header so bench/ota_pipeline.cpp can build it on the host, with
+// FreeRTOS queues and tasks backed by threads, and exercise the overlap,
+// abort and flash-error paths (under ThreadSanitizer too).
+// =============================================================================
+#include <Arduino.h>
+#include <Preferences.h>
+#include <atomic>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include "mbedtls/sha256.h"
+
+void logEvent(const char* fmt, ...);  // defined in webui.h
+
+// ── Hex helpers ───────────────────────────────────────────────────────────
+inline void bytesToHex(const uint8_t* in, size_t n, char* out) {
+  static const char* H = "0123456789abcdef";
+  for (size_t i = 0; i < n; i++) {
+    out[i*2]   = H[(in[i] >> 4) & 0xF];
+    out[i*2+1] = H[ in[i]       & 0xF];
+  }
+  out[n*2] = 0;
+}
+
+// ── Partition hashing ─────────────────────────────────────────────────────
+// Feed the first `len` bytes of `part` into `sha`. False on a flash read
+// error.
+static bool hashPartition(const esp_partition_t* part, size_t len,
+                          mbedtls_sha256_context* sha) {
+  uint8_t buf[1024];
+  for (size_t off = 0; off < len; off += sizeof(buf)) {
+    size_t k = min(sizeof(buf), len - off);
+    if (esp_partition_read(part, off, buf, k) != ESP_OK) return false;
+    mbedtls_sha256_update(sha, buf, k);
+  }
+  return true;
+}
+
+// ── Resume point (NVS namespace "ota") ────────────────────────────────────
+// How far an interrupted full-image download got: the target image's sha256,
+// the slot it was going into, and how many bytes of it are in flash. Saved
+// every OTA_CHECKPOINT bytes, rounded down to a sector so the resumed write
+// starts on a fresh erase. The next check (5 min later, or after a reboot)
+// picks it up with a Range request instead of starting at byte 0.
+static constexpr size_t OTA_SECTOR     = 4096;
+static constexpr size_t OTA_CHECKPOINT = 64 * 1024;
+
+// Bytes of `imageSha` already in the next OTA slot, or 0.
+static size_t otaResumeOffset(const String& imageSha, size_t imageSize) {
+  const esp_partition_t* part = esp_ota_get_next_update_partition(nullptr);
+  Preferences p;
+  p.begin("ota", true);
+  String sha   = p.getString("sha", "");
+  uint32_t off = p.getUInt("off", 0);
+  uint32_t at  = p.getUInt("part", 0);
+  p.end();
+  if (!part || at != part->address || !sha.equalsIgnoreCase(imageSha)) return 0;
+  if (off % OTA_SECTOR || (imageSize && off >= imageSize)) return 0;
+  return off;
+}
+
+static void otaResumeSave(const String& imageSha, const esp_partition_t* part, size_t off) {
+  Preferences p;
+  p.begin("ota", false);
+  p.putString("sha", imageSha);
+  p.putUInt("part", part->address);
+  p.putUInt("off", off);
+  p.end();
+}
+
+static void otaResumeClear() {
+  Preferences p;
+  p.begin("ota", false);
+  p.clear();
+  p.end();
+}
+
+// ── Image writer: next OTA slot + SHA-256 of exactly what was written ─────
+// Shared by every path. Writes the partition directly rather than through
+// Update, because Update can only start at byte 0. The slot only becomes
+// bootable in finish(), once the hash matches (and esp_ota_set_boot_partition
+// validates the image header and checksum on top). On failure, leaves
+// err set.
+//
+// Pipelined: write() only copies into one of OTA_PIPE_BUFS sector-sized
+// buffers. Each full buffer goes to a flash task that erases its sector,
+// programs it and hashes it, while the caller — the loop task — goes back
+// to reading the network (and decrypting, inflating or patching). So an
+// update takes about max(network, flash) instead of their sum, and every
+// program is one aligned sector after one erase. finish() logs where the
+// time went.
+static constexpr int      OTA_PIPE_BUFS        = 3;
+static constexpr uint32_t OTA_FLASH_TASK_STACK = 4096;
+
+struct OtaImageWriter {
+  struct Buf { uint8_t* data; size_t off, len; };
+
+  const esp_partition_t* part = nullptr;
+  mbedtls_sha256_context sha;
+  size_t total = 0, written = 0;        // written = accepted from the caller
+  std::atomic<size_t> flushed{0};       // erased + programmed + hashed
+  unsigned long lastReport = 0;
+  String err;
+
+  ~OtaImageWriter() { stop(); }
+
+  // resumeAt (sector-aligned) = bytes already in the slot from an earlier
+  // attempt. They're read back and hashed, so finish() still checks the
+  // whole image, not just the part that came over this connection.
+  bool begin(size_t len, size_t resumeAt = 0) {
+    part = esp_ota_get_next_update_partition(nullptr);
+    if (!part) {
+      err = "no OTA partition";
+      return false;
+    }
+    if (len > part->size || resumeAt > len || resumeAt % OTA_SECTOR) {
+      err = String("image of ") + len + " bytes doesn't fit the OTA partition";
+      return false;
+    }
+    if (resumeAt == 0) otaResumeClear();  // whatever was in the slot is going
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);  // 0 = SHA-256 (not SHA-224)
+    shaLive = true;
+    if (!hashPartition(part, resumeAt, &sha)) {
+      err = "can't read back the partial image";
+      stop();
+      return false;
+    }
+    total = len;
+    written = resumeAt;
+    flushed = resumeAt;
+    startedAt = resumeAt;
+
+    freeQ = xQueueCreate(OTA_PIPE_BUFS + 1, sizeof(Buf*));   // +1 for the stop marker
+    fullQ = xQueueCreate(OTA_PIPE_BUFS + 1, sizeof(Buf*));
+    for (int i = 0; i < OTA_PIPE_BUFS; i++) {
+      pool[i].data = (uint8_t*)malloc(OTA_SECTOR);
+      if (!pool[i].data) break;
+      Buf* b = &pool[i];
+      if (freeQ) xQueueSend(freeQ, &b, 0);
+    }
+    if (!freeQ || !fullQ || !pool[OTA_PIPE_BUFS - 1].data ||
+        xTaskCreate(flashTask, "ota-flash", OTA_FLASH_TASK_STACK, this,
+                    tskIDLE_PRIORITY + 2, &task) != pdPASS) {
+      err = "no RAM for the OTA pipeline";
+      task = nullptr;
+      stop();
+      return false;
+    }
+    t0 = lastReport = millis();
+    return true;
+  }
+
+  bool write(const uint8_t* buf, size_t n) {
+    if (n > total - written) {
+      err = "image longer than announced";
+      return false;
+    }
+    while (n) {
+      if (failed) {
+        err = flashErr;
+        return false;
+      }
+      if (!cur) {
+        unsigned long w = millis();
+        xQueueReceive(freeQ, &cur, portMAX_DELAY);
+        waitedMs += millis() - w;
+        cur->off = written;
+        cur->len = 0;
+      }
+      size_t k = min(n, OTA_SECTOR - cur->len);
+      memcpy(cur->data + cur->len, buf, k);
+      cur->len += k;
+      written += k;
+      buf += k;
+      n -= k;
+      if (cur->len == OTA_SECTOR || written == total) {
+        xQueueSend(fullQ, &cur, portMAX_DELAY);
+        cur = nullptr;
+      }
+    }
+    if (millis() - lastReport > 1000) {
+      lastReport = millis();
+      size_t f = flushed;
+      logEvent("ota %u / %u bytes (%u%%)",
+        (unsigned)f, (unsigned)total, (unsigned)(f * 100 / total));
+    }
+    return true;
+  }
+
+  // Nothing to undo in flash — the slot just never gets selected.
+  void abort() {
+    stop();
+  }
+
+  // Drain the pipeline, check the image hash, then make the slot the boot
+  // partition.
+  bool finish(const String& expectedSha) {
+    drain();
+    if (failed) {
+      err = flashErr;
+      stop();
+      return false;
+    }
+    logThroughput();
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&sha, digest);
+    stop();
+
+    char gotHex[65];
+    bytesToHex(digest, 32, gotHex);
+    String got = String(gotHex);
+    String want = expectedSha;
+    want.toLowerCase();
+    got.toLowerCase();
+
+    if (written != total || flushed != total || got != want) {
+      err = String("sha256 mismatch — expected ") + want + " got " + got;
+      return false;
+    }
+    esp_err_t e = esp_ota_set_boot_partition(part);
+    if (e != ESP_OK) {
+      err = String("set boot partition failed: ") + esp_err_to_name(e);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  Buf  pool[OTA_PIPE_BUFS] = {};
+  Buf* cur = nullptr;
+  QueueHandle_t freeQ = nullptr, fullQ = nullptr;
+  TaskHandle_t  task = nullptr;
+  bool shaLive = false;
+  std::atomic<bool> failed{false};
+  String flashErr;                       // set by the flash task before `failed`
+  size_t startedAt = 0;
+  unsigned long t0 = 0, waitedMs = 0;    // loop side: blocked on a free buffer
+  uint32_t eraseUs = 0, programUs = 0, hashUs = 0;   // flash task side
+
+  // Erase, program, hash — one sector-aligned buffer at a time, in order.
+  // A null buffer means stop: it's passed back through freeQ so drain()
+  // knows everything before it is done.
+  static void flashTask(void* arg) {
+    OtaImageWriter* w = (OtaImageWriter*)arg;
+    for (;;) {
+      Buf* b = nullptr;
+      xQueueReceive(w->fullQ, &b, portMAX_DELAY);
+      if (b && !w->failed) w->program(*b);
+      xQueueSend(w->freeQ, &b, portMAX_DELAY);
+      if (!b) break;
+    }
+    vTaskDelete(nullptr);
+  }
+
+  void program(const Buf& b) {
+    uint32_t t = micros();
+    esp_err_t e = esp_partition_erase_range(part, b.off, OTA_SECTOR);
+    eraseUs += micros() - t;
+    if (e == ESP_OK) {
+      t = micros();
+      e = esp_partition_write(part, b.off, b.data, b.len);
+      programUs += micros() - t;
+    }
+    if (e != ESP_OK) {
+      flashErr = String("flash write at ") + b.off + " failed: " + esp_err_to_name(e);
+      failed = true;
+      return;
+    }
+    t = micros();
+    mbedtls_sha256_update(&sha, b.data, b.len);
+    hashUs += micros() - t;
+    flushed += b.len;
+  }
+
+  // Send the stop marker and wait for it to come back; the task is gone
+  // after that.
+  void drain() {
+    if (!task) return;
+    if (cur) {                      // a partial buffer the caller never filled
+      xQueueSend(fullQ, &cur, portMAX_DELAY);
+      cur = nullptr;
+    }
+    unsigned long w = millis();
+    Buf* stopMark = nullptr;
+    xQueueSend(fullQ, &stopMark, portMAX_DELAY);
+    for (Buf* b = (Buf*)1; b; ) xQueueReceive(freeQ, &b, portMAX_DELAY);
+    waitedMs += millis() - w;
+    task = nullptr;
+  }
+
+  void stop() {
+    drain();
+    for (auto& b : pool) { free(b.data); b.data = nullptr; }
+    if (freeQ) { vQueueDelete(freeQ); freeQ = nullptr; }
+    if (fullQ) { vQueueDelete(fullQ); fullQ = nullptr; }
+    if (shaLive) { mbedtls_sha256_free(&sha); shaLive = false; }
+  }
+
+  // Wall time against what the network and flash sides each took. With the
+  // two overlapped, wall ≈ the larger; strictly in turn it'd be the sum.
+  void logThroughput() {
+    unsigned long wall = millis() - t0;
+    uint32_t flashMs = (eraseUs + programUs + hashUs) / 1000;
+    unsigned long netMs = wall > waitedMs ? wall - waitedMs : 0;
+    size_t bytes = total - startedAt;
+    logEvent("ota: %u KB in %lu ms (%lu KB/s) — network+decode %lu ms, flash %u ms "
+             "(erase %u, program %u, sha %u), in turn would be %lu ms",
+      (unsigned)(bytes / 1024), wall, wall ? (unsigned long)((uint64_t)bytes * 1000 / 1024 / wall) : 0UL,
+      netMs, (unsigned)flashMs, (unsigned)(eraseUs / 1000), (unsigned)(programUs / 1000),
+      (unsigned)(hashUs / 1000), netMs + flashMs);
+  }
+};
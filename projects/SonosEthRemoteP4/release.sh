@@ -7,10 +7,12 @@
 #   1. Sanity-check version + working tree clean (no uncommitted changes)
 #   2. Bump FW_VERSION in config.h to <version>
 #   3. arduino-cli compile fresh binary
-#   4. Compute SHA-256 of the binary
-#   5. Create GitHub Release tagged sonos-eth-p4-v<version>, attach the .bin
-#   6. Rewrite manifest.json to point at the new release asset
-#   7. Commit version bump + manifest, tag, push
+#   4. Compute SHA-256 of the binary, pack it (ota/lzss.py) and hash that too
+#   5. Build delta patches from the previous DELTA_BASES (default 3) releases
+#   6. Create GitHub Release tagged sonos-eth-p4-v<version>, attach the .bin
+#      the packed .otz and the patches
+#   7. Rewrite manifest.json to point at the new release asset + patches
+#   8. Commit version bump + manifest, tag, push
 #
 # Boards on the network will pick up the new version within ~6h (or now if you
 # hit "check now" in their web UI / curl /api/checkupdate).
@@ -22,6 +24,7 @@ FQBN=esp32:esp32:esp32p4
 REPO_OWNER=davidvivesprice
 REPO_NAME=arduino-projects
 TAG_PREFIX=sonos-eth-p4-v
+DELTA_BASES=${DELTA_BASES:-3}
 
 usage() {
   echo "usage: ./release.sh <version> [release notes...]"
@@ -38,6 +41,7 @@ NOTES="${*:-Routine update.}"
 
 TAG="${TAG_PREFIX}${VER}"
 ASSET="SonosEthRemoteP4-v${VER}.bin"
+ZASSET="SonosEthRemoteP4-v${VER}.otz"
 
 # Refuse to release with uncommitted changes — the manifest + version bump
 # need to be the only change in the release commit, for clean rollback later.
@@ -46,6 +50,9 @@ if [[ -n "$(git status --porcelain config.h manifest.json 2>/dev/null)" ]]; then
   exit 1
 fi
 
+# The dashboard ships as a generated header — make sure it matches the source.
+python3 webui/build_webui.py --check || exit 1
+
 # Refuse to overwrite an existing tag.
 if git rev-parse -q --verify "refs/tags/$TAG" >/dev/null; then
   echo "tag $TAG already exists locally — pick a new version"
@@ -79,8 +86,56 @@ echo "==> binary: ${SIZE} bytes  sha256=${SHA}"
 
 cp "$BIN" "/tmp/${ASSET}"
 
+# ── Compressed copy ───────────────────────────────────────────────────────
+# Boards without a matching delta download this and inflate it as it
+# arrives (ota_lzss.h). Checked offline before it's published; both hashes
+# go in the manifest.
+python3 ota/lzss.py pack "$BIN" "/tmp/${ZASSET}"
+python3 ota/lzss.py check "/tmp/${ZASSET}" "$BIN" || exit 2
+ZSHA=$(shasum -a 256 "/tmp/${ZASSET}" | awk '{print $1}')
+ZSIZE=$(stat -f%z "/tmp/${ZASSET}")
+
+# ── Delta patches from recent releases ────────────────────────────────────
+# Boards running one of the last DELTA_BASES releases download a patch
+# against their own image instead of the whole thing (ota_delta.h). Each
+# patch is made and then re-applied offline by ota/delta.py; a patch over
+# half the image isn't worth publishing.
+DELTA_DIR=$(mktemp -d)
+DELTA_ASSETS=()
+DELTAS_JSON=""
+for PTAG in $(git tag -l "${TAG_PREFIX}*" --sort=-v:refname | head -n "$DELTA_BASES"); do
+  PVER="${PTAG#"$TAG_PREFIX"}"
+  PASSET="SonosEthRemoteP4-v${PVER}.bin"
+  if ! gh release download "$PTAG" --repo "$REPO_OWNER/$REPO_NAME" \
+         --pattern "$PASSET" --dir "$DELTA_DIR" >/dev/null 2>&1; then
+    echo "==> no $PASSET on $PTAG — no delta from it"
+    continue
+  fi
+  PATCH="SonosEthRemoteP4-v${PVER}-to-v${VER}.sdp"
+  echo "==> delta v${PVER} → v${VER}"
+  python3 ota/delta.py make "$DELTA_DIR/$PASSET" "$BIN" "$DELTA_DIR/$PATCH"
+  python3 ota/delta.py check "$DELTA_DIR/$PASSET" "$DELTA_DIR/$PATCH" "$BIN" || exit 2
+  PSIZE=$(stat -f%z "$DELTA_DIR/$PATCH")
+  if (( PSIZE * 2 > SIZE )); then
+    echo "    ${PSIZE} bytes is over half the image — skipped"
+    continue
+  fi
+  BSHA=$(shasum -a 256 "$DELTA_DIR/$PASSET" | awk '{print $1}')
+  PSHA=$(shasum -a 256 "$DELTA_DIR/$PATCH" | awk '{print $1}')
+  DELTA_ASSETS+=("$DELTA_DIR/$PATCH")
+  DELTAS_JSON+="${DELTAS_JSON:+,}
+    {
+      \"from\": \"${PVER}\",
+      \"base\": \"${BSHA}\",
+      \"url\": \"https://github.com/${REPO_OWNER}/${REPO_NAME}/releases/download/${TAG}/${PATCH}\",
+      \"sha256\": \"${PSHA}\",
+      \"size\": ${PSIZE}
+    }"
+done
+
 # ── Rewrite manifest.json ─────────────────────────────────────────────────
 ASSET_URL="https://github.com/${REPO_OWNER}/${REPO_NAME}/releases/download/${TAG}/${ASSET}"
+ZASSET_URL="https://github.com/${REPO_OWNER}/${REPO_NAME}/releases/download/${TAG}/${ZASSET}"
 echo "==> rewriting manifest.json"
 cat > manifest.json <<EOF
 {
@@ -88,6 +143,13 @@ cat > manifest.json <<EOF
   "url": "${ASSET_URL}",
   "sha256": "${SHA}",
   "size": ${SIZE},
+  "compressed": {
+    "url": "${ZASSET_URL}",
+    "sha256": "${ZSHA}",
+    "size": ${ZSIZE}
+  },
+  "deltas": [${DELTAS_JSON}
+  ],
   "released": "$(date -u +%Y-%m-%dT%H:%M:%SZ)",
   "notes": "${NOTES//\"/\\\"}"
 }
@@ -114,9 +176,10 @@ gh release create "$TAG" \
 sha256: ${SHA}
 size:   ${SIZE} bytes
 \`\`\`" \
-  "/tmp/${ASSET}"
+  "/tmp/${ASSET}" "/tmp/${ZASSET}" ${DELTA_ASSETS[@]+"${DELTA_ASSETS[@]}"}
 
-rm -f "/tmp/${ASSET}"
+rm -f "/tmp/${ASSET}" "/tmp/${ZASSET}"
+rm -rf "$DELTA_DIR"
 
 echo
 echo "✓ Release v${VER} published"
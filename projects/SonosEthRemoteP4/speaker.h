@@ -15,9 +15,22 @@ public:
   SonosController() {}
   SonosController(const String& speakerIP) : ip(speakerIP) {}
 
-  String soap(const char* endpoint, const char* serviceType,
-              const char* action, const char* params) {
-    HTTPClient http;
+  // The SOAP envelope for one action. Also used by discovery's
+  // non-blocking topology fetch (topology.h).
+  static void soapEnvelope(char* body, size_t bodyLen, const char* serviceType,
+                           const char* action, const char* params) {
+    snprintf(body, bodyLen,
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+      "<s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\""
+      " s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\">"
+      "<s:Body><u:%s xmlns:u=\"%s\">%s</u:%s></s:Body></s:Envelope>",
+      action, serviceType, params, action);
+  }
+
+  // Open the request and fill `body` with the SOAP envelope.
+  void beginSoap(HTTPClient& http, char* body, size_t bodyLen,
+                 const char* endpoint, const char* serviceType,
+                 const char* action, const char* params) {
     http.setTimeout(3000);
     char url[128];
     snprintf(url, sizeof(url), "http://%s:1400%s", ip.c_str(), endpoint);
@@ -28,13 +41,14 @@ public:
     snprintf(soapAction, sizeof(soapAction), "\"%s#%s\"", serviceType, action);
     http.addHeader("soapaction", soapAction);
 
+    soapEnvelope(body, bodyLen, serviceType, action, params);
+  }
+
+  String soap(const char* endpoint, const char* serviceType,
+              const char* action, const char* params) {
+    HTTPClient http;
     char body[600];
-    snprintf(body, sizeof(body),
-      "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
-      "<s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\""
-      " s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\">"
-      "<s:Body><u:%s xmlns:u=\"%s\">%s</u:%s></s:Body></s:Envelope>",
-      action, serviceType, params, action);
+    beginSoap(http, body, sizeof(body), endpoint, serviceType, action, params);
 
     String resp;
     int code = http.POST(body);
@@ -245,11 +259,14 @@ public:
 struct SpeakerInfo {
   String ip;
   String name;
+  String uuid;  // "RINCON_xxxxxxxxxxxx01400" — stable across DHCP moves
+  String coordinator;  // UUID of its group's coordinator ("" if unknown)
 };
 
 struct SpeakerState {
   String ip;
   String name;
+  String uuid;     // RINCON id — identity; `ip` is just where it is right now
   int    volume  = 0;
   bool   muted   = false;
   bool   playing = false;
@@ -265,6 +282,88 @@ static SonosController ctrl;
 static SpeakerState spk;
 static std::vector<SpeakerInfo> speakers;
 
+// =============================================================================
+// State lock
+//
+// Two tasks drive the speaker: loop() (knob, discovery, polling) and the
+// web-jobs task in webui.h, which runs the web UI's requests. Whoever holds
+// this lock owns ctrl, spk, speakers and the rest of the board state those
+// touch. It's recursive, so a holder can call helpers that take it again.
+//
+// loop() never waits for it. While a web request is in a SOAP call the knob
+// is still read every pass and its detents add up in `pending`; they go out
+// on the first pass after the request lets go.
+// =============================================================================
+static SemaphoreHandle_t stateMutex() {
+  static SemaphoreHandle_t m = xSemaphoreCreateRecursiveMutex();
+  return m;
+}
+
+struct StateLock {
+  bool held;
+  explicit StateLock(TickType_t wait = portMAX_DELAY)
+    : held(xSemaphoreTakeRecursive(stateMutex(), wait) == pdTRUE) {}
+  ~StateLock() { if (held) xSemaphoreGiveRecursive(stateMutex()); }
+  StateLock(const StateLock&) = delete;
+  StateLock& operator=(const StateLock&) = delete;
+  explicit operator bool() const { return held; }
+};
+
+// =============================================================================
+// UUID → IP index
+//
+// Speakers are identified by RINCON UUID; the IP is only their current
+// address. Every source that sees a UUID next to an address — SSDP replies
+// and NOTIFYs, ZoneGroupState, device descriptions — records it here, so a
+// DHCP move can be followed with one hash lookup instead of a rescan.
+// Fixed open-addressed table: no heap, O(1) expected lookup.
+// =============================================================================
+struct UuidSlot {
+  char          uuid[32];   // "RINCON_" + 12-hex MAC + "01400" fits with room
+  uint32_t      ip;
+  unsigned long seenMs;
+};
+// Power of two. 256 keeps load ≤ 0.8 even for the 200-player household in
+// bench/household_sim.py; at 64 that run overwrote two thirds of the entries.
+static constexpr size_t UUID_INDEX_SLOTS = 256;
+static UuidSlot uuidIndex[UUID_INDEX_SLOTS];
+
+static uint32_t fnv1a(const char* s) {
+  uint32_t h = 2166136261u;
+  while (*s) { h ^= (uint8_t)*s++; h *= 16777619u; }
+  return h;
+}
+
+// Returns the slot holding `uuid`, or (create=true) a free / reclaimed one.
+static UuidSlot* uuidIndexSlot(const char* uuid, bool create) {
+  size_t home = fnv1a(uuid) & (UUID_INDEX_SLOTS - 1);
+  for (size_t n = 0; n < UUID_INDEX_SLOTS; n++) {
+    UuidSlot& s = uuidIndex[(home + n) & (UUID_INDEX_SLOTS - 1)];
+    if (s.uuid[0] == '\0') return create ? &s : nullptr;
+    if (strcmp(s.uuid, uuid) == 0) return &s;
+  }
+  // Full (never in a real household) — recycle the home slot.
+  return create ? &uuidIndex[home] : nullptr;
+}
+
+static void uuidIndexPut(const String& uuid, const String& ip) {
+  if (uuid.length() == 0 || uuid.length() >= sizeof(UuidSlot::uuid)) return;
+  IPAddress addr;
+  if (!addr.fromString(ip)) return;
+  UuidSlot* s = uuidIndexSlot(uuid.c_str(), true);
+  strcpy(s->uuid, uuid.c_str());
+  s->ip = (uint32_t)addr;
+  s->seenMs = millis();
+}
+
+static bool uuidIndexGet(const String& uuid, String& ip) {
+  if (uuid.length() == 0) return false;
+  const UuidSlot* s = uuidIndexSlot(uuid.c_str(), false);
+  if (!s) return false;
+  ip = IPAddress(s->ip).toString();
+  return true;
+}
+
 static bool refreshState() {
   if (!spk.connected()) return false;
   ctrl.ip = spk.ip;
@@ -351,19 +450,44 @@ static bool prevTrack() {
   return ctrl.previous().length() > 0;
 }
 
+static void saveSelectedSpeaker() {
+  Preferences p;
+  p.begin("sonos", false);
+  p.putString("uuid", spk.uuid);
+  p.putString("ip", spk.ip);
+  p.putString("name", spk.name);
+  p.end();
+}
+
+// The selected speaker turned up at a new address — follow it in place,
+// without touching the rest of the selection state.
+static void rebindSpeaker(const String& ip) {
+  logEvent("speaker %s moved %s -> %s", spk.name.c_str(), spk.ip.c_str(), ip.c_str());
+  spk.ip = ip;
+  spk.online = true;
+  ctrl.ip = ip;
+  for (auto& s : speakers) if (s.uuid == spk.uuid) s.ip = ip;
+  saveSelectedSpeaker();
+}
+
+// Connect-failure hook: if the index already knows a newer address for the
+// selected speaker, rebind to it and return true so the caller can retry.
+static bool reResolveSpeaker() {
+  String ip;
+  if (!uuidIndexGet(spk.uuid, ip) || ip == spk.ip) return false;
+  rebindSpeaker(ip);
+  return true;
+}
+
 static void selectSpeaker(int idx) {
   if (idx < 0 || idx >= (int)speakers.size()) return;
   spk.idx = idx;
   spk.ip = speakers[idx].ip;
   spk.name = speakers[idx].name;
+  spk.uuid = speakers[idx].uuid;
   spk.online = true;
   ctrl.ip = spk.ip;
-
-  Preferences p;
-  p.begin("sonos", false);
-  p.putString("ip", spk.ip);
-  p.putString("name", spk.name);
-  p.end();
+  saveSelectedSpeaker();
 
   dbg("selected: %s @ %s", spk.name.c_str(), spk.ip.c_str());
   refreshState();
@@ -372,12 +496,18 @@ static void selectSpeaker(int idx) {
 static void restoreSpeaker() {
   Preferences p;
   p.begin("sonos", true);
+  String savedUuid = p.getString("uuid", "");
   String savedIP   = p.getString("ip", "");
   String savedName = p.getString("name", "");
   p.end();
 
   if (savedName.length() == 0 && savedIP.length() == 0) return;
 
+  // UUID first — it survives DHCP moves. IP and room name are the fallbacks
+  // for boards that saved their selection before UUIDs were stored.
+  if (savedUuid.length() > 0)
+    for (size_t i = 0; i < speakers.size(); i++)
+      if (speakers[i].uuid == savedUuid) { selectSpeaker(i); return; }
   for (size_t i = 0; i < speakers.size(); i++)
     if (speakers[i].ip == savedIP) { selectSpeaker(i); return; }
   for (size_t i = 0; i < speakers.size(); i++)
@@ -0,0 +1,189 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "lan_http.h"
+#include "speaker.h"
+
+// =============================================================================
+// Household topology — ZoneGroupTopology#GetZoneGroupState.
+//
+// Any one ZonePlayer can describe the whole household: every member's UUID,
+// location, room name, group coordinator and whether it's an invisible
+// satellite (sub / surrounds). One SOAP call replaces the per-speaker
+// device_description.xml fetch that discovery used to pay for each responder.
+//
+// The response is an entity-escaped XML document inside the SOAP envelope and
+// grows with the household (~1 KB per player), so it is parsed as it streams
+// in rather than buffered into a String. The scan drives the request through
+// LanHttp, one slice per loop() pass.
+// =============================================================================
+
+struct ZoneMember {
+  String uuid;
+  String ip;
+  String name;
+  String coordinator;   // UUID of the group coordinator this member plays in
+  bool   invisible = false;
+};
+
+// "http://192.168.1.23:1400/xml/device_description.xml" → "192.168.1.23"
+static String urlHost(const char* url) {
+  const char* p = strstr(url, "://");
+  if (!p) return "";
+  p += 3;
+  size_t n = strcspn(p, ":/");
+  return String(p).substring(0, n);
+}
+
+// Streaming tokenizer for the ZoneGroupState document. Entity-decodes one
+// level (the payload is escaped once inside the SOAP body), then tracks just
+// enough of the tag grammar to pick attributes off <ZoneGroup>,
+// <ZoneGroupMember> and <Satellite>. Memory use is a few fixed buffers plus
+// one ZoneMember per player found, independent of response size.
+class ZoneGroupParser : public Stream {
+public:
+  std::vector<ZoneMember> members;
+
+  size_t write(uint8_t c) override {
+    if (entLen > 0) {
+      if (c == ';') {
+        ent[entLen] = '\0';
+        entLen = 0;
+        if      (!strcmp(ent, "&lt"))   feed('<');
+        else if (!strcmp(ent, "&gt"))   feed('>');
+        else if (!strcmp(ent, "&quot")) feed('"');
+        else if (!strcmp(ent, "&apos")) feed('\'');
+        else if (!strcmp(ent, "&amp"))  feed('&');
+        return 1;
+      }
+      if (entLen < sizeof(ent) - 1) { ent[entLen++] = (char)c; return 1; }
+      // Not an entity we know — replay it verbatim.
+      for (size_t i = 0; i < entLen; i++) feed(ent[i]);
+      entLen = 0;
+    }
+    if (c == '&') { ent[0] = '&'; entLen = 1; return 1; }
+    feed((char)c);
+    return 1;
+  }
+  size_t write(const uint8_t* buf, size_t n) override {
+    for (size_t i = 0; i < n; i++) write(buf[i]);
+    return n;
+  }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+  // Ready for another document.
+  void reset() {
+    members.clear();
+    state = TEXT;
+    entLen = 0;
+    groupCoordinator = "";
+  }
+
+private:
+  enum State : uint8_t { TEXT, TAG_NAME, ATTRS, ATTR_NAME, ATTR_EQ, ATTR_VALUE };
+  State  state = TEXT;
+  char   ent[8];
+  size_t entLen = 0;
+  char   tagName[24];   size_t tagLen = 0;
+  char   attrName[24];  size_t attrLen = 0;
+  char   attrVal[128];  size_t valLen = 0;
+  char   quote = '"';
+  String groupCoordinator;
+  ZoneMember cur;
+
+  static void append(char* buf, size_t& len, size_t cap, char c) {
+    if (len < cap - 1) buf[len++] = c;
+  }
+  bool isMemberTag() const {
+    return !strcmp(tagName, "ZoneGroupMember") || !strcmp(tagName, "Satellite");
+  }
+
+  void feed(char c) {
+    switch (state) {
+      case TEXT:
+        if (c == '<') { state = TAG_NAME; tagLen = 0; cur = ZoneMember(); }
+        break;
+      case TAG_NAME:
+        if (c == '>' || c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '/') {
+          tagName[tagLen] = '\0';
+          if (c == '>') endTag();
+          else state = ATTRS;
+        } else {
+          append(tagName, tagLen, sizeof(tagName), c);
+        }
+        break;
+      case ATTRS:
+        if (c == '>') endTag();
+        else if (c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != '/' && c != '?') {
+          state = ATTR_NAME;
+          attrLen = 0;
+          append(attrName, attrLen, sizeof(attrName), c);
+        }
+        break;
+      case ATTR_NAME:
+        if (c == '=') { attrName[attrLen] = '\0'; state = ATTR_EQ; }
+        else if (c == '>') endTag();
+        else if (c != ' ') append(attrName, attrLen, sizeof(attrName), c);
+        break;
+      case ATTR_EQ:
+        if (c == '"' || c == '\'') { quote = c; valLen = 0; state = ATTR_VALUE; }
+        break;
+      case ATTR_VALUE:
+        if (c == quote) { attrVal[valLen] = '\0'; attribute(); state = ATTRS; }
+        else append(attrVal, valLen, sizeof(attrVal), c);
+        break;
+    }
+  }
+
+  void attribute() {
+    if (!strcmp(tagName, "ZoneGroup")) {
+      if (!strcmp(attrName, "Coordinator")) groupCoordinator = attrVal;
+      return;
+    }
+    if (!isMemberTag()) return;
+    if      (!strcmp(attrName, "UUID"))      cur.uuid = attrVal;
+    else if (!strcmp(attrName, "Location"))  cur.ip = urlHost(attrVal);
+    else if (!strcmp(attrName, "ZoneName"))  cur.name = SonosController::unescape(attrVal);
+    else if (!strcmp(attrName, "Invisible")) cur.invisible = !strcmp(attrVal, "1");
+  }
+
+  void endTag() {
+    state = TEXT;
+    if (!isMemberTag() || cur.uuid.length() == 0 || cur.ip.length() == 0) return;
+    cur.coordinator = groupCoordinator;
+    members.push_back(cur);
+  }
+};
+
+// GetZoneGroupState on `seedIP`, as a LanHttp request: begin() sends it,
+// poll() until it's no longer PENDING, then take() the members.
+struct ZoneGroupFetch {
+  LanHttp         http;
+  ZoneGroupParser parser;
+
+  bool begin(const String& seedIP, unsigned long timeoutMs = 3000) {
+    static const char svc[] = "urn:schemas-upnp-org:service:ZoneGroupTopology:1";
+    char body[400], headers[160];
+    SonosController::soapEnvelope(body, sizeof(body), svc, "GetZoneGroupState", "");
+    snprintf(headers, sizeof(headers),
+      "Content-Type: text/xml; charset=\"utf-8\"\r\nsoapaction: \"%s#GetZoneGroupState\"\r\n", svc);
+    parser.reset();
+    return http.begin(seedIP, 1400, "POST", "/ZoneGroupTopology/Control", headers, body,
+                      parser, timeoutMs);
+  }
+
+  LanHttp::Result poll() { return http.poll(); }
+
+  // After poll() returned DONE. False for a non-200 or an empty household.
+  bool take(std::vector<ZoneMember>& out) {
+    if (http.status() != 200) {
+      dbg("topology: GetZoneGroupState -> HTTP %d", http.status());
+      return false;
+    }
+    out.swap(parser.members);
+    parser.reset();
+    return !out.empty();
+  }
+};
@@ -5,24 +5,56 @@
 // Periodically (every ~6h with jitter) the board fetches a small JSON manifest
 // over HTTPS from raw.githubusercontent.com. If the manifest's `version` is
 // newer than FW_VERSION, it downloads the binary listed at `url`, verifies
-// SHA-256, streams into the ESP32 Update partition, and reboots.
+// SHA-256, streams into the inactive OTA partition, and reboots.
+//
+// Downloads survive flaky links: a stalled connection is resumed with a
+// Range request from the byte it stopped at, and a full-image download that
+// still fails leaves a resume point in NVS, so the next check — or the one
+// after a reboot — fetches only the rest. The final SHA-256 always covers
+// the whole image, re-read from flash for the part that came earlier.
+//
+// If the manifest lists a patch (`deltas`) whose base is the image we're
+// running, that's tried first: a ~10–100x smaller download applied against
+// the running partition (ota_delta.h). Any failure there falls back to the
+// full image in the same check.
+//
+// Otherwise, if the manifest lists a `compressed` copy of the image (OTZ1,
+// ota/lzss.py — about half the bytes), that's downloaded and inflated on the
+// fly (ota_lzss.h), with the SHA-256 of both the compressed stream and the
+// inflated image checked. Failure there falls back to the raw .bin too.
 //
 // ESP32 has dual OTA partitions, so if the new firmware fails to boot, the
 // bootloader rolls back to the last known-good partition automatically — we
 // don't need to implement rollback ourselves.
 //
+// Before any of that, it looks for a board on the LAN already running the
+// new image (mDNS, see below) and copies it from there, so a site pulls each
+// release over the WAN once rather than once per board.
+//
+// The manifest is fetched conditionally (If-None-Match / If-Modified-Since
+// against the last copy, kept in RAM), so an unchanged one is a bodiless 304.
+// And on the periodic path it's usually not fetched at all: the fleet hub's
+// reply to the heartbeat report just before names the latest version, and
+// when that's not newer than ours the check ends there — one TLS handshake
+// per cycle (the hub's, often reused) instead of two.
+//
 // Trigger paths:
 //   - Periodic timer in loop()         (auto)
 //   - POST /api/checkupdate            (manual, web UI button)
 // =============================================================================
 #include <Arduino.h>
-#include <Update.h>
 #include <HTTPClient.h>
 #include <NetworkClientSecure.h>
 #include <ArduinoJson.h>
+#include <ESPmDNS.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
 #include "mbedtls/sha256.h"
 #include "config.h"
 #include "fleet.h"
+#include "ota_delta.h"
+#include "ota_lzss.h"
+#include "ota_writer.h"
 
 void logEvent(const char* fmt, ...);  // defined in webui.h
 
@@ -37,6 +69,11 @@ struct UpdaterState {
 };
 static UpdaterState updaterState;
 
+// /api/checkupdate only sets these (web-jobs task, under the state lock);
+// the check itself runs from updaterTick() on loop(), like the scheduled one.
+static bool updateRequested = false;
+static bool updateForce     = false;
+
 // ── Version compare (returns >0 if a>b, <0 if a<b, 0 if equal) ────────────
 inline int compareVersion(const String& a, const String& b) {
   int ax[3] = {0,0,0}, bx[3] = {0,0,0};
@@ -46,87 +83,374 @@ inline int compareVersion(const String& a, const String& b) {
   return 0;
 }
 
-// ── Hex helpers ───────────────────────────────────────────────────────────
-inline void bytesToHex(const uint8_t* in, size_t n, char* out) {
-  static const char* H = "0123456789abcdef";
-  for (size_t i = 0; i < n; i++) {
-    out[i*2]   = H[(in[i] >> 4) & 0xF];
-    out[i*2+1] = H[ in[i]       & 0xF];
+// ── Download with Range resume ────────────────────────────────────────────
+// One file off the network. If it stalls for OTA_STALL_MS or the connection
+// drops early, it reconnects with `Range: bytes=<pos>-` and carries on
+// (GitHub's asset CDN and LAN peers answer 206), up to OTA_RECONNECTS times per check, so
+// a flaky switch costs a reconnect instead of the whole download. With
+// `hashed`, everything handed out is hashed too — the delta and compressed
+// paths verify the download itself, not just what it turns into.
+static constexpr unsigned long OTA_STALL_MS   = 10000;
+static constexpr int           OTA_RECONNECTS = 5;
+
+struct OtaDownload {
+  String url;
+  bool   hashed;
+  size_t total = 0;      // size of the whole file
+  size_t pos = 0;        // next byte handed out
+  size_t fetched = 0;    // bytes over the wire this check
+  int    reconnects = 0;
+  String err;
+  NetworkClientSecure tls;
+  NetworkClient plain;   // LAN peers serve plain HTTP
+  HTTPClient http;
+  NetworkClient* s = nullptr;
+  mbedtls_sha256_context sha;
+
+  OtaDownload(const String& u, bool hash) : url(u), hashed(hash) {
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+  }
+  ~OtaDownload() {
+    http.end();
+    mbedtls_sha256_free(&sha);
   }
-  out[n*2] = 0;
-}
 
-// ── Stream binary into Update + verify SHA-256 in the same pass ───────────
-// Returns true on success. On failure, leaves updaterState.lastError set.
-static bool streamUpdateWithHash(NetworkClient& stream, size_t contentLen,
-                                  const String& expectedSha) {
-  // Begin Update — pass contentLen so the partition is sized correctly.
-  if (!Update.begin(contentLen)) {
-    updaterState.lastError = String("Update.begin failed: ") + Update.errorString();
+  // Request the file from byte `from`. A resumed request must come back
+  // 206 with a Content-Range that starts there and agrees on the total.
+  bool open(size_t from) {
+    http.end();
+    s = nullptr;
+    tls.setInsecure();  // sha256 is the integrity check
+    NetworkClient& client = url.startsWith("https:") ? (NetworkClient&)tls : plain;
+    http.setUserAgent(String("SonosEthRemoteP4/") + FW_VERSION);
+    http.setTimeout(15000);
+    // Follow GitHub Release asset redirects (302 → objects.githubusercontent.com).
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    if (!http.begin(client, url)) {
+      err = "http.begin failed";
+      return false;
+    }
+    const char* keep[] = {"Content-Range"};
+    http.collectHeaders(keep, 1);
+    if (from) http.addHeader("Range", String("bytes=") + from + "-");
+    int code = http.GET();
+    int len = http.getSize();
+    if (from == 0 && code == HTTP_CODE_OK && len > 0) {
+      total = len;
+    } else if (from > 0 && code == HTTP_CODE_PARTIAL_CONTENT) {
+      unsigned long start = 0, whole = 0;
+      String range = http.header("Content-Range");
+      if (sscanf(range.c_str(), "bytes %lu-%*u/%lu", &start, &whole) != 2 ||
+          start != from || (total && whole != total)) {
+        err = String("bad Content-Range '") + range + "'";
+        return false;
+      }
+      total = whole;
+    } else {
+      err = String("HTTP ") + code + (from ? " to a Range request" : "");
+      return false;
+    }
+    pos = from;
+    s = http.getStreamPtr();
+    return true;
+  }
+
+  // After a stall or early close: reconnect at `pos`, with a short pause
+  // between tries. False once the budget for this check is spent.
+  bool resume() {
+    while (reconnects < OTA_RECONNECTS) {
+      reconnects++;
+      logEvent("ota: stalled at %u / %u — reconnecting (%d/%d)",
+        (unsigned)pos, (unsigned)total, reconnects, OTA_RECONNECTS);
+      if (open(pos)) return true;
+      logEvent("ota: reconnect failed: %s", err.c_str());
+      delay(2000);
+    }
+    err = String("network stall at ") + pos + " / " + total + " bytes";
     return false;
   }
 
-  mbedtls_sha256_context sha;
-  mbedtls_sha256_init(&sha);
-  mbedtls_sha256_starts(&sha, 0);  // 0 = SHA-256 (not SHA-224)
-
-  const size_t BUFSZ = 1024;
-  uint8_t buf[BUFSZ];
-  size_t totalRead = 0;
-  unsigned long lastReport = millis();
-
-  while (totalRead < contentLen) {
-    size_t want = min(BUFSZ, contentLen - totalRead);
-    int n = stream.readBytes((char*)buf, want);
-    if (n <= 0) {
-      // Network stall — give it a moment, then bail.
-      if (millis() - lastReport > 10000) {
-        updaterState.lastError = "network stall during download";
-        mbedtls_sha256_free(&sha);
-        Update.abort();
-        return false;
+  // Whatever has arrived, up to n (waiting for at least one byte); 0 at the
+  // end, or when the download can't continue (`err` says why).
+  size_t readSome(uint8_t* dst, size_t n) {
+    if (n > total - pos) n = total - pos;
+    if (n == 0) return 0;
+    unsigned long lastData = millis();
+    for (;;) {
+      int got = s ? s->read(dst, n) : 0;
+      if (got > 0) {
+        if (hashed) mbedtls_sha256_update(&sha, dst, got);
+        pos += got;
+        fetched += got;
+        return got;
+      }
+      if (!s || millis() - lastData > OTA_STALL_MS || (!s->connected() && !s->available())) {
+        if (!resume()) return 0;
+        lastData = millis();
+        continue;
       }
-      delay(20);
-      continue;
+      delay(5);
+    }
+  }
+
+  // Exactly n bytes or false.
+  bool read(uint8_t* dst, size_t n) {
+    while (n) {
+      size_t got = readSome(dst, n);
+      if (got == 0) return false;
+      dst += got;
+      n -= got;
     }
-    if (Update.write(buf, n) != (size_t)n) {
-      updaterState.lastError = String("Update.write failed: ") + Update.errorString();
-      mbedtls_sha256_free(&sha);
-      Update.abort();
+    return true;
+  }
+
+  bool complete() const { return total && pos == total; }
+
+  void hex(char out[65]) {
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&sha, digest);
+    bytesToHex(digest, 32, out);
+  }
+};
+
+// ── Full image: stream into the slot, resuming where the last check stopped
+// Returns true on success. On failure, leaves updaterState.lastError set and
+// the resume point saved, so the next check carries on from it.
+static bool streamUpdateWithHash(const String& url, const String& expectedSha,
+                                 size_t imageSize) {
+  size_t resumeAt = otaResumeOffset(expectedSha, imageSize);
+  OtaDownload in(url, false);
+  if (resumeAt && !in.open(resumeAt)) {
+    logEvent("ota: can't resume at %u (%s) — starting over", (unsigned)resumeAt, in.err.c_str());
+    resumeAt = 0;
+  }
+  if (!resumeAt && !in.open(0)) {
+    updaterState.lastError = String("binary ") + in.err;
+    return false;
+  }
+  if (imageSize && in.total != imageSize) {
+    updaterState.lastError = String("binary is ") + in.total + " bytes, manifest says " + imageSize;
+    return false;
+  }
+  if (resumeAt) logEvent("ota: resuming at %u of %u bytes", (unsigned)resumeAt, (unsigned)in.total);
+  else          logEvent("ota: %u bytes incoming", (unsigned)in.total);
+
+  OtaImageWriter out;
+  if (!out.begin(in.total, resumeAt)) {
+    updaterState.lastError = out.err;
+    return false;
+  }
+  updaterState.status = "installing";
+
+  uint8_t buf[1024];
+  size_t nextCheckpoint = (resumeAt / OTA_CHECKPOINT + 1) * OTA_CHECKPOINT;
+  while (out.written < out.total) {
+    size_t n = in.readSome(buf, min(sizeof(buf), out.total - out.written));
+    if (n == 0) {
+      updaterState.lastError = in.err;
+      out.abort();
+      return false;
+    }
+    if (!out.write(buf, n)) {
+      updaterState.lastError = out.err;
+      out.abort();
       return false;
     }
-    mbedtls_sha256_update(&sha, buf, n);
-    totalRead += n;
-    if (millis() - lastReport > 1000) {
-      lastReport = millis();
-      logEvent("ota %u / %u bytes (%u%%)",
-        (unsigned)totalRead, (unsigned)contentLen,
-        (unsigned)(totalRead * 100 / contentLen));
+    size_t durable = out.flushed;
+    if (durable >= nextCheckpoint) {
+      otaResumeSave(expectedSha, out.part, durable & ~(OTA_SECTOR - 1));
+      nextCheckpoint += OTA_CHECKPOINT;
     }
   }
+  logEvent("ota: fetched %u bytes this check for a %u byte image (%d reconnects)",
+    (unsigned)in.fetched, (unsigned)in.total, in.reconnects);
+  bool ok = out.finish(expectedSha);
+  if (!ok) updaterState.lastError = out.err;
+  otaResumeClear();  // installed, or the bytes were wrong — either way start clean
+  return ok;
+}
 
+// ── Delta path ─────────────────────────────────────────────────────────────
+// SHA-256 of the image we booted, hex — the same bytes release.sh hashed as
+// the .bin, so it's the key into the manifest's `deltas`. One read of the
+// running partition on first use, then cached.
+static const char* runningImageSha() {
+  static char hex[65] = "";
+  if (hex[0]) return hex;
+  const esp_partition_t* part = esp_ota_get_running_partition();
+  size_t len = ESP.getSketchSize();
+  if (!part || len == 0) return hex;
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  bool ok = hashPartition(part, len, &sha);
   uint8_t digest[32];
   mbedtls_sha256_finish(&sha, digest);
   mbedtls_sha256_free(&sha);
+  if (ok) bytesToHex(digest, 32, hex);
+  return hex;
+}
 
-  char gotHex[65];
-  bytesToHex(digest, 32, gotHex);
-  String got = String(gotHex);
-  String want = expectedSha;
-  want.toLowerCase();
-  got.toLowerCase();
+// The running partition, as the patch's base.
+struct OtaRunningImage {
+  const esp_partition_t* part;
+  bool readBase(uint32_t off, uint8_t* dst, size_t n) {
+    return esp_partition_read(part, off, dst, n) == ESP_OK;
+  }
+};
 
-  if (got != want) {
-    updaterState.lastError = String("sha256 mismatch — expected ") + want + " got " + got;
-    Update.abort();
+// Download `url` (an SDP1 patch against the running image) and apply it into
+// the update partition. False → caller falls back to the full image.
+static bool applyDeltaUpdate(const String& url, const String& patchSha,
+                             const String& imageSha) {
+  OtaDownload in(url, true);
+  if (!in.open(0)) {
+    updaterState.lastError = String("delta ") + in.err;
+    return false;
+  }
+  if (in.total <= SDP_HEADER_LEN) {
+    updaterState.lastError = "delta too short";
     return false;
   }
+  logEvent("ota: %u byte patch incoming", (unsigned)in.total);
 
-  if (!Update.end(true)) {  // true = finalize partition
-    updaterState.lastError = String("Update.end failed: ") + Update.errorString();
+  SdpHeader h;
+  const char* err = nullptr;
+  char baseHex[65];
+  if (!sdpReadHeader(in, h, err)) {
+    updaterState.lastError = err;
     return false;
   }
-  return true;
+  bytesToHex(h.baseSha, 32, baseHex);
+  if (h.baseSize != ESP.getSketchSize() || strcmp(baseHex, runningImageSha()) != 0) {
+    updaterState.lastError = "delta is for a different base image";
+    return false;
+  }
+
+  OtaRunningImage base{esp_ota_get_running_partition()};
+  OtaImageWriter out;
+  if (!out.begin(h.newSize)) {
+    updaterState.lastError = out.err;
+    return false;
+  }
+  updaterState.status = "installing";
+  if (!sdpApply(in, base, out, h, err)) {
+    updaterState.lastError = in.err.length()  ? in.err
+                           : out.err.length() ? out.err
+                           : String("delta: ") + err;
+    out.abort();
+    return false;
+  }
+  char gotPatch[65];
+  in.hex(gotPatch);
+  if (!in.complete() || !patchSha.equalsIgnoreCase(gotPatch)) {
+    updaterState.lastError = "delta patch sha256 mismatch";
+    out.abort();
+    return false;
+  }
+  if (out.finish(imageSha)) return true;
+  updaterState.lastError = out.err;
+  return false;
+}
+
+// ── Compressed path ───────────────────────────────────────────────────────
+// Download `url` (the OTZ1-packed image) and inflate it into the update
+// partition. False → caller falls back to the raw image.
+static bool applyCompressedUpdate(const String& url, const String& zSha,
+                                  const String& imageSha) {
+  OtaDownload in(url, true);
+  if (!in.open(0)) {
+    updaterState.lastError = String("otz ") + in.err;
+    return false;
+  }
+
+  LzsReader<OtaDownload> z(in);
+  if (!z.begin()) {
+    updaterState.lastError = String("otz: ") + z.err;
+    return false;
+  }
+  logEvent("ota: %u bytes incoming, inflating to %u", (unsigned)in.total, (unsigned)z.rawSize);
+
+  OtaImageWriter out;
+  if (!out.begin(z.rawSize)) {
+    updaterState.lastError = out.err;
+    return false;
+  }
+  updaterState.status = "installing";
+  uint8_t buf[1024];
+  unsigned long t0 = millis();
+  while (out.written < out.total) {
+    size_t k = min(sizeof(buf), out.total - out.written);
+    if (!z.read(buf, k)) {
+      updaterState.lastError = in.err.length() ? in.err : String("otz: ") + z.err;
+      out.abort();
+      return false;
+    }
+    if (!out.write(buf, k)) {
+      updaterState.lastError = out.err;
+      out.abort();
+      return false;
+    }
+  }
+  char gotZ[65];
+  in.hex(gotZ);
+  if (!z.done() || !in.complete() || !zSha.equalsIgnoreCase(gotZ)) {
+    updaterState.lastError = "otz sha256 mismatch";
+    out.abort();
+    return false;
+  }
+  logEvent("ota: %u → %u bytes in %lu ms (%d reconnects)",
+    (unsigned)in.total, (unsigned)z.rawSize, millis() - t0, in.reconnects);
+  if (out.finish(imageSha)) return true;
+  updaterState.lastError = out.err;
+  return false;
+}
+
+// ── LAN peers ─────────────────────────────────────────────────────────────
+// Every board advertises _sonosp4._tcp with TXT fw=<version> and
+// fwsha=<sha256 of its running image>, and serves that image at /api/fw.bin
+// straight from its running partition, Range-capable (webui.h). An updating
+// board that finds a peer already running the manifest's image copies it
+// from there over plain HTTP — the end-to-end sha256 check is the same as
+// for GitHub, so a peer can't hand over anything else.
+//
+// When no peer has it yet, one board per site goes to GitHub: the one with
+// the lowest IP among the boards still on our version. The rest wait a
+// check (5 min) for it to install and advertise, at most OTA_PEER_WAITS
+// times in a row, then fetch it themselves in case the leader can't.
+static constexpr int OTA_PEER_WAITS = 3;
+static int otaPeerWaits = 0;
+
+struct LanPeerPlan {
+  String url;            // a peer that has the image, or empty
+  IPAddress leader;      // who should fetch it for the site, if not us
+  bool waitForLeader = false;
+};
+
+static bool ipBefore(const IPAddress& a, const IPAddress& b) {
+  for (int i = 0; i < 4; i++)
+    if (a[i] != b[i]) return a[i] < b[i];
+  return false;
+}
+
+static LanPeerPlan lanPeerPlan(const String& version, const String& sha) {
+  LanPeerPlan plan;
+  IPAddress me = ETH.localIP();
+  plan.leader = me;
+  int n = MDNS.queryService("sonosp4", "tcp");   // blocks up to ~3 s
+  for (int i = 0; i < n; i++) {
+    IPAddress ip = MDNS.address(i);
+    if (ip == me) continue;
+    String fw = MDNS.txt(i, "fw");
+    if (fw == version && MDNS.txt(i, "fwsha").equalsIgnoreCase(sha)) {
+      plan.url = String("http://") + ip.toString() + ":" + MDNS.port(i) + "/api/fw.bin";
+      return plan;
+    }
+    if (fw == FW_VERSION && ipBefore(ip, plan.leader)) plan.leader = ip;
+  }
+  plan.waitForLeader = plan.leader != me;
+  return plan;
 }
 
 // ── Public: fetch manifest + apply if newer. force=true bypasses the
@@ -137,6 +461,9 @@ inline bool checkForUpdate(bool force = false) {
   updaterState.lastError = "";
   updaterState.lastCheckMs = millis();
 
+  // Last manifest we got, and its validators, for a conditional GET.
+  static String manifestBody, manifestEtag, manifestLastMod;
+
   NetworkClientSecure manifestClient;
   manifestClient.setInsecure();  // sha256 of binary is the real integrity check
 
@@ -148,18 +475,29 @@ inline bool checkForUpdate(bool force = false) {
     updaterState.lastError = "http.begin(manifest) failed";
     return false;
   }
+  const char* keep[] = {"ETag", "Last-Modified"};
+  http.collectHeaders(keep, 2);
+  if (manifestBody.length()) {
+    if (manifestEtag.length())    http.addHeader("If-None-Match", manifestEtag);
+    if (manifestLastMod.length()) http.addHeader("If-Modified-Since", manifestLastMod);
+  }
   int code = http.GET();
-  if (code != 200) {
+  if (code == HTTP_CODE_NOT_MODIFIED && manifestBody.length()) {
+    dbg("ota: manifest unchanged (304)");
+  } else if (code == HTTP_CODE_OK) {
+    manifestBody    = http.getString();
+    manifestEtag    = http.header("ETag");
+    manifestLastMod = http.header("Last-Modified");
+  } else {
     updaterState.status = "error";
     updaterState.lastError = String("manifest HTTP ") + code;
     http.end();
     return false;
   }
-  String body = http.getString();
   http.end();
 
   JsonDocument doc;
-  DeserializationError jerr = deserializeJson(doc, body);
+  DeserializationError jerr = deserializeJson(doc, manifestBody);
   if (jerr) {
     updaterState.status = "error";
     updaterState.lastError = String("manifest JSON parse: ") + jerr.c_str();
@@ -183,41 +521,76 @@ inline bool checkForUpdate(bool force = false) {
     return true;
   }
 
-  logEvent("ota: %s available (currently %s) — downloading", latest.c_str(), FW_VERSION);
-  updaterState.status = "downloading";
+  size_t imageSize = doc["size"] | 0;
 
-  NetworkClientSecure binClient;
-  binClient.setInsecure();
-  HTTPClient bin;
-  bin.setUserAgent(String("SonosEthRemoteP4/") + FW_VERSION);
-  bin.setTimeout(15000);
-  // Follow GitHub Release asset redirects (302 → objects.githubusercontent.com).
-  bin.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  if (!bin.begin(binClient, url)) {
-    updaterState.status = "error";
-    updaterState.lastError = "http.begin(bin) failed";
-    return false;
+  // A peer on the LAN with the image beats anything over the WAN.
+  LanPeerPlan lan = lanPeerPlan(latest, sha256);
+  if (lan.url.length()) {
+    logEvent("ota: %s available (currently %s) — copying from %s", latest.c_str(), FW_VERSION, lan.url.c_str());
+    updaterState.status = "downloading";
+    if (streamUpdateWithHash(lan.url, sha256, imageSize)) {
+      logEvent("ota: installed v%s from LAN peer — rebooting", latest.c_str());
+      updaterState.status = "rebooting";
+      delay(500);
+      ESP.restart();
+      return true;
+    }
+    logEvent("ota: LAN peer failed (%s) — falling back to GitHub", updaterState.lastError.c_str());
+  } else if (lan.waitForLeader && !force && otaPeerWaits < OTA_PEER_WAITS) {
+    otaPeerWaits++;
+    updaterState.status = "waiting";
+    logEvent("ota: %s available — waiting for %s to fetch it for the site (%d/%d)",
+      latest.c_str(), lan.leader.toString().c_str(), otaPeerWaits, OTA_PEER_WAITS);
+    return true;
   }
-  int bc = bin.GET();
-  if (bc != 200) {
-    updaterState.status = "error";
-    updaterState.lastError = String("binary HTTP ") + bc;
-    bin.end();
-    return false;
+  otaPeerWaits = 0;
+
+  // A full-image download that an earlier check left half done goes next:
+  // what's left of it is less than any alternative.
+  bool resuming = otaResumeOffset(sha256, imageSize) > 0;
+
+  // A patch against the image we're running? Much smaller than the full one.
+  const char* mine = runningImageSha();
+  for (JsonVariant d : doc["deltas"].as<JsonArray>()) {
+    if (resuming) break;
+    String dBase = d["base"] | "";
+    if (!mine[0] || !dBase.equalsIgnoreCase(mine)) continue;
+    String dUrl = d["url"] | "";
+    String dSha = d["sha256"] | "";
+    if (dUrl.length() == 0 || dSha.length() == 0) break;
+    logEvent("ota: %s available (currently %s) — applying delta", latest.c_str(), FW_VERSION);
+    updaterState.status = "downloading";
+    if (applyDeltaUpdate(dUrl, dSha, sha256)) {
+      logEvent("ota: installed v%s from delta — rebooting", latest.c_str());
+      updaterState.status = "rebooting";
+      delay(500);
+      ESP.restart();
+      return true;
+    }
+    logEvent("ota: delta failed (%s) — falling back to full image", updaterState.lastError.c_str());
+    break;
   }
-  size_t contentLen = bin.getSize();
-  if (contentLen <= 0) {
-    updaterState.status = "error";
-    updaterState.lastError = "binary has no Content-Length";
-    bin.end();
-    return false;
+
+  // The packed image: same bytes once inflated, about half the download.
+  String zUrl = doc["compressed"]["url"]    | "";
+  String zSha = doc["compressed"]["sha256"] | "";
+  if (!resuming && zUrl.length() && zSha.length()) {
+    logEvent("ota: %s available (currently %s) — downloading compressed", latest.c_str(), FW_VERSION);
+    updaterState.status = "downloading";
+    if (applyCompressedUpdate(zUrl, zSha, sha256)) {
+      logEvent("ota: installed v%s — rebooting", latest.c_str());
+      updaterState.status = "rebooting";
+      delay(500);
+      ESP.restart();
+      return true;
+    }
+    logEvent("ota: compressed image failed (%s) — falling back to raw", updaterState.lastError.c_str());
   }
-  logEvent("ota: %u bytes incoming", (unsigned)contentLen);
 
-  updaterState.status = "installing";
-  NetworkClient* stream = bin.getStreamPtr();
-  bool ok = streamUpdateWithHash(*stream, contentLen, sha256);
-  bin.end();
+  logEvent("ota: %s available (currently %s) — downloading", latest.c_str(), FW_VERSION);
+  updaterState.status = "downloading";
+
+  bool ok = streamUpdateWithHash(url, sha256, imageSize);
 
   if (!ok) {
     updaterState.status = "error";
@@ -241,6 +614,14 @@ inline void updaterTick(bool ethConnected, const char* hostname,
                          bool i2cOk, uint16_t ssPid) {
   if (!ethConnected) return;
 
+  if (updateRequested) {
+    bool force = updateForce;
+    updateRequested = updateForce = false;
+    logEvent("update check requested%s", force ? " (force)" : "");
+    checkForUpdate(force);  // may reboot on success
+    return;
+  }
+
   // First scheduled check 60s after boot (give DHCP/mDNS/SSDP time).
   static unsigned long nextHeartbeat = 60UL * 1000UL;
   static unsigned long lastActivityReport = 0;
@@ -248,7 +629,7 @@ inline void updaterTick(bool ethConnected, const char* hostname,
 
   // Activity-triggered path — flush pending events to the hub fast so the
   // dashboard pulse stays responsive to real user input.
-  bool hasEvents = (fleetEvtCount > 0);
+  bool hasEvents = (fleetEvents.count > 0);
   if (hasEvents && (millis() - lastActivityReport) > T_FLEET_ACTIVE) {
     lastActivityReport = millis();
     fleetReport(hostname, i2cOk, ssPid);
@@ -262,5 +643,15 @@ inline void updaterTick(bool ethConnected, const char* hostname,
   nextHeartbeat = millis() + T_UPDATE_CHECK + jitter;
   lastActivityReport = millis();
   fleetReport(hostname, i2cOk, ssPid);
+
+  // The hub just told us the latest version. Nothing newer, and the last
+  // check didn't leave an error to retry → no need to ask GitHub ourselves.
+  bool hubFresh = fleetHubFw.length() && millis() - fleetHubFwMs < 60000;
+  if (hubFresh && compareVersion(fleetHubFw, FW_VERSION) <= 0 && updaterState.status != "error") {
+    updaterState.status = "up_to_date";
+    updaterState.latestVer = fleetHubFw;
+    updaterState.lastCheckMs = millis();
+    return;
+  }
   checkForUpdate(false);  // may reboot on success
 }
@@ -1,17 +1,21 @@
 #pragma once
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
 #include <Preferences.h>
+#include <atomic>
 #include "config.h"
+#include "json.h"
 #include "room.h"
 #include "speaker.h"
 #include "discovery.h"
 #include "actions.h"
+#include "art.h"
 #include "modes.h"
 #include "logo.h"
+#include "webui_index.h"
 #include "updater.h"
 
-static WebServer web(80);
+static AsyncWebServer web(80);
 static char deviceHostname[24];
 static String deviceName;
 
@@ -26,1086 +30,807 @@ extern unsigned long lastFiredMs;
 void saveEncoderInvert(bool v);  // implemented in encoder.h
 void saveVolumeStep(int v);      // implemented in encoder.h
 
-// Ring buffer log for web UI
-static const int LOG_LINES = 40;
-static String logRing[LOG_LINES];
-static int logHead = 0;
+// =============================================================================
+// Log ring for the web UI
+//
+// A fixed arena of LOG_LINES entries, each stamped with a sequence number and
+// the uptime second it was logged. logEvent() formats the message exactly
+// once, straight into its slot — no String per line, no heap at all. The
+// "<sec> " prefix is only printed when someone reads the log, and readers
+// ask for what they haven't seen: /api/log?after=<seq> and the SSE `log`
+// event carry only newer entries.
+//
+// Per-detent lines (`rot …`) go through logHot(), which returns before
+// formatting anything while hot-path logging is switched off
+// (/api/loghot?v=0). On by default so the dashboard keeps showing turns.
+// =============================================================================
+static constexpr int    LOG_LINES    = 40;
+static constexpr size_t LOG_TEXT_MAX = 128;
+
+struct LogEntry {
+  uint32_t seq;                // 0 = slot never used
+  uint32_t sec;                // millis() / 1000 when logged
+  char     text[LOG_TEXT_MAX];
+};
+
+static LogEntry logRing[LOG_LINES];
+static uint32_t logSeq = 0;       // newest entry's seq (= lines ever logged)
+static bool     logHotLines = true;
+
+// Room slug only changes through /api/setroom, /api/setup or serial ROOM:,
+// all of which restart the board — read NVS once at init, not per status.
+static String roomSlug;
+
+// Lines come from loop(), the web-jobs task and the web-art task. The art
+// task logs without the state lock while it fetches a cover, so the slot is
+// claimed and filled under a spinlock. Formatting happens outside it.
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void logEventV(const char* fmt, va_list ap) {
+  char text[LOG_TEXT_MAX];
+  vsnprintf(text, sizeof(text), fmt, ap);
+  portENTER_CRITICAL(&logMux);
+  uint32_t seq = logSeq + 1;
+  LogEntry& e = logRing[seq % LOG_LINES];
+  memcpy(e.text, text, sizeof(e.text));
+  e.sec = millis() / 1000;
+  e.seq = seq;
+  logSeq = seq;
+  portEXIT_CRITICAL(&logMux);
+  Serial.println(text);
+}
 
 void logEvent(const char* fmt, ...) {
-  char buf[128];
   va_list ap;
   va_start(ap, fmt);
-  vsnprintf(buf, sizeof(buf), fmt, ap);
+  logEventV(fmt, ap);
+  va_end(ap);
+}
+
+// For lines logged on every detent or packet: free when switched off.
+void logHot(const char* fmt, ...) {
+  if (!logHotLines) return;
+  va_list ap;
+  va_start(ap, fmt);
+  logEventV(fmt, ap);
   va_end(ap);
-  Serial.println(buf);
-  // Timestamp + message
-  char entry[160];
-  snprintf(entry, sizeof(entry), "%lu %s", millis() / 1000, buf);
-  logRing[logHead] = entry;
-  logHead = (logHead + 1) % LOG_LINES;
+}
+
+// Oldest seq still in the ring that is newer than `after`. An `after` from
+// the future (a previous boot) counts as "nothing seen".
+static uint32_t logFirstAfter(uint32_t after) {
+  uint32_t oldest = logSeq > (uint32_t)LOG_LINES ? logSeq - LOG_LINES + 1 : 1;
+  if (after > logSeq) after = 0;
+  return after + 1 > oldest ? after + 1 : oldest;
+}
+
+// "<sec> <text>\n" for one entry into `out`; returns the length written.
+static size_t logFormatEntry(const LogEntry& e, char* out, size_t cap) {
+  int n = snprintf(out, cap, "%lu %s\n", (unsigned long)e.sec, e.text);
+  return n < 0 ? 0 : ((size_t)n < cap ? (size_t)n : cap - 1);
+}
+
+// Entries after `after`, oldest first, streamed to `out`.
+static void logWrite(Print& out, uint32_t after) {
+  char line[LOG_TEXT_MAX + 12];
+  for (uint32_t seq = logFirstAfter(after); seq <= logSeq; seq++)
+    out.write((const uint8_t*)line, logFormatEntry(logRing[seq % LOG_LINES], line, sizeof(line)));
+}
+
+// Same into a fixed buffer, NUL-terminated and without the final newline
+// (AsyncEventSource splits data on '\n'). If they don't all fit, the oldest
+// are dropped — the newest lines are the ones worth pushing.
+static size_t logFormat(char* buf, size_t cap, uint32_t after) {
+  uint32_t first = logFirstAfter(after);
+  size_t len = 0;
+  for (uint32_t seq = logSeq; seq >= first && seq > 0; seq--) {
+    const LogEntry& e = logRing[seq % LOG_LINES];
+    size_t need = strlen(e.text) + 12;   // "<sec> " + text + '\n', generously
+    if (len + need >= cap) { first = seq + 1; break; }
+    len += need;
+  }
+  len = 0;
+  for (uint32_t seq = first; seq <= logSeq; seq++)
+    len += logFormatEntry(logRing[seq % LOG_LINES], buf + len, cap - len);
+  if (len && buf[len - 1] == '\n') len--;
+  buf[len] = '\0';
+  return len;
 }
 
 // --- Handlers ---
 
-static void serveRoot() {
-  static const char HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html><html><head>
-<meta charset='utf-8'><meta name='viewport' content='width=device-width,initial-scale=1'>
-<title>Sonos Remote</title>
-<link rel='preconnect' href='https://fonts.googleapis.com'>
-<link rel='preconnect' href='https://fonts.gstatic.com' crossorigin>
-<link href='https://fonts.googleapis.com/css2?family=Fraunces:opsz,wght@9..144,300;9..144,500;9..144,600&family=IBM+Plex+Sans:wght@300;400;500;600&family=JetBrains+Mono:wght@400;500;600&display=swap' rel='stylesheet'>
-<style>
-:root{
-  --bg:#0a0a0c;
-  --surface:#121218;
-  --surface-2:#16161e;
-  --rail:#1c1c26;
-  --ink:#e9e7e3;
-  --ink-2:#a09c95;
-  --ink-3:#5a564f;
-  --ink-4:#2e2c28;
-  --accent:#7B2D2D;
-  --accent-2:#9a3838;
-  --accent-soft:#3a1418;
-  --serif:'Fraunces',Georgia,serif;
-  --sans:'IBM Plex Sans',system-ui,sans-serif;
-  --mono:'JetBrains Mono',ui-monospace,monospace;
-}
-*{box-sizing:border-box;margin:0;padding:0}
-html,body{background:var(--bg);color:var(--ink)}
-body{
-  font-family:var(--sans);font-weight:400;font-size:14px;line-height:1.55;
-  max-width:1040px;margin:0 auto;padding:28px 24px 40px;
-  background:
-    radial-gradient(900px 600px at 50% -10%, #14141c 0%, transparent 60%),
-    linear-gradient(180deg, #0a0a0c 0%, #08080a 100%);
-  min-height:100vh;
-  -webkit-font-smoothing:antialiased;text-rendering:optimizeLegibility;
-}
-::selection{background:var(--accent);color:#fff}
-.masthead{display:flex;flex-direction:column;align-items:center;gap:6px;padding:8px 0 18px;border-bottom:1px solid var(--ink-4);margin-bottom:24px}
-.logo img{height:56px;opacity:.92;filter:saturate(.85)}
-.eyebrow{font-family:var(--mono);font-size:10px;font-weight:500;letter-spacing:4px;text-transform:uppercase;color:var(--ink-3);margin-top:2px}
-.room{font-family:var(--serif);font-size:22px;font-weight:400;color:var(--ink);letter-spacing:.3px;margin-top:4px;text-align:center;line-height:1.1;display:flex;align-items:center;justify-content:center;gap:10px}
-.room.unassigned{font-style:italic;color:#a55;font-size:16px;letter-spacing:1px;text-transform:uppercase;font-family:var(--mono)}
-.room .roomhost{display:block;font-family:var(--mono);font-size:10px;color:var(--ink-3);letter-spacing:2px;margin-top:4px;text-transform:lowercase;font-style:normal}
-.room .actdot{display:inline-block;width:10px;height:10px;border-radius:50%;background:#2a2a2e;transition:background .1s,box-shadow .1s,transform .1s;flex-shrink:0}
-.room .actdot.live{background:#5dd17b;box-shadow:0 0 14px #5dd17b,0 0 4px #5dd17b;transform:scale(1.15)}
-/* Gesture row flash — green = SOAP success, red = Sonos rejected. */
-@keyframes flashOk { 0% { background: rgba(93,209,123,.45); box-shadow: inset 0 0 24px rgba(93,209,123,.4); } 100% { background: transparent; box-shadow: none; } }
-@keyframes flashFail { 0% { background: rgba(255,90,90,.45); box-shadow: inset 0 0 24px rgba(255,90,90,.4); } 100% { background: transparent; box-shadow: none; } }
-.gesture-row.flash-ok   { animation: flashOk 1.6s ease-out; }
-.gesture-row.flash-fail { animation: flashFail 1.6s ease-out; }
-.room .roomtxt{display:inline-block}
-.dev{font-family:var(--mono);font-size:11px;color:var(--ink-3);cursor:pointer;text-align:center;letter-spacing:.5px;transition:color .2s}
-.steprow{font-family:var(--mono);font-size:10px;color:var(--ink-3);text-align:center;letter-spacing:1px;text-transform:uppercase;margin-top:8px;display:flex;align-items:center;justify-content:center;gap:10px}
-.steprow input[type=range]{width:140px;height:14px;-webkit-appearance:none;background:transparent}
-.steprow input[type=range]::-webkit-slider-runnable-track{height:3px;background:var(--ink-4);border-radius:2px}
-.steprow input[type=range]::-webkit-slider-thumb{-webkit-appearance:none;width:12px;height:12px;border-radius:50%;background:var(--accent);margin-top:-4px;cursor:pointer}
-.steprow .stepval{display:inline-block;width:18px;text-align:right;color:var(--ink);font-variant-numeric:tabular-nums}
-.invrow{font-family:var(--mono);font-size:10px;color:var(--ink-3);text-align:center;letter-spacing:1px;text-transform:uppercase;margin-top:6px;display:flex;align-items:center;justify-content:center;gap:8px}
-.invrow .toggle{position:relative;width:32px;height:18px;background:var(--ink-4);border-radius:9px;cursor:pointer;transition:background .2s;border:1px solid var(--ink-4)}
-.invrow .toggle.on{background:var(--accent);border-color:var(--accent)}
-.invrow .toggle::after{content:'';position:absolute;top:2px;left:2px;width:12px;height:12px;background:var(--ink-3);border-radius:50%;transition:all .2s}
-.invrow .toggle.on::after{left:16px;background:#fff}
-.dev:hover{color:var(--accent)}
-.dev .dot{display:inline-block;width:6px;height:6px;border-radius:50%;background:var(--accent);margin-right:8px;vertical-align:middle;box-shadow:0 0 8px var(--accent)}
-.col-narrow{max-width:480px;margin:0 auto}
-.col-wide{max-width:980px;margin:24px auto 0}
-.card{background:var(--surface);border:1px solid var(--ink-4);border-radius:12px;padding:18px;margin:14px 0;position:relative}
-.gauge-wrap{display:flex;justify-content:center;align-items:center;padding:14px 0 6px}
-.gauge{position:relative;width:188px;height:188px;cursor:ns-resize;touch-action:none}
-.gauge svg{width:100%;height:100%}
-.gauge .track{fill:none;stroke:var(--rail);stroke-width:8;stroke-linecap:round}
-.gauge .fill{fill:none;stroke:var(--accent);stroke-width:8;stroke-linecap:round;transition:stroke-dashoffset .15s ease-out,stroke .2s;filter:drop-shadow(0 0 6px var(--accent-soft))}
-.gauge .center{position:absolute;inset:0;display:flex;flex-direction:column;justify-content:center;align-items:center}
-.gauge .num{font-family:var(--serif);font-size:64px;font-weight:300;color:var(--ink);letter-spacing:-3px;line-height:1;font-variant-numeric:tabular-nums;transition:color .2s;font-feature-settings:"ss01"}
-.gauge .num.mut{color:#a55}
-.gauge .label{font-family:var(--mono);font-size:9px;font-weight:500;color:var(--ink-3);margin-top:6px;letter-spacing:3px;text-transform:uppercase}
-.modepill{font-family:var(--mono);display:inline-flex;align-items:center;gap:6px;padding:5px 11px;border-radius:2px;font-size:10px;font-weight:600;letter-spacing:2px;text-transform:uppercase;background:transparent;color:var(--ink-3);border:1px solid var(--ink-4);margin-top:10px;transition:all .25s}
-.modepill .mp-dot{width:5px;height:5px;border-radius:50%;background:var(--ink-3)}
-.modepill.bass{color:var(--accent);border-color:var(--accent)}
-.modepill.bass .mp-dot{background:var(--accent);animation:pulseSlow 1s infinite}
-.modepill.treble{color:var(--accent-2);border-color:var(--accent-2)}
-.modepill.treble .mp-dot{background:var(--accent-2);animation:pulseFast .33s infinite}
-@keyframes pulseSlow{50%{opacity:.25;transform:scale(.7)}}
-@keyframes pulseFast{50%{opacity:.25;transform:scale(.7)}}
-.meta{text-align:center;margin-top:6px}
-.spkname{font-family:var(--serif);font-size:18px;font-weight:500;color:var(--ink);letter-spacing:-.2px}
-.badges{margin-top:8px;display:flex;justify-content:center;gap:6px}
-.badges span{font-family:var(--mono);padding:3px 8px;border-radius:2px;font-size:9px;font-weight:600;letter-spacing:1.5px;text-transform:uppercase}
-.on{background:transparent;color:#7aa97a;border:1px solid #2c4a2c}
-.off{background:transparent;color:var(--ink-3);border:1px solid var(--ink-4)}
-.mut{background:transparent;color:#a55;border:1px solid #4a2828}
-.spk{cursor:pointer;border:1px solid var(--ink-4);transition:all .15s;display:flex;justify-content:space-between;align-items:center}
-.spk:hover{border-color:var(--accent);background:#15101a}
-.spk.act{border-color:var(--accent);background:var(--accent-soft)}
-.spk.act::before{content:'';display:inline-block;width:4px;height:24px;background:var(--accent);margin-right:12px;border-radius:2px}
-.sn{font-family:var(--serif);font-size:15px;font-weight:500;letter-spacing:-.2px}
-.si{font-family:var(--mono);color:var(--ink-3);font-size:11px}
-.np{display:flex;align-items:center;gap:16px}
-.np img{width:72px;height:72px;border-radius:4px;background:#0a0a0a;object-fit:cover;flex-shrink:0;border:1px solid var(--ink-4)}
-.np .noart{width:72px;height:72px;border-radius:4px;background:#0a0a0a;flex-shrink:0;display:flex;align-items:center;justify-content:center;color:var(--ink-4);font-size:28px;border:1px solid var(--ink-4)}
-.np .info{min-width:0;flex:1}
-.np .t{font-family:var(--serif);font-size:17px;font-weight:500;color:var(--ink);white-space:nowrap;overflow:hidden;text-overflow:ellipsis;letter-spacing:-.3px}
-.np .a{font-size:13px;color:var(--ink-2);white-space:nowrap;overflow:hidden;text-overflow:ellipsis;margin-top:2px}
-.np .al{font-size:11px;color:var(--ink-3);white-space:nowrap;overflow:hidden;text-overflow:ellipsis;margin-top:1px;font-style:italic}
-.np .time{font-family:var(--mono);font-size:10px;color:var(--ink-3);margin-top:6px;letter-spacing:1px}
-.transport{display:flex;justify-content:center;gap:18px;padding:8px 0 4px}
-.tbtn{background:transparent;border:1px solid var(--ink-4);color:var(--ink-2);width:46px;height:46px;border-radius:50%;cursor:pointer;display:flex;align-items:center;justify-content:center;transition:all .15s;user-select:none}
-.tbtn:hover{border-color:var(--accent);color:var(--ink);background:rgba(123,45,45,.08)}
-.tbtn:active{transform:scale(.92)}
-.tbtn svg{width:18px;height:18px;fill:currentColor}
-.tbtn.play{background:var(--accent);border-color:var(--accent);color:#fff;width:56px;height:56px;box-shadow:0 4px 16px rgba(123,45,45,.3)}
-.tbtn.play:hover{background:var(--accent-2);border-color:var(--accent-2)}
-.tbtn.play svg{width:22px;height:22px}
-.tbtn.muted{color:#c66;border-color:#c66}
-.scan{font-family:var(--mono);font-size:11px;color:var(--ink-3);text-align:center;padding:8px;letter-spacing:.5px}
-.btns{display:flex;gap:10px;flex-wrap:wrap}
-.btn{flex:1;background:transparent;border:1px solid var(--ink-4);color:var(--ink-2);padding:9px 0;border-radius:4px;cursor:pointer;font:500 12px var(--mono);text-align:center;transition:all .15s;letter-spacing:1.5px;text-transform:uppercase}
-.btn:hover{border-color:var(--accent);color:var(--ink)}
-.log{background:#06060a;border:1px solid var(--ink-4);border-radius:6px;padding:12px 14px;margin-top:14px;font:11px/1.65 var(--mono);color:var(--ink-3);max-height:180px;overflow-y:auto;white-space:pre-wrap;scroll-behavior:smooth;letter-spacing:.3px}
-.log::-webkit-scrollbar{width:6px}
-.log::-webkit-scrollbar-thumb{background:var(--ink-4);border-radius:3px}
-details.section{background:var(--surface);border:1px solid var(--ink-4);border-radius:8px;margin:14px 0;overflow:hidden}
-details.section>summary{padding:14px 18px;cursor:pointer;font-family:var(--serif);font-size:14px;font-weight:500;color:var(--ink);letter-spacing:-.1px;list-style:none;display:flex;justify-content:space-between;align-items:center;transition:background .15s}
-details.section>summary>span{font-family:var(--mono);font-size:10px;font-weight:400;letter-spacing:1.5px;text-transform:uppercase;color:var(--ink-3)}
-details.section>summary::-webkit-details-marker{display:none}
-details.section>summary::after{content:'+';color:var(--ink-3);font-size:18px;font-weight:300;transition:transform .25s;font-family:var(--mono)}
-details.section[open]>summary::after{transform:rotate(45deg)}
-details.section>summary:hover{background:#16161e}
-.section-body{padding:4px 18px 20px;border-top:1px solid var(--ink-4)}
-
-/* Side-by-side workspace */
-.workspace{display:grid;grid-template-columns:1fr 1px 1fr;gap:0;background:var(--surface);border:1px solid var(--ink-4);border-radius:8px;overflow:hidden}
-.workspace .rail{background:repeating-linear-gradient(to bottom, var(--ink-4) 0 4px, transparent 4px 12px)}
-.ws-col{padding:18px 20px;min-width:0}
-.ws-head{display:flex;align-items:baseline;justify-content:space-between;padding-bottom:14px;border-bottom:1px solid var(--ink-4);margin-bottom:14px}
-.ws-head h3{font-family:var(--serif);font-size:15px;font-weight:500;letter-spacing:-.2px;color:var(--ink)}
-.ws-head .sub{font-family:var(--mono);font-size:9px;letter-spacing:2px;text-transform:uppercase;color:var(--ink-3)}
-@media(max-width:760px){
-  .workspace{grid-template-columns:1fr;grid-template-rows:auto auto auto}
-  .workspace .rail{height:1px;background:var(--ink-4)}
-}
-
-/* Filter chips for action library */
-.filter-chips{display:flex;flex-wrap:wrap;gap:5px;margin-bottom:14px}
-.chip{font-family:var(--mono);font-size:10px;font-weight:500;letter-spacing:1px;text-transform:uppercase;padding:5px 10px;border:1px solid var(--ink-4);border-radius:2px;color:var(--ink-3);cursor:pointer;transition:all .12s;background:transparent}
-.chip:hover{color:var(--ink-2);border-color:var(--ink-3)}
-.chip.active{color:var(--ink);border-color:var(--accent);background:var(--accent-soft)}
-
-/* Action pills — single column for narrow workspace cells */
-.actions-list{display:flex;flex-direction:column;gap:6px;max-height:520px;overflow-y:auto;padding-right:4px}
-.actions-list::-webkit-scrollbar{width:4px}
-.actions-list::-webkit-scrollbar-thumb{background:var(--ink-4);border-radius:2px}
-.action-pill{background:#0e0e14;border:1px solid var(--ink-4);color:var(--ink-2);padding:9px 12px;border-radius:4px;font-size:12px;cursor:grab;user-select:none;display:flex;align-items:center;gap:10px;transition:all .15s;position:relative}
-.action-pill .alabel{flex:1;min-width:0;overflow:hidden;text-overflow:ellipsis;white-space:nowrap;font-weight:400;color:var(--ink)}
-.action-pill .acat{font-family:var(--mono);font-size:9px;color:var(--ink-3);letter-spacing:1px;text-transform:uppercase;flex-shrink:0}
-.action-pill:hover{border-color:var(--accent);background:#13101a;color:var(--ink)}
-.action-pill:hover .acat{color:var(--accent)}
-.action-pill:active{cursor:grabbing}
-.action-pill.dragging{opacity:.35;transform:scale(.97)}
-.action-pill .try{border:1px solid var(--ink-4);color:var(--ink-3);width:22px;height:22px;border-radius:50%;display:inline-flex;align-items:center;justify-content:center;font-size:9px;cursor:pointer;transition:all .15s;flex-shrink:0}
-.action-pill .try:hover{background:var(--accent);color:#fff;border-color:var(--accent)}
-.action-pill input{width:48px;background:#06060a;border:1px solid var(--ink-4);color:var(--ink);border-radius:2px;font-size:11px;padding:2px 4px;text-align:center;font-family:var(--mono)}
-
-/* Gesture rows */
-.gesture-list{display:flex;flex-direction:column;gap:8px}
-.gesture-row{display:grid;grid-template-columns:78px 1fr auto;align-items:center;gap:10px;padding:6px 0}
-.gesture-row .gname{font-family:var(--mono);font-size:11px;color:var(--ink-2);font-weight:500;letter-spacing:.5px;border-right:1px solid var(--ink-4);padding-right:10px;line-height:1.2}
-.gesture-row .gname small{display:block;font-size:9px;color:var(--ink-3);margin-top:2px;letter-spacing:.3px}
-.gesture-row .test{background:transparent;border:1px solid var(--ink-4);color:var(--ink-3);padding:5px 10px;border-radius:2px;cursor:pointer;font-family:var(--mono);font-size:9px;letter-spacing:1.5px;text-transform:uppercase;flex-shrink:0;transition:all .15s}
-.gesture-row .test:hover{background:var(--accent);color:#fff;border-color:var(--accent)}
-.gesture-row .test:active{transform:scale(.95)}
-.gesture-slot{min-height:38px;background:#06060a;border:1px dashed var(--ink-4);border-radius:4px;padding:5px 8px;display:flex;align-items:center;gap:6px;transition:all .15s}
-.gesture-slot.drop-over{border-color:var(--accent);background:var(--accent-soft);border-style:solid}
-.gesture-slot .assigned{background:var(--accent-soft);border:1px solid var(--accent);color:var(--ink);padding:4px 10px;border-radius:2px;font-size:11px;display:inline-flex;align-items:center;gap:8px;font-weight:400}
-.gesture-slot .assigned.def{background:transparent;border-color:var(--ink-4);color:var(--ink-3);border-style:dashed}
-.gesture-slot .assigned .x{cursor:pointer;color:var(--ink-3);font-size:14px;line-height:1;padding-left:4px;border-left:1px solid var(--ink-4)}
-.gesture-slot .assigned .x:hover{color:var(--accent)}
-.gesture-slot .assigned input{width:48px;background:#06060a;border:1px solid var(--ink-4);color:var(--ink);border-radius:2px;font-size:11px;padding:2px 4px;text-align:center;font-family:var(--mono)}
-.gesture-slot .empty-hint{font-family:var(--mono);font-size:10px;color:var(--ink-4);letter-spacing:1px;text-transform:uppercase;margin:0 auto}
-.sound-row{display:flex;align-items:center;gap:14px;padding:14px 0}
-.sound-row:not(:last-child){border-bottom:1px solid var(--ink-4)}
-.sound-row .slabel{font-family:var(--serif);font-size:14px;font-weight:500;color:var(--ink);width:90px;flex-shrink:0;letter-spacing:-.2px}
-.sound-row .sval{font-family:var(--mono);font-size:14px;color:var(--accent);font-weight:600;width:42px;text-align:right;flex-shrink:0;font-variant-numeric:tabular-nums;letter-spacing:.5px}
-.sound-row input[type=range]{flex:1;-webkit-appearance:none;background:transparent;height:24px;cursor:pointer}
-.sound-row input[type=range]::-webkit-slider-runnable-track{height:2px;background:var(--ink-4);border-radius:1px}
-.sound-row input[type=range]::-webkit-slider-thumb{-webkit-appearance:none;width:14px;height:14px;background:var(--accent);border-radius:50%;margin-top:-6px;cursor:pointer;border:none;box-shadow:0 0 0 4px var(--surface), 0 2px 6px rgba(123,45,45,.4)}
-.sound-row input[type=range]::-moz-range-track{height:2px;background:var(--ink-4);border-radius:1px}
-.sound-row input[type=range]::-moz-range-thumb{width:14px;height:14px;background:var(--accent);border-radius:50%;cursor:pointer;border:none;box-shadow:0 0 0 4px var(--surface), 0 2px 6px rgba(123,45,45,.4)}
-.sound-row .sw{position:relative;width:38px;height:22px;background:var(--rail);border-radius:11px;cursor:pointer;flex-shrink:0;transition:background .2s;border:1px solid var(--ink-4)}
-.sound-row .sw.on{background:var(--accent);border-color:var(--accent)}
-.sound-row .sw::after{content:'';position:absolute;top:2px;left:2px;width:16px;height:16px;background:var(--ink-3);border-radius:50%;transition:all .2s}
-.sound-row .sw.on::after{left:18px;background:#fff}
-</style></head><body>
-<header class='masthead'>
-<div class='logo'><img src='/logo.png' alt='TPS Audio'></div>
-<div class='eyebrow'>Sonos · Ethernet · Edition</div>
-<div class='room' id='room'><span class='actdot' id='actdot' title='Lights up when this board sees a knob turn or click'></span><span class='roomtxt' id='roomtxt'>···</span><span class='roomhost' id='roomhost'></span></div>
-<div class='dev' id='dev' onclick='rename()' title='Click to rename'></div>
-<div id='fwline' style="font-family:var(--mono);font-size:11px;color:var(--ink);text-align:center;letter-spacing:1.5px;margin-top:8px;text-transform:uppercase"></div>
-<div class='steprow' title='How much the volume changes per encoder detent'>
-  <span>Vol/detent</span>
-  <input type='range' min='1' max='10' step='1' id='stepsld' oninput='onStepInput(this.value)' onchange='onStepCommit(this.value)'>
-  <span class='stepval' id='stepval'>—</span>
-</div>
-<div class='invrow' title='Flip knob direction if rotation feels backwards on this board'>
-  <span>Invert rotation</span>
-  <div class='toggle' id='invtgl' onclick='toggleInv()'></div>
-</div>
-</header>
-<div class='col-narrow'>
-<div class='card'>
-<div class='gauge-wrap'>
-<div class='gauge' id='gauge' title='Click and drag up/down to change volume — also scrolls'>
-<svg viewBox='0 0 120 120'>
-<path class='track' d='M42.9 107A50 50 0 1 1 77.1 107'/>
-<path class='fill' id='arc' d='M42.9 107A50 50 0 1 1 77.1 107' stroke-dasharray='279.3' stroke-dashoffset='279.3'/>
-</svg>
-<div class='center'>
-<div class='num' id='vol'>--</div>
-<div class='label' id='vlbl'>volume</div>
-</div>
-</div>
-</div>
-<div class='transport'>
-<div class='tbtn' onclick='cmd("prev")' title='Previous'><svg viewBox='0 0 24 24'><path d='M6 6h2v12H6zm3.5 6l8.5 6V6z'/></svg></div>
-<div class='tbtn play' onclick='cmd("play")' title='Play/Pause' id='btnplay'><svg viewBox='0 0 24 24'><path d='M8 5v14l11-7z'/></svg></div>
-<div class='tbtn' onclick='cmd("next")' title='Next'><svg viewBox='0 0 24 24'><path d='M6 18l8.5-6L6 6v12zM16 6v12h2V6h-2z'/></svg></div>
-<div class='tbtn' onclick='cmd("mute")' title='Mute' id='btnmute'><svg viewBox='0 0 24 24'><path d='M3 9v6h4l5 5V4L7 9H3zm13.5 3c0-1.77-1.02-3.29-2.5-4.03v8.05c1.48-.73 2.5-2.25 2.5-4.02z'/></svg></div>
-</div>
-<div class='meta'>
-<div class='spkname' id='spkn'>—</div>
-<div class='badges' id='badges'></div>
-<div id='modepill' class='modepill' style='display:none'></div>
-</div>
-</div>
-<div class='card' id='npcard' style='display:none'><div class='np'>
-<div id='npart'></div>
-<div class='info'>
-<div class='t' id='npt'></div>
-<div class='a' id='npa'></div>
-<div class='al' id='npal'></div>
-<div class='time' id='nptime'></div>
-</div>
-</div></div>
-<div class='scan' id='scan'></div>
-<div id='list'></div>
-<div class='card btns'>
-<div class='btn' onclick='disc()'>Discover</div>
-<div class='btn' onclick='location.reload()'>Refresh</div>
-</div>
-<details class='section' open>
-<summary>Sound Shape <span>bass · treble · loudness</span></summary>
-<div class='section-body'>
-<div class='sound-row'>
-<div class='slabel'>Bass</div>
-<input type='range' id='slBass' min='-10' max='10' step='1' value='0' oninput='setBass(this.value)'>
-<div class='sval' id='vBass'>0</div>
-</div>
-<div class='sound-row'>
-<div class='slabel'>Treble</div>
-<input type='range' id='slTreble' min='-10' max='10' step='1' value='0' oninput='setTreble(this.value)'>
-<div class='sval' id='vTreble'>0</div>
-</div>
-<div class='sound-row'>
-<div class='slabel'>Loudness</div>
-<div style='flex:1'></div>
-<div class='sw' id='swLoud' onclick='toggleLoud()'></div>
-</div>
-</div>
-</details>
-</div><!-- /col-narrow -->
-<div class='col-wide'>
-<div class='workspace'>
-<section class='ws-col'>
-<div class='ws-head'><h3>Gestures</h3><span class='sub'>Input · Bindings</span></div>
-<div class='gesture-list' id='gestureBody'></div>
-</section>
-<div class='rail'></div>
-<section class='ws-col'>
-<div class='ws-head'><h3>Actions</h3><span class='sub'>Library · Drag or Try</span></div>
-<div class='filter-chips' id='filterChips'></div>
-<div class='actions-list' id='actionsBody'></div>
-</section>
-</div>
-</div>
-<div class='col-narrow'>
-<div class='log' id='log'></div>
-</div>
-<script>
-const ARC=279.3;
-let lastVol=-1,lastLog='';
-
-function setGauge(vol,muted){
-  let arc=document.getElementById('arc');
-  arc.style.strokeDashoffset=ARC-(vol/100*ARC);
-  arc.style.stroke=muted?'#a55':vol>80?'#c44':vol>50?'#7B2D2D':'#4a3535';
-  let num=document.getElementById('vol');
-  num.textContent=vol;
-  num.className='num'+(muted?' mut':'');
-  document.getElementById('vlbl').textContent=muted?'muted':'volume';
-}
-
-function poll(){
-  fetch('/api/status').then(r=>r.json()).then(d=>{
-    if(dragY===null){setGauge(d.vol,d.mut);lastVol=d.vol;}
-    document.getElementById('btnplay').innerHTML=d.play?
-      "<svg viewBox='0 0 24 24'><path d='M6 4h4v16H6zm8 0h4v16h-4z'/></svg>":
-      "<svg viewBox='0 0 24 24'><path d='M8 5v14l11-7z'/></svg>";
-    let mb=document.getElementById('btnmute');
-    mb.classList.toggle('muted',d.mut);
-    // Mode pill
-    let mp=document.getElementById('modepill');
-    if(d.mode && d.mode!=='volume'){
-      mp.style.display='inline-flex';
-      mp.className='modepill '+d.mode;
-      mp.innerHTML="<span class='mp-dot'></span>"+d.mode+" · "+(d.modeVal>=0?'+'+d.modeVal:d.modeVal);
-    }else{
-      mp.style.display='none';
-    }
-    // Sound sliders (don't fight the user while they drag)
-    if(!soundDragging){
-      let sb=document.getElementById('slBass'),vb=document.getElementById('vBass');
-      if(sb && document.activeElement!==sb){sb.value=d.bass;vb.textContent=d.bass>0?'+'+d.bass:d.bass;}
-      let st=document.getElementById('slTreble'),vt=document.getElementById('vTreble');
-      if(st && document.activeElement!==st){st.value=d.treble;vt.textContent=d.treble>0?'+'+d.treble:d.treble;}
-    }
-    document.getElementById('spkn').textContent=d.spk||'No speaker';
-    let rm=document.getElementById('room'),rt=document.getElementById('roomtxt'),rh=document.getElementById('roomhost'),ad=document.getElementById('actdot');
-    if(d.roomSlug && d.roomSlug.length>0){
-      rm.className='room';
-      rt.textContent=(d.roomLabel && d.roomLabel.length>0)?d.roomLabel:d.roomSlug;
-    } else {
-      rm.className='room unassigned';
-      rt.textContent='Unassigned';
-    }
-    rh.textContent=d.host+'.local';
-    // Activity dot — green pulse when the user just touched this knob.
-    // sinceAct=-1 means no activity ever since boot. We keep the dot lit for
-    // a full 1200ms from the event itself so it survives between 1Hz polls.
-    if(typeof d.sinceAct==='number' && d.sinceAct>=0 && d.sinceAct<1200){
-      ad.classList.add('live');
-      if(window._actTimer)clearTimeout(window._actTimer);
-      window._actTimer=setTimeout(()=>ad.classList.remove('live'),1200-d.sinceAct);
-    }
-    document.getElementById('dev').innerHTML="<span class='dot'></span>"+(d.dev||d.host);
-    let it=document.getElementById('invtgl');
-    if(it){ if(d.inv) it.classList.add('on'); else it.classList.remove('on'); }
-    let sld=document.getElementById('stepsld'),sv=document.getElementById('stepval');
-    if(sld && typeof d.step==='number' && !stepDragging){
-      sld.value=d.step;
-      sv.textContent=d.step;
-    }
-    // Gesture-fired flash. Dedup by (gid + event-timestamp) so we only fire
-    // the animation once per actual gesture, not on every status poll.
-    if(d.firedGid && d.firedSince>=0){
-      let eventStamp=Math.round((d.up*1000) - d.firedSince);
-      let key=d.firedGid+':'+eventStamp;
-      if(key!==window._lastFlashKey){
-        window._lastFlashKey=key;
-        let slot=document.querySelector('.gesture-slot[data-gid="'+d.firedGid+'"]');
-        let row=slot ? slot.closest('.gesture-row') : null;
-        if(row){
-          row.classList.remove('flash-ok','flash-fail');
-          // Force a reflow so the animation re-runs even when same class re-applied.
-          void row.offsetWidth;
-          row.classList.add(d.firedOk?'flash-ok':'flash-fail');
-        }
-      }
-    }
-    let fw=document.getElementById('fwline');
-    if(fw){
-      let extra='';
-      if(d.updStatus && d.updStatus!=='idle' && d.updStatus!=='up_to_date'){
-        extra=' · '+d.updStatus;
-      } else if(d.updLatest && d.updLatest!==d.fwver){
-        extra=' · update available: '+d.updLatest;
-      }
-      fw.innerHTML='FW '+d.fwver+extra+' · <a href="#" onclick="checkUpdate();return false" style="color:inherit;text-decoration:underline">check now</a>';
-    }
-    let b='';
-    b+=d.play?"<span class='on'>Playing</span>":"<span class='off'>Paused</span>";
-    if(d.mut)b+="<span class='mut'>Muted</span>";
-    document.getElementById('badges').innerHTML=b;
-    let nc=document.getElementById('npcard');
-    if(d.title){
-      nc.style.display='block';
-      document.getElementById('npt').textContent=d.title;
-      document.getElementById('npa').textContent=d.artist||'';
-      document.getElementById('npal').textContent=d.album||'';
-      document.getElementById('nptime').textContent=(d.elapsed||'')+' / '+(d.dur||'');
-      let artEl=document.getElementById('npart');
-      if(d.art){
-        if(!artEl.querySelector('img')||artEl.querySelector('img').src!==d.art)
-          artEl.innerHTML="<img src='"+d.art+"' alt=''>";
-      }else{
-        artEl.innerHTML="<div class='noart'>&#9835;</div>";
-      }
-    }else{nc.style.display='none';}
-  }).catch(()=>{});
+// The dashboard lives in webui/index.html; webui/build_webui.py minifies and
+// gzips it into webui_index.h. Every browser since 2000 takes gzip, so the
+// bytes go out as stored, and a repeat load whose ETag still matches is a
+// bare 304.
+static void serveRoot(AsyncWebServerRequest* req) {
+  AsyncWebServerResponse* res;
+  if (req->header("If-None-Match") == WEBUI_INDEX_ETAG) {
+    res = req->beginResponse(304);
+  } else {
+    res = req->beginResponse(200, "text/html; charset=utf-8", WEBUI_INDEX_GZ, WEBUI_INDEX_GZ_LEN);
+    res->addHeader("Content-Encoding", "gzip");
+  }
+  res->addHeader("ETag", WEBUI_INDEX_ETAG);
+  res->addHeader("Cache-Control", "no-cache");  // always revalidate — cheap now
+  req->send(res);
 }
 
-function pollLog(){
-  fetch('/api/log').then(r=>r.text()).then(t=>{
-    if(t!==lastLog){
-      lastLog=t;
-      let el=document.getElementById('log');
-      el.textContent=t;
-      el.scrollTop=el.scrollHeight;
-    }
-  }).catch(()=>{});
+// Raw PNG bytes from logo.h (generated from webui/logo.png). The page asks
+// for /logo.png?v=<hash>, so the response can be cached forever — a changed
+// logo is a changed URL. One send straight out of mapped flash.
+static void serveLogo(AsyncWebServerRequest* req) {
+  AsyncWebServerResponse* res = req->header("If-None-Match") == LOGO_ETAG
+    ? req->beginResponse(304)
+    : req->beginResponse(200, "image/png", LOGO_PNG, LOGO_PNG_LEN);
+  res->addHeader("ETag", LOGO_ETAG);
+  res->addHeader("Cache-Control", "public, max-age=31536000, immutable");
+  req->send(res);
 }
 
-function pollSlow(){
-  fetch('/api/speakers').then(r=>r.json()).then(d=>{
-    let h='';
-    d.list.forEach(s=>{
-      let a=s.name===d.cur?' act':'';
-      h+="<div class='card spk"+a+"' onclick='sel(\""+s.ip+"\",\""+s.name+"\")'><div class='sn'>"+s.name+"</div><div class='si'>"+s.ip+"</div></div>";
+// GET /api/fw.bin — the image this board is running, for LAN peers doing an
+// update (updater.h). Read straight from the running partition on the
+// network task, a TCP window at a time; `Range: bytes=N-` gets a 206 from
+// N, so a peer's stalled copy resumes the same way a GitHub download does.
+static void serveFirmware(AsyncWebServerRequest* req) {
+  const char* sha = runningImageSha();   // computed in initWebUI
+  const esp_partition_t* part = esp_ota_get_running_partition();
+  size_t len = ESP.getSketchSize();
+  if (!sha[0] || !part || !len) {
+    req->send(503, "text/plain", "image not available");
+    return;
+  }
+  unsigned long from = 0;
+  const String& range = req->header("Range");
+  if (range.length() && (sscanf(range.c_str(), "bytes=%lu-", &from) != 1 || from >= len)) {
+    req->send(416, "text/plain", "bad range");
+    return;
+  }
+  AsyncWebServerResponse* res = req->beginResponse("application/octet-stream", len - from,
+    [part, from, len](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      size_t k = min(maxLen, len - from - index);
+      return esp_partition_read(part, from + index, buf, k) == ESP_OK ? k : 0;
     });
-    document.getElementById('list').innerHTML=h;
-  }).catch(()=>{});
-  fetch('/api/scan').then(r=>r.json()).then(d=>{
-    document.getElementById('scan').textContent=d.active?d.msg:'';
-  }).catch(()=>{});
-}
-
-function sel(ip,nm){fetch('/api/select?ip='+ip+'&name='+encodeURIComponent(nm)).then(()=>{poll();pollSlow();});}
-function disc(){fetch('/api/discover');setTimeout(()=>{pollSlow();},4000);}
-function rename(){let n=prompt('Name this controller:');if(n)fetch('/api/name?name='+encodeURIComponent(n)).then(poll);}
-function toggleInv(){
-  let cur=document.getElementById('invtgl').classList.contains('on');
-  fetch('/api/setinvert?v='+(cur?'0':'1')).then(poll);
-}
-function checkUpdate(){fetch('/api/checkupdate').then(()=>setTimeout(poll,800));}
-let stepDragging=false;
-function onStepInput(v){
-  document.getElementById('stepval').textContent=v;
-  stepDragging=true;
-}
-function onStepCommit(v){
-  fetch('/api/setstep?v='+v).then(()=>{stepDragging=false;poll();});
-}
-
-// --- Volume + transport controls ---
-function cmd(action){fetch('/api/'+action).then(()=>setTimeout(poll,200));}
-
-// Throttled absolute volume send (used by drag + wheel)
-let volTimer=null;
-function sendVol(v){
-  if(volTimer)clearTimeout(volTimer);
-  volTimer=setTimeout(()=>{fetch('/api/vol?v='+v).then(()=>poll());},80);
-}
-
-// Scroll wheel on gauge — instant feedback, throttled send
-let g=document.getElementById('gauge');
-g.addEventListener('wheel',e=>{
-  e.preventDefault();
-  let step=e.deltaY<0?2:-2;
-  let v=Math.max(0,Math.min(100,(lastVol||0)+step));
-  setGauge(v,false);lastVol=v;
-  sendVol(v);
-},{passive:false});
-
-// Click-and-drag on gauge: vertical drag = volume (Logic-style)
-let dragY=null,dragStartVol=0;
-function gStart(y){dragY=y;dragStartVol=lastVol||0;}
-function gMove(y){
-  if(dragY===null)return;
-  let dy=dragY-y;
-  // 2px per volume unit — comfortable, predictable
-  let target=Math.max(0,Math.min(100,dragStartVol+Math.round(dy/2)));
-  if(target!==lastVol){
-    setGauge(target,false);
-    lastVol=target;
-    sendVol(target);  // continuous throttled send while dragging
+  if (from) {
+    res->setCode(206);
+    res->addHeader("Content-Range", String("bytes ") + from + "-" + (len - 1) + "/" + len);
   }
+  res->addHeader("Accept-Ranges", "bytes");
+  res->addHeader("X-Fw-Version", FW_VERSION);
+  res->addHeader("X-Fw-Sha256", sha);
+  req->send(res);
 }
-function gEnd(){
-  if(dragY===null)return;
-  dragY=null;
-  // Final commit to be sure
-  fetch('/api/vol?v='+lastVol).then(()=>poll());
-}
-g.addEventListener('mousedown',e=>{e.preventDefault();gStart(e.clientY);});
-window.addEventListener('mousemove',e=>gMove(e.clientY));
-window.addEventListener('mouseup',gEnd);
-g.addEventListener('touchstart',e=>{e.preventDefault();gStart(e.touches[0].clientY);},{passive:false});
-g.addEventListener('touchmove',e=>{e.preventDefault();gMove(e.touches[0].clientY);},{passive:false});
-g.addEventListener('touchend',gEnd);
-
-// --- Gesture mappings + action library ---
-let allActions=[];
-let gestureMappings={};
-const GESTURES=[
-  {id:'1c',   label:'1 click'},
-  {id:'2c',   label:'2 clicks'},
-  {id:'3c',   label:'3 clicks'},
-  {id:'4c',   label:'4 clicks'},
-  {id:'5c',   label:'5 clicks'},
-  {id:'1c+h', label:'click + hold'},
-  {id:'2c+h', label:'2c + hold'},
-  {id:'3c+h', label:'3c + hold'},
-  {id:'4c+h', label:'4c + hold'},
-  {id:'hold', label:'hold (700ms)'},
-  {id:'lh',   label:'long hold (2s)'},
-];
-
-function loadActions(){
-  return fetch('/api/actions').then(r=>r.json()).then(a=>{allActions=a;renderFilters();renderActions();});
-}
-function loadMappings(){
-  return fetch('/api/mappings').then(r=>r.json()).then(m=>{gestureMappings=m;renderGestures();});
-}
-
-function actionLabel(id){let a=allActions.find(x=>x.id===id);return a?a.label:id;}
-function actionHint(id){let a=allActions.find(x=>x.id===id);return a?a.hint:'';}
-
-const CAT_LABELS={playback:'Playback',volume:'Volume',knob:'Knob',eq:'EQ',speaker:'Speaker',playmode:'Mode',sleep:'Sleep'};
-const CAT_ORDER=['playback','volume','knob','eq','speaker','playmode','sleep'];
-let activeFilter='all';
-
-function renderFilters(){
-  let cats=new Set(allActions.map(a=>a.cat));
-  let h="<div class='chip"+(activeFilter==='all'?' active':'')+"' onclick='setFilter(\"all\")'>All</div>";
-  CAT_ORDER.forEach(c=>{
-    if(!cats.has(c))return;
-    h+="<div class='chip"+(activeFilter===c?' active':'')+"' onclick='setFilter(\""+c+"\")'>"+CAT_LABELS[c]+"</div>";
-  });
-  document.getElementById('filterChips').innerHTML=h;
-}
-function setFilter(c){activeFilter=c;renderFilters();renderActions();}
-
-function renderActions(){
-  let h='';
-  let list=activeFilter==='all'?allActions:allActions.filter(a=>a.cat===activeFilter);
-  list.forEach(a=>{
-    let p=a.hint?"<input type='text' placeholder='"+a.hint+"' onclick='event.stopPropagation()' onmousedown='event.stopPropagation()'>":"";
-    h+="<div class='action-pill' draggable='true' data-id='"+a.id+"' ondragstart='dragStart(event,\""+a.id+"\")' ondragend='dragEnd(event)' onclick='tryAction(event,this,\""+a.id+"\")'>"
-      +"<span class='alabel'>"+a.label+"</span>"+p
-      +"<span class='acat'>"+(CAT_LABELS[a.cat]||a.cat)+"</span>"
-      +"<span class='try' title='Try'>▶</span>"
-      +"</div>";
-  });
-  document.getElementById('actionsBody').innerHTML=h;
-}
-
-function tryAction(ev,el,id){
-  if(ev.target.tagName==='INPUT')return;
-  ev.stopPropagation();
-  let inp=el.querySelector('input');
-  let p=inp?inp.value:'';
-  fetch('/api/action?id='+id+'&p='+encodeURIComponent(p)).then(()=>setTimeout(poll,200));
-}
-
-function renderGestures(){
-  let h='';
-  GESTURES.forEach(g=>{
-    let m=gestureMappings[g.id]||{};
-    // Split label into ID + descriptor for two-line gname
-    let parts=g.label.split(' (');
-    let mainLabel=parts[0];
-    let subLabel=parts[1]?parts[1].replace(')',''):'';
-    h+="<div class='gesture-row'>";
-    h+="<div class='gname'>"+mainLabel+(subLabel?"<small>"+subLabel+"</small>":'')+"</div>";
-    h+="<div class='gesture-slot' data-gid='"+g.id+"' ondragover='dragOver(event)' ondragleave='dragLeave(event)' ondrop='drop(event,\""+g.id+"\")'>";
-    if(m.action){
-      let cls='assigned'+(m.default?' def':'');
-      let pi=actionHint(m.action)?
-        "<input type='text' value='"+(m.param||'')+"' placeholder='"+actionHint(m.action)+"' onchange='setMap(\""+g.id+"\",\""+m.action+"\",this.value)'>":'';
-      h+="<div class='"+cls+"'>"+actionLabel(m.action)+pi
-        +"<span class='x' onclick='clearMap(\""+g.id+"\")' title='Reset to default'>×</span></div>";
-    }else{
-      h+="<span class='empty-hint'>drop action here</span>";
-    }
-    h+="</div>";
-    h+="<button class='test' onclick='testGesture(\""+g.id+"\")'>Test</button>";
-    h+="</div>";
-  });
-  document.getElementById('gestureBody').innerHTML=h;
-}
-
-function testGesture(gid){
-  fetch('/api/gesture?g='+encodeURIComponent(gid)).then(()=>setTimeout(poll,200));
-}
-
-// --- Sound shape sliders ---
-let soundDragging=false,soundTimer=null;
-function setBass(v){
-  document.getElementById('vBass').textContent=v>0?'+'+v:v;
-  soundDragging=true;
-  if(soundTimer)clearTimeout(soundTimer);
-  soundTimer=setTimeout(()=>{
-    fetch('/api/bass?v='+v).then(()=>{soundDragging=false;poll();});
-  },120);
-}
-function setTreble(v){
-  document.getElementById('vTreble').textContent=v>0?'+'+v:v;
-  soundDragging=true;
-  if(soundTimer)clearTimeout(soundTimer);
-  soundTimer=setTimeout(()=>{
-    fetch('/api/treble?v='+v).then(()=>{soundDragging=false;poll();});
-  },120);
-}
-let loudState=false;
-function toggleLoud(){
-  loudState=!loudState;
-  document.getElementById('swLoud').classList.toggle('on',loudState);
-  fetch('/api/loudness?v='+(loudState?1:0));
-}
-function refreshSound(){
-  fetch('/api/sound').then(r=>r.json()).then(d=>{
-    let sb=document.getElementById('slBass');if(sb){sb.value=d.bass;document.getElementById('vBass').textContent=d.bass>0?'+'+d.bass:d.bass;}
-    let st=document.getElementById('slTreble');if(st){st.value=d.treble;document.getElementById('vTreble').textContent=d.treble>0?'+'+d.treble:d.treble;}
-    loudState=!!d.loudness;
-    document.getElementById('swLoud').classList.toggle('on',loudState);
-  }).catch(()=>{});
-}
-
-let draggingId=null;
-function dragStart(e,id){draggingId=id;e.dataTransfer.effectAllowed='copy';e.target.classList.add('dragging');}
-function dragEnd(e){e.target.classList.remove('dragging');document.querySelectorAll('.gesture-slot').forEach(s=>s.classList.remove('drop-over'));}
-function dragOver(e){e.preventDefault();e.currentTarget.classList.add('drop-over');}
-function dragLeave(e){e.currentTarget.classList.remove('drop-over');}
-function drop(e,gid){
-  e.preventDefault();
-  e.currentTarget.classList.remove('drop-over');
-  if(!draggingId)return;
-  setMap(gid,draggingId,'');
-}
-function setMap(gid,aid,p){
-  fetch('/api/setmap?g='+gid+'&a='+aid+'&p='+encodeURIComponent(p||'')).then(()=>loadMappings());
-}
-function clearMap(gid){
-  fetch('/api/setmap?g='+gid+'&a=default').then(()=>loadMappings());
-}
-
-loadActions().then(loadMappings);
-refreshSound();
-
-poll();pollLog();pollSlow();
-setInterval(poll,1000);
-setInterval(pollLog,2000);
-setInterval(pollSlow,10000);
-</script></body></html>)rawliteral";
-  web.send_P(200, "text/html", HTML);
-}
-
-static void serveLogo() {
-  // Decode base64 to binary PNG and serve with cache headers
-  // For simplicity, serve as base64 data URI redirect — browser caches the PNG
-  web.sendHeader("Cache-Control", "public, max-age=86400");
-  web.sendHeader("Content-Type", "image/png");
-
-  // Decode base64 in chunks
-  static const char b64chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-  auto b64val = [](char c) -> uint8_t {
-    if (c >= 'A' && c <= 'Z') return c - 'A';
-    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
-    if (c >= '0' && c <= '9') return c - '0' + 52;
-    if (c == '+') return 62;
-    if (c == '/') return 63;
-    return 0;
-  };
-
-  // Calculate decoded size
-  size_t b64len = LOGO_B64_LEN;
-  size_t pad = 0;
-  if (b64len > 0 && pgm_read_byte(&LOGO_B64[b64len-1]) == '=') pad++;
-  if (b64len > 1 && pgm_read_byte(&LOGO_B64[b64len-2]) == '=') pad++;
-  size_t decoded_len = (b64len / 4) * 3 - pad;
-
-  web.setContentLength(decoded_len);
-  web.send(200, "image/png", "");
-
-  // Stream decode
-  uint8_t out[3];
-  for (size_t i = 0; i < b64len; i += 4) {
-    uint8_t a = b64val(pgm_read_byte(&LOGO_B64[i]));
-    uint8_t b = b64val(pgm_read_byte(&LOGO_B64[i+1]));
-    uint8_t c = b64val(pgm_read_byte(&LOGO_B64[i+2]));
-    uint8_t d = b64val(pgm_read_byte(&LOGO_B64[i+3]));
-    out[0] = (a << 2) | (b >> 4);
-    out[1] = (b << 4) | (c >> 2);
-    out[2] = (c << 6) | d;
-    size_t remaining = decoded_len - ((i/4)*3);
-    size_t n = (remaining >= 3) ? 3 : remaining;
-    web.client().write(out, n);
+
+// JSON response written through a small stack buffer into the server's
+// response stream — the stream is the only allocation, and the server
+// needs it anyway.
+struct JsonReply {
+  AsyncWebServerRequest* req;
+  AsyncResponseStream*   stream;
+  char       buf[256];
+  JsonWriter w;
+  explicit JsonReply(AsyncWebServerRequest* r)
+    : req(r), stream(r->beginResponseStream("application/json")), w(buf, sizeof(buf), stream) {}
+  void send(int code = 200) {
+    w.flush();
+    stream->setCode(code);
+    req->send(stream);
   }
+};
+
+static void sendOk(AsyncWebServerRequest* req, bool ok) {
+  req->send(200, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
 }
 
-static String jsonEscape(const String& s) {
-  String out;
-  out.reserve(s.length() + 8);
-  for (unsigned int i = 0; i < s.length(); i++) {
-    char c = s[i];
-    if (c == '"') out += "\\\"";
-    else if (c == '\\') out += "\\\\";
-    else out += c;
-  }
-  return out;
-}
-
-static void serveApiStatus() {
-  String json;
-  json.reserve(640);
-  json = "{\"vol\":"; json += spk.volume;
-  json += ",\"mut\":"; json += spk.muted ? "true" : "false";
-  json += ",\"play\":"; json += spk.playing ? "true" : "false";
-  json += ",\"spk\":\""; json += jsonEscape(spk.name);
-  json += "\",\"dev\":\""; json += jsonEscape(deviceName);
-  json += "\",\"host\":\""; json += deviceHostname;
-  // Room assignment — slug + human label so the UI can render the right banner
-  // and tell at a glance whether this board has been assigned yet.
-  {
-    String slug = loadRoomSlug();
-    json += "\",\"roomSlug\":\""; json += jsonEscape(slug);
-    json += "\",\"roomLabel\":\""; json += jsonEscape(slug.length() ? String(labelForSlug(slug.c_str())) : String(""));
+// ── Status JSON, in change groups ─────────────────────────────────────────
+// /api/status?since= and /api/events send only the groups whose version is
+// newer than what the client has. Each writer adds its members to an object
+// the caller has already opened. Groups are split by how often they change:
+// transport ticks every refresh while playing, track only between songs,
+// device almost never.
+
+// Volume, transport and the EQ cache the sliders mirror.
+static void writeStatusTransport(JsonWriter& w) {
+  w.kv("vol", spk.volume)
+   .kv("mut", spk.muted)
+   .kv("play", spk.playing)
+   .kv("elapsed", spk.elapsed)
+   .kv("bass", modeBassCache)
+   .kv("treble", modeTrebleCache);
+}
+
+// `art` is the speaker's own URL; `artId` names the same image behind
+// /api/art?h=<artId>, which is what the page loads.
+static void writeStatusTrack(JsonWriter& w) {
+  char artId[9] = "";
+  if (spk.artURL.length())
+    snprintf(artId, sizeof(artId), "%08lx", (unsigned long)artUrlHash(spk.artURL));
+  w.kv("spk", spk.name)
+   .kv("title", spk.title)
+   .kv("artist", spk.artist)
+   .kv("album", spk.album)
+   .kv("art", spk.artURL)
+   .kv("artId", (const char*)artId)
+   .kv("dur", spk.duration);
+}
+
+static void writeStatusMode(JsonWriter& w) {
+  w.kv("mode", modeName(currentMode))
+   .kv("modeVal", currentModeValue());
+}
+
+static void writeStatusDevice(JsonWriter& w) {
+  IPAddress a = ETH.localIP();
+  char ip[16];
+  snprintf(ip, sizeof(ip), "%u.%u.%u.%u", a[0], a[1], a[2], a[3]);
+  w.kv("dev", deviceName)
+   .kv("host", (const char*)deviceHostname)
+   // Room assignment — slug + human label so the UI can render the right banner
+   // and tell at a glance whether this board has been assigned yet.
+   .kv("roomSlug", roomSlug)
+   .kv("roomLabel", roomSlug.length() ? labelForSlug(roomSlug.c_str()) : "")
+   .kv("ip", (const char*)ip)
+   .kv("inv", encoderInvert)
+   .kv("step", volumeStep)
+   // Firmware version + OTA updater state.
+   .kv("fwver", FW_VERSION)
+   .kv("updStatus", updaterState.status)
+   .kv("updLatest", updaterState.latestVer)
+   .kv("updError", updaterState.lastError);
+}
+
+// ms since last physical knob interaction — UI uses this to light an
+// "I am the one you're touching" indicator. -1 means no activity ever yet.
+static void writeStatusActivity(JsonWriter& w) {
+  unsigned long actMs = lastActivityMs;
+  w.kv("sinceAct", actMs == 0 ? -1L : (long)(millis() - actMs));
+}
+
+// Last-fired gesture for UI flash — only report if it happened in the last
+// 2s, otherwise null so the UI doesn't re-flash stale events on every poll.
+// `up` rides along: the UI dedups flashes by (gid, up*1000 - firedSince).
+static void writeStatusFired(JsonWriter& w) {
+  w.kv("up", millis() / 1000);
+  unsigned long since = millis() - lastFiredMs;
+  if (lastFiredMs > 0 && since < 2000) {
+    w.kv("firedGid", lastFiredGid).kv("firedOk", lastFiredOk).kv("firedSince", since);
+  } else {
+    w.kv("firedGid", "").kv("firedOk", false).kv("firedSince", -1);
   }
-  json += "\",\"ip\":\""; json += ETH.localIP().toString();
-  json += "\",\"title\":\""; json += jsonEscape(spk.title);
-  json += "\",\"artist\":\""; json += jsonEscape(spk.artist);
-  json += "\",\"album\":\""; json += jsonEscape(spk.album);
-  json += "\",\"art\":\""; json += jsonEscape(spk.artURL);
-  json += "\",\"dur\":\""; json += spk.duration;
-  json += "\",\"elapsed\":\""; json += spk.elapsed;
-  json += "\",\"mode\":\""; json += modeName(currentMode);
-  json += "\",\"modeVal\":"; json += currentModeValue();
-  json += ",\"bass\":"; json += modeBassCache;
-  json += ",\"treble\":"; json += modeTrebleCache;
-  json += ",\"up\":"; json += millis() / 1000;
-  // ms since last physical knob interaction — UI uses this to light an
-  // "I am the one you're touching" indicator. -1 means no activity ever yet.
-  {
-    unsigned long actMs = lastActivityMs;
-    long since = actMs == 0 ? -1 : (long)(millis() - actMs);
-    json += ",\"sinceAct\":"; json += since;
+}
+
+// ── Status versions ──────────────────────────────────────────────────────
+// One counter for the whole status, stamped onto a group whenever one of its
+// inputs is seen to change. A client that remembers the "v" of its last reply
+// asks for ?since=v and gets only groups stamped after it — or a bodyless
+// 304 when there are none, which is the usual case between songs: a dozen
+// int/String compares and no JSON at all.
+//
+// The counter starts from a random base each boot, so a tab polling across
+// a reboot sends a `since` outside (base, now] and gets the full document
+// instead of a delta against state the board no longer has.
+enum StatusGroup : uint8_t {
+  SG_TRANSPORT, SG_TRACK, SG_MODE, SG_DEVICE, SG_ACTIVITY, SG_FIRED, SG_COUNT
+};
+
+typedef void (*StatusWriter)(JsonWriter&);
+static const StatusWriter STATUS_WRITERS[SG_COUNT] = {
+  writeStatusTransport, writeStatusTrack, writeStatusMode,
+  writeStatusDevice, writeStatusActivity, writeStatusFired,
+};
+
+static uint32_t statusBase = 0;
+static uint32_t statusVersion = 0;
+static uint32_t statusGroupVer[SG_COUNT];
+
+// Last values seen, per group. Only what the writers print from state that
+// can change; derived fields (roomLabel, sinceAct) follow their inputs.
+static struct {
+  int vol = -1; bool mut = false, play = false;
+  String elapsed; int bass = 0, treble = 0;
+  String name, title, artist, album, art, dur;
+  EncoderMode mode = MODE_VOLUME; int modeVal = 0;
+  String dev, room, updStatus, updLatest, updError;
+  uint32_t ip = 0; bool inv = false; int step = 0;
+  unsigned long actMs = 0, firedMs = 0;
+} statusShadow;
+
+template <typename T>
+static bool shadowChanged(T& shadow, const T& now) {
+  if (shadow == now) return false;
+  shadow = now;
+  return true;
+}
+
+static void initStatusVersions() {
+  statusBase = statusVersion = esp_random() & 0x3FFFFFFF;
+  for (auto& v : statusGroupVer) v = ++statusVersion;
+}
+
+// Compare the shadow against live state and stamp changed groups. Cheap
+// enough to run per poll and per SSE tick; both hold the state lock.
+static void statusTrack() {
+  auto& sh = statusShadow;
+  bool ch[SG_COUNT] = {};
+  ch[SG_TRANSPORT] |= shadowChanged(sh.vol, spk.volume);
+  ch[SG_TRANSPORT] |= shadowChanged(sh.mut, spk.muted);
+  ch[SG_TRANSPORT] |= shadowChanged(sh.play, spk.playing);
+  ch[SG_TRANSPORT] |= shadowChanged(sh.elapsed, spk.elapsed);
+  ch[SG_TRANSPORT] |= shadowChanged(sh.bass, modeBassCache);
+  ch[SG_TRANSPORT] |= shadowChanged(sh.treble, modeTrebleCache);
+  ch[SG_TRACK]     |= shadowChanged(sh.name, spk.name);
+  ch[SG_TRACK]     |= shadowChanged(sh.title, spk.title);
+  ch[SG_TRACK]     |= shadowChanged(sh.artist, spk.artist);
+  ch[SG_TRACK]     |= shadowChanged(sh.album, spk.album);
+  ch[SG_TRACK]     |= shadowChanged(sh.art, spk.artURL);
+  ch[SG_TRACK]     |= shadowChanged(sh.dur, spk.duration);
+  ch[SG_MODE]      |= shadowChanged(sh.mode, currentMode);
+  ch[SG_MODE]      |= shadowChanged(sh.modeVal, currentModeValue());
+  ch[SG_DEVICE]    |= shadowChanged(sh.dev, deviceName);
+  ch[SG_DEVICE]    |= shadowChanged(sh.room, roomSlug);
+  ch[SG_DEVICE]    |= shadowChanged(sh.ip, (uint32_t)ETH.localIP());
+  ch[SG_DEVICE]    |= shadowChanged(sh.inv, encoderInvert);
+  ch[SG_DEVICE]    |= shadowChanged(sh.step, volumeStep);
+  ch[SG_DEVICE]    |= shadowChanged(sh.updStatus, updaterState.status);
+  ch[SG_DEVICE]    |= shadowChanged(sh.updLatest, updaterState.latestVer);
+  ch[SG_DEVICE]    |= shadowChanged(sh.updError, updaterState.lastError);
+  ch[SG_ACTIVITY]  |= shadowChanged(sh.actMs, (unsigned long)lastActivityMs);
+  ch[SG_FIRED]     |= shadowChanged(sh.firedMs, lastFiredMs);
+  for (int g = 0; g < SG_COUNT; g++)
+    if (ch[g]) statusGroupVer[g] = ++statusVersion;
+}
+
+// Does `since` come from this boot's counter (and not from the future)?
+static bool statusSinceValid(uint32_t since) {
+  return since - statusBase <= statusVersion - statusBase;  // base ≤ since ≤ now, wrap-safe
+}
+
+// Groups stamped after `since`, plus the version to ask with next time.
+// since == 0 (or from another boot) → everything.
+static void writeStatusSince(JsonWriter& w, uint32_t since) {
+  bool all = !statusSinceValid(since);
+  w.beginObject().kv("v", statusVersion);
+  for (int g = 0; g < SG_COUNT; g++)
+    if (all || statusGroupVer[g] > since) STATUS_WRITERS[g](w);
+  w.endObject();
+}
+
+static void writeStatus(JsonWriter& w) { writeStatusSince(w, 0); }
+
+// ── Status snapshot ──────────────────────────────────────────────────────
+// The status document, rendered once per change instead of once per request.
+// loop() (or the web-jobs task) writes into the back buffer and publishes it by swapping
+// statusLive. /api/status is then answered on the network task by copying
+// the live buffer out: O(bytes), no queue hop and no JSON, however many tabs
+// are polling. Each buffer has a seqlock generation that is odd while it is
+// being written. A reader that raced two publishes just copies again.
+//
+// A snapshot holds the full document and the delta from the previous one —
+// what a tab polling ?since=<previous v> wants. Any other `since` gets the
+// full document, which is always a valid answer.
+//
+// The clock fields (up, sinceAct, firedSince) age with time, not state, so a
+// snapshot also expires: after a second, or after one publish tick while an
+// activity dot or gesture flash is showing. Publishing stops once nobody has
+// read for STATUS_IDLE_MS. The first request after that finds a stale
+// snapshot and takes the slow path through the web-jobs task, which wakes
+// it up.
+static constexpr size_t        STATUS_SNAP_MAX   = 1536;
+static constexpr unsigned long STATUS_PUBLISH_MS = 100;
+static constexpr unsigned long STATUS_SNAP_AGE   = 1000;
+static constexpr unsigned long STATUS_SNAP_STALE = 2000;
+static constexpr unsigned long STATUS_IDLE_MS    = 10000;
+
+struct StatusSnap {
+  std::atomic<uint32_t> gen{0};
+  uint32_t      version = 0;
+  uint32_t      since = 0;          // delta[] is relative to this version
+  unsigned long builtMs = 0;
+  size_t        fullLen = 0, deltaLen = 0;
+  char          full[STATUS_SNAP_MAX];
+  char          delta[STATUS_SNAP_MAX];
+};
+static StatusSnap statusSnaps[2];
+static std::atomic<StatusSnap*>    statusLive{nullptr};
+static std::atomic<unsigned long>  statusReadMs{0};   // last read, any task
+static unsigned long               statusLastPublish = 0;
+
+// Clock fields on screen right now? Then a snapshot only lives one tick.
+static unsigned long statusSnapMaxAge(unsigned long now) {
+  bool dot   = lastActivityMs && now - lastActivityMs < 1200;
+  bool flash = lastFiredMs && now - lastFiredMs < 2000;
+  return dot || flash ? STATUS_PUBLISH_MS : STATUS_SNAP_AGE;
+}
+
+// Under the state lock. Re-renders when the version moved or the clock fields aged.
+static void statusPublish() {
+  statusTrack();
+  unsigned long now = millis();
+  StatusSnap* live = statusLive.load(std::memory_order_acquire);
+  if (live && live->version == statusVersion && now - live->builtMs < statusSnapMaxAge(now))
+    return;
+  StatusSnap* back = live == &statusSnaps[0] ? &statusSnaps[1] : &statusSnaps[0];
+  uint32_t since = !live ? 0 : live->version == statusVersion ? live->since : live->version;
+
+  back->gen.fetch_add(1, std::memory_order_relaxed);      // odd: writing
+  std::atomic_thread_fence(std::memory_order_release);
+  JsonWriter full(back->full, sizeof(back->full));
+  writeStatus(full);
+  JsonWriter delta(back->delta, sizeof(back->delta));
+  writeStatusSince(delta, since);
+  back->fullLen  = full.length();
+  back->deltaLen = delta.length();
+  back->version  = statusVersion;
+  back->since    = since;
+  back->builtMs  = now;
+  back->gen.fetch_add(1, std::memory_order_release);      // even: stable
+  if (full.overflow() || delta.overflow()) {
+    dbg("status: snapshot over %u B, not published", (unsigned)STATUS_SNAP_MAX);
+    return;
   }
-  json += ",\"inv\":"; json += encoderInvert ? "true" : "false";
-  json += ",\"step\":"; json += volumeStep;
-  // Firmware version + OTA updater state.
-  json += ",\"fwver\":\""; json += FW_VERSION; json += "\"";
-  json += ",\"updStatus\":\""; json += jsonEscape(updaterState.status); json += "\"";
-  json += ",\"updLatest\":\""; json += jsonEscape(updaterState.latestVer); json += "\"";
-  json += ",\"updError\":\""; json += jsonEscape(updaterState.lastError); json += "\"";
-  // Last-fired gesture for UI flash — only report if it happened in the last
-  // 2s, otherwise null so the UI doesn't re-flash stale events on every poll.
-  {
-    unsigned long since = millis() - lastFiredMs;
-    if (lastFiredMs > 0 && since < 2000) {
-      json += ",\"firedGid\":\""; json += jsonEscape(lastFiredGid); json += "\"";
-      json += ",\"firedOk\":"; json += lastFiredOk ? "true" : "false";
-      json += ",\"firedSince\":"; json += since;
+  statusLive.store(back, std::memory_order_release);
+}
+
+// webTick(): keep the snapshot current while someone is reading it.
+static void statusPublishTick(bool sseClients) {
+  unsigned long now = millis();
+  if (now - statusLastPublish < STATUS_PUBLISH_MS) return;
+  statusLastPublish = now;
+  if (!sseClients && now - statusReadMs.load(std::memory_order_relaxed) >= STATUS_IDLE_MS) return;
+  statusPublish();
+}
+
+// Any task. The body answering `since` (304 → len 0) copied into `out`,
+// or false if there's no fresh snapshot.
+static bool statusSnapRead(bool hasSince, uint32_t since, char* out, size_t& len) {
+  statusReadMs.store(millis(), std::memory_order_relaxed);
+  for (int tries = 0; tries < 3; tries++) {
+    StatusSnap* s = statusLive.load(std::memory_order_acquire);
+    if (!s) return false;
+    uint32_t g = s->gen.load(std::memory_order_acquire);
+    if (g & 1) continue;
+    if (millis() - s->builtMs >= STATUS_SNAP_STALE) return false;
+    if (hasSince && since == s->version) {
+      len = 0;
     } else {
-      json += ",\"firedGid\":\"\",\"firedOk\":false,\"firedSince\":-1";
+      bool d = hasSince && since == s->since;
+      len = min(d ? s->deltaLen : s->fullLen, STATUS_SNAP_MAX - 1);
+      memcpy(out, d ? s->delta : s->full, len);
     }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (s->gen.load(std::memory_order_relaxed) != g) continue;
+    out[len] = '\0';
+    return true;
+  }
+  return false;
+}
+
+// GET /api/status[?since=v] — slow path, on the web-jobs task. Exact delta from live
+// state; also republishes the snapshot so the next request is fast.
+static void serveApiStatus(AsyncWebServerRequest* req) {
+  statusPublish();
+  uint32_t since = req->hasArg("since") ? strtoul(req->arg("since").c_str(), nullptr, 10) : 0;
+  if (since == statusVersion && statusSinceValid(since)) {
+    req->send(304);
+    return;
   }
-  json += "}";
-  web.send(200, "application/json", json);
+  JsonReply out(req);
+  writeStatusSince(out.w, since);
+  out.send();
 }
 
 // Set bass/treble/loudness directly from the web UI (sliders)
-static void serveApiBass() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v"); return; }
-  if (!spk.connected()) { web.send(503, "text/plain", "no speaker"); return; }
-  int v = constrain(web.arg("v").toInt(), -10, 10);
+static void serveApiBass(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  if (!spk.connected()) { req->send(503, "text/plain", "no speaker"); return; }
+  int v = constrain(req->arg("v").toInt(), -10, 10);
   ctrl.ip = spk.ip;
   ctrl.setBass(v);
   modeBassCache = v;
   logEvent("bass -> %d (web)", v);
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiTreble() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v"); return; }
-  if (!spk.connected()) { web.send(503, "text/plain", "no speaker"); return; }
-  int v = constrain(web.arg("v").toInt(), -10, 10);
+static void serveApiTreble(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  if (!spk.connected()) { req->send(503, "text/plain", "no speaker"); return; }
+  int v = constrain(req->arg("v").toInt(), -10, 10);
   ctrl.ip = spk.ip;
   ctrl.setTreble(v);
   modeTrebleCache = v;
   logEvent("treble -> %d (web)", v);
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiLoudness() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v"); return; }
-  if (!spk.connected()) { web.send(503, "text/plain", "no speaker"); return; }
-  bool on = web.arg("v") == "1" || web.arg("v") == "true";
+static void serveApiLoudness(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  if (!spk.connected()) { req->send(503, "text/plain", "no speaker"); return; }
+  bool on = req->arg("v") == "1" || req->arg("v") == "true";
   ctrl.ip = spk.ip;
   ctrl.setLoudness(on);
   logEvent("loudness -> %s (web)", on ? "on" : "off");
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
 // Refresh bass/treble cache from speaker (called when sliders card is opened)
-static void serveApiSoundRefresh() {
-  if (!spk.connected()) { web.send(503, "text/plain", "no speaker"); return; }
+static void serveApiSoundRefresh(AsyncWebServerRequest* req) {
+  if (!spk.connected()) { req->send(503, "text/plain", "no speaker"); return; }
   ctrl.ip = spk.ip;
   modeBassCache = ctrl.getBass();
   modeTrebleCache = ctrl.getTreble();
   bool loud = ctrl.getLoudness();
-  String r = "{\"bass\":"; r += modeBassCache;
-  r += ",\"treble\":"; r += modeTrebleCache;
-  r += ",\"loudness\":"; r += loud ? "true" : "false";
-  r += "}";
-  web.send(200, "application/json", r);
+  JsonReply out(req);
+  out.w.beginObject()
+       .kv("bass", modeBassCache)
+       .kv("treble", modeTrebleCache)
+       .kv("loudness", loud)
+       .endObject();
+  out.send();
 }
 
 // Fire a gesture from the web UI (Test button)
-static void serveApiGesture() {
-  if (!web.hasArg("g")) { web.send(400, "text/plain", "missing g"); return; }
-  String g = web.arg("g");
-  bool ok = runGesture(g.c_str());
-  String r = "{\"ok\":";
-  r += ok ? "true" : "false";
-  r += "}";
-  web.send(200, "application/json", r);
-}
-
-static void serveApiSpeakers() {
-  String json;
-  json.reserve(128 + speakers.size() * 64);
-  json = "{\"cur\":\"";
-  json += spk.name;
-  json += "\",\"list\":[";
-  for (size_t i = 0; i < speakers.size(); i++) {
-    if (i) json += ',';
-    json += "{\"name\":\"";
-    json += speakers[i].name;
-    json += "\",\"ip\":\"";
-    json += speakers[i].ip;
-    json += "\"}";
+static void serveApiGesture(AsyncWebServerRequest* req) {
+  if (!req->hasArg("g")) { req->send(400, "text/plain", "missing g"); return; }
+  String g = req->arg("g");
+  sendOk(req, runGesture(g.c_str()));
+}
+
+static void writeSpeakers(JsonWriter& w) {
+  w.beginObject().kv("cur", spk.name).key("list").beginArray();
+  for (auto& s : speakers) {
+    w.beginObject()
+     .kv("name", s.name)
+     .kv("ip", s.ip)
+     .kv("uuid", s.uuid)
+     .kv("coord", s.coordinator)
+     .endObject();
   }
-  json += "]}";
-  web.send(200, "application/json", json);
+  w.endArray().endObject();
+}
+
+static void serveApiSpeakers(AsyncWebServerRequest* req) {
+  JsonReply out(req);
+  writeSpeakers(out.w);
+  out.send();
 }
 
-static void serveApiSelect() {
-  if (!web.hasArg("ip")) { web.send(400, "text/plain", "missing ip"); return; }
-  String ip = web.arg("ip");
+static void serveApiSelect(AsyncWebServerRequest* req) {
+  if (!req->hasArg("ip")) { req->send(400, "text/plain", "missing ip"); return; }
+  String ip = req->arg("ip");
   for (size_t i = 0; i < speakers.size(); i++) {
     if (speakers[i].ip == ip) {
       selectSpeaker(i);
       logEvent("selected: %s", speakers[i].name.c_str());
-      web.send(200, "application/json", "{\"ok\":true}");
+      req->send(200, "application/json", "{\"ok\":true}");
       return;
     }
   }
-  web.send(404, "text/plain", "not found");
+  req->send(404, "text/plain", "not found");
 }
 
-static void serveApiDiscover() {
+static void serveApiDiscover(AsyncWebServerRequest* req) {
   scanRequested = true;
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiReset() {
+static void serveApiReset(AsyncWebServerRequest* req) {
   Preferences p;
   p.begin("sonos", false);
+  p.remove("uuid");
   p.remove("ip");
   p.remove("name");
   p.end();
   spk = SpeakerState();
   speakers.clear();
+  speakersVersion++;
   logEvent("speaker assignment cleared");
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
+}
+
+static void writeScan(JsonWriter& w) {
+  w.beginObject()
+   .kv("active", scanActive)
+   .kv("msg", scanMsg)
+   .kv("found", (unsigned)speakers.size())
+   .endObject();
 }
 
-static void serveApiScan() {
-  char buf[128];
-  snprintf(buf, sizeof(buf), "{\"active\":%s,\"msg\":\"%s\",\"found\":%d}",
-    scanActive ? "true" : "false", scanMsg.c_str(), (int)speakers.size());
-  web.send(200, "application/json", buf);
+static void serveApiScan(AsyncWebServerRequest* req) {
+  JsonReply out(req);
+  writeScan(out.w);
+  out.send();
 }
 
-static void serveApiName() {
-  if (!web.hasArg("name")) { web.send(400, "text/plain", "missing name"); return; }
-  deviceName = web.arg("name");
+static void serveApiName(AsyncWebServerRequest* req) {
+  if (!req->hasArg("name")) { req->send(400, "text/plain", "missing name"); return; }
+  deviceName = req->arg("name");
   Preferences p;
   p.begin("sonos", false);
   p.putString("devname", deviceName);
   p.end();
   logEvent("renamed: %s", deviceName.c_str());
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
 // --- Room assignment (drives mDNS hostname) ---
-static void serveApiRooms() {
-  String slug = loadRoomSlug();
-  String json;
-  json.reserve(64 + ROOMS_COUNT * 64);
-  json = "{\"current\":\"";
-  json += slug;
-  json += "\",\"hostname\":\"";
-  json += deviceHostname;
-  json += "\",\"rooms\":[";
-  for (size_t i = 0; i < ROOMS_COUNT; i++) {
-    if (i) json += ',';
-    json += "{\"slug\":\"";
-    json += ROOMS[i].slug;
-    json += "\",\"label\":\"";
-    json += ROOMS[i].label;
-    json += "\"}";
-  }
-  json += "]}";
-  web.send(200, "application/json", json);
+static void serveApiRooms(AsyncWebServerRequest* req) {
+  JsonReply out(req);
+  out.w.beginObject()
+       .kv("current", roomSlug)
+       .kv("hostname", (const char*)deviceHostname)
+       .key("rooms").beginArray();
+  for (size_t i = 0; i < ROOMS_COUNT; i++)
+    out.w.beginObject().kv("slug", ROOMS[i].slug).kv("label", ROOMS[i].label).endObject();
+  out.w.endArray().endObject();
+  out.send();
+}
+
+// Restart from loop() once the reply has had time to flush. The handlers
+// below run on the web-jobs task holding the state lock, so they must not
+// sleep there: every other /api/* request would queue behind them.
+static unsigned long restartAt = 0;   // 0: none pending
+
+static void restartSoon() {
+  restartAt = millis() + 250;
+  if (!restartAt) restartAt = 1;
 }
 
 // Atomically set prefix + slug in one shot. Replaces the older two-call dance
 // of /api/setprefix → reboot → /api/setroom → reboot. Single restart at the end.
-static void serveApiSetup() {
-  String prefix = web.hasArg("prefix") ? web.arg("prefix") : String("");
-  String slug   = web.hasArg("slug")   ? web.arg("slug")   : String("");
+static void serveApiSetup(AsyncWebServerRequest* req) {
+  String prefix = req->hasArg("prefix") ? req->arg("prefix") : String("");
+  String slug   = req->hasArg("slug")   ? req->arg("slug")   : String("");
   if (prefix.length() > 0 && !isValidRoomSlug(prefix)) {
-    web.send(400, "text/plain", "invalid prefix");
+    req->send(400, "text/plain", "invalid prefix");
     return;
   }
   if (slug.length() > 0 && !isValidRoomSlug(slug)) {
-    web.send(400, "text/plain", "invalid slug");
+    req->send(400, "text/plain", "invalid slug");
     return;
   }
   if (!saveHostPrefix(prefix) || !saveRoomSlug(slug)) {
-    web.send(500, "text/plain", "NVS write failed");
+    req->send(500, "text/plain", "NVS write failed");
     return;
   }
   logEvent("setup prefix='%s' slug='%s' — restarting",
     prefix.length() ? prefix.c_str() : "(default)",
     slug.length() ? slug.c_str() : "(cleared)");
-  web.send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
-  delay(250);
-  ESP.restart();
+  req->send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
+  restartSoon();
 }
 
-static void serveApiSetPrefix() {
-  String prefix = web.hasArg("p") ? web.arg("p") : (web.hasArg("prefix") ? web.arg("prefix") : String(""));
+static void serveApiSetPrefix(AsyncWebServerRequest* req) {
+  String prefix = req->hasArg("p") ? req->arg("p") : (req->hasArg("prefix") ? req->arg("prefix") : String(""));
   if (prefix.length() > 0 && !isValidRoomSlug(prefix)) {
-    web.send(400, "text/plain", "invalid prefix");
+    req->send(400, "text/plain", "invalid prefix");
     return;
   }
   if (!saveHostPrefix(prefix)) {
-    web.send(500, "text/plain", "NVS write failed");
+    req->send(500, "text/plain", "NVS write failed");
     return;
   }
   logEvent("prefix set to '%s' — restarting", prefix.length() ? prefix.c_str() : "(default)");
-  web.send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
-  delay(250);
-  ESP.restart();
+  req->send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
+  restartSoon();
 }
 
-static void serveApiSetRoom() {
-  String slug = web.hasArg("slug") ? web.arg("slug") : String("");
+static void serveApiSetRoom(AsyncWebServerRequest* req) {
+  String slug = req->hasArg("slug") ? req->arg("slug") : String("");
   // Empty slug = clear assignment (board returns to sonos-p4-XXXX fallback).
   if (slug.length() > 0 && !isValidRoomSlug(slug)) {
-    web.send(400, "text/plain", "invalid slug — lowercase letters/digits/hyphens, ≤16 chars");
+    req->send(400, "text/plain", "invalid slug — lowercase letters/digits/hyphens, ≤16 chars");
     return;
   }
   if (!saveRoomSlug(slug)) {
-    web.send(500, "text/plain", "NVS write failed");
+    req->send(500, "text/plain", "NVS write failed");
     return;
   }
   logEvent("room set to '%s' — restarting", slug.length() ? slug.c_str() : "(cleared)");
-  web.send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
-  delay(250);  // give the response time to flush
-  ESP.restart();
+  req->send(200, "application/json", "{\"ok\":true,\"restarting\":true}");
+  restartSoon();
 }
 
-static void serveApiRestart() {
+static void serveApiRestart(AsyncWebServerRequest* req) {
   logEvent("restart requested via API");
-  web.send(200, "application/json", "{\"ok\":true}");
-  delay(250);
-  ESP.restart();
+  req->send(200, "application/json", "{\"ok\":true}");
+  restartSoon();
 }
 
 // Manual update trigger. ?force=1 will apply even if manifest version is the
 // same as ours (useful for re-flashing or rolling back via a hand-edited manifest).
-static void serveApiCheckUpdate() {
-  bool force = web.hasArg("force") && web.arg("force") == "1";
-  web.send(200, "application/json", "{\"ok\":true,\"checking\":true}");
-  // checkForUpdate may reboot on success — flush before calling.
-  delay(100);
-  checkForUpdate(force);
+// Answers at once; the next updaterTick() on loop() runs the check, so a
+// download never holds this task, and the reply is out long before any reboot.
+static void serveApiCheckUpdate(AsyncWebServerRequest* req) {
+  updateRequested = true;
+  if (req->hasArg("force") && req->arg("force") == "1") updateForce = true;
+  req->send(200, "application/json", "{\"ok\":true,\"checking\":true}");
 }
 
 // Set volume step (1..10). Persisted to NVS, takes effect immediately.
-static void serveApiSetStep() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v"); return; }
-  int v = web.arg("v").toInt();
+static void serveApiSetStep(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  int v = req->arg("v").toInt();
   if (v < 1) v = 1;
   if (v > 10) v = 10;
   volumeStep = v;
   saveVolumeStep(v);
   logEvent("volume step = %d", v);
-  web.send(200, "application/json", String("{\"ok\":true,\"step\":") + v + "}");
+  JsonReply out(req);
+  out.w.beginObject().kv("ok", true).kv("step", v).endObject();
+  out.send();
 }
 
 // Toggle/set rotation inversion. Persisted to NVS, takes effect immediately
 // — no reboot needed since processEncoder() reads `encoderInvert` every tick.
-static void serveApiSetInvert() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v=0|1"); return; }
-  String v = web.arg("v");
+static void serveApiSetInvert(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v=0|1"); return; }
+  String v = req->arg("v");
   bool inv = (v == "1" || v == "true" || v == "on");
   encoderInvert = inv;
   saveEncoderInvert(inv);
   logEvent("encoder invert = %d", inv ? 1 : 0);
-  web.send(200, "application/json", String("{\"ok\":true,\"inv\":") + (inv ? "true" : "false") + "}");
+  JsonReply out(req);
+  out.w.beginObject().kv("ok", true).kv("inv", inv).endObject();
+  out.send();
 }
 
 // --- Action registry + gesture mappings ---
-static void serveApiActions() {
-  String json;
-  json.reserve(64 + ACTIONS_COUNT * 96);
-  json = "[";
+static void serveApiActions(AsyncWebServerRequest* req) {
+  JsonReply out(req);
+  out.w.beginArray();
   for (size_t i = 0; i < ACTIONS_COUNT; i++) {
-    if (i) json += ',';
-    json += "{\"id\":\"";  json += ACTIONS[i].id;
-    json += "\",\"label\":\""; json += ACTIONS[i].label;
-    json += "\",\"cat\":\"";   json += ACTIONS[i].category;
-    json += "\",\"hint\":\"";  json += ACTIONS[i].paramHint;
-    json += "\"}";
+    out.w.beginObject()
+         .kv("id", ACTIONS[i].id)
+         .kv("label", ACTIONS[i].label)
+         .kv("cat", ACTIONS[i].category)
+         .kv("hint", ACTIONS[i].paramHint)
+         .endObject();
   }
-  json += "]";
-  web.send(200, "application/json", json);
+  out.w.endArray();
+  out.send();
 }
 
-static void serveApiAction() {
-  String id = web.hasArg("id") ? web.arg("id") : "";
-  String param = web.hasArg("p") ? web.arg("p") : "";
-  if (id.length() == 0) { web.send(400, "text/plain", "missing id"); return; }
+static void serveApiAction(AsyncWebServerRequest* req) {
+  String id = req->hasArg("id") ? req->arg("id") : "";
+  String param = req->hasArg("p") ? req->arg("p") : "";
+  if (id.length() == 0) { req->send(400, "text/plain", "missing id"); return; }
   bool ok = runAction(id, param);
   logEvent("action: %s%s%s -> %s", id.c_str(),
            param.length() ? "(" : "", param.c_str(),
            ok ? "ok" : "fail");
-  String r = "{\"ok\":";
-  r += ok ? "true" : "false";
-  r += "}";
-  web.send(200, "application/json", r);
-}
-
-static void serveApiMappings() {
-  static const char* GIDS[] = {"1c", "2c", "3c", "4c", "hold"};
-  String json = "{";
-  for (size_t i = 0; i < 5; i++) {
-    if (i) json += ',';
-    GestureMap m = getMapping(GIDS[i]);
-    String aid = m.actionId.length() ? m.actionId : defaultActionFor(GIDS[i]);
-    bool isDefault = (m.actionId.length() == 0);
-    json += "\""; json += GIDS[i]; json += "\":";
-    json += "{\"action\":\""; json += aid;
-    json += "\",\"param\":\""; json += m.param;
-    json += "\",\"default\":"; json += isDefault ? "true" : "false";
-    json += "}";
-  }
-  json += "}";
-  web.send(200, "application/json", json);
+  sendOk(req, ok);
 }
 
-static void serveApiSetMap() {
-  if (!web.hasArg("g")) { web.send(400, "text/plain", "missing g"); return; }
-  String g = web.arg("g");
-  String a = web.hasArg("a") ? web.arg("a") : "";
-  String p = web.hasArg("p") ? web.arg("p") : "";
+// One gesture's entry. Templated on the literal id so it goes out as a
+// literal key — no String built for it.
+template <size_t N>
+static void writeMapping(JsonWriter& w, const char (&gid)[N]) {
+  GestureMap m = getMapping(gid);
+  bool isDefault = (m.actionId.length() == 0);
+  w.key(gid).beginObject()
+   .kv("action", isDefault ? defaultActionFor(gid) : m.actionId)
+   .kv("param", m.param)
+   .kv("default", isDefault)
+   .endObject();
+}
+
+static void serveApiMappings(AsyncWebServerRequest* req) {
+  JsonReply out(req);
+  out.w.beginObject();
+  writeMapping(out.w, "1c");
+  writeMapping(out.w, "2c");
+  writeMapping(out.w, "3c");
+  writeMapping(out.w, "4c");
+  writeMapping(out.w, "hold");
+  out.w.endObject();
+  out.send();
+}
+
+static void serveApiSetMap(AsyncWebServerRequest* req) {
+  if (!req->hasArg("g")) { req->send(400, "text/plain", "missing g"); return; }
+  String g = req->arg("g");
+  String a = req->hasArg("a") ? req->arg("a") : "";
+  String p = req->hasArg("p") ? req->arg("p") : "";
   if (a.length() == 0 || a == "default") {
     clearMapping(g.c_str());
     logEvent("mapping %s reset to default", g.c_str());
@@ -1113,66 +838,373 @@ static void serveApiSetMap() {
     setMapping(g.c_str(), a, p);
     logEvent("mapping %s -> %s", g.c_str(), a.c_str());
   }
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
 // --- Control endpoints ---
-static void serveApiVol() {
-  if (!web.hasArg("v")) { web.send(400, "text/plain", "missing v"); return; }
-  int v = web.arg("v").toInt();
+static void serveApiVol(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  int v = req->arg("v").toInt();
   if (setVolume(v)) logEvent("vol -> %d (web)", v);
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiVolDelta() {
-  int d = web.hasArg("d") ? web.arg("d").toInt() : 0;
-  if (d == 0) { web.send(400, "text/plain", "missing d"); return; }
+static void serveApiVolDelta(AsyncWebServerRequest* req) {
+  int d = req->hasArg("d") ? req->arg("d").toInt() : 0;
+  if (d == 0) { req->send(400, "text/plain", "missing d"); return; }
   int prev = spk.volume;
   int newVol = adjustVolume(d);
   logEvent("vol %d -> %d (web)", prev, newVol);
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiPlay() {
+static void serveApiPlay(AsyncWebServerRequest* req) {
   togglePlay();
   logEvent("play/pause (web)");
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiNext() {
+static void serveApiNext(AsyncWebServerRequest* req) {
   nextTrack();
   logEvent("next (web)");
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiPrev() {
+static void serveApiPrev(AsyncWebServerRequest* req) {
   prevTrack();
   logEvent("prev (web)");
-  web.send(200, "application/json", "{\"ok\":true}");
+  req->send(200, "application/json", "{\"ok\":true}");
 }
 
-static void serveApiMute() {
+static void serveApiMute(AsyncWebServerRequest* req) {
   bool ok = toggleMute();
   logEvent("mute -> %s%s", spk.muted ? "on" : "off", ok ? "" : " (FAILED)");
-  String r = "{\"ok\":";
-  r += ok ? "true" : "false";
-  r += ",\"muted\":";
-  r += spk.muted ? "true" : "false";
-  r += "}";
-  web.send(200, "application/json", r);
-}
-
-static void serveApiLog() {
-  String out;
-  out.reserve(LOG_LINES * 80);
-  for (int i = 0; i < LOG_LINES; i++) {
-    int idx = (logHead + i) % LOG_LINES;
-    if (logRing[idx].length() > 0) {
-      out += logRing[idx];
-      out += '\n';
+  JsonReply out(req);
+  out.w.beginObject().kv("ok", ok).kv("muted", spk.muted).endObject();
+  out.send();
+}
+
+// GET /api/art[?h=artId] — current cover via the PSRAM cache (art.h). A tab
+// still asking for the previous track's id gets that one if it's cached.
+static void serveApiArt(AsyncWebServerRequest* req) {
+  // Runs on the web-art task without the state lock (see initWebUI): a
+  // cover fetch can take seconds, and neither the knob nor the other /api/*
+  // jobs should wait on it. The art cache is only ever touched here, by that
+  // one task; spk.artURL is copied under the lock.
+  String url;
+  {
+    StateLock lock;
+    url = spk.artURL;
+  }
+  ArtEntry* e = nullptr;
+  if (req->hasArg("h")) {
+    e = artLookup(strtoul(req->arg("h").c_str(), nullptr, 16));
+    if (e) e->usedMs = millis();
+  }
+  if (!e) {
+    if (!url.length()) { req->send(404, "text/plain", "no art"); return; }
+    e = artGet(url);
+  }
+  if (!e) { req->redirect(url); return; }
+
+  AsyncWebServerResponse* res;
+  if (req->header("If-None-Match") == e->etag) {
+    res = req->beginResponse(304);
+  } else {
+    std::shared_ptr<ArtBlob> blob = e->blob;
+    res = req->beginResponse(e->type, blob->len,
+      [blob](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+        size_t n = min(maxLen, blob->len - index);
+        memcpy(buf, blob->data + index, n);
+        return n;
+      });
+  }
+  res->addHeader("ETag", e->etag);
+  res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+}
+
+// GET /api/log[?after=seq] — text lines newer than `after` (all 40 without
+// it), with the newest seq in X-Log-Seq for the next call. 304 if none.
+static void serveApiLog(AsyncWebServerRequest* req) {
+  uint32_t after = req->hasArg("after") ? strtoul(req->arg("after").c_str(), nullptr, 10) : 0;
+  if (after == logSeq && req->hasArg("after")) {
+    req->send(304);
+    return;
+  }
+  char seq[12];
+  snprintf(seq, sizeof(seq), "%lu", (unsigned long)logSeq);
+  AsyncResponseStream* out = req->beginResponseStream("text/plain");
+  out->addHeader("X-Log-Seq", seq);
+  logWrite(*out, after);
+  req->send(out);
+}
+
+// Entries after `after` as an array of JSON strings, oldest first.
+static void logWriteJson(JsonWriter& w, uint32_t after) {
+  char line[LOG_TEXT_MAX + 12];
+  w.beginArray();
+  for (uint32_t seq = logFirstAfter(after); seq <= logSeq; seq++) {
+    size_t n = logFormatEntry(logRing[seq % LOG_LINES], line, sizeof(line));
+    if (n && line[n - 1] == '\n') line[n - 1] = '\0';
+    w.value((const char*)line);
+  }
+  w.endArray();
+}
+
+// GET /api/poll?since=<v>&after=<seq>[&spk=<v>&scan=0|1] — everything the
+// event stream would have pushed, in one request: status delta (omitted if
+// unchanged), new log lines, the speaker-list version and scan state. The
+// page falls back to this when it can't hold /api/events open, instead of
+// three timers opening ~100 connections a minute. A bodyless 304 when none
+// of it changed since what the page quotes back — the page then stretches
+// its poll interval from 1 s towards 10 s.
+static void serveApiPoll(AsyncWebServerRequest* req) {
+  statusPublish();
+  uint32_t since = req->hasArg("since") ? strtoul(req->arg("since").c_str(), nullptr, 10) : 0;
+  uint32_t after = req->hasArg("after") ? strtoul(req->arg("after").c_str(), nullptr, 10) : 0;
+  bool spkSame = req->hasArg("spk") && strtoul(req->arg("spk").c_str(), nullptr, 10) == speakersVersion;
+  bool scanSame = req->hasArg("scan") && (req->arg("scan") == "1") == scanActive && !scanActive;
+  if (since == statusVersion && statusSinceValid(since) && req->hasArg("after") && after == logSeq &&
+      spkSame && scanSame) {
+    req->send(304);
+    return;
+  }
+  JsonReply out(req);
+  JsonWriter& w = out.w;
+  w.beginObject();
+  if (!(since == statusVersion && statusSinceValid(since))) {
+    w.key("status");
+    writeStatusSince(w, since);
+  }
+  w.key("log");
+  logWriteJson(w, after);
+  w.kv("logSeq", logSeq)
+   .kv("spk", speakersVersion)
+   .key("scan");
+  writeScan(w);
+  w.endObject();
+  out.send();
+}
+
+// GET /api/loghot?v=0|1 — per-detent `rot` lines on or off (until reboot).
+static void serveApiLogHot(AsyncWebServerRequest* req) {
+  if (!req->hasArg("v")) { req->send(400, "text/plain", "missing v"); return; }
+  logHotLines = req->arg("v") == "1" || req->arg("v") == "true";
+  logEvent("hot-path log lines %s", logHotLines ? "on" : "off");
+  sendOk(req, true);
+}
+
+// =============================================================================
+// /api/events — Server-Sent Events push channel
+//
+// Open dashboards used to poll /api/status every second, /api/log every 2s
+// and /api/speakers every 10s, each rebuilding JSON whether or not anything
+// had changed. Now each tab holds one event stream: on connect it gets a full
+// snapshot, after that sseTick() compares a typed shadow of the inputs and
+// pushes only the status groups (or new log lines, or speaker list) that
+// actually changed. No clients → sseTick() returns on its first line; nothing
+// changed → a handful of int/String compares and no JSON at all.
+//
+// AsyncEventSource owns the sockets; connects land on the network task,
+// which only bumps sseConnects — the snapshot itself is built in loop(),
+// where the state lives. Browsers without EventSource (or past the client
+// cap) keep using the polling endpoints, which are unchanged.
+// =============================================================================
+static constexpr size_t        SSE_MAX_CLIENTS = 4;
+static constexpr unsigned long SSE_TICK_MS     = 100;    // change-check cadence
+static constexpr unsigned long SSE_PING_MS     = 15000;  // keepalive / dead-peer probe
+
+static AsyncEventSource events("/api/events");
+static std::atomic<uint32_t> sseConnects{0};  // bumped by the network task
+static uint32_t          sseSnapshotted = 0;
+static unsigned long     sseLastTick = 0;
+static unsigned long     sseLastPing = 0;
+
+// Status version last pushed; everything else is tracked by its own shadow.
+static uint32_t sseStatusVer = 0;
+static struct {
+  uint32_t logSeq = 0, speakersVersion = 0;
+  String cur;
+  bool scanActive = false; String scanMsg;
+} sseShadow;
+
+// Event payloads are rendered here; AsyncEventSource copies them into its
+// own per-client queue, so one buffer serves every push. Sized for the
+// `logall` snapshot: a typical 40-line window fits, long lines drop the oldest.
+static char sseBuf[2048];
+
+static void sseBroadcast(const char* event, const char* data) {
+  events.send(data, event);
+}
+
+static void sseBroadcast(const char* event, JsonWriter& w) {
+  if (w.overflow()) { dbg("sse: %s payload truncated, dropped", event); return; }
+  events.send(w.c_str(), event);
+}
+
+// The speaker list can be long (one entry per player), so the stream only
+// says it changed and the page fetches /api/speakers, which is streamed.
+static void sseSpeakersChanged() {
+  JsonWriter w(sseBuf, sizeof(sseBuf));
+  w.beginObject().kv("v", speakersVersion).endObject();
+  sseBroadcast("speakers", w);
+}
+
+static void sseScan() {
+  JsonWriter w(sseBuf, sizeof(sseBuf));
+  writeScan(w);
+  sseBroadcast("scan", w);
+}
+
+// Full state to everyone — sent when a tab connects. Tabs already open just
+// re-render the same values.
+static void sseSnapshot() {
+  JsonWriter w(sseBuf, sizeof(sseBuf));
+  statusTrack();
+  writeStatus(w);
+  sseBroadcast("status", w);
+  sseStatusVer = statusVersion;
+  logFormat(sseBuf, sizeof(sseBuf), 0);
+  sseBroadcast("logall", sseBuf);
+  sseShadow.logSeq = logSeq;
+  sseSpeakersChanged();
+  sseScan();
+}
+
+static void sseTick() {
+  unsigned long now = millis();
+  if (now - sseLastTick < SSE_TICK_MS) return;
+  sseLastTick = now;
+  if (events.count() == 0) return;
+  uint32_t connects = sseConnects.load();
+  if (sseSnapshotted != connects) {
+    sseSnapshotted = connects;
+    sseSnapshot();
+  }
+
+  statusTrack();
+  if (statusVersion != sseStatusVer) {
+    JsonWriter w(sseBuf, sizeof(sseBuf));
+    writeStatusSince(w, sseStatusVer);
+    sseBroadcast("status", w);
+    sseStatusVer = statusVersion;
+  }
+
+  auto& sh = sseShadow;
+
+  if (sh.logSeq != logSeq) {
+    logFormat(sseBuf, sizeof(sseBuf), sh.logSeq);
+    sh.logSeq = logSeq;
+    sseBroadcast("log", sseBuf);
+  }
+  bool list = shadowChanged(sh.speakersVersion, speakersVersion);
+  list |= shadowChanged(sh.cur, spk.name);
+  if (list) sseSpeakersChanged();
+  bool scanning = shadowChanged(sh.scanActive, scanActive);
+  scanning |= shadowChanged(sh.scanMsg, scanMsg);
+  if (scanning) sseScan();
+
+  if (now - sseLastPing >= SSE_PING_MS) {
+    sseLastPing = now;
+    sseBroadcast("ping", "");
+  }
+}
+
+// =============================================================================
+// Request → web-jobs task hand-off
+//
+// AsyncWebServer parses requests on its own network task, so many phones and
+// dashboards are accepted and served in parallel. Static assets are answered
+// right there. Everything that reads or changes speaker/board state — most of
+// it over SOAP — is parked with pause() and queued for the web-jobs task,
+// which runs them one at a time under the state lock (speaker.h) and sends
+// the reply, which resumes the request. loop() keeps polling the knob while
+// a job is in a SOAP call; it used to run these itself, and a 2 s volume
+// call or a 6 s cover-art fetch stopped the knob for as long. If the client
+// goes away while queued, its weak pointer expires and the job is skipped.
+//
+// /api/art has a queue and task of its own (web-art), running the same job
+// loop: a cover from a slow speaker can take seconds to fetch, and a volume
+// change queued behind it on web-jobs would wait just as long.
+// =============================================================================
+typedef void (*WebJobFn)(AsyncWebServerRequest*);
+
+struct WebJob {
+  AsyncWebServerRequestPtr req;
+  WebJobFn fn;
+  bool     stateLock;   // false: the handler takes the lock itself, briefly
+};
+
+static constexpr UBaseType_t WEB_JOB_QUEUE      = 16;
+static constexpr uint32_t    WEB_JOB_TASK_STACK = 8192;   // as loop(): SOAP calls
+static constexpr UBaseType_t ART_JOB_QUEUE      = 4;      // a few tabs after a track change
+static constexpr uint32_t    ART_JOB_TASK_STACK = 6144;   // one plain-HTTP HTTPClient GET
+static QueueHandle_t webJobs = nullptr;
+static QueueHandle_t artJobs = nullptr;   // null: art jobs share webJobs
+
+// Runs on the network task.
+static void deferToQueue(QueueHandle_t q, AsyncWebServerRequest* req, WebJobFn fn, bool stateLock) {
+  if (!q || uxQueueSpacesAvailable(q) == 0) {
+    req->send(503, "text/plain", "busy");
+    return;
+  }
+  WebJob* job = new WebJob{req->pause(), fn, stateLock};
+  if (xQueueSend(q, &job, 0) != pdTRUE) {
+    delete job;  // lost the race for the last slot — client will see a reset
+    req->abort();
+  }
+}
+
+static void deferToWorker(AsyncWebServerRequest* req, WebJobFn fn, bool stateLock = true) {
+  deferToQueue(webJobs, req, fn, stateLock);
+}
+
+// Both job tasks; `arg` is the queue it serves.
+static void webJobTask(void* arg) {
+  QueueHandle_t q = (QueueHandle_t)arg;
+  for (;;) {
+    WebJob* job = nullptr;
+    if (xQueueReceive(q, &job, portMAX_DELAY) != pdTRUE) continue;
+    if (auto req = job->req.lock()) {
+      if (job->stateLock) {
+        StateLock lock;
+        job->fn(req.get());
+      } else {
+        job->fn(req.get());
+      }
     }
+    delete job;
   }
-  web.send(200, "text/plain", out);
+}
+
+static void onWorker(const char* path, WebJobFn fn, bool stateLock = true) {
+  web.on(path, HTTP_ANY, [fn, stateLock](AsyncWebServerRequest* req) {
+    deferToWorker(req, fn, stateLock);
+  });
+}
+
+// GET /api/status on the network task, straight from the snapshot. Only a
+// cold or stale snapshot goes through the web-jobs task.
+static void serveApiStatusCached(AsyncWebServerRequest* req) {
+  static char body[STATUS_SNAP_MAX];   // the network task serves one request at a time
+  bool hasSince = req->hasArg("since");
+  uint32_t since = hasSince ? strtoul(req->arg("since").c_str(), nullptr, 10) : 0;
+  size_t len;
+  if (!statusSnapRead(hasSince, since, body, len)) {
+    deferToWorker(req, serveApiStatus);
+    return;
+  }
+  if (len == 0) req->send(304);
+  else          req->send(200, "application/json", (const char*)body);
+}
+
+// Call from loop(), holding the state lock: a restart a handler asked for,
+// the status snapshot, then the SSE diff. Web requests run on the web-jobs task.
+static void webTick() {
+  if (restartAt && (long)(millis() - restartAt) >= 0) ESP.restart();
+  statusPublishTick(events.count() > 0);
+  sseTick();
 }
 
 static void initWebUI(const char* hostname) {
@@ -1183,42 +1215,81 @@ static void initWebUI(const char* hostname) {
   deviceName = p.getString("devname", "");
   p.end();
   if (deviceName.length() == 0) deviceName = hostname;
+  roomSlug = loadRoomSlug();
 
   MDNS.begin(hostname);
   MDNS.addService("http", "tcp", 80);
+  // LAN OTA: what we're running, so peers can copy it (updater.h). Hashing
+  // the image is one read of the partition, here rather than on first use.
+  MDNS.addService("sonosp4", "tcp", 80);
+  MDNS.addServiceTxt("sonosp4", "tcp", "fw", FW_VERSION);
+  MDNS.addServiceTxt("sonosp4", "tcp", "fwsha", runningImageSha());
+
+  webJobs = xQueueCreate(WEB_JOB_QUEUE, sizeof(WebJob*));
+  if (!webJobs || xTaskCreate(webJobTask, "web-jobs", WEB_JOB_TASK_STACK, webJobs,
+                              tskIDLE_PRIORITY + 1, nullptr) != pdPASS) {
+    logEvent("web: no RAM for the web-jobs task");   // every state request answers 503
+    if (webJobs) vQueueDelete(webJobs);
+    webJobs = nullptr;
+  }
+  artJobs = xQueueCreate(ART_JOB_QUEUE, sizeof(WebJob*));
+  if (!artJobs || xTaskCreate(webJobTask, "web-art", ART_JOB_TASK_STACK, artJobs,
+                              tskIDLE_PRIORITY + 1, nullptr) != pdPASS) {
+    logEvent("web: no RAM for the web-art task — covers queue with the rest");
+    if (artJobs) vQueueDelete(artJobs);
+    artJobs = nullptr;
+  }
+  initStatusVersions();
+
+  // Constant data — served straight from the network task.
+  web.on("/", HTTP_GET, serveRoot);
+  web.on("/logo.png", HTTP_GET, serveLogo);
+  web.on("/api/fw.bin", HTTP_GET, serveFirmware);
+  // Published snapshot — also network task, falls back to the web-jobs task when cold.
+  web.on("/api/status", HTTP_GET, serveApiStatusCached);
+
+  // Everything touching live state runs on the web-jobs task.
+  onWorker("/api/speakers", serveApiSpeakers);
+  onWorker("/api/select", serveApiSelect);
+  onWorker("/api/discover", serveApiDiscover);
+  onWorker("/api/scan", serveApiScan);
+  onWorker("/api/name", serveApiName);
+  onWorker("/api/reset", serveApiReset);
+  onWorker("/api/rooms", serveApiRooms);
+  onWorker("/api/setroom", serveApiSetRoom);
+  onWorker("/api/setprefix", serveApiSetPrefix);
+  onWorker("/api/setup", serveApiSetup);
+  onWorker("/api/restart", serveApiRestart);
+  onWorker("/api/setinvert", serveApiSetInvert);
+  onWorker("/api/setstep", serveApiSetStep);
+  onWorker("/api/checkupdate", serveApiCheckUpdate);
+  onWorker("/api/vol", serveApiVol);
+  onWorker("/api/voldelta", serveApiVolDelta);
+  onWorker("/api/play", serveApiPlay);
+  onWorker("/api/next", serveApiNext);
+  onWorker("/api/prev", serveApiPrev);
+  onWorker("/api/mute", serveApiMute);
+  onWorker("/api/actions", serveApiActions);
+  onWorker("/api/action", serveApiAction);
+  onWorker("/api/mappings", serveApiMappings);
+  onWorker("/api/setmap", serveApiSetMap);
+  onWorker("/api/bass", serveApiBass);
+  onWorker("/api/treble", serveApiTreble);
+  onWorker("/api/loudness", serveApiLoudness);
+  onWorker("/api/sound", serveApiSoundRefresh);
+  onWorker("/api/gesture", serveApiGesture);
+  onWorker("/api/log", serveApiLog);
+  // Own task; locks only to read the URL.
+  web.on("/api/art", HTTP_ANY, [](AsyncWebServerRequest* req) {
+    deferToQueue(artJobs ? artJobs : webJobs, req, serveApiArt, false);
+  });
+  onWorker("/api/loghot", serveApiLogHot);
+  onWorker("/api/poll", serveApiPoll);
 
-  web.on("/", serveRoot);
-  web.on("/logo.png", serveLogo);
-  web.on("/api/status", serveApiStatus);
-  web.on("/api/speakers", serveApiSpeakers);
-  web.on("/api/select", serveApiSelect);
-  web.on("/api/discover", serveApiDiscover);
-  web.on("/api/scan", serveApiScan);
-  web.on("/api/name", serveApiName);
-  web.on("/api/reset", serveApiReset);
-  web.on("/api/rooms", serveApiRooms);
-  web.on("/api/setroom", serveApiSetRoom);
-  web.on("/api/setprefix", serveApiSetPrefix);
-  web.on("/api/setup", serveApiSetup);
-  web.on("/api/restart", serveApiRestart);
-  web.on("/api/setinvert", serveApiSetInvert);
-  web.on("/api/setstep", serveApiSetStep);
-  web.on("/api/checkupdate", serveApiCheckUpdate);
-  web.on("/api/vol", serveApiVol);
-  web.on("/api/voldelta", serveApiVolDelta);
-  web.on("/api/play", serveApiPlay);
-  web.on("/api/next", serveApiNext);
-  web.on("/api/prev", serveApiPrev);
-  web.on("/api/mute", serveApiMute);
-  web.on("/api/actions", serveApiActions);
-  web.on("/api/action", serveApiAction);
-  web.on("/api/mappings", serveApiMappings);
-  web.on("/api/setmap", serveApiSetMap);
-  web.on("/api/bass", serveApiBass);
-  web.on("/api/treble", serveApiTreble);
-  web.on("/api/loudness", serveApiLoudness);
-  web.on("/api/sound", serveApiSoundRefresh);
-  web.on("/api/gesture", serveApiGesture);
-  web.on("/api/log", serveApiLog);
+  events.onConnect([](AsyncEventSourceClient* client) {
+    if (events.count() > SSE_MAX_CLIENTS) { client->close(); return; }
+    sseConnects++;
+  });
+  web.addHandler(&events);
   web.begin();
 }
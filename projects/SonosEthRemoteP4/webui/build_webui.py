@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Build the embedded dashboard assets:
+  webui/index.html → ../webui_index.h
+  webui/logo.png   → ../logo.h
+
+  - light minify: <style> blocks collapsed to one line; elsewhere strip
+    indentation, blank lines and whole-line // and /* */ comments (line breaks
+    are kept — the JS leans on ASI)
+  - gzip -9 with a zeroed mtime, so the same page always yields the same bytes
+  - emit a PROGMEM byte array plus a strong ETag taken from the SHA-256 of
+    the gzipped body
+
+serveRoot() sends the array as-is with Content-Encoding: gzip and answers a
+matching If-None-Match with 304.
+
+The logo is already-compressed PNG, so it's embedded as raw bytes (no gzip,
+no base64) with its own content hash. The page refers to it as
+/logo.png?v=<hash>, which lets serveLogo() mark it immutable: a new logo
+means a new URL.
+
+  ./webui/build_webui.py           # regenerate both headers
+  ./webui/build_webui.py --check   # exit 1 if either header is stale (release.sh)
+
+The generated headers are committed so a plain `arduino-cli compile` works
+without Python. Edit the files in webui/, never the headers.
+"""
+import gzip
+import hashlib
+import io
+import re
+import sys
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+SRC = HERE / "index.html"
+OUT = HERE.parent / "webui_index.h"
+LOGO_SRC = HERE / "logo.png"
+LOGO_OUT = HERE.parent / "logo.h"
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{}:;,>])\s*", r"\1", css)
+    return css.replace(";}", "}").strip()
+
+
+def minify(html):
+    # CSS has no ASI hazard — collapse each <style> block to one line first.
+    html = re.sub(r"(<style>)(.*?)(</style>)",
+                  lambda m: m.group(1) + minify_css(m.group(2)) + m.group(3),
+                  html, flags=re.S)
+    out = []
+    in_block = False
+    for line in html.splitlines():
+        line = line.strip()
+        if in_block:
+            if "*/" in line:
+                in_block = False
+                line = line.split("*/", 1)[1].strip()
+            else:
+                continue
+        if line.startswith("/*"):
+            if "*/" not in line:
+                in_block = True
+                continue
+            rest = line.split("*/", 1)[1].strip()
+            if not rest:
+                continue
+            line = rest
+        if not line or line.startswith("//"):
+            continue
+        out.append(line)
+    return "\n".join(out) + "\n"
+
+
+def compress(data):
+    buf = io.BytesIO()
+    with gzip.GzipFile(fileobj=buf, mode="wb", compresslevel=9, mtime=0) as gz:
+        gz.write(data)
+    return buf.getvalue()
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def byte_rows(data):
+    rows = []
+    for i in range(0, len(data), 20):
+        rows.append("  " + ",".join("0x%02x" % b for b in data[i:i + 20]) + ",")
+    return "\n".join(rows)
+
+
+def render_logo(png):
+    return (
+        "#pragma once\n"
+        "// GENERATED by webui/build_webui.py from webui/logo.png — do not edit.\n"
+        "#include <Arduino.h>\n"
+        "\n"
+        "static const char LOGO_ETAG[] = \"\\\"%s\\\"\";\n"
+        "static const size_t LOGO_PNG_LEN = %d;\n"
+        "static const uint8_t LOGO_PNG[] PROGMEM = {\n"
+        "%s\n"
+        "};\n" % (content_hash(png), len(png), byte_rows(png))
+    )
+
+
+def render(gz, raw_len, min_len):
+    etag = content_hash(gz)
+    return (
+        "#pragma once\n"
+        "// GENERATED by webui/build_webui.py from webui/index.html — do not edit.\n"
+        "// %d B source → %d B minified → %d B gzipped.\n"
+        "#include <Arduino.h>\n"
+        "\n"
+        "static const char WEBUI_INDEX_ETAG[] = \"\\\"%s\\\"\";\n"
+        "static const size_t WEBUI_INDEX_GZ_LEN = %d;\n"
+        "static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {\n"
+        "%s\n"
+        "};\n" % (raw_len, min_len, len(gz), etag, len(gz), byte_rows(gz))
+    )
+
+
+def main():
+    png = LOGO_SRC.read_bytes()
+    html = SRC.read_text(encoding="utf-8")
+    html = html.replace("'/logo.png'", "'/logo.png?v=%s'" % content_hash(png))
+    small = minify(html).encode("utf-8")
+    gz = compress(small)
+    outputs = [
+        (OUT, render(gz, len(html.encode("utf-8")), len(small))),
+        (LOGO_OUT, render_logo(png)),
+    ]
+    if "--check" in sys.argv[1:]:
+        stale = [p.name for p, text in outputs
+                 if not p.exists() or p.read_text(encoding="utf-8") != text]
+        if stale:
+            print("%s stale — run webui/build_webui.py" % ", ".join(stale), file=sys.stderr)
+            return 1
+        return 0
+    for path, text in outputs:
+        path.write_text(text, encoding="utf-8")
+    print("webui_index.h: %d B → %d B gzipped (%.1fx)"
+          % (len(html.encode("utf-8")), len(gz), len(html.encode("utf-8")) / len(gz)))
+    print("logo.h: %d B PNG" % len(png))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,514 @@
+#pragma once
+// GENERATED by webui/build_webui.py from webui/index.html — do not edit.
+// 40016 B source → 36385 B minified → 10086 B gzipped.
+#include <Arduino.h>
+
+static const char WEBUI_INDEX_ETAG[] = "\"a21064f4b39fc2ae\"";
+static const size_t WEBUI_INDEX_GZ_LEN = 10086;
+static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xd5,0x7d,0xd9,0x72,0xdb,0xc8,0x92,0xe8,0xbb,0xbe,
+  0x02,0xa6,0xa3,0x1b,0xc4,0x21,0x09,0x71,0x95,0x28,0xd2,0xa4,0x8e,0xb7,0x5e,0x66,0xec,0xb6,0x6f,0xcb,
+  0xdd,0x13,0x27,0x7c,0x1c,0x1d,0x20,0x50,0x24,0x71,0x04,0x02,0x68,0x00,0xa4,0xac,0x66,0x2b,0x62,0x3e,
+  0x62,0x62,0xee,0x9f,0xdc,0x79,0x9f,0xfb,0x27,0xf3,0x25,0x37,0x33,0xab,0x0a,0x28,0x6c,0x24,0xbd,0xdc,
+  0x2d,0xd4,0x2d,0x01,0xb5,0x64,0x65,0x65,0x65,0x66,0x65,0x66,0x65,0xc1,0x4f,0x1e,0xbd,0x78,0xf3,0xfc,
+  0xdd,0xdf,0xde,0xbe,0xd4,0xd6,0xc9,0xc6,0x9b,0x3f,0x11,0xbf,0x99,0xe5,0xcc,0xcf,0x9e,0x6c,0x58,0x62,
+  0x69,0xf6,0xda,0x8a,0x62,0x96,0xcc,0xf4,0x6d,0xb2,0xec,0x8c,0xf5,0x39,0x2f,0xf5,0xad,0x0d,0x9b,0xe9,
+  0x3b,0x97,0xdd,0x85,0x41,0x94,0xe8,0x9a,0x1d,0xf8,0x09,0xf3,0xa1,0xd5,0x9d,0xeb,0x24,0xeb,0x99,0xc3,
+  0x76,0xae,0xcd,0x3a,0xf4,0xd2,0x76,0x7d,0x37,0x71,0x2d,0xaf,0x13,0xdb,0x96,0xc7,0x66,0x3d,0x1d,0x20,
+  0x27,0x6e,0xe2,0xb1,0xf9,0x4d,0xe0,0x07,0xb1,0xf6,0x33,0xdb,0x04,0x09,0x7b,0x72,0xce,0xcb,0xce,0x9e,
+  0x78,0xae,0x7f,0xab,0x45,0xcc,0x9b,0xe9,0x61,0xc4,0x00,0xae,0xcf,0x6c,0x18,0x60,0x1d,0xb1,0xe5,0x4c,
+  0x5f,0x27,0x49,0x18,0x4f,0xce,0xcf,0x97,0x30,0x5c,0x6c,0xae,0x82,0x60,0xe5,0x31,0x2b,0x74,0x63,0xd3,
+  0x0e,0x36,0xfa,0xa7,0xf5,0x8d,0x13,0x2b,0x71,0x6d,0xea,0xa8,0xd9,0x51,0x10,0xc7,0x41,0xe4,0xae,0x5c,
+  0x5f,0x02,0x39,0x3e,0xde,0xb9,0x1d,0xc7,0xfd,0xeb,0xa5,0xb5,0x71,0xbd,0xfb,0xd9,0x77,0x91,0xb5,0xf5,
+  0x6d,0x16,0x4f,0x82,0x30,0xfe,0xa3,0x7d,0xb7,0x5a,0x27,0x7f,0xbd,0x32,0xcd,0xde,0x70,0xd8,0x1e,0x74,
+  0xbb,0x53,0xf1,0x38,0xca,0x1e,0x2f,0xba,0xdd,0x6f,0x45,0xd7,0x1f,0x9f,0xbd,0x6e,0xbd,0xf5,0xd8,0xc7,
+  0xd6,0x8d,0xe5,0xc7,0x13,0xea,0x8a,0x7d,0x86,0xf0,0x3f,0x76,0x50,0x5a,0xfe,0x13,0x4b,0x9e,0x45,0x96,
+  0xeb,0xc7,0xad,0xd7,0x40,0x39,0xde,0x54,0x6d,0xe6,0xb8,0x71,0xe8,0x59,0xf7,0xb3,0xf8,0xce,0x0a,0x75,
+  0x4e,0x86,0x38,0xb9,0xf7,0x58,0xbc,0x66,0x2c,0x41,0xf2,0xd0,0xdb,0x7c,0x12,0x05,0x41,0xb2,0xef,0x74,
+  0x16,0xab,0xc9,0xe3,0xae,0x05,0x3f,0xf6,0xb4,0xd3,0x89,0xb7,0xd1,0xd2,0xb2,0xd9,0xe4,0x71,0xaf,0x0f,
+  0x3f,0xe3,0xac,0xa4,0xd3,0x87,0xb2,0x0b,0xf8,0x61,0x50,0x06,0xa3,0x7b,0xf0,0x6a,0xf7,0xec,0xfe,0x05,
+  0xbc,0x02,0xa1,0x26,0x8f,0xd9,0x15,0xbb,0x64,0x03,0xfe,0x86,0x8d,0xad,0xee,0x95,0x7d,0x35,0x12,0xef,
+  0x83,0xc9,0xe3,0x91,0x35,0xba,0x18,0x2e,0xc5,0xfb,0x70,0xf2,0xb8,0xcf,0xfa,0x76,0x1f,0x07,0xb0,0x6c,
+  0x1b,0x58,0x66,0xf2,0xf8,0xf2,0x59,0xff,0x45,0xff,0x45,0x5a,0x80,0x30,0xae,0xac,0xc1,0x78,0x90,0xb5,
+  0xe9,0xc4,0xc1,0x12,0x1a,0x0e,0xac,0xde,0x90,0xa3,0xc6,0x22,0x77,0x39,0xd1,0x25,0xd1,0xf5,0xf6,0xf7,
+  0x2c,0x88,0x56,0xae,0xd5,0xa6,0x0a,0x6c,0x80,0xa4,0xd4,0x81,0xb2,0x1a,0x52,0x56,0x43,0xca,0xea,0xed,
+  0xf8,0x3e,0x4e,0xd8,0xa6,0xb3,0x75,0xdb,0x58,0xdd,0x91,0x6d,0x37,0x48,0x4b,0x3d,0xa5,0xad,0x86,0xb4,
+  0xd5,0xdb,0x5b,0x97,0x2a,0xe2,0x10,0x48,0xd0,0x4e,0x9f,0x1e,0xfe,0xb2,0x5f,0x04,0x1f,0x3b,0xb1,0xfb,
+  0x87,0xeb,0xaf,0x26,0x8b,0x20,0x72,0x58,0xd4,0x81,0x92,0xe9,0xc6,0x82,0xf1,0xfd,0x49,0x77,0x1a,0x5a,
+  0x8e,0x83,0x75,0xdd,0x07,0x14,0xa5,0xf6,0x22,0x70,0xee,0xf7,0x0b,0xcb,0xbe,0x5d,0x45,0xc1,0xd6,0x77,
+  0x26,0x3b,0x2b,0x6a,0x22,0xe5,0x8d,0xa9,0x1d,0x78,0x41,0x24,0xde,0x81,0x32,0xc6,0x03,0x35,0x45,0x46,
+  0xeb,0xf0,0xe5,0x16,0x75,0x88,0xab,0x31,0xa5,0xf2,0x3b,0xe6,0xc2,0x92,0x4f,0x70,0xc9,0xe9,0x1d,0xd0,
+  0x60,0x93,0xde,0x30,0xfc,0x38,0x05,0x96,0x65,0x9d,0x35,0xaf,0xee,0x99,0xa3,0x11,0xe0,0xf3,0x91,0x4b,
+  0xdf,0xa4,0xd7,0x1d,0x76,0xc3,0x0c,0x41,0xcd,0xda,0x26,0x41,0x8a,0x65,0x7f,0x1c,0x7e,0xd4,0xfa,0x00,
+  0x41,0xa3,0x46,0x0a,0xa2,0x91,0xe5,0xa0,0xcc,0xae,0xf0,0x2f,0xac,0x40,0xf3,0xaa,0x0b,0x0d,0xb4,0x0b,
+  0xfa,0x6d,0x25,0xda,0xa8,0xfb,0x8d,0xd6,0xe9,0x75,0xbf,0x69,0x3f,0x86,0x25,0x19,0xf6,0x6c,0x0d,0x1e,
+  0x93,0x08,0x50,0x0d,0xad,0x08,0x9a,0x43,0xc3,0x6f,0x8c,0x36,0x62,0x65,0x45,0x19,0x8c,0xde,0xb8,0xeb,
+  0xb0,0x55,0x5b,0x30,0x1d,0x76,0x79,0xdc,0x1d,0xc3,0x8f,0xa5,0xf5,0xba,0xd0,0x7e,0xba,0x71,0xfd,0x74,
+  0x12,0xdd,0xee,0x6e,0x3d,0x85,0x19,0x2f,0x6e,0x5d,0x20,0x08,0xcd,0x76,0x03,0x6c,0xbb,0x46,0xac,0x2d,
+  0x1f,0xf5,0x89,0x6b,0xc5,0xcc,0x99,0x26,0xec,0x63,0xd2,0x81,0x21,0x61,0x21,0xb0,0x2a,0x08,0x13,0x77,
+  0x03,0x64,0x79,0xc5,0x56,0xee,0xc2,0xf5,0xdc,0xe4,0xfe,0x61,0x32,0x89,0x99,0x07,0x7a,0xc0,0x0d,0xfc,
+  0xf2,0x4a,0x70,0xfe,0x92,0xab,0xf1,0x78,0xb9,0x5c,0x3e,0x98,0x1b,0x2b,0x4e,0x50,0x03,0xee,0x85,0x3c,
+  0x4d,0x96,0xc0,0x43,0x53,0xfc,0xd5,0x71,0xdc,0x88,0x43,0x9a,0x40,0x87,0xed,0xc6,0x9f,0x02,0x1a,0x2b,
+  0xbf,0xe3,0x02,0x5f,0xc5,0x13,0x84,0xc4,0xa2,0xe9,0xca,0x0a,0x27,0x17,0x40,0x4c,0x49,0x63,0x24,0x71,
+  0x57,0xeb,0x8d,0x91,0xbe,0x92,0x61,0x92,0x24,0xd8,0x4c,0x7a,0x50,0x11,0x07,0x9e,0xeb,0x68,0x29,0x17,
+  0x74,0x86,0x86,0x58,0x29,0xd9,0x08,0x17,0xe7,0xc1,0xf4,0x82,0x55,0xa0,0xb9,0x9b,0xd5,0x5e,0x90,0x67,
+  0x84,0x03,0x04,0xc0,0x91,0x30,0xc1,0x89,0x79,0xd5,0x9f,0x2e,0x5d,0x0f,0xc6,0x9e,0xc4,0x56,0xb2,0x8d,
+  0xac,0x84,0x35,0xcd,0xf1,0xc8,0x78,0x30,0xd9,0x3d,0x5b,0x44,0xc1,0x5d,0x05,0x57,0x21,0x47,0x1b,0x2a,
+  0x17,0xe1,0xf2,0xab,0x4c,0x86,0x3a,0xc5,0x63,0x09,0x00,0xed,0x20,0xe7,0xe3,0x44,0x90,0xd1,0x88,0xdc,
+  0xb4,0xd0,0xcb,0x20,0xda,0x4c,0xb6,0x61,0xc8,0x22,0x1b,0x16,0xa2,0xc8,0xce,0x9d,0x41,0x3a,0x91,0x24,
+  0x08,0x27,0x7d,0x9c,0x04,0xa8,0x9d,0x4d,0x15,0x83,0xa3,0x1c,0xaa,0xb8,0xf4,0xfb,0x05,0x5c,0x90,0xe1,
+  0x8b,0xe2,0x52,0x44,0xce,0x1c,0xa4,0x4c,0x4e,0x23,0xa6,0xc8,0xd2,0x0a,0xc9,0xb5,0xc9,0xcb,0x49,0x6f,
+  0x9a,0x5b,0xe1,0x8a,0xb5,0xfc,0xc7,0x36,0x4e,0xdc,0xe5,0x7d,0x47,0x6c,0x6f,0xea,0x12,0x23,0xc5,0xf8,
+  0x9c,0xcc,0xad,0x6f,0xc5,0x31,0xf4,0x65,0x0e,0x9f,0x1e,0xa9,0xd9,0x89,0x9b,0x00,0x40,0x5b,0x72,0x96,
+  0x05,0x42,0xa9,0x90,0x1b,0xd7,0xaf,0x30,0x83,0xde,0x21,0xf2,0xd6,0xac,0x20,0x47,0x40,0xa3,0xdf,0xeb,
+  0x20,0x4e,0x52,0x96,0x5d,0x78,0x81,0x7d,0x3b,0x3d,0x71,0xdd,0x2b,0xd6,0xae,0x80,0x5b,0xbf,0x86,0xb8,
+  0x19,0xaa,0x5e,0x70,0xa7,0xa2,0xca,0x49,0xe0,0x43,0x8d,0xe5,0x49,0x24,0x2d,0x3b,0x71,0x82,0x0c,0x45,
+  0xd7,0xa7,0xd5,0xe0,0x98,0x4a,0x5d,0x05,0x80,0x53,0x0d,0x90,0x09,0x0c,0x2a,0x90,0x6d,0x0c,0x3c,0xf9,
+  0x8d,0xaa,0xa2,0x1e,0xf7,0x2d,0xf8,0x61,0x53,0x42,0xc2,0x25,0xa9,0xcc,0x6a,0x35,0xb3,0x17,0xb7,0x49,
+  0x57,0xaf,0x2d,0x27,0xb8,0xa3,0xd7,0x14,0x5b,0x7c,0xe3,0x02,0x1d,0xaf,0x23,0xdc,0xc4,0xba,0x79,0x1c,
+  0x4d,0xcf,0xdd,0x31,0x55,0x59,0x3c,0x1e,0x39,0x4e,0xef,0x72,0x31,0xcd,0x00,0x82,0x26,0x05,0xa1,0x46,
+  0xcd,0x29,0xea,0xda,0x58,0xa0,0xbc,0x4f,0x33,0xda,0x90,0xe1,0xd3,0x04,0x7e,0x03,0x99,0xfc,0xeb,0x2d,
+  0xbb,0x5f,0x46,0x60,0x3d,0xc5,0xda,0xd2,0xb3,0xe2,0xf5,0x9b,0xdb,0x7d,0xf7,0x1b,0x75,0xa8,0x68,0xb5,
+  0xb0,0x9a,0x57,0x83,0x76,0xbf,0x7b,0xd5,0xee,0xf5,0x07,0x6d,0x73,0x38,0x32,0xd4,0x71,0x61,0x8b,0x62,
+  0x89,0x86,0x83,0x91,0xde,0x2e,0x37,0x37,0x1e,0x50,0x9b,0xaa,0x20,0x15,0xc5,0xac,0x42,0xf2,0x03,0x9f,
+  0x3d,0x94,0x10,0xfa,0x0e,0xb6,0xf8,0x2a,0x94,0xfa,0xa3,0x51,0xfb,0xaa,0x8b,0xff,0x9d,0x82,0x91,0xda,
+  0xfa,0x13,0x11,0x32,0x57,0x2c,0x06,0x2d,0xc6,0x3a,0xa0,0xb9,0x4c,0x42,0xa9,0x13,0xdc,0xee,0x2d,0xdf,
+  0xdd,0x58,0xb4,0xc6,0x82,0x6c,0x5a,0xcf,0xbc,0x88,0x35,0x06,0x1c,0xd7,0x09,0xb6,0x49,0x55,0xaf,0x25,
+  0xce,0xa4,0xd0,0x0f,0x67,0x57,0xec,0x99,0x89,0x50,0xf2,0xb1,0x9a,0x3d,0x1f,0x4c,0x30,0x68,0x4f,0xd1,
+  0xa2,0xbd,0x6a,0x69,0xb2,0xb7,0x11,0x98,0x97,0x93,0x30,0x70,0x49,0x7d,0x54,0xe8,0xa5,0x82,0x32,0x1b,
+  0xa1,0x80,0x65,0x6c,0x4d,0x20,0x35,0xb3,0x1f,0x3f,0x98,0x60,0xc2,0x84,0x9f,0xa0,0xd2,0x2b,0x90,0x39,
+  0x3a,0xfa,0x41,0x45,0xa4,0x68,0x01,0xdc,0xd1,0xbe,0x58,0x81,0x8a,0xf9,0x68,0xae,0x1f,0x6e,0x93,0xf7,
+  0xc9,0x7d,0xc8,0x66,0x30,0xea,0x8a,0x7d,0xd8,0x0b,0x95,0x30,0x54,0x75,0x02,0x2a,0x1e,0x69,0x14,0x58,
+  0x80,0x93,0x05,0x6d,0x6d,0x46,0x8c,0x33,0xad,0xe6,0xaf,0x03,0x23,0x4c,0x26,0x12,0x54,0x0c,0x9b,0x30,
+  0xaa,0x99,0xad,0xef,0x5b,0x0b,0x8f,0xe1,0xc4,0xed,0x5b,0xb9,0xd7,0x0e,0xf2,0x86,0x51,0x6e,0xaf,0xce,
+  0xeb,0xa7,0xfe,0xc1,0x09,0x95,0x86,0x4b,0xd6,0xdb,0xcd,0x62,0x5f,0x37,0x1d,0x31,0xfd,0xbe,0x32,0xfb,
+  0xfe,0x31,0x8d,0x98,0xb7,0x69,0x94,0xa5,0xea,0x20,0xe1,0xf2,0x5c,0x98,0x61,0x4a,0x0f,0x3b,0xcb,0x3b,
+  0xa8,0x99,0xc7,0xf9,0xfd,0x34,0x42,0x8c,0xca,0x9b,0x32,0x71,0x1f,0xbc,0xbb,0x60,0xa2,0x75,0xfc,0xed,
+  0x06,0xb6,0x76,0x7b,0x92,0x58,0x8b,0xad,0x07,0x76,0x20,0xbc,0x03,0x03,0xbb,0xfe,0xee,0xff,0x11,0xfe,
+  0xbd,0xf8,0x32,0xfe,0x1d,0xe3,0x6a,0xf3,0xd9,0x68,0x66,0x12,0xac,0xc0,0x35,0xdc,0x87,0x81,0x90,0x58,
+  0x70,0xbe,0x40,0xeb,0xec,0xe4,0x32,0x0e,0xd4,0x65,0x1c,0x9f,0xcc,0x50,0x57,0xa5,0x55,0xab,0xdb,0xec,
+  0xfa,0xb1,0xe8,0x5a,0x63,0x55,0x16,0x31,0x35,0x0f,0x19,0xc3,0x02,0x09,0x95,0xf6,0xa2,0xaa,0x08,0x66,
+  0x32,0xb1,0x96,0x80,0xd5,0x5e,0x92,0x47,0xd7,0xa7,0x29,0x09,0xac,0x05,0xa0,0xb1,0x4d,0x60,0x7f,0xe6,
+  0x06,0x20,0x2c,0x13,0x38,0x71,0xf8,0x50,0xc7,0xda,0x55,0x34,0x19,0x18,0x15,0x2c,0xaf,0x10,0xc1,0xf2,
+  0x3c,0xae,0x18,0x4b,0xf3,0x93,0xb8,0xd1,0xb0,0x64,0x70,0xa9,0x1b,0x3a,0x59,0xfa,0xa0,0xd5,0x27,0xeb,
+  0x60,0x47,0x13,0xa8,0x98,0x2b,0x54,0x6b,0xe6,0x11,0x93,0xe5,0x22,0x9b,0xc4,0xc5,0x67,0x89,0x27,0x49,
+  0x12,0xe9,0x52,0xc0,0x23,0x71,0xc1,0x54,0x10,0xcc,0xbd,0x71,0x1d,0xc7,0x63,0x45,0x93,0x03,0xbd,0x89,
+  0x02,0x9a,0x80,0x7b,0xc7,0xb7,0x22,0x94,0xaa,0xcc,0xed,0x1b,0x8e,0x4b,0x5e,0x1f,0x6f,0x09,0xd5,0x4c,
+  0x69,0x77,0xa5,0xb6,0xa3,0xfd,0x1b,0x9b,0x6a,0x60,0x10,0xd9,0x56,0xe4,0x94,0x79,0x44,0x44,0x05,0x8c,
+  0xc3,0xec,0x56,0xa0,0x03,0x2d,0xaf,0xf4,0x87,0x88,0xff,0xc5,0x80,0x64,0x40,0x75,0xa7,0x25,0xb1,0x81,
+  0xed,0xdc,0xda,0xae,0x58,0xe7,0x2e,0xb2,0xc2,0xbc,0x1b,0x56,0x23,0x90,0x15,0xa2,0x9b,0x8e,0x47,0x63,
+  0x68,0x17,0x28,0xae,0x04,0xb5,0x56,0x4a,0x7b,0xe3,0xb1,0x2a,0xa6,0xe3,0x4c,0xfa,0xfc,0x18,0x7c,0x4c,
+  0xd4,0x4a,0xc0,0xcc,0x5b,0x7b,0x0d,0xb4,0xa7,0xfe,0x64,0xb0,0x70,0xa0,0x5a,0xbc,0x5b,0xc9,0x2d,0x0b,
+  0xac,0x9d,0xcc,0x8a,0xed,0x7e,0x23,0x5b,0x98,0x7c,0x5b,0x01,0x57,0xcd,0xe3,0x2a,0x3e,0x4e,0xa2,0xe0,
+  0x96,0x09,0xc2,0x62,0x68,0xc5,0x10,0x45,0x62,0x6d,0xc6,0xf2,0x15,0xb9,0xce,0x06,0x95,0x43,0x0b,0x91,
+  0x82,0x43,0x40,0x75,0xd0,0x24,0x93,0x9d,0x00,0x4f,0x95,0x26,0x51,0xef,0x80,0xa5,0x14,0x2c,0x97,0x68,
+  0xd6,0x81,0xd1,0x9a,0xd9,0x4a,0x6d,0x5e,0x4f,0xea,0x46,0x78,0x9c,0x4e,0x14,0x84,0x82,0x3f,0x9b,0x5d,
+  0x4e,0xe6,0x1c,0x7f,0x52,0xe8,0xc6,0x30,0x52,0xa4,0xf9,0xe2,0xec,0xcb,0x5a,0x82,0xac,0xc8,0x49,0x77,
+  0x7a,0x82,0xd3,0x7d,0x32,0x0f,0xa4,0xa3,0xc2,0xd6,0x73,0x8a,0xe7,0x79,0x31,0x2c,0x78,0x9e,0x83,0x13,
+  0x3c,0xcf,0xce,0xa0,0x18,0x80,0x39,0xbe,0x0d,0x56,0x1a,0x77,0xc2,0x5d,0x63,0x16,0xd9,0xb1,0x40,0x8d,
+  0x04,0xc0,0xc7,0x93,0x46,0x1c,0x77,0x7b,0x0d,0x75,0x2a,0xe6,0x66,0x9b,0xec,0x33,0xbf,0x32,0xad,0xf2,
+  0xac,0x05,0xf3,0x4e,0xd8,0x59,0xaf,0x2a,0x7c,0xfd,0xc3,0xfe,0x7b,0x85,0xbb,0x3a,0x38,0xb0,0xcb,0x3e,
+  0x98,0x9b,0xc0,0x61,0x21,0xf1,0x67,0x0d,0x36,0x05,0x95,0x5a,0xb7,0xff,0x16,0x83,0x29,0x60,0x18,0x6b,
+  0x64,0x65,0x97,0x2c,0xaf,0x43,0xc1,0x8c,0x8b,0x72,0x30,0xa3,0x7f,0xc8,0x48,0xa8,0x71,0x55,0x2a,0x68,
+  0x74,0x58,0x0b,0x2a,0x14,0x24,0x9c,0x4a,0xfb,0xd6,0x28,0xce,0x48,0xa5,0x99,0x9b,0xb0,0x83,0xbb,0x0d,
+  0x17,0xd6,0x51,0xa6,0x8a,0x46,0xa7,0x6d,0x2c,0x1c,0xa5,0x0c,0xa0,0xb9,0xb0,0xe2,0xb8,0x6a,0x67,0x3b,
+  0xb8,0xc1,0xe7,0x7a,0xa7,0x38,0xd5,0xee,0x62,0x99,0x7f,0x15,0x6e,0xbd,0x98,0xdd,0x78,0xb0,0x07,0xf7,
+  0x62,0xb0,0x7e,0x97,0x18,0xf6,0x57,0x38,0x01,0xb4,0x1f,0x03,0xdb,0xba,0x02,0x9f,0x4e,0xff,0x00,0x46,
+  0x50,0x59,0x82,0x71,0x0c,0x2b,0x04,0x58,0xc0,0xeb,0x3b,0x2b,0x06,0x5d,0x36,0x18,0x28,0x98,0x29,0x8e,
+  0x6f,0x8a,0xfa,0x1e,0x08,0xbb,0x4f,0xe3,0x6a,0xfd,0x51,0xc9,0x89,0x37,0x2f,0x8d,0x87,0x52,0x4f,0x04,
+  0x7e,0x5a,0x4f,0x13,0x0f,0x4f,0xf6,0x65,0x0b,0x36,0x2f,0x6a,0x60,0x9a,0x87,0xb7,0x78,0xc2,0x72,0x8a,
+  0xce,0xa2,0xed,0xf4,0x88,0x34,0x97,0x75,0x96,0x49,0xbe,0xca,0xc2,0x72,0xc0,0x6d,0xde,0x1f,0xf2,0xe9,
+  0x0e,0x18,0xc0,0x17,0x19,0x08,0x0d,0x00,0xfb,0xb5,0xb2,0x2e,0x85,0x17,0x54,0x86,0x36,0x3e,0x22,0xbb,
+  0x57,0xc7,0x45,0xb7,0xc7,0xdd,0xe3,0x5a,0xdd,0x93,0x37,0x6d,0xcb,0x02,0xfc,0xf8,0xd2,0xb2,0xae,0x2e,
+  0xad,0xb2,0xec,0x3e,0xee,0xdb,0x43,0xab,0x6f,0x03,0x84,0xe5,0x72,0xff,0x95,0x74,0xc0,0x03,0x29,0xeb,
+  0xc3,0xf8,0x60,0x6c,0xb0,0x8c,0x0c,0xa0,0x32,0xee,0x8f,0x89,0x17,0xf6,0x05,0x27,0xe0,0xb0,0xd6,0x29,
+  0x6a,0x19,0xd8,0xc1,0x0f,0xaf,0x29,0x1d,0x6d,0x74,0x16,0x2c,0xb9,0x63,0xcc,0xaf,0xdc,0x46,0x01,0x07,
+  0x61,0x28,0xd7,0xab,0x8e,0x9c,0x79,0xdd,0x1b,0xf5,0xba,0x3d,0x8b,0x3a,0x62,0x4c,0xed,0xc4,0x6e,0x65,
+  0xc3,0x21,0x85,0x30,0x99,0x2c,0x18,0x2c,0x34,0x53,0x5d,0x8d,0x03,0x66,0xf9,0x30,0xd3,0x9e,0x68,0xd4,
+  0x9e,0x68,0x85,0x57,0x78,0xd8,0xdc,0xa7,0xf7,0x4f,0x92,0xc4,0xd1,0xf1,0x18,0xba,0x10,0xbc,0xd8,0xad,
+  0x15,0x96,0x0a,0x06,0xcb,0x07,0x98,0x1e,0x4c,0xbf,0x60,0x13,0xd7,0xec,0x9b,0xbd,0x0b,0xde,0x98,0x0e,
+  0x0e,0x38,0x59,0x2e,0x15,0x9f,0xeb,0xb2,0x3c,0xd9,0x02,0xa5,0xf8,0x41,0x8d,0x35,0x0d,0x16,0xff,0x00,
+  0x03,0xac,0xb3,0x74,0x41,0xfc,0x91,0x09,0xf2,0xa1,0xd3,0x63,0xfc,0x0f,0x08,0x98,0x7e,0x60,0x45,0xc9,
+  0x17,0xe1,0x90,0x1f,0xf2,0x33,0xdd,0xf6,0x22,0x6d,0x87,0xb9,0x63,0x87,0x4c,0x35,0x1d,0x9c,0x0b,0x6c,
+  0x20,0xc1,0x1e,0x8f,0xaa,0xf8,0x74,0xba,0x84,0xda,0xa4,0xc7,0x2b,0x93,0x93,0x18,0xe5,0xf2,0x14,0x95,
+  0x7d,0xb7,0x86,0x29,0x11,0xe3,0x60,0x44,0x08,0x3d,0xa1,0x29,0x12,0x7f,0x09,0xdb,0xd4,0x64,0x0d,0xbe,
+  0x21,0x88,0x2a,0xe9,0xc0,0xb4,0x90,0x79,0x9e,0x1b,0xc6,0x6e,0x5c,0xe6,0xb9,0x81,0x60,0x04,0xd3,0xda,
+  0x2b,0x58,0x0c,0x2a,0xe2,0x2b,0xfd,0x2f,0x19,0xb7,0x78,0xe0,0x43,0x23,0x7a,0xfb,0xe3,0xf1,0xd1,0xaf,
+  0x32,0x64,0x2f,0xdd,0x47,0x94,0xe3,0x17,0xb1,0x2a,0x6e,0xe5,0x5e,0x7a,0x6a,0xc4,0xe9,0xb0,0x21,0x4c,
+  0x22,0xc9,0xb5,0x7a,0x10,0x25,0xfb,0x53,0x77,0x4f,0xda,0xb7,0xf3,0x67,0x84,0x74,0xd4,0x97,0x2c,0x12,
+  0xbf,0x3e,0x56,0x7e,0x48,0xef,0x57,0xad,0x25,0x57,0x86,0x4a,0x90,0x62,0x58,0x1d,0xa5,0x28,0x6c,0x30,
+  0x9f,0x29,0x5f,0x55,0x3b,0xcf,0x36,0x46,0x5a,0xd1,0x09,0xac,0xf0,0x97,0x71,0x86,0xc7,0x77,0x93,0x92,
+  0x3c,0x14,0x0f,0x24,0xf0,0xb4,0x63,0x38,0xc2,0xff,0xcc,0xee,0xd8,0x10,0x60,0xd1,0x31,0xdf,0xb1,0x7d,
+  0xc9,0xf8,0xba,0xea,0x8b,0x16,0xaa,0x9f,0x3e,0x2e,0x04,0xe5,0xc8,0x97,0x06,0x4a,0x20,0xad,0x9f,0xe3,
+  0xf0,0xbc,0x8b,0x89,0xa4,0xf8,0x9c,0x68,0x99,0x72,0xaa,0x2c,0x56,0x62,0xa4,0xac,0xc4,0x88,0xaf,0x84,
+  0x12,0xdd,0xc1,0x40,0x05,0x2a,0x6d,0xad,0x38,0xbf,0x81,0xa1,0x60,0x22,0x49,0x57,0x6f,0xfb,0x1e,0x36,
+  0xa6,0x53,0x40,0x0a,0x29,0xfa,0x8a,0x4e,0xee,0xf7,0x25,0x1b,0xa2,0xe9,0xc2,0x1c,0xe9,0x69,0xda,0x17,
+  0x17,0x79,0xc8,0x58,0x02,0x5b,0x99,0x7d,0xc0,0xf2,0x3b,0x2e,0xfa,0x65,0x5b,0x58,0x91,0x89,0xaa,0x73,
+  0x11,0x30,0x39,0x13,0x3f,0xce,0x8b,0x99,0x3c,0x4e,0xe0,0xbb,0x04,0xea,0x8f,0x09,0xfe,0xa2,0xa6,0x7b,
+  0xae,0x9e,0xa7,0x5f,0x4b,0xa4,0x24,0x7a,0x57,0x14,0xb9,0x2a,0xef,0x5d,0x05,0x49,0x42,0x0a,0xa0,0x7e,
+  0xd7,0xd0,0xb6,0xd0,0x54,0xda,0x94,0x67,0x5e,0x25,0x3e,0x9f,0x68,0xfb,0x7e,0x96,0x68,0x51,0x7e,0x41,
+  0xee,0xb8,0xb3,0x7b,0x01,0x3f,0xd6,0x27,0xc5,0xf8,0x54,0x2f,0x9d,0xe6,0x4a,0x87,0x35,0xaa,0x7e,0x96,
+  0xc1,0x15,0xe2,0x85,0xf3,0x9e,0x79,0x31,0xd2,0x8e,0x18,0x3e,0x18,0xa6,0x4c,0x05,0x14,0xd7,0x57,0x6e,
+  0x00,0x9d,0xfb,0x09,0xe5,0xb1,0xa8,0x1b,0x47,0x18,0xf1,0x78,0xe1,0x34,0xb6,0xa3,0xc0,0xf3,0xc0,0x9e,
+  0x5d,0x5b,0x3b,0x17,0x40,0xf2,0xc4,0x91,0xaa,0x84,0x01,0x9a,0xb8,0x72,0x2e,0x43,0x1d,0x17,0x56,0xb4,
+  0x4f,0x63,0xbb,0x75,0x2d,0xc4,0xe1,0xcd,0x69,0x61,0x7c,0x1c,0xc9,0x01,0xc7,0xcf,0xf5,0x62,0x33,0xae,
+  0xcb,0x44,0xf9,0xac,0xc0,0x6a,0x39,0x94,0x5a,0xd8,0x37,0x8b,0xe3,0xce,0xe3,0xed,0x06,0x3a,0xdc,0xef,
+  0x73,0xd1,0xd1,0xde,0xb8,0x9a,0x71,0x8f,0xd9,0x31,0xc3,0xcf,0x72,0x3d,0x7b,0x14,0x2f,0x8b,0xb3,0x24,
+  0x01,0x9f,0x7d,0x99,0x7f,0x52,0x9b,0x01,0x30,0x8a,0xeb,0xe6,0x3f,0x3f,0xe8,0xb0,0x1e,0x08,0x25,0x0d,
+  0x3f,0xd5,0x1f,0xad,0xe0,0xeb,0x3a,0xa4,0x32,0x3e,0x13,0x0d,0x3a,0x50,0x7a,0x0b,0xb2,0x2c,0xa9,0x43,
+  0xfb,0x67,0x6d,0xe7,0xc2,0x51,0x4c,0x4b,0x3f,0xe2,0x4b,0x8c,0x2b,0x82,0x9d,0x0a,0x25,0x95,0x6c,0x89,
+  0xfe,0x28,0xae,0xcd,0x40,0x29,0xa0,0xf3,0x3e,0x08,0x99,0xff,0xa1,0x88,0x54,0x46,0x97,0x28,0x48,0x30,
+  0x3f,0x69,0x38,0x72,0xd8,0xaa,0x9e,0x10,0xa5,0x2d,0x4e,0xa4,0x20,0x3e,0xc8,0x96,0x1d,0xca,0x96,0x93,
+  0x4c,0x2c,0x79,0x58,0xeb,0x2b,0x49,0x23,0xc2,0x26,0xac,0xb4,0xe3,0xef,0x82,0xe8,0x96,0xb8,0x2a,0x25,
+  0xed,0x2a,0x72,0x9d,0x29,0xfe,0xea,0x00,0x63,0x41,0x09,0xa8,0x15,0x1e,0x6d,0x8e,0x27,0xbd,0x65,0xa4,
+  0x21,0x20,0xf8,0x4b,0x3b,0x4d,0x77,0xfa,0xf5,0x84,0xb7,0x28,0xae,0x19,0x66,0x9a,0x89,0x27,0x02,0xb9,
+  0x34,0x0c,0x16,0x32,0x0b,0x63,0xc2,0x9d,0x62,0x62,0x5d,0x12,0x68,0x3c,0x5d,0xac,0xad,0x0e,0xc7,0x2d,
+  0xca,0x5c,0x5a,0x1e,0x11,0x0a,0x94,0x33,0x92,0x20,0xc6,0x09,0xee,0xd5,0x53,0x19,0x4e,0x3e,0xc5,0xb5,
+  0xa1,0x56,0xe5,0x54,0x38,0x55,0x02,0x17,0xc0,0xe2,0x88,0xce,0x11,0xa1,0x15,0xc3,0xa4,0xa9,0x6f,0xc3,
+  0xcf,0xcb,0x86,0xeb,0x91,0x89,0x2c,0x90,0xd2,0xd6,0x83,0xaf,0xea,0x96,0x57,0xec,0x8b,0x72,0x24,0x33,
+  0xde,0x2e,0x4e,0x0c,0xac,0x7f,0x4a,0x9c,0xb9,0x42,0x35,0xfc,0x75,0xc3,0x1c,0xd7,0x6a,0x66,0x07,0x74,
+  0x97,0x17,0xb0,0x28,0xc6,0x5e,0x61,0xd9,0x5a,0x2e,0x2d,0xf0,0x6f,0x14,0xdc,0xc5,0xb4,0x4d,0x6a,0xe9,
+  0xaf,0x32,0x7f,0xc9,0xed,0xb5,0xfe,0x4c,0xfa,0xe1,0xc1,0xe4,0x67,0x3d,0x1d,0x7b,0x0d,0x4e,0x57,0x45,
+  0x56,0x64,0x6a,0x70,0x91,0x78,0x8c,0xb2,0x6d,0x3f,0xb7,0x6a,0xd8,0xfb,0x2b,0x65,0x22,0x1e,0x3c,0xe1,
+  0xcf,0x1d,0x15,0x74,0x8f,0xf9,0xf4,0x15,0xc1,0xc8,0x13,0x12,0x78,0x8a,0x86,0x1a,0x1e,0xbf,0xd7,0xa4,
+  0x9f,0xe0,0xb4,0x2b,0x0e,0x99,0x85,0x35,0x59,0x61,0xa5,0xc9,0x30,0x3e,0x76,0x34,0x85,0x3f,0x53,0x76,
+  0x86,0x3e,0x3b,0x9e,0xc6,0x8f,0x2e,0xe3,0x0e,0xee,0xc0,0xa7,0x64,0xb8,0xca,0x13,0x18,0xc5,0x16,0x1b,
+  0xf5,0xab,0x6c,0x31,0x29,0xe2,0x3c,0x94,0x46,0x4b,0xae,0x8e,0x55,0x6f,0x66,0x9d,0xd2,0xf4,0x93,0xec,
+  0xad,0x7e,0x06,0xb0,0x43,0x87,0x50,0x39,0xd3,0x96,0x75,0x59,0x6f,0xf8,0x65,0x76,0x7f,0xaf,0x3a,0x6c,
+  0xa5,0x30,0x71,0x3f,0x33,0xa8,0x40,0x4b,0x2f,0x4a,0x5e,0xf0,0xf4,0xa4,0x00,0x5e,0xd5,0x99,0x11,0x3a,
+  0x05,0x15,0xe7,0xe5,0xca,0x74,0x31,0xe8,0xc2,0x4f,0x02,0xb9,0xe7,0xa3,0xc6,0xaa,0x4e,0x0c,0xab,0x54,
+  0x04,0x64,0x8e,0x25,0xe4,0x16,0x51,0xb0,0xad,0xe4,0x44,0x8d,0x79,0x3c,0xfd,0xf4,0x70,0x6a,0x6c,0x3e,
+  0x8f,0x53,0xc1,0xe2,0x13,0x43,0xd6,0x03,0x0c,0x59,0x1f,0x9e,0x17,0x87,0x28,0x66,0x57,0x79,0x7c,0xa6,
+  0x36,0x96,0xc2,0x9b,0xf1,0xc1,0x02,0x66,0x93,0x6b,0x63,0x3a,0x91,0xb5,0x02,0x55,0xb9,0xca,0xce,0x8e,
+  0x06,0x15,0x67,0x47,0x57,0x97,0x45,0xfa,0x26,0x60,0xc3,0x7f,0x1a,0x0f,0x0f,0x64,0x38,0xa8,0xe8,0xec,
+  0x57,0x84,0x83,0x4e,0x3c,0x9d,0xad,0x09,0x03,0x15,0x96,0xf7,0x88,0xee,0x1c,0xc5,0x07,0x96,0x90,0x26,
+  0x7a,0x38,0xe2,0x91,0x0b,0xb3,0x1c,0x3a,0xd9,0x54,0xc1,0x52,0x76,0x9e,0xd4,0x3f,0xe3,0x62,0xc8,0xf9,
+  0x14,0xef,0xb7,0x4e,0x25,0x57,0x9f,0x48,0xf7,0x14,0xef,0x18,0x9d,0xe3,0xea,0xf4,0xf4,0xda,0x2c,0x6f,
+  0x99,0xdc,0xfa,0x29,0x4a,0x9b,0xf2,0xd3,0x94,0xac,0xd8,0x53,0x4c,0xdd,0xcb,0x31,0xb7,0x73,0xf9,0x2d,
+  0x91,0x43,0x6a,0x49,0x4e,0x06,0xc3,0x55,0xdd,0xdc,0x38,0x9a,0xb9,0xaa,0x39,0xbb,0x3c,0x29,0x26,0xd4,
+  0x37,0x8e,0xed,0xfe,0xa6,0x7a,0x1e,0x2e,0xad,0x97,0xaa,0x25,0xca,0xef,0x48,0x84,0x76,0xfe,0x02,0x40,
+  0xbf,0x0a,0x71,0x2d,0xde,0x00,0x63,0x56,0x65,0xd2,0x1f,0xd2,0x58,0xf9,0xd8,0x77,0x75,0xb0,0x21,0x37,
+  0x56,0x02,0x2f,0x5f,0x27,0xce,0x3b,0x30,0xea,0x6c,0x9e,0x9c,0x55,0x73,0xcc,0xbd,0x3f,0xc1,0x98,0x3d,
+  0xe2,0xe9,0xe6,0xcf,0x68,0x2a,0x04,0xbd,0x82,0x04,0x5f,0x49,0xb6,0xcb,0x70,0x6b,0x23,0xc1,0x23,0xa5,
+  0x79,0xec,0x05,0xc9,0x5e,0xb9,0x76,0x34,0x38,0xae,0x0a,0x30,0x37,0x8a,0x1d,0xb4,0x21,0x87,0x85,0x7c,
+  0x95,0x53,0xf2,0xa4,0xa5,0x95,0x75,0x90,0x68,0x88,0xad,0x49,0x09,0x57,0x9f,0xb0,0xaf,0x95,0x6d,0x40,
+  0x89,0x2e,0x0f,0xbf,0x10,0x83,0xe5,0xc7,0x80,0xfd,0x4d,0xde,0x67,0x39,0x05,0x50,0x89,0x4f,0x6b,0x43,
+  0xf8,0x39,0x7f,0xbd,0x7b,0x2c,0x8b,0xa7,0xa7,0xd0,0xed,0x84,0x34,0xa1,0x71,0x39,0x52,0x53,0x37,0x2d,
+  0xd3,0x61,0xcb,0xc3,0xb2,0xd7,0xa9,0x38,0x2a,0xac,0x3d,0xfa,0x17,0x94,0xe4,0x9c,0x51,0x37,0xa6,0x66,
+  0x7e,0x2c,0x1e,0xe3,0x1f,0x0e,0xcf,0x94,0xee,0xf5,0xa5,0xfa,0x8c,0x32,0x5a,0x15,0x0f,0x9a,0x67,0xb8,
+  0xd6,0x84,0x3a,0x6a,0xb1,0x39,0x94,0xf9,0x5a,0xd3,0xe9,0xff,0xd3,0x5d,0x93,0xcf,0x02,0xf6,0xba,0xe4,
+  0xbe,0xb3,0x06,0xd2,0x7f,0xee,0x51,0xe0,0xd0,0xf8,0x8c,0x54,0xf3,0x34,0xf9,0x36,0x46,0x32,0xe5,0x36,
+  0xe2,0x83,0xb6,0xbf,0xaa,0x45,0x78,0x6c,0x57,0x01,0x01,0x46,0x79,0xd2,0x9c,0x78,0x56,0x9c,0xa0,0x53,
+  0xee,0x39,0xc6,0xfe,0x94,0x60,0x8a,0x02,0x40,0x33,0xe3,0xba,0x6c,0xc1,0xcf,0x0c,0xf3,0x8a,0x74,0xe2,
+  0xf4,0x14,0x26,0xdd,0x07,0x6a,0x32,0x20,0x14,0x4c,0x76,0xd6,0x29,0x59,0x8b,0x84,0x46,0x95,0xb2,0x2b,
+  0xa6,0x0b,0x09,0xfe,0xec,0x57,0xdd,0x58,0xc8,0xa3,0x76,0x3c,0x4f,0xb3,0xf2,0x00,0x2a,0xc3,0xbd,0x7c,
+  0x6b,0x45,0xf8,0x5c,0x9f,0x76,0x49,0x25,0x97,0xaa,0x52,0xba,0xa6,0x51,0x3f,0xda,0x89,0x37,0x58,0xfa,
+  0x27,0x5f,0x38,0xe8,0x1d,0x99,0xde,0xe7,0xdd,0x61,0x19,0x16,0x6e,0xf0,0x1c,0x3b,0x4a,0x55,0x1c,0x11,
+  0xf5,0x0e,0xcb,0x45,0xd9,0x8a,0x11,0xca,0x86,0x93,0x36,0x9f,0x28,0xcf,0x8f,0x53,0xf3,0xe1,0xd9,0x76,
+  0x57,0x43,0x35,0x52,0x75,0xc4,0x9a,0x97,0x8e,0xaa,0x89,0x6f,0x82,0x3f,0x3a,0xf4,0xf2,0xbf,0x91,0xb8,
+  0xca,0x18,0x44,0xd8,0x2f,0x27,0xe0,0xff,0x21,0x82,0x99,0xf1,0x5d,0xfd,0xe5,0x97,0x71,0xd1,0xdf,0x2c,
+  0xa2,0xcf,0x73,0xdf,0x0b,0xd4,0xea,0x55,0x18,0xad,0x75,0x06,0xe6,0xa7,0x5d,0x85,0xc9,0xa1,0xfd,0xd9,
+  0x37,0x61,0x72,0x50,0xbe,0xe8,0x22,0x8c,0x92,0x14,0x50,0xbc,0xa7,0xf2,0x19,0x17,0x61,0x8a,0xb3,0xcb,
+  0xdf,0x83,0x19,0x57,0xdc,0x83,0x79,0x72,0xce,0x3f,0x0c,0xf1,0xe4,0x9c,0x3e,0xfc,0xf1,0x04,0xcf,0x56,
+  0xe6,0x67,0xf4,0x15,0x10,0x16,0x69,0x36,0x6c,0x33,0xf1,0x4c,0x97,0xb7,0xe2,0xf1,0x3b,0x12,0x8e,0xbb,
+  0x93,0xc5,0x78,0x33,0x5d,0x9f,0x3f,0x71,0x37,0x2b,0x2d,0x8e,0xec,0x99,0x7e,0x8e,0x05,0x66,0xe8,0xaf,
+  0xae,0x77,0xb3,0xd1,0xa2,0xd7,0xbb,0x74,0x06,0x23,0x8b,0x59,0xdd,0xb1,0x73,0x69,0xeb,0x9a,0xe5,0x25,
+  0x33,0xfd,0xdd,0xdb,0x1b,0xed,0xe9,0xd6,0x71,0xb1,0xdf,0x39,0x80,0xca,0x03,0x14,0x77,0xd6,0x75,0xf1,
+  0x75,0x90,0xff,0xfc,0x0f,0xed,0x25,0x8c,0x1b,0xf9,0x2c,0xa1,0x67,0x87,0x66,0x5b,0xd1,0x0f,0xef,0x6f,
+  0xea,0x9a,0xeb,0x88,0xa7,0xf9,0x13,0x3c,0xe1,0x93,0x95,0xfc,0x5a,0x2f,0xaf,0x96,0xcf,0xf4,0xbd,0x91,
+  0x99,0xfe,0x0a,0xe9,0x1e,0x6b,0xdb,0x50,0xbb,0x5b,0x33,0x5f,0x4b,0xd6,0x6e,0xac,0x2d,0x02,0x2b,0x72,
+  0xb4,0x98,0xb1,0x58,0xb3,0xb4,0x5b,0x3f,0x58,0x68,0x60,0x47,0xf8,0x5a,0x80,0xc4,0x70,0xed,0x5b,0xc4,
+  0x1b,0xa1,0xe7,0xc7,0x10,0x17,0x48,0x33,0x1c,0xf0,0x65,0xfe,0x9f,0xff,0x81,0x3f,0x75,0xed,0xf1,0xce,
+  0x76,0xd6,0x81,0xde,0x52,0xd8,0xe5,0x29,0x3a,0x6c,0xc7,0x1b,0xd3,0x43,0xe0,0x13,0x32,0xd0,0x95,0xa1,
+  0xdb,0xda,0x34,0xd2,0x29,0x3d,0xc7,0x72,0x2d,0x09,0x34,0x5e,0x93,0x27,0x33,0xf6,0x5f,0xde,0xa1,0x61,
+  0xa9,0x6b,0xb4,0xec,0xb3,0xc6,0xe7,0x79,0xea,0xa7,0xdc,0xc4,0x33,0x47,0xf9,0x1c,0x80,0xf1,0x01,0x7b,
+  0xa9,0x51,0x35,0x65,0x71,0x47,0x31,0x9d,0xda,0x0f,0xc0,0xd6,0x9b,0xad,0xbd,0x86,0x75,0x62,0xda,0x0e,
+  0xa3,0x16,0x0c,0xbf,0x50,0xe3,0x63,0x0e,0x32,0xc0,0xd1,0x98,0x6f,0x07,0xc8,0xb4,0x0e,0x43,0x31,0xa4,
+  0x6f,0x9e,0x20,0x31,0x7f,0x0d,0xbc,0x73,0x5e,0x24,0xa8,0x7b,0xf6,0x84,0xd4,0xaf,0x46,0xea,0x57,0x27,
+  0x95,0xab,0x6b,0xe0,0x08,0xce,0xf4,0x1e,0xfc,0xb5,0x3e,0xc2,0xdf,0x2e,0xd2,0x87,0x85,0x54,0x82,0x44,
+  0xc3,0x97,0xd8,0x73,0x90,0xf0,0xd4,0x77,0xa6,0x07,0xfe,0x0d,0x94,0xfd,0x88,0x2f,0x4d,0xe4,0x1b,0x13,
+  0x0c,0x99,0x2d,0x33,0x68,0x69,0x08,0x27,0xd9,0xe4,0x79,0xb0,0xd9,0xb8,0xf9,0x36,0x02,0x33,0x75,0x9e,
+  0x50,0x93,0x8d,0x84,0x2f,0xf3,0xff,0xfa,0xd7,0x7f,0x4b,0xf1,0x2d,0xd3,0x86,0xdf,0x78,0x4b,0x49,0xf3,
+  0x9d,0xe7,0x86,0x9c,0x59,0xd3,0x70,0x90,0xe6,0x2e,0x35,0x3a,0x70,0xc5,0xe7,0x25,0x63,0x1e,0xb0,0x36,
+  0xc8,0xfe,0x1d,0x70,0x77,0x0c,0x48,0x2a,0xcc,0x9e,0x52,0xea,0x47,0x1f,0xaf,0xa1,0xa5,0xbd,0xd2,0xe1,
+  0x95,0x71,0xf9,0x0d,0x3b,0x8e,0x2a,0xe0,0x90,0xac,0x3c,0x85,0x19,0x79,0x25,0x40,0x01,0x7e,0x4c,0x17,
+  0x54,0xfe,0xe1,0x1a,0x25,0x0f,0x2d,0xbb,0xbd,0x56,0xd0,0x2c,0xb6,0x40,0x4b,0x29,0xca,0x2e,0x85,0x55,
+  0x55,0x70,0x8c,0xc4,0x63,0x4e,0x14,0x2c,0xd8,0x17,0x30,0xd0,0x0a,0x52,0x7e,0x0e,0xdb,0x9d,0x8f,0xb2,
+  0xc1,0x57,0x48,0xf2,0x10,0x50,0x1a,0x94,0x53,0x1c,0x68,0xfc,0xc4,0x21,0x26,0x7a,0xec,0x56,0x1a,0x7e,
+  0xe1,0xe8,0x59,0x00,0xec,0x40,0xd7,0xfd,0xfb,0xf4,0x3f,0xd6,0x85,0x56,0xb2,0x4e,0xe9,0x81,0xe6,0x80,
+  0xae,0xc1,0xd8,0xaf,0x87,0x7d,0xf3,0x0a,0x3c,0xdb,0xcb,0xa7,0xa3,0xae,0x36,0xa2,0x2e,0xf0,0x73,0x79,
+  0x69,0xf6,0xb0,0x50,0x3f,0x2f,0x74,0xc4,0x7c,0x33,0xa1,0x93,0x22,0xfb,0x14,0x00,0x9a,0x72,0x3f,0x0b,
+  0x48,0x66,0xdd,0xcf,0xf4,0xfe,0xe5,0x95,0x39,0xc8,0x55,0xf0,0x8b,0x5b,0xb2,0x06,0xc7,0x3c,0x87,0x99,
+  0x14,0x68,0x4b,0xe2,0x5a,0x20,0x22,0x18,0xbc,0x1c,0x1b,0xa0,0x89,0x3e,0xef,0x74,0x2a,0x58,0x8e,0x7c,
+  0x06,0xd1,0xc8,0x5b,0x40,0x2b,0x4e,0xbe,0xe2,0x3a,0xe7,0xfe,0xa8,0x9c,0x23,0xb3,0x24,0x0b,0x23,0x63,
+  0xb2,0x99,0xc2,0x43,0xf6,0xc6,0x69,0x36,0xc2,0x88,0xed,0x1a,0x99,0x4e,0x7b,0x0b,0xaf,0x6e,0xb0,0x8d,
+  0x51,0xb1,0x17,0xd7,0xa5,0x3f,0x84,0xff,0xa0,0x82,0x68,0x8b,0x54,0xbc,0xd0,0x2e,0xd6,0xfd,0x5d,0xaf,
+  0xff,0xc3,0xc5,0x1f,0x9b,0x81,0x39,0xd2,0x2e,0xbc,0x31,0xfe,0xfe,0xf5,0xe2,0x0f,0xa0,0x07,0x27,0x47,
+  0x15,0x76,0x98,0x1e,0x88,0x8e,0x59,0x09,0x15,0x28,0x53,0x51,0x81,0xd7,0xf3,0xb7,0xd6,0x36,0x16,0x1c,
+  0x07,0xdd,0xa8,0xd7,0x29,0x98,0x8d,0xb5,0xd1,0xae,0x37,0xf4,0x7a,0xbd,0xce,0xe5,0x51,0x5c,0x8a,0x68,
+  0xf8,0xa0,0x38,0x15,0x34,0x7e,0x62,0xb8,0xbf,0x9c,0x44,0x8d,0xde,0x18,0x09,0xd0,0xb9,0x78,0x05,0x84,
+  0x01,0xb2,0xfc,0xf1,0xba,0xc7,0x1f,0xd6,0xfd,0x5f,0x2f,0xd6,0x9d,0xfe,0x27,0x63,0x82,0x79,0x81,0x0a,
+  0x26,0xaf,0xe1,0x35,0x25,0x05,0xd6,0x9d,0x84,0xd6,0x40,0xbb,0xda,0x5d,0xac,0x87,0xde,0x48,0x1b,0xfd,
+  0x3a,0x7c,0x75,0xa9,0x5d,0xfd,0x30,0xf8,0x63,0xd3,0xc3,0xe5,0x1a,0xd8,0xdd,0x4e,0xcf,0xbc,0xbc,0x84,
+  0x5f,0xdd,0x7e,0x67,0x60,0xf6,0xaf,0x3a,0x7d,0x40,0x7f,0x68,0x76,0x07,0xbb,0xb1,0xd9,0x1d,0xd9,0x3d,
+  0x73,0x38,0xee,0x98,0x97,0x03,0x0d,0x8b,0xfb,0x66,0x7f,0xa4,0x89,0xfa,0x8a,0xa9,0x94,0x67,0x84,0x77,
+  0x70,0x0a,0x0c,0x28,0xee,0xdb,0x08,0xf5,0x0b,0x2f,0x42,0xf7,0x96,0xfa,0xf2,0xeb,0x2e,0x62,0xb2,0xfc,
+  0xb9,0xb4,0xbb,0xca,0xdb,0x4a,0x7a,0x3a,0x60,0x5a,0xc0,0x37,0x5c,0x5d,0xcd,0xe7,0x29,0x6b,0xc9,0xd2,
+  0xa0,0xa4,0x09,0x09,0xb4,0x1f,0xf2,0xe7,0x6a,0x38,0xaa,0x2c,0xa7,0x1a,0x92,0x77,0xb3,0xa2,0xa4,0xd2,
+  0xda,0xc2,0x64,0xf6,0xa2,0x30,0xca,0xa1,0xaa,0x7b,0x58,0xb2,0xda,0xaa,0xae,0xf6,0xd2,0x7a,0xaf,0xb2,
+  0x01,0xe6,0x62,0xa7,0x23,0xb8,0x9b,0x9a,0xf9,0x57,0x99,0x02,0xb6,0xe5,0x8b,0x05,0xc2,0xa7,0x12,0xd9,
+  0xf1,0x6c,0xa4,0x72,0x44,0x24,0x99,0x86,0x49,0xa3,0x85,0x89,0xe6,0x19,0x1b,0x68,0x69,0xe3,0x9e,0xf5,
+  0x02,0xfe,0x62,0x60,0xac,0x6a,0xf1,0x73,0x1d,0xbc,0xc0,0xa6,0x2d,0xd2,0x04,0x77,0x27,0xb0,0x1c,0xec,
+  0xfb,0x33,0x5b,0x46,0x2c,0x5e,0x17,0x57,0x92,0x27,0x39,0xa5,0xf3,0xe0,0x7b,0x33,0x40,0x0a,0x19,0xee,
+  0xac,0x32,0x23,0xed,0x86,0xdc,0x97,0x9b,0xb5,0x15,0x32,0x8d,0xef,0xc5,0x74,0x03,0x0f,0x8c,0x5e,0x71,
+  0xeb,0x0d,0x9e,0xbc,0x60,0xeb,0xf8,0x2c,0x8e,0x53,0x1b,0x51,0x76,0xce,0x53,0x4a,0xc9,0x91,0x2a,0x32,
+  0xba,0x74,0x0e,0x8a,0xe5,0x5c,0xb3,0xcf,0x9f,0x59,0x08,0x9c,0xe3,0x5d,0x61,0x21,0x11,0xf5,0x3d,0x6c,
+  0x24,0xac,0xa5,0x0e,0x9a,0x49,0x65,0x7b,0x89,0x8c,0x1c,0x90,0x7b,0xc5,0x58,0x82,0x3d,0x09,0xfb,0x15,
+  0x8d,0x20,0x15,0x87,0xd4,0x00,0xda,0xd1,0x08,0xf3,0x6e,0xbd,0x48,0x1c,0x9b,0xc7,0x3b,0x22,0xd9,0xd1,
+  0x99,0xf0,0x66,0x9f,0x33,0x17,0xde,0xf3,0xb4,0xd9,0x88,0x51,0xbe,0x64,0x3e,0xaf,0xd2,0x85,0xcf,0xba,
+  0x0a,0x25,0xc0,0x23,0x4e,0x95,0x9c,0x1f,0xdf,0x89,0x89,0xde,0x61,0xff,0x92,0x95,0x86,0x85,0x55,0x66,
+  0x9a,0xfc,0xc3,0xf9,0x36,0x15,0xc9,0x47,0x9d,0x8e,0x76,0x9e,0x99,0x6b,0x5a,0xa7,0x53,0xb6,0xe4,0xf0,
+  0xeb,0x02,0x85,0x29,0xa4,0x19,0x47,0x64,0x53,0x09,0xc3,0x54,0xd6,0x51,0x12,0x5a,0xb1,0x03,0x4f,0xba,
+  0x02,0xbc,0xd6,0x83,0xf9,0xf7,0x3c,0x86,0x0b,0x13,0x87,0x97,0xbc,0xc9,0xbc,0x5d,0xe8,0x73,0x32,0xbe,
+  0x51,0x32,0x9e,0xb9,0x3e,0x86,0x4a,0xe3,0x7a,0xef,0x49,0x3d,0x43,0x15,0xa6,0x22,0x2f,0x79,0x46,0x62,
+  0x92,0x4e,0x5b,0xe6,0x22,0xe6,0xbd,0x4b,0xa0,0x44,0xd6,0xe6,0x93,0x67,0xf1,0x94,0x67,0xb7,0xd4,0x4c,
+  0xe2,0x95,0xbb,0x88,0x40,0x88,0x71,0x1a,0x2f,0xd0,0x4a,0x05,0x3f,0xf3,0x5d,0x74,0x5f,0x3f,0x13,0x35,
+  0x1d,0x8b,0xcf,0x84,0x97,0x3c,0xa7,0x82,0x4a,0xad,0xac,0x64,0xd7,0xa4,0x5e,0x30,0x96,0xd4,0xce,0xbd,
+  0x7e,0x33,0xaa,0xb3,0xd7,0xc1,0xf1,0xe7,0xa0,0xf1,0xa1,0xc8,0x53,0x60,0x56,0xbb,0x61,0x32,0x3f,0xb3,
+  0x61,0xcc,0x44,0x7b,0xfa,0xf3,0xf3,0x19,0x99,0xa7,0xd3,0x33,0xf0,0x18,0x35,0x8c,0x63,0x83,0x87,0x36,
+  0xeb,0xf4,0xda,0xf8,0xf8,0x2a,0x58,0xcd,0x74,0xbd,0x0d,0x60,0x9e,0x62,0xe0,0x62,0xd6,0x9d,0x9e,0x2d,
+  0xb7,0x3e,0xa7,0x38,0x48,0xde,0xf7,0x68,0xe0,0x37,0xc1,0xf0,0x6c,0xd3,0xf5,0x04,0x63,0x4f,0x30,0xc0,
+  0x82,0x9e,0x39,0x81,0x0d,0xc6,0xa8,0x9f,0x98,0x2b,0x96,0xbc,0xf4,0x18,0x3e,0x3e,0xbb,0xff,0xd1,0x69,
+  0x92,0x79,0x6d,0x4c,0xcf,0xe0,0x8f,0x49,0x42,0x63,0x72,0x73,0xf9,0x45,0x66,0x2d,0x03,0x46,0x1d,0x84,
+  0x79,0xde,0xeb,0x76,0xff,0x02,0x2f,0x15,0xad,0x67,0x34,0xdc,0xb5,0x8e,0xd7,0x35,0xf5,0x09,0xb4,0x9d,
+  0x8f,0xbb,0xf0,0x66,0x0f,0x87,0xfc,0x6d,0x84,0x6f,0xfc,0x5b,0x96,0xfa,0x44,0x7f,0x3c,0xb4,0x06,0xa3,
+  0xc1,0x48,0xe7,0x33,0x04,0xd3,0xba,0x1e,0x3b,0x34,0xb7,0x61,0x3c,0xbc,0xd8,0x8f,0xbe,0xf1,0x73,0xf1,
+  0x29,0x55,0x28,0xe6,0x85,0x44,0xdf,0x9f,0xe8,0x83,0xab,0x68,0xa2,0xb7,0x9a,0x02,0x11,0x70,0x84,0x13,
+  0x18,0x09,0xfb,0xd6,0xc3,0x46,0x2b,0xdd,0xc8,0xc1,0x15,0xbd,0xe9,0x0f,0x74,0xe7,0x16,0x3c,0xe0,0xf9,
+  0x40,0x98,0xde,0xcc,0xf6,0x0f,0x0a,0xbd,0xad,0x30,0xf4,0xee,0x9b,0x48,0xe4,0x37,0x74,0x09,0x50,0x9c,
+  0x05,0x35,0x6f,0xda,0x0e,0x0c,0xcb,0xbf,0xbb,0xd8,0xbc,0x81,0xc7,0x1b,0x33,0x76,0x7d,0x9b,0x01,0xa3,
+  0xc3,0x32,0x4e,0x35,0xed,0xfc,0x1c,0xb4,0x0d,0xeb,0x00,0x81,0x93,0x89,0xe6,0xc0,0x76,0x07,0x3e,0x25,
+  0xca,0xde,0x6a,0x9d,0x90,0xef,0xee,0x04,0x09,0x7a,0xa0,0x5b,0x9f,0x82,0x85,0xcc,0x01,0xd7,0xcc,0x81,
+  0xbf,0x31,0xa0,0x91,0x0e,0x1e,0x82,0x27,0xd6,0x84,0xa1,0x5d,0xc7,0x63,0x6f,0xd1,0x2b,0x03,0x56,0x20,
+  0xc8,0x08,0x00,0x33,0xaa,0xc0,0xd3,0x75,0xb4,0x38,0x00,0x83,0x0e,0xbf,0x0b,0x49,0x4e,0x1c,0xf6,0xc1,
+  0x0f,0x54,0x2e,0xb7,0xf0,0x17,0x3f,0x85,0xa8,0x59,0x2b,0xcb,0xf5,0xcf,0x96,0x2c,0xb1,0xd7,0x4d,0xfd,
+  0xdc,0x0a,0xdd,0x73,0xfc,0xf4,0xeb,0x36,0xbe,0x26,0x84,0x67,0x40,0xcf,0x1b,0x73,0xf7,0xe7,0x9f,0x5d,
+  0xc3,0x38,0x33,0x01,0xb0,0xdf,0x8c,0x66,0xf3,0xc8,0xe4,0x6d,0x66,0xb3,0xd9,0xa0,0x3b,0xbc,0xf6,0x01,
+  0xd8,0x24,0x32,0xff,0x11,0x07,0x7e,0xd3,0x30,0x78,0x2b,0x67,0x36,0xdf,0xbb,0x4b,0x20,0x8d,0x24,0xd1,
+  0xf4,0xc1,0x30,0xc1,0x22,0x80,0x51,0x9a,0x06,0xd4,0x3d,0x18,0x53,0x75,0x2e,0x82,0x54,0x48,0x49,0xec,
+  0x05,0x62,0xfe,0x37,0x00,0x8e,0x80,0x8d,0x7d,0xca,0xd4,0x8e,0x89,0x6c,0xed,0xe0,0xbd,0x1b,0x63,0x2a,
+  0xa5,0x82,0x0a,0xa7,0x0f,0xf5,0x6b,0x2c,0xfd,0x0f,0xc3,0x74,0x7d,0x9f,0x45,0x3f,0xbc,0x7b,0xfd,0x0a,
+  0x3a,0x61,0xd1,0xf5,0x59,0xe3,0x24,0xff,0x60,0xb8,0x1e,0xee,0x7a,0x17,0xe8,0x2d,0x8d,0xb5,0x2e,0x3d,
+  0xaf,0x3b,0xc3,0xcc,0x94,0x6e,0x4c,0x4e,0x82,0x53,0xe9,0xdb,0x34,0xb8,0x00,0x6c,0x16,0xb3,0x43,0xf8,
+  0x93,0xd3,0x00,0x04,0xdb,0x2c,0x38,0xb7,0xbf,0x02,0x3d,0x25,0xbe,0xe4,0xd3,0x14,0x9c,0x2a,0xc9,0xc2,
+  0xc1,0x85,0xf5,0xe0,0x52,0x6b,0x1b,0xda,0x22,0xa9,0xe9,0xeb,0x01,0xda,0xb7,0xdf,0x6a,0xfc,0xe9,0xd1,
+  0x6c,0x26,0x79,0x1e,0xd6,0x62,0x13,0x0a,0x19,0x97,0xdf,0xce,0xd5,0x95,0x93,0x66,0x10,0x0a,0xa8,0x57,
+  0xc4,0x2f,0xfd,0x54,0x83,0xde,0xe2,0xc0,0xa8,0x41,0x46,0xf5,0x46,0x4e,0xb7,0xf3,0x8f,0x14,0xa4,0x01,
+  0xbd,0x86,0xe8,0xd3,0x6a,0xa0,0xa2,0x6f,0xb4,0x04,0x66,0xbf,0x5a,0xde,0x7c,0x06,0xaa,0xa3,0x25,0x61,
+  0x42,0xc1,0x24,0x7d,0x42,0x26,0x62,0x5e,0xcc,0xaa,0x30,0x25,0xab,0x1f,0x99,0x0c,0x66,0xf9,0x88,0x0c,
+  0x88,0x17,0x22,0x99,0x4c,0xe8,0xc4,0xf8,0x00,0xd1,0x85,0x15,0x67,0xb4,0x77,0x07,0x1a,0x71,0x3b,0x8c,
+  0xd3,0x31,0x5e,0x10,0x0d,0x65,0x53,0x9e,0x5e,0x21,0x5a,0x03,0x4d,0xe3,0x05,0xf0,0xf1,0x82,0x9b,0x42,
+  0xc0,0x7d,0x68,0xba,0x4e,0x77,0x8b,0x9c,0xe2,0xe1,0xa5,0x73,0x39,0x57,0x7c,0x99,0x88,0x96,0x5c,0xf7,
+  0xc4,0xc9,0x21,0x7c,0x85,0x15,0x05,0x18,0x1f,0x68,0x26,0x6d,0x2d,0x81,0x73,0x72,0x18,0xe7,0x04,0x70,
+  0x4e,0x52,0x9c,0xb9,0x99,0x3d,0xdd,0x25,0x05,0xac,0x79,0x79,0x8a,0x37,0x7f,0x9d,0xa4,0xed,0x1f,0xce,
+  0x0e,0xc8,0x26,0xf9,0x92,0x46,0x01,0x20,0x14,0xfe,0xf9,0xa7,0xfe,0x53,0xa0,0xc5,0x21,0xb3,0x6e,0x59,
+  0x24,0x36,0x89,0xe8,0xc0,0x1e,0x41,0x31,0x6d,0xa3,0x1d,0x25,0x87,0x9b,0x60,0xc8,0x19,0x5a,0xad,0x0f,
+  0xb7,0xa2,0x38,0xb3,0xd1,0xb6,0x9c,0x03,0x3b,0x26,0x0f,0x92,0x4b,0x11,0xc2,0x5e,0x37,0xde,0x76,0xc5,
+  0xc5,0x48,0xbe,0x99,0x1e,0xf3,0x57,0xc9,0x7a,0xde,0x05,0x7e,0x8b,0x72,0xfb,0x14,0xa1,0x0b,0xfb,0x43,
+  0x9e,0x94,0x02,0xd0,0x2b,0x34,0x69,0x33,0x48,0xf4,0x9a,0x81,0xba,0x56,0x4a,0x27,0xd9,0x58,0xc0,0xe7,
+  0x1a,0x0a,0x82,0x56,0x35,0x94,0x96,0x7d,0x81,0xb5,0x3c,0xaa,0xfe,0x8b,0x5a,0xf9,0x70,0x16,0xad,0x0b,
+  0xcb,0x81,0xe4,0x68,0xe9,0x26,0xfa,0x73,0x9e,0x4e,0x13,0x46,0x4f,0x21,0x58,0x02,0x7e,0xe9,0x9e,0x36,
+  0xa3,0xbd,0x77,0x01,0x6b,0xc5,0x11,0x97,0x15,0x20,0xba,0xf9,0x82,0x27,0xbd,0x7e,0x17,0xe9,0x61,0x39,
+  0x8a,0x26,0xb3,0x1c,0x20,0x29,0x7e,0x53,0x54,0x10,0xf4,0x0e,0x8c,0xd5,0xe0,0xce,0xfc,0x0d,0xa8,0xfc,
+  0x0e,0x5c,0xe0,0xc8,0xb0,0x3d,0x66,0x45,0xf8,0x18,0x6c,0x93,0x72,0xed,0xf4,0xac,0x58,0x34,0x43,0x0f,
+  0x44,0x34,0xc7,0xdd,0x26,0x37,0x5a,0xc4,0x36,0xe0,0xc0,0xca,0x01,0xdb,0x88,0x50,0x27,0x43,0x90,0xb6,
+  0xa5,0xda,0x75,0xc7,0x93,0x05,0xa3,0x56,0xa3,0xe5,0xd5,0x59,0x13,0xf3,0x68,0x60,0xe7,0xe4,0x14,0x14,
+  0x9a,0xd9,0x3d,0xc0,0xa1,0x22,0x58,0xcc,0x69,0xe0,0x82,0xf0,0x69,0xc4,0x5c,0x50,0x6c,0x40,0xbf,0x22,
+  0xbd,0xc0,0x66,0x30,0xa6,0x7c,0xcd,0x73,0x95,0x72,0x7a,0xbc,0x5e,0x68,0x0e,0xef,0x00,0x2f,0xcb,0xc0,
+  0xbd,0xd1,0x8e,0x77,0x87,0x5b,0xa1,0xcb,0x26,0x34,0x87,0xe7,0xe0,0xba,0x66,0x8c,0x80,0xde,0x60,0x9e,
+  0x09,0x1e,0x61,0x99,0xa2,0x71,0xa1,0x4b,0xaa,0x4a,0xb0,0x6a,0x7a,0x16,0xef,0x8a,0x82,0x4f,0xc5,0x0f,
+  0x5c,0xa6,0x96,0x6e,0xc4,0x9c,0xef,0x5d,0x87,0xf3,0x0f,0xbd,0xdd,0xe0,0x1a,0x01,0x4b,0x09,0xfd,0xcd,
+  0x76,0xd0,0xed,0x26,0xb1,0x60,0xb7,0x7b,0x0d,0x9b,0xac,0x49,0x47,0x76,0x4d,0xe8,0xba,0x0d,0xff,0x02,
+  0x76,0x6a,0xd7,0xd0,0x3a,0xb9,0x9e,0x62,0x09,0x6e,0xd9,0xfd,0x2c,0x03,0xdf,0x02,0x1b,0xaf,0x95,0x41,
+  0xa2,0xd9,0x41,0x0b,0x50,0x7f,0x92,0xa9,0xd0,0xd0,0xf8,0x0e,0x3f,0x8e,0xfa,0xcf,0xec,0x1e,0x46,0xae,
+  0x2a,0x9e,0x41,0x8f,0xa9,0xa0,0x74,0xa0,0xac,0xf0,0xef,0x5b,0x16,0xdd,0xdf,0x50,0x5a,0x7b,0x10,0x35,
+  0xf5,0x5c,0xc6,0xcd,0x7b,0xb0,0xe7,0xac,0xce,0x0a,0x3c,0x82,0x06,0xaa,0xcd,0x0c,0x9f,0xc6,0x07,0x5d,
+  0x60,0x0a,0x4e,0xc4,0x8c,0x92,0x73,0xae,0x09,0x2e,0x2c,0x72,0x10,0x03,0x04,0x05,0x10,0xba,0x19,0x86,
+  0x36,0xd1,0xd0,0x50,0x22,0xd4,0xa1,0x00,0xb5,0x0d,0x20,0x58,0xe6,0x08,0xf9,0xb1,0x58,0xbd,0xad,0x67,
+  0x5f,0x80,0xc5,0xb1,0x76,0x01,0x90,0x19,0xfb,0x70,0x6b,0xff,0x5f,0xf0,0xd8,0x75,0x5a,0x00,0x82,0x3c,
+  0x27,0xb0,0x7c,0x73,0x7b,0x9d,0xc1,0x9a,0x14,0x60,0x3d,0xd0,0x0f,0x62,0xbf,0xbc,0xab,0xe7,0x26,0x71,
+  0xc2,0xc6,0x99,0x69,0x79,0x27,0x17,0xf4,0x63,0x12,0x59,0xe0,0xdb,0x08,0xad,0x0a,0x26,0xef,0x0d,0x99,
+  0x99,0x9c,0x05,0xd2,0x57,0x34,0x51,0xd0,0xe6,0xd5,0x2b,0xca,0xb7,0xe1,0x6f,0x49,0xf0,0x1b,0x9a,0xca,
+  0x68,0xbe,0x08,0x80,0x68,0x50,0x20,0x8d,0xd3,0x96,0xa9,0xb6,0x94,0xe3,0xbc,0x42,0xdb,0x3a,0x49,0xe1,
+  0xf1,0x57,0x80,0x07,0x33,0xbe,0xdb,0x81,0x8a,0xc9,0x81,0xe2,0xa6,0xb8,0x66,0xed,0x60,0xca,0x98,0x4d,
+  0x32,0x91,0xc0,0x79,0x37,0xb2,0x6b,0xef,0x14,0x25,0xa1,0x7f,0xf7,0x2f,0xd4,0x82,0x40,0xb5,0x08,0x50,
+  0x8b,0x00,0x3d,0xb1,0xf8,0xbf,0xa3,0xd0,0x78,0xdc,0x48,0x63,0x0f,0x0d,0x7b,0xcd,0xec,0xdb,0x5f,0x68,
+  0x88,0xa6,0x31,0x8d,0x18,0x1d,0xad,0x2e,0x2d,0xc0,0xb6,0x21,0x0f,0x24,0xf9,0x49,0xa3,0xeb,0xaf,0x59,
+  0xe4,0x26,0xfc,0xc0,0xd0,0x61,0x76,0x10,0xf1,0x0f,0x3a,0x6d,0xd1,0x92,0x46,0xf2,0x36,0xe6,0x04,0x4b,
+  0xf3,0x83,0xbb,0x27,0xe7,0xd6,0x3c,0xf5,0x61,0x16,0x44,0xe2,0x45,0x4b,0x5a,0xc1,0x79,0x25,0x06,0x7a,
+  0x63,0x8e,0x21,0x7c,0x90,0x5a,0xa9,0xca,0x26,0x85,0x16,0xcb,0x25,0x34,0xc1,0x00,0xbf,0x23,0x5b,0x48,
+  0x53,0x12,0x2c,0x50,0x80,0x5b,0xb0,0xf3,0xc0,0x0d,0x9b,0x63,0x0c,0x5c,0x69,0x5d,0x6f,0xec,0xf2,0xa0,
+  0xb1,0xaa,0x63,0x17,0xc2,0x47,0x3c,0xe0,0xc0,0x8a,0xb8,0xaf,0xdc,0x8e,0x29,0xee,0x0e,0x6b,0xe6,0xdb,
+  0x45,0x9b,0x90,0xb2,0x95,0xf5,0x03,0xe3,0x63,0x58,0xb7,0x68,0x8f,0x10,0xb8,0x83,0x7d,0xac,0x52,0x1f,
+  0x2b,0x4a,0x40,0x6a,0xc0,0x8c,0x39,0x3c,0x98,0xe5,0x95,0x7b,0x7a,0x8b,0xed,0xe6,0x68,0x47,0x0a,0x0d,
+  0x1b,0x45,0xf3,0x01,0x7c,0xc5,0x10,0x56,0x05,0x7b,0x1b,0xc0,0x62,0xe7,0xc0,0x76,0xb8,0x0b,0x6d,0x23,
+  0x2a,0x99,0x8a,0x48,0x00,0xc0,0x3a,0x44,0x4a,0x8c,0x85,0x4b,0x4a,0xc2,0xf3,0x8f,0x32,0x84,0xc0,0xf3,
+  0x17,0xd0,0x41,0x84,0xd2,0xeb,0xf5,0x0c,0x59,0x9a,0xea,0xdb,0xee,0x66,0x35,0x23,0xb0,0x45,0x85,0x07,
+  0x15,0x02,0xd4,0x23,0x78,0xfc,0xf3,0x4f,0xf8,0x85,0x03,0x3e,0x4d,0x92,0xc8,0x5d,0x00,0x47,0xc0,0xb6,
+  0x82,0xa1,0x07,0xb4,0x35,0x23,0xdb,0x38,0xe3,0x30,0xd4,0xdd,0x35,0xcd,0x9b,0x68,0xb4,0xe0,0x4f,0xab,
+  0x21,0x52,0x24,0x74,0xe4,0x21,0x61,0xf8,0x97,0x3b,0xa9,0x71,0xfe,0x80,0x22,0xfb,0xdf,0x3e,0xbe,0x1a,
+  0x0f,0x46,0x53,0x1e,0x6d,0x69,0x90,0x92,0xa2,0xce,0x65,0x06,0xe1,0x4e,0xc3,0x83,0xea,0x9a,0x82,0x46,
+  0x7c,0x15,0xac,0x9a,0x09,0x77,0x4d,0xd1,0xd6,0x11,0x51,0x18,0x83,0x0b,0x27,0x90,0x55,0x44,0x65,0x12,
+  0x4e,0x61,0x76,0x80,0xbc,0x18,0xfc,0x01,0x8a,0x80,0x45,0xa7,0x2e,0x5d,0x42,0x25,0xfc,0x6c,0xf5,0x5d,
+  0x10,0xce,0xd2,0x97,0x1f,0x28,0xed,0x25,0xe7,0x29,0x63,0x12,0x99,0xef,0x48,0x8c,0x28,0x3e,0x04,0xb2,
+  0x1e,0xcf,0x9a,0x02,0x8b,0x16,0x18,0x6b,0x7f,0x47,0xa3,0x1a,0x66,0xe4,0xc2,0x5e,0x41,0xcf,0x3c,0x00,
+  0xd6,0xf4,0x66,0x73,0x69,0x4a,0x02,0x12,0x62,0x62,0xd4,0xdd,0x8c,0x41,0xfb,0xb0,0x66,0x67,0xd8,0x35,
+  0xcc,0x7f,0x04,0xae,0xcf,0xfb,0x71,0x48,0x38,0x3c,0x0f,0x4c,0xbd,0x7d,0xf3,0xea,0xd5,0x6f,0xdf,0x3f,
+  0x7d,0x7b,0x33,0x7b,0x8f,0x1b,0x6c,0x9b,0x7e,0xf5,0xf1,0xd7,0x48,0xbe,0x76,0x3f,0x88,0x8d,0x30,0xbc,
+  0xfd,0x15,0x23,0x56,0x78,0x18,0xf1,0xc6,0x9f,0x75,0xdb,0x4a,0x94,0xa2,0x8d,0x51,0x08,0x6e,0xa8,0xe1,
+  0xc6,0x45,0xaf,0xdf,0x33,0x3f,0x17,0xc9,0xc2,0xb2,0xa7,0x3c,0xbe,0x81,0xe0,0x56,0x50,0x2d,0x9a,0x4d,
+  0x73,0xc1,0x0a,0x2c,0x2c,0x85,0x2a,0x5a,0xfa,0xb7,0x94,0xd4,0x03,0x45,0x32,0x4c,0x06,0x45,0x80,0x12,
+  0x14,0x20,0x62,0xf8,0x02,0x78,0xe1,0x1b,0xa1,0x67,0xa4,0x91,0x0d,0x5a,0xe3,0x7c,0x78,0xc3,0xd8,0xa7,
+  0xa8,0xb7,0x5a,0x42,0x21,0x03,0x87,0xa8,0x51,0x97,0x33,0xa1,0xa6,0x65,0x0c,0x24,0x0b,0x81,0x70,0x31,
+  0xe2,0xe0,0x64,0x28,0x44,0xbe,0x0a,0x19,0x03,0x0c,0xe5,0x9a,0xf0,0xb9,0xa2,0x16,0xc0,0xc2,0x6c,0x1d,
+  0xb8,0x08,0xc9,0xa9,0xa0,0x49,0x09,0xcf,0x37,0xec,0xf7,0x27,0xb2,0xc8,0x90,0x4c,0x2a,0x56,0x8c,0x36,
+  0x37,0x95,0x53,0x48,0xf7,0xcb,0x88,0xa1,0xec,0x2e,0x10,0x00,0x8a,0xa0,0x04,0x02,0x5d,0xc0,0xdf,0xc3,
+  0x65,0xa3,0xa2,0x69,0x2e,0x24,0xc4,0x3d,0x31,0x54,0xcc,0x59,0x0c,0x28,0x17,0xef,0xe1,0x01,0x9c,0x1b,
+  0xd1,0xae,0x18,0xea,0x79,0x38,0x13,0x7c,0xe0,0xd0,0x07,0x51,0x84,0xab,0x79,0xdd,0x9b,0x74,0x65,0x94,
+  0xec,0x06,0x8a,0x9b,0xbc,0x16,0x91,0xa5,0xff,0xf3,0x40,0xf8,0x38,0xf4,0x82,0x78,0xa7,0x3c,0xf4,0x88,
+  0xc7,0x89,0xbe,0xfd,0x16,0x79,0x64,0x26,0xb9,0xc4,0xc8,0x78,0x4c,0x71,0x06,0x04,0x57,0xb5,0x53,0x46,
+  0x7e,0x4f,0x96,0xe3,0x06,0x08,0x9d,0xae,0x67,0x56,0x29,0x96,0xa5,0xd3,0x33,0x3e,0x48,0x9c,0x8a,0x11,
+  0x2b,0x39,0xe1,0xa6,0xd4,0x92,0x6b,0xda,0x5c,0x81,0xc2,0x68,0x34,0x2d,0x83,0xe8,0xa5,0x05,0x33,0x88,
+  0x11,0x67,0x52,0xbe,0xb3,0xd8,0xa4,0x7f,0x1b,0x0a,0x4d,0x0b,0x7b,0x1b,0x5d,0x83,0x42,0xb3,0x29,0x4a,
+  0x39,0x3d,0x5b,0xb7,0xf2,0xba,0x8b,0xce,0xe5,0x60,0x21,0x1a,0x2d,0x0b,0x15,0x5f,0x7a,0x38,0x11,0x33,
+  0xaf,0xf9,0xf7,0x06,0x28,0x44,0xd3,0x0d,0x5b,0x8d,0xbf,0x37,0xda,0xfc,0x05,0xc1,0xe2,0xab,0x91,0x3f,
+  0xe9,0x8c,0x61,0x3b,0xcf,0xaa,0xc5,0x51,0x85,0x5a,0xef,0xf2,0x7a,0x84,0xa5,0x9e,0x2d,0x36,0xf8,0x84,
+  0xeb,0x15,0x19,0x86,0xca,0xd5,0x6d,0x7a,0x5d,0x45,0x1d,0x5a,0x54,0xa0,0x4c,0xbd,0x5b,0x81,0x67,0x95,
+  0xa5,0x2d,0x90,0x73,0x07,0xd8,0x13,0xf1,0x8a,0x48,0x53,0x08,0x7a,0xe2,0xa7,0x28,0x51,0x31,0x7c,0x4d,
+  0x0e,0xcd,0x03,0x13,0x58,0x1d,0x04,0x84,0x9c,0x7a,0x20,0xa2,0x89,0xcb,0xe4,0x86,0x6d,0x7f,0x63,0xec,
+  0x73,0xa0,0x69,0x73,0xbc,0x76,0x43,0x50,0x3e,0x40,0x73,0xfd,0x5b,0xfe,0x4f,0x85,0xb5,0x78,0x66,0xd6,
+  0x2f,0x3f,0xff,0xf8,0x3c,0xd8,0x84,0xb0,0x09,0xf9,0x49,0x13,0xba,0xaa,0x4c,0xcf,0xc3,0xbd,0xd3,0x8c,
+  0x00,0x53,0x12,0xac,0x74,0x40,0x7e,0x42,0x9b,0x1b,0xcc,0x11,0x87,0xb5,0xa0,0x11,0x0a,0x1e,0xf1,0x5e,
+  0x05,0xd3,0x1e,0xa2,0xb7,0x34,0xcd,0x2f,0x1f,0xe5,0xcc,0xed,0xc9,0xf2,0x9a,0x85,0x11,0x20,0x05,0x7b,
+  0x09,0x86,0x14,0x78,0x56,0x14,0x26,0x72,0xe2,0x06,0xc5,0xa2,0x09,0x00,0x07,0x71,0xf4,0x0d,0x75,0x60,
+  0xec,0x7d,0x7d,0x60,0x66,0x72,0x62,0x88,0x45,0x6e,0x60,0x25,0x3f,0x8a,0x4b,0x0c,0x08,0xc9,0x71,0x8f,
+  0x59,0xf1,0x53,0x10,0x31,0xfc,0x77,0xaa,0x84,0x03,0x9c,0x5f,0x56,0x96,0xb8,0x94,0xbf,0x75,0xbd,0xc3,
+  0xcd,0x82,0xe4,0xaf,0x0b,0xc2,0xd7,0xd3,0xf3,0xf8,0xa8,0xcb,0x98,0x33,0xc7,0x73,0xc4,0xa5,0x1a,0xee,
+  0x0b,0xe8,0xca,0x3a,0x15,0xb4,0x4d,0x7b,0x0c,0xa4,0x35,0xd2,0x08,0x5e,0xe6,0x12,0xcf,0xc8,0xa6,0x57,
+  0x76,0x3c,0x35,0x5d,0x6e,0x77,0x50,0x66,0xa4,0x2b,0x9e,0x3f,0x0f,0x81,0x0d,0x5d,0x05,0x9f,0x44,0x5b,
+  0x96,0x9b,0x49,0x2e,0xd7,0x6e,0x57,0x14,0x1f,0x96,0x60,0x6f,0x22,0xcc,0x4e,0xe5,0xba,0x0a,0x94,0x05,
+  0x23,0x16,0xf8,0x1d,0x33,0x5f,0xf8,0xa9,0x59,0x9e,0x4c,0x7a,0x4b,0x94,0xd6,0x93,0xa8,0xaf,0x90,0x68,
+  0x17,0x28,0x96,0x41,0xee,0x64,0xcb,0x77,0x7e,0x0d,0x3c,0x42,0x1c,0xd8,0x4d,0x36,0xcb,0x87,0x86,0xd2,
+  0x52,0xf4,0x69,0xbd,0xca,0x50,0x50,0x0e,0x37,0x68,0x54,0x9a,0x31,0x9f,0x1d,0x4a,0xc5,0xb8,0x6b,0x48,
+  0x97,0x69,0x55,0xcf,0x83,0x3c,0xa1,0x0e,0x5a,0xae,0xd0,0x47,0x7e,0x89,0x91,0x04,0x64,0x44,0x06,0x7a,
+  0xb1,0xa9,0xdf,0xad,0x19,0xf3,0xf4,0x36,0x43,0xfd,0xcf,0x4c,0xcc,0xd9,0x82,0xea,0x17,0x6c,0x69,0x6d,
+  0xbd,0xa4,0x29,0x0c,0x72,0x8a,0x9d,0x80,0x09,0xca,0xbc,0xc4,0xfa,0xdb,0x93,0xee,0x75,0x7f,0xd2,0xe9,
+  0xf3,0x9a,0x1d,0x8f,0x6b,0x6c,0xac,0x8f,0xcd,0x6e,0x3b,0xdd,0xa8,0xc0,0xca,0x6a,0x37,0xc5,0xe9,0x07,
+  0x19,0x3b,0x08,0xc0,0xe0,0xf6,0x9c,0x38,0xfc,0x6b,0xd3,0x42,0x65,0x67,0x24,0xc8,0x1b,0x29,0xfd,0x60,
+  0x4e,0xed,0x7d,0x88,0x31,0xbf,0x1d,0x9b,0x50,0xc3,0x07,0x81,0x09,0x3f,0x76,0x21,0x93,0x0c,0x1f,0xc1,
+  0x57,0x8e,0xa8,0xbb,0x6a,0x97,0xf1,0xd2,0xe6,0xbd,0xb1,0xe7,0xad,0xef,0xa7,0xb9,0xa6,0x19,0x5e,0xaa,
+  0x54,0xaf,0x5e,0x63,0x00,0xe2,0xbe,0xe2,0x70,0x27,0x35,0xa1,0x71,0xf8,0xfb,0x19,0xd5,0x75,0x44,0x2c,
+  0x05,0x60,0x02,0xb1,0x6b,0x69,0xa0,0x8e,0xdb,0x52,0x02,0x40,0xce,0xfd,0x79,0xdf,0x30,0xb8,0xcd,0xc4,
+  0x41,0x3c,0x9a,0x49,0xbc,0x30,0x0e,0x25,0xa9,0xc4,0xeb,0x24,0xa9,0xce,0x24,0xad,0x78,0x71,0x46,0x30,
+  0xfe,0x6e,0xf0,0x93,0x35,0xd4,0x2e,0xae,0xbf,0x0d,0xb6,0x31,0xa8,0xc1,0x28,0x48,0xc0,0x31,0x74,0x88,
+  0x35,0xb5,0xbb,0xb5,0xeb,0x31,0x4d,0x5e,0x57,0x3f,0xcb,0x79,0x10,0xab,0x97,0x80,0xd6,0x81,0xc9,0x67,
+  0x74,0xcf,0xeb,0x2b,0xc9,0x9e,0x12,0xf9,0x32,0x93,0xc2,0x28,0x55,0x6c,0xb7,0x09,0xd0,0x39,0x0f,0xee,
+  0x7c,0xce,0x7a,0x15,0x9c,0x27,0x96,0x91,0x81,0xe6,0xc4,0x4f,0xe4,0xfc,0x8d,0x8b,0xb3,0x88,0x6d,0xd5,
+  0x00,0xc4,0x28,0x12,0x01,0xe4,0xcb,0x99,0xf5,0x3d,0xda,0x73,0x1b,0xea,0x6d,0x24,0x42,0x8d,0x94,0xd0,
+  0x3f,0x1a,0x10,0x23,0x42,0xc7,0xf1,0xa5,0xb6,0x2c,0x7e,0xdf,0xfd,0xa0,0xa0,0x5e,0xc1,0xcf,0xb5,0xe3,
+  0xa4,0xb3,0xa8,0x1c,0x46,0xcc,0xec,0x8b,0x47,0x01,0x96,0x48,0xa7,0x4c,0x86,0x1f,0xd8,0x9d,0x3c,0xa5,
+  0x60,0xf6,0x5e,0x78,0x48,0x22,0x86,0xf7,0x1a,0xcc,0x74,0xcc,0xcc,0xa0,0x83,0x65,0xee,0x66,0x7d,0xff,
+  0xf2,0xe6,0xdd,0x2f,0x3f,0xbf,0x04,0x2f,0xeb,0x0c,0x7c,0x0f,0xd8,0x9f,0x6c,0xbd,0xad,0x69,0x1a,0xe5,
+  0xba,0xc0,0x9b,0xc8,0xb2,0x7f,0x68,0xf3,0xda,0x7e,0xae,0xb6,0xcf,0x6b,0xe3,0xb4,0x7a,0x90,0xab,0x1e,
+  0x14,0xab,0x87,0xb9,0xea,0x61,0xb1,0x7a,0x94,0xab,0x1e,0x15,0xab,0x7b,0x76,0x6b,0x0d,0x0d,0x44,0x35,
+  0x55,0x6a,0x2d,0x6d,0x1d,0x78,0x8e,0x82,0x9e,0xda,0xa4,0x6f,0x17,0xeb,0x07,0xb9,0xfa,0x41,0xa9,0x7e,
+  0x98,0xab,0x1f,0x96,0xea,0xe9,0x25,0xad,0xc7,0x37,0xad,0x79,0xd9,0xed,0x6e,0x62,0x23,0x6d,0xe2,0xad,
+  0xd5,0x49,0x78,0x81,0xbf,0xd2,0x78,0xbb,0x3e,0x6f,0xf4,0x41,0xd1,0x6f,0x98,0xab,0x26,0x56,0x0a,0x45,
+  0x56,0xc6,0xdf,0x14,0xa9,0x14,0xa9,0x21,0xf5,0xf6,0xa1,0x05,0xbc,0xa5,0xac,0xb7,0x35,0xe5,0x06,0xe3,
+  0x77,0xe4,0x83,0xc7,0x14,0xd4,0xc3,0xf7,0x74,0x94,0xe2,0x4e,0x8a,0x28,0x48,0xae,0xa8,0xc1,0x61,0x23,
+  0xaa,0xeb,0x91,0xd8,0x00,0x12,0x45,0x0e,0xdb,0x88,0x91,0x65,0xd2,0x50,0x79,0x68,0x3e,0x37,0x3a,0x5c,
+  0x02,0x87,0x88,0x9b,0x7f,0xd6,0x2c,0x9b,0x8c,0xb9,0x04,0x39,0x6f,0x7e,0x9c,0xcd,0x3f,0x9a,0xae,0x03,
+  0x6a,0x0c,0xda,0xc8,0x10,0xa5,0x75,0x6d,0xf1,0x7f,0x61,0x61,0xe2,0x3a,0xd3,0x12,0xc8,0x1f,0x5c,0x30,
+  0xfb,0x3e,0x03,0x22,0xde,0x47,0x45,0x17,0x40,0x46,0x20,0x9e,0x3f,0x7d,0xf7,0xdb,0xab,0xa7,0xcf,0x5e,
+  0xbe,0xba,0x99,0xed,0x31,0x62,0x83,0xf9,0xfa,0x13,0x4a,0x39,0xc6,0x27,0xbd,0xcd,0x8f,0xae,0x27,0xfa,
+  0xaf,0xfc,0x08,0xbb,0x8d,0x09,0xff,0x13,0xfd,0x9f,0xe1,0x37,0xc8,0xfc,0xef,0x13,0xfd,0xe5,0x7f,0xd3,
+  0xdb,0xc2,0x55,0x98,0xe8,0xc2,0x17,0xd0,0xdb,0x08,0x09,0x4f,0x94,0x27,0xfa,0x6b,0xf8,0x0d,0x2d,0x3c,
+  0xc6,0x42,0xa8,0xc7,0x3f,0x7a,0x2a,0x96,0x38,0xf6,0x9b,0x9f,0x5f,0xbc,0xfc,0x79,0xf6,0x5e,0x0f,0xd3,
+  0x11,0xe5,0x69,0x79,0x5b,0xbf,0xa5,0x51,0x74,0xf6,0x3b,0xfc,0x92,0x47,0x97,0x6d,0x5d,0xc2,0xc6,0x42,
+  0x82,0x27,0xc4,0x9f,0x3b,0x39,0x9c,0x29,0x30,0x2f,0x14,0xcf,0xd6,0x0a,0xee,0x53,0xca,0x31,0xc2,0x14,
+  0xb6,0x92,0x78,0xe6,0xb3,0x3b,0xed,0x86,0x25,0x4d,0x85,0x82,0xc0,0x0c,0xc8,0x73,0x16,0x3a,0x23,0x86,
+  0xd0,0x37,0xeb,0x82,0x2f,0xb9,0x76,0xc3,0x46,0xab,0x99,0x1b,0x73,0xc6,0x47,0xe5,0x2e,0x28,0x9e,0x85,
+  0x61,0xae,0x4c,0xc1,0xd3,0x4c,0x78,0x5b,0xf0,0x37,0xa1,0x29,0xf9,0x96,0xe0,0x3d,0xa7,0x0e,0x62,0x4a,
+  0x90,0xd4,0xd1,0xb5,0x85,0x73,0xfe,0x08,0x71,0x35,0xd7,0x56,0xdc,0xb4,0x8d,0x74,0x9b,0x2b,0x39,0xb8,
+  0x95,0x48,0xd9,0x27,0x22,0xd4,0x68,0xd9,0xc2,0xdd,0x6d,0xb4,0x32,0xae,0x78,0x6f,0x7f,0x90,0x7e,0xec,
+  0x31,0x0f,0x56,0x4d,0x0a,0xab,0x77,0x64,0xb3,0x21,0x6d,0x63,0x9f,0x43,0xd5,0x3e,0x2e,0xd7,0xc5,0x05,
+  0x55,0x14,0x4b,0x16,0x2b,0xe0,0x21,0xbc,0x38,0x99,0x55,0xae,0x4e,0xb6,0xce,0x93,0x9c,0xd0,0x10,0x4a,
+  0x72,0xd5,0xa1,0xb5,0xda,0x19,0x79,0x40,0x0d,0x3f,0x58,0x32,0xfc,0x10,0xce,0xb8,0x44,0x5d,0x37,0x72,
+  0x39,0x9f,0xe8,0x46,0xe8,0x98,0xda,0x6f,0x33,0xd4,0x8b,0xc8,0x8f,0x8d,0x16,0x6f,0x99,0x23,0x3f,0x6d,
+  0x96,0x66,0x9c,0x04,0xe1,0xdb,0x28,0x08,0xad,0x15,0x9d,0x37,0x34,0xe9,0x42,0x4f,0x6a,0x71,0xd4,0xb7,
+  0xc2,0x73,0x84,0x46,0x99,0x0b,0x94,0xcf,0xce,0xe8,0xdc,0x7e,0xc2,0x33,0x15,0xbc,0x0c,0xb1,0x65,0x50,
+  0x80,0x87,0x64,0x98,0x35,0x87,0x08,0xb9,0x0e,0x47,0x07,0x5b,0x91,0xb9,0x30,0xd3,0x53,0x23,0xb0,0x49,
+  0xc3,0x52,0x2c,0x84,0x37,0x44,0xd6,0x10,0x6d,0x81,0xf6,0xbc,0x25,0xda,0x61,0xd4,0xce,0x50,0x93,0x3d,
+  0xa3,0x7b,0x4e,0x56,0x01,0x02,0xfd,0xdb,0x02,0x9c,0x79,0xe3,0xac,0x95,0x3f,0xd4,0xb0,0x44,0xe2,0x29,
+  0xb6,0xa2,0x47,0xe4,0x3a,0x71,0xf0,0x1b,0x96,0x1a,0xc3,0x12,0x61,0xd3,0xa6,0xc2,0xa7,0xb4,0x6e,0x1f,
+  0xfe,0xfc,0x93,0x4b,0x6d,0xd6,0xbb,0xd8,0x17,0xb0,0x4b,0x2f,0x12,0xbc,0x83,0xe7,0xf9,0x7f,0xfd,0xfb,
+  0xff,0x50,0xdb,0x9e,0xc4,0xea,0x6a,0x36,0x63,0x3d,0xab,0xab,0x84,0x68,0x33,0xaf,0xed,0x8a,0x6c,0x2c,
+  0xb6,0x33,0xb9,0x11,0x0c,0x7f,0x56,0x3f,0xf1,0xe8,0x95,0xfe,0xe3,0x4f,0x6f,0x7f,0x79,0xa7,0xa7,0xb2,
+  0x0d,0x6d,0x4a,0x2b,0x2e,0x4e,0xbc,0x7d,0x8a,0x67,0x17,0x4f,0x06,0x90,0xfd,0xe4,0x91,0x44,0x38,0x83,
+  0xd7,0x6b,0xf8,0x9f,0x1f,0x10,0x53,0xc8,0xa7,0xbc,0xe3,0x5e,0x23,0x1b,0xb4,0xf0,0x84,0xf4,0xdb,0xb0,
+  0x3a,0xac,0x10,0x1a,0x47,0x9d,0xcc,0x72,0x8c,0x2a,0xdb,0x0c,0x55,0xa1,0x94,0x26,0x58,0x2a,0x43,0x2b,
+  0x29,0x43,0x9b,0x59,0x61,0x5b,0x7d,0xbf,0x02,0x3e,0x81,0x95,0x44,0xfb,0x8d,0x66,0x03,0xdc,0x18,0xcf,
+  0x56,0x9c,0x2d,0x64,0x14,0x5e,0x6b,0xca,0xc9,0x6e,0x2c,0x97,0x6f,0xb0,0x33,0x6a,0xf8,0x3e,0x0d,0x98,
+  0x6f,0x17,0x6a,0x71,0xef,0xc3,0xb5,0x7c,0x30,0x23,0x46,0xb2,0x09,0x20,0x60,0x13,0xd1,0x8d,0xca,0x68,
+  0xa1,0x7a,0x22,0x3c,0xaf,0x10,0xb3,0x15,0xbf,0xea,0xd8,0x68,0xa5,0xe3,0xb7,0x9a,0x72,0x48,0x3c,0x01,
+  0xc4,0x8f,0xfa,0x60,0x20,0x50,0x14,0x11,0x43,0xf2,0x32,0xae,0x85,0x53,0x46,0xab,0x1b,0x18,0x4f,0xa8,
+  0x85,0xbc,0xae,0xb8,0xc0,0xae,0x72,0x02,0x8b,0x71,0x28,0x2e,0x85,0x6f,0xe0,0x49,0x11,0x43,0x2c,0x02,
+  0x27,0x7e,0xc7,0x78,0xed,0x2b,0x7c,0xcc,0x55,0x07,0x21,0xd6,0x04,0xa1,0x22,0xe2,0x2b,0x45,0x34,0xc9,
+  0xd1,0xdb,0x98,0x32,0xf6,0xc0,0xb7,0x4a,0x0f,0xc5,0x4e,0xa6,0xb5,0xb4,0xa0,0xda,0xe1,0x36,0x3e,0x6c,
+  0x2e,0xf0,0x24,0xd2,0x42,0x69,0xb5,0xdc,0x99,0x62,0xa1,0xa4,0x60,0x30,0x35,0xb0,0xac,0x22,0x45,0xae,
+  0x7b,0x03,0x01,0xc2,0xea,0x58,0x1b,0x7e,0xd2,0xd6,0x28,0x2b,0xcf,0x0a,0x90,0x42,0x95,0x8a,0x9b,0x8f,
+  0xc0,0x9e,0xc0,0x40,0x4d,0x75,0x32,0x34,0x33,0xd9,0x9c,0x0a,0x72,0xe9,0xf3,0x8d,0xca,0x75,0x87,0x6d,
+  0xd0,0x8b,0x01,0xf4,0x5c,0x0e,0xca,0x8d,0xb7,0x6c,0xd4,0xd0,0x2d,0xaa,0x94,0x8f,0xea,0x7d,0x25,0x0c,
+  0x9f,0x14,0x11,0xc9,0xae,0x2e,0xfd,0xcc,0xf0,0x1f,0x39,0x4b,0x02,0x4d,0x90,0x4f,0x9f,0xff,0xcf,0xff,
+  0x9e,0x4b,0xbc,0xce,0xce,0xe1,0xd6,0xc5,0x73,0xdf,0xec,0x83,0x22,0xfa,0x1c,0x97,0x4f,0x58,0x82,0xda,
+  0x9a,0x45,0x2c,0x3b,0x09,0x7e,0xe0,0x1d,0x73,0xdc,0xb5,0xd8,0x26,0x49,0x96,0x3e,0x8e,0x67,0xea,0xaa,
+  0xba,0x86,0x57,0x21,0xb3,0x05,0xa4,0xe7,0xef,0xa0,0xf8,0xc9,0x39,0xef,0x9d,0x02,0x3b,0x49,0x41,0xaa,
+  0xa9,0xee,0x07,0x14,0xa4,0x32,0xf4,0x8a,0xb4,0xa3,0xaa,0xa5,0x04,0x8c,0xeb,0x55,0xb5,0x72,0xc2,0x0e,
+  0xa7,0xa8,0x27,0xd2,0x05,0x6a,0xb6,0x22,0x8f,0xba,0xb5,0xa9,0xac,0x26,0x34,0xc6,0xaf,0x8e,0x1c,0x0c,
+  0x1a,0x8a,0x5c,0xc5,0x7c,0xc8,0x50,0x24,0xed,0xed,0x26,0x18,0x20,0xca,0x8d,0xc9,0xa3,0x87,0x98,0xe9,
+  0x93,0x0e,0x9b,0x0f,0xb5,0x29,0xe5,0xa2,0x6f,0x75,0xb8,0x2d,0x47,0x22,0x4c,0x66,0xac,0x08,0x31,0x96,
+  0x67,0x9b,0x8b,0x31,0x62,0x8a,0x56,0x31,0xb6,0x2e,0x2f,0x98,0x1c,0x9e,0xb3,0xcc,0x76,0xfc,0xbf,0x3b,
+  0x6b,0x9e,0x08,0xf9,0x05,0xf3,0x26,0x0b,0x31,0xd8,0x52,0xf2,0x0a,0x2b,0xc5,0x8d,0xd5,0xcb,0x2a,0xa0,
+  0xfd,0xd2,0x76,0x8f,0xd2,0xc7,0x03,0x8c,0x2f,0xae,0xbe,0x18,0x15,0x79,0xc5,0x81,0x8f,0x97,0x0c,0x04,
+  0x88,0x42,0x24,0x5d,0x5e,0xb4,0xe2,0x81,0xf4,0xb4,0x15,0x1e,0xe8,0x95,0x36,0x59,0xba,0xf3,0x45,0xb7,
+  0xb7,0x4a,0x67,0x36,0x58,0x58,0xef,0xc2,0x3a,0x72,0xcb,0x3d,0x25,0x51,0x77,0x4a,0x39,0xb8,0xe5,0x24,
+  0xdb,0x4f,0x12,0x88,0xaf,0x94,0x82,0x4b,0xb8,0x54,0x26,0xcf,0x7e,0x22,0xab,0x9e,0x90,0x5c,0xab,0xac,
+  0xf7,0x23,0x3c,0xd7,0xe5,0xeb,0xf2,0x75,0x56,0xbc,0x2a,0x63,0x5f,0xc6,0x89,0x91,0x67,0x7f,0x74,0x8a,
+  0xaa,0x48,0x31,0xc7,0xc9,0x7c,0x54,0x5a,0xba,0xce,0x94,0x99,0x68,0x1e,0xbc,0xa3,0x6f,0x1b,0xb0,0xc8,
+  0x64,0xcb,0x25,0x58,0x83,0xe0,0x50,0x06,0x77,0xcc,0xc1,0x9b,0x33,0xe1,0xbd,0x0e,0x6d,0x84,0xad,0x59,
+  0x48,0x77,0x94,0x90,0xf4,0xfc,0x99,0x97,0x34,0xea,0x8d,0x7d,0x45,0x47,0x99,0xf8,0xa6,0xf4,0xad,0x4e,
+  0xcd,0xc3,0x44,0x83,0x7c,0x76,0x1e,0xe6,0x4c,0x64,0x87,0xb7,0x71,0x25,0x50,0xf1,0xa1,0x39,0xdd,0x28,
+  0xa1,0xc4,0x2d,0x1c,0xa3,0x2a,0xc2,0xc8,0x4c,0xf1,0x2f,0xa8,0xbc,0xab,0x99,0x66,0x0a,0xb5,0x08,0x54,
+  0x18,0x46,0x08,0xb5,0x0e,0x44,0x05,0x6e,0x79,0x28,0x68,0x44,0xb5,0xf9,0xd6,0x55,0x75,0x1c,0xf1,0x69,
+  0x90,0xc9,0xd1,0xcf,0x56,0x38,0xf5,0x05,0x84,0x69,0x03,0xc3,0xb4,0xb3,0xda,0xb6,0xae,0x97,0x74,0xb8,
+  0x6c,0x65,0xc1,0xff,0x61,0xf9,0x40,0x6a,0x63,0x85,0xb4,0x99,0xae,0xc8,0xe6,0xb7,0xe0,0xc9,0x3a,0x68,
+  0xfd,0x93,0x31,0xa6,0x28,0xd8,0x7c,0x1c,0xad,0x70,0x5a,0x25,0xed,0x9e,0xf2,0x3e,0x5e,0x31,0xb2,0xb4,
+  0x7e,0x0e,0x03,0xcf,0x85,0x0e,0x79,0x4b,0xb5,0x15,0x5d,0x08,0x52,0x95,0xa1,0xba,0x85,0xa3,0xcc,0x60,
+  0xf6,0x01,0x34,0x14,0x27,0x05,0xc5,0xfc,0x86,0xec,0xa8,0x24,0xbb,0xf8,0x25,0x92,0x6c,0xa6,0x32,0xc9,
+  0x66,0x5a,0xba,0x0a,0x14,0x6e,0xe9,0x73,0x8c,0x94,0xe3,0xa3,0xd9,0x56,0x14,0xdd,0x6b,0x7e,0x00,0xb4,
+  0xff,0x9d,0x6e,0x03,0x01,0x3e,0x38,0x71,0xba,0x30,0xc4,0x23,0xf8,0x67,0x59,0xda,0x44,0x77,0x2a,0x52,
+  0x29,0x5a,0x2d,0x0e,0xcb,0xe2,0x21,0x48,0x40,0x16,0xef,0x78,0xc0,0x5e,0xa7,0x2d,0xa3,0x60,0xa3,0xf1,
+  0x7f,0x78,0x4e,0x23,0xf7,0x4f,0xce,0x40,0x03,0xd7,0x2a,0xd6,0xdc,0x24,0xc6,0xef,0x48,0xb8,0xfe,0x59,
+  0x9a,0xcd,0x93,0x67,0x01,0xb5,0xcb,0x5e,0x9d,0x73,0x7e,0xd7,0xcd,0x8a,0xa7,0xf9,0xcc,0x21,0x95,0xb9,
+  0xed,0x00,0xac,0x36,0x3b,0xa1,0x60,0x7c,0x2c,0x68,0xf8,0x48,0x1c,0x4b,0x50,0x21,0x50,0x3d,0xb2,0x19,
+  0x6a,0x65,0x95,0xd6,0x59,0x42,0x0f,0xa5,0x6e,0xf1,0x00,0x9b,0xd2,0x5e,0x30,0x05,0x49,0x0a,0xdd,0xf5,
+  0x60,0x71,0x45,0xcc,0x9f,0x67,0xf4,0xd0,0xb1,0x02,0x4f,0xf2,0xf9,0xa7,0x9b,0x37,0x3f,0xa1,0x8b,0x10,
+  0xe3,0x69,0x02,0x6a,0x3d,0x3a,0x91,0xaa,0xec,0x0b,0xeb,0x89,0x91,0x1e,0x3a,0x92,0xc8,0xee,0xf7,0x4d,
+  0x45,0x46,0x0f,0xef,0x2d,0xd2,0x7a,0x1e,0x0e,0xc0,0x90,0x83,0x8b,0x94,0x1f,0x39,0x6a,0x1d,0xc2,0x32,
+  0x5d,0xa2,0x8d,0xcc,0xfc,0x15,0x13,0x29,0x6a,0x07,0xc4,0x94,0x0a,0x44,0x51,0xc9,0x0c,0xa9,0x25,0x52,
+  0xe0,0xe3,0xe5,0xef,0x99,0xc2,0x1f,0xa2,0x98,0x45,0x51,0x10,0xcd,0xb8,0x89,0x55,0x58,0x47,0x8a,0x54,
+  0xc4,0xa0,0xa8,0x2c,0xe7,0x9e,0x6f,0x88,0xb3,0x99,0xb2,0x8e,0xe6,0xf3,0x57,0x6f,0x6e,0x5e,0xbe,0x30,
+  0x14,0x4b,0x2d,0xc7,0x31,0xed,0x41,0x97,0x92,0x20,0xce,0x1e,0x44,0xba,0x9b,0xca,0x4c,0x53,0xbc,0xfb,
+  0xc9,0xaf,0x68,0x82,0x7f,0x81,0x9f,0x7f,0x7a,0x72,0xbe,0x4e,0x36,0xde,0xfc,0xec,0x7f,0x01,0x73,0xa8,
+  0x2c,0x15,0x21,0x8e,0x00,0x00,
+};